@@ -7,73 +7,139 @@ C_SRCS += \
 ../source/accelerometer.c \
 ../source/adc.c \
 ../source/adc_calibrate.c \
+../source/adpcm.c \
+../source/adpcm_clips.c \
 ../source/autocorrelate.c \
+../source/benchmark.c \
 ../source/commandhandler.c \
 ../source/commandprocessor.c \
 ../source/dac.c \
+../source/dds.c \
 ../source/dma.c \
+../source/effects.c \
+../source/envelope.c \
+../source/health.c \
 ../source/i2c.c \
+../source/i2c_engine.c \
 ../source/led.c \
 ../source/main.c \
+../source/midi.c \
+../source/midi_uart.c \
+../source/mixer.c \
+../source/mma_fifo.c \
 ../source/mtb.c \
 ../source/musical_tones.c \
+../source/pcm_stream.c \
+../source/pcm_uart.c \
+../source/power.c \
 ../source/queue.c \
 ../source/semihost_hardfault.c \
+../source/sequencer.c \
 ../source/sysclock.c \
 ../source/systick.c \
 ../source/test_queue.c \
 ../source/test_sine.c \
+../source/theremin.c \
+../source/tilt.c \
+../source/tone_cache.c \
 ../source/tone_to_sample.c \
 ../source/tpm.c \
-../source/uart.c 
+../source/tunes.c \
+../source/uart.c \
+../source/wavetable.c \
+../source/wavetable_data.c 
 
 C_DEPS += \
 ./source/accelerometer.d \
 ./source/adc.d \
 ./source/adc_calibrate.d \
+./source/adpcm.d \
+./source/adpcm_clips.d \
 ./source/autocorrelate.d \
+./source/benchmark.d \
 ./source/commandhandler.d \
 ./source/commandprocessor.d \
 ./source/dac.d \
+./source/dds.d \
 ./source/dma.d \
+./source/effects.d \
+./source/envelope.d \
+./source/health.d \
 ./source/i2c.d \
+./source/i2c_engine.d \
 ./source/led.d \
 ./source/main.d \
+./source/midi.d \
+./source/midi_uart.d \
+./source/mixer.d \
+./source/mma_fifo.d \
 ./source/mtb.d \
 ./source/musical_tones.d \
+./source/pcm_stream.d \
+./source/pcm_uart.d \
+./source/power.d \
 ./source/queue.d \
 ./source/semihost_hardfault.d \
+./source/sequencer.d \
 ./source/sysclock.d \
 ./source/systick.d \
 ./source/test_queue.d \
 ./source/test_sine.d \
+./source/theremin.d \
+./source/tilt.d \
+./source/tone_cache.d \
 ./source/tone_to_sample.d \
 ./source/tpm.d \
-./source/uart.d 
+./source/tunes.d \
+./source/uart.d \
+./source/wavetable.d \
+./source/wavetable_data.d 
 
 OBJS += \
 ./source/accelerometer.o \
 ./source/adc.o \
 ./source/adc_calibrate.o \
+./source/adpcm.o \
+./source/adpcm_clips.o \
 ./source/autocorrelate.o \
+./source/benchmark.o \
 ./source/commandhandler.o \
 ./source/commandprocessor.o \
 ./source/dac.o \
+./source/dds.o \
 ./source/dma.o \
+./source/effects.o \
+./source/envelope.o \
+./source/health.o \
 ./source/i2c.o \
+./source/i2c_engine.o \
 ./source/led.o \
 ./source/main.o \
+./source/midi.o \
+./source/midi_uart.o \
+./source/mixer.o \
+./source/mma_fifo.o \
 ./source/mtb.o \
 ./source/musical_tones.o \
+./source/pcm_stream.o \
+./source/pcm_uart.o \
+./source/power.o \
 ./source/queue.o \
 ./source/semihost_hardfault.o \
+./source/sequencer.o \
 ./source/sysclock.o \
 ./source/systick.o \
 ./source/test_queue.o \
 ./source/test_sine.o \
+./source/theremin.o \
+./source/tilt.o \
+./source/tone_cache.o \
 ./source/tone_to_sample.o \
 ./source/tpm.o \
-./source/uart.o 
+./source/tunes.o \
+./source/uart.o \
+./source/wavetable.o \
+./source/wavetable_data.o 
 
 
 # Each subdirectory must supply rules for building sources it contributes
@@ -88,7 +154,7 @@ source/%.o: ../source/%.c source/subdir.mk
 clean: clean-source
 
 clean-source:
-	-$(RM) ./source/accelerometer.d ./source/accelerometer.o ./source/adc.d ./source/adc.o ./source/adc_calibrate.d ./source/adc_calibrate.o ./source/autocorrelate.d ./source/autocorrelate.o ./source/commandhandler.d ./source/commandhandler.o ./source/commandprocessor.d ./source/commandprocessor.o ./source/dac.d ./source/dac.o ./source/dma.d ./source/dma.o ./source/i2c.d ./source/i2c.o ./source/led.d ./source/led.o ./source/main.d ./source/main.o ./source/mtb.d ./source/mtb.o ./source/musical_tones.d ./source/musical_tones.o ./source/queue.d ./source/queue.o ./source/semihost_hardfault.d ./source/semihost_hardfault.o ./source/sysclock.d ./source/sysclock.o ./source/systick.d ./source/systick.o ./source/test_queue.d ./source/test_queue.o ./source/test_sine.d ./source/test_sine.o ./source/tone_to_sample.d ./source/tone_to_sample.o ./source/tpm.d ./source/tpm.o ./source/uart.d ./source/uart.o
+	-$(RM) ./source/accelerometer.d ./source/accelerometer.o ./source/adc.d ./source/adc.o ./source/adc_calibrate.d ./source/adc_calibrate.o ./source/adpcm.d ./source/adpcm.o ./source/adpcm_clips.d ./source/adpcm_clips.o ./source/autocorrelate.d ./source/autocorrelate.o ./source/benchmark.d ./source/benchmark.o ./source/commandhandler.d ./source/commandhandler.o ./source/commandprocessor.d ./source/commandprocessor.o ./source/dac.d ./source/dac.o ./source/dds.d ./source/dds.o ./source/dma.d ./source/dma.o ./source/effects.d ./source/effects.o ./source/envelope.d ./source/envelope.o ./source/health.d ./source/health.o ./source/i2c.d ./source/i2c.o ./source/i2c_engine.d ./source/i2c_engine.o ./source/led.d ./source/led.o ./source/main.d ./source/main.o ./source/midi.d ./source/midi.o ./source/midi_uart.d ./source/midi_uart.o ./source/mixer.d ./source/mixer.o ./source/mma_fifo.d ./source/mma_fifo.o ./source/mtb.d ./source/mtb.o ./source/musical_tones.d ./source/musical_tones.o ./source/pcm_stream.d ./source/pcm_stream.o ./source/pcm_uart.d ./source/pcm_uart.o ./source/power.d ./source/power.o ./source/queue.d ./source/queue.o ./source/semihost_hardfault.d ./source/semihost_hardfault.o ./source/sequencer.d ./source/sequencer.o ./source/sysclock.d ./source/sysclock.o ./source/systick.d ./source/systick.o ./source/test_queue.d ./source/test_queue.o ./source/test_sine.d ./source/test_sine.o ./source/theremin.d ./source/theremin.o ./source/tilt.d ./source/tilt.o ./source/tone_cache.d ./source/tone_cache.o ./source/tone_to_sample.d ./source/tone_to_sample.o ./source/tpm.d ./source/tpm.o ./source/tunes.d ./source/tunes.o ./source/uart.d ./source/uart.o ./source/wavetable.d ./source/wavetable.o ./source/wavetable_data.d ./source/wavetable_data.o
 
 .PHONY: clean-source
 
@@ -0,0 +1,189 @@
+/*
+ * @file        adpcm_encode.c
+ * @brief       IMA-ADPCM encoder implementation for the host tools
+ *
+ * Each code is chosen by the IMA reference's successive approximation of the difference from
+ * the decoder's last sample, then fed through adpcm_decode() so the encoder's prediction never
+ * drifts from the board's.
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       gcc
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "adpcm_encode.h"
+
+#define WAV_HEADER_BYTES   (12)
+#define CHUNK_HEADER_BYTES (8)
+#define START_SAMPLES      (64)  //Samples the start step size is chosen over
+#define SIGN_BIT           (8)
+
+/*
+ * @name   encode_sample
+ * @brief  Picks the code for a sample and advances the decoder with it
+ *
+ * @param  adpcm_state_t *state, int32_t sample
+ * @return uint8_t code
+ */
+static uint8_t encode_sample(adpcm_state_t *state, int32_t sample)
+{
+	int32_t step = adpcm_step_table[state->index];
+	int32_t diff = sample - state->predictor;
+	uint8_t code = 0;
+
+	if(diff < 0)
+	{
+		code = SIGN_BIT;
+		diff = -diff;
+	}
+	for(uint8_t bit = 4; bit; bit >>= 1, step >>= 1)
+	{
+		if(diff >= step)
+		{
+			code |= bit;
+			diff -= step;
+		}
+	}
+	adpcm_decode(state, code);
+	return code;
+}
+
+/*
+ * @name   adpcm_encode
+ * @brief  Encodes a clip, two codes per byte with the earlier in the low nibble
+ *
+ * The start step size is the one that tracks the first samples best, so a clip starting loud
+ * does not open with the quantiser ramping up
+ *
+ * @param  const int16_t *pcm, uint32_t samples, uint32_t loop_start,
+ *         adpcm_state_t *start (out), adpcm_state_t *loop (out, state before loop_start),
+ *         int16_t *decoded (out, the samples the decoder plays, or NULL)
+ * @return uint8_t * codes, malloc'd, (samples + 1) / 2 bytes, or NULL
+ */
+uint8_t *adpcm_encode(const int16_t *pcm, uint32_t samples, uint32_t loop_start, adpcm_state_t *start,
+		adpcm_state_t *loop, int16_t *decoded)
+{
+	uint8_t *codes = calloc((samples + 1) / 2 + 1, 1);
+	double best = -1;
+	adpcm_state_t state;
+
+	if(codes == NULL)
+		return NULL;
+	for(uint8_t index = 0; index < ADPCM_STEPS; index++)
+	{
+		adpcm_state_t trial = { 0, index };
+		double error = 0;
+
+		for(uint32_t i = 0; i < samples && i < START_SAMPLES; i++)
+		{
+			encode_sample(&trial, pcm[i]);
+			error += (double)(trial.predictor - pcm[i]) * (trial.predictor - pcm[i]);
+		}
+		if(best < 0 || error < best)
+		{
+			best = error;
+			start->predictor = 0;
+			start->index = index;
+		}
+	}
+
+	state = *start;
+	*loop = *start;
+	for(uint32_t i = 0; i < samples; i++)
+	{
+		if(i == loop_start)
+			*loop = state;
+		codes[i >> 1] |= encode_sample(&state, pcm[i]) << ((i & 1) ? 4 : 0);
+		if(decoded != NULL)
+			decoded[i] = state.predictor;
+	}
+	return codes;
+}
+
+/*
+ * @name   wav_read
+ * @brief  Reads the samples of a 16-bit mono PCM WAV file
+ *
+ * @param  const char *path, uint32_t *rate, uint32_t *samples
+ * @return int16_t * samples, malloc'd, or NULL
+ */
+int16_t *wav_read(const char *path, uint32_t *rate, uint32_t *samples)
+{
+	FILE *f = fopen(path, "rb");
+	uint8_t header[WAV_HEADER_BYTES], chunk[CHUNK_HEADER_BYTES], fmt[16];
+	int16_t *pcm = NULL;
+	int have_fmt = 0;
+
+	if(f == NULL)
+		return NULL;
+	if(fread(header, 1, sizeof(header), f) != sizeof(header) || memcmp(header, "RIFF", 4) ||
+			memcmp(header + 8, "WAVE", 4))
+	{
+		fclose(f);
+		return NULL;
+	}
+	while(pcm == NULL && fread(chunk, 1, sizeof(chunk), f) == sizeof(chunk))
+	{
+		uint32_t size = chunk[4] | chunk[5] << 8 | chunk[6] << 16 | (uint32_t)chunk[7] << 24;
+
+		if(memcmp(chunk, "fmt ", 4) == 0 && size >= sizeof(fmt))
+		{
+			if(fread(fmt, 1, sizeof(fmt), f) != sizeof(fmt))
+				break;
+			fseek(f, size - sizeof(fmt) + (size & 1), SEEK_CUR);
+			//PCM format, one channel, 16 bits
+			if(fmt[0] != 1 || fmt[1] != 0 || fmt[2] != 1 || fmt[3] != 0 || fmt[14] != 16)
+				break;
+			*rate = fmt[4] | fmt[5] << 8 | fmt[6] << 16 | (uint32_t)fmt[7] << 24;
+			have_fmt = 1;
+		}
+		else if(memcmp(chunk, "data", 4) == 0 && have_fmt)
+		{
+			*samples = size / sizeof(int16_t);
+			pcm = malloc(size ? size : 1);
+			if(pcm != NULL && fread(pcm, sizeof(int16_t), *samples, f) != *samples)
+			{
+				free(pcm);
+				pcm = NULL;
+			}
+			break;
+		}
+		else
+			fseek(f, size + (size & 1), SEEK_CUR);
+	}
+	fclose(f);
+	return pcm;
+}
+
+/*
+ * @name   wav_write
+ * @brief  Writes 16-bit mono PCM samples as a WAV file
+ *
+ * @param  const char *path, const int16_t *pcm, uint32_t samples, uint32_t rate
+ * @return int 1 on success
+ */
+int wav_write(const char *path, const int16_t *pcm, uint32_t samples, uint32_t rate)
+{
+	FILE *f = fopen(path, "wb");
+	uint32_t data_bytes = samples * 2, riff_bytes = 36 + data_bytes, fmt_bytes = 16, byte_rate = rate * 2;
+	uint16_t format = 1, channels = 1, block_align = 2, bits = 16;
+
+	if(f == NULL)
+		return 0;
+	fwrite("RIFF", 1, 4, f);
+	fwrite(&riff_bytes, 4, 1, f);
+	fwrite("WAVEfmt ", 1, 8, f);
+	fwrite(&fmt_bytes, 4, 1, f);
+	fwrite(&format, 2, 1, f);
+	fwrite(&channels, 2, 1, f);
+	fwrite(&rate, 4, 1, f);
+	fwrite(&byte_rate, 4, 1, f);
+	fwrite(&block_align, 2, 1, f);
+	fwrite(&bits, 2, 1, f);
+	fwrite("data", 1, 4, f);
+	fwrite(&data_bytes, 4, 1, f);
+	fwrite(pcm, 2, samples, f);
+	return fclose(f) == 0;
+}
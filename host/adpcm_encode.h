@@ -0,0 +1,52 @@
+/*
+ * @file        adpcm_encode.h
+ * @brief       IMA-ADPCM encoder declarations for the host tools
+ *
+ * Encodes 16-bit PCM into the 4-bit codes source/adpcm.c decodes, tracking the decoder with
+ * adpcm_decode() itself so the encoder's reconstruction is exactly what the board plays.
+ * Reads and writes 16-bit mono WAV files.
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       gcc
+ */
+
+#ifndef ADPCM_ENCODE_H_
+#define ADPCM_ENCODE_H_
+
+#include <stdint.h>
+#include "adpcm.h"
+
+/*
+ * @name   adpcm_encode
+ * @brief  Encodes a clip, two codes per byte with the earlier in the low nibble
+ *
+ * The start step size is the one that tracks the first samples best, so a clip starting loud
+ * does not open with the quantiser ramping up
+ *
+ * @param  const int16_t *pcm, uint32_t samples, uint32_t loop_start,
+ *         adpcm_state_t *start (out), adpcm_state_t *loop (out, state before loop_start),
+ *         int16_t *decoded (out, the samples the decoder plays, or NULL)
+ * @return uint8_t * codes, malloc'd, (samples + 1) / 2 bytes, or NULL
+ */
+uint8_t *adpcm_encode(const int16_t *pcm, uint32_t samples, uint32_t loop_start, adpcm_state_t *start,
+		adpcm_state_t *loop, int16_t *decoded);
+
+/*
+ * @name   wav_read
+ * @brief  Reads the samples of a 16-bit mono PCM WAV file
+ *
+ * @param  const char *path, uint32_t *rate, uint32_t *samples
+ * @return int16_t * samples, malloc'd, or NULL
+ */
+int16_t *wav_read(const char *path, uint32_t *rate, uint32_t *samples);
+
+/*
+ * @name   wav_write
+ * @brief  Writes 16-bit mono PCM samples as a WAV file
+ *
+ * @param  const char *path, const int16_t *pcm, uint32_t samples, uint32_t rate
+ * @return int 1 on success
+ */
+int wav_write(const char *path, const int16_t *pcm, uint32_t samples, uint32_t rate);
+
+#endif /* ADPCM_ENCODE_H_ */
@@ -0,0 +1,404 @@
+/*
+ * @file        bench_adpcm.c
+ * @brief       Host test and benchmark of IMA-ADPCM sample playback
+ *
+ * Checks the encoder's round trip signal to noise ratio, that a voice plays exactly what the
+ * encoder reconstructed, that the clip bank's loop states match its codes, that a held loop
+ * repeats exactly without a click at the seam, that a clip keeps its pitch and length at 8 and
+ * 48 kHz and across a rate switch, and that a released voice plays out and frees itself.
+ * Times a sample voice against an oscillator voice in the mixer and prints the flash the clip
+ * bank takes against 16-bit PCM.
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       gcc
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "adpcm.h"
+#include "adpcm_encode.h"
+#include "mixer.h"
+#include "tpm.h"
+#include "check.h"
+
+#define BLOCK          (MIXER_BLOCK_SIZE)
+#define UNITY          (1 << 15)      //Q15 gain that passes samples unchanged
+#define TEST_RATE      (16000)
+#define TEST_SAMPLES   (TEST_RATE)
+#define TEST_HZ        (440.0)
+#define TEST_LEVEL     (16000.0)
+#define SNR_MIN_DB     (25.0)         //IMA-ADPCM keeps roughly 4 bits of detail on a full band signal
+#define LOOPS          (8)            //Loop passes compared
+#define PITCH_ERROR    (0.002)        //Largest relative pitch error after resampling
+#define FLASH_BUDGET   (32768)        //Bytes of the 128 KB flash the clip bank may take
+#define BENCH_SAMPLES  (4800000)      //100 s of audio
+
+/*
+ * @name   play
+ * @brief  Renders a voice one block at a time into a buffer
+ *
+ * @param  adpcm_voice_t *voice, int32_t *out, uint32_t count
+ * @return void
+ */
+static void play(adpcm_voice_t *voice, int32_t *out, uint32_t count)
+{
+	memset(out, 0, count * sizeof(out[0]));
+	for(uint32_t n = 0; n < count && voice->active; n += BLOCK)
+		adpcm_voice_mix(voice, out + n, (count - n < BLOCK) ? count - n : BLOCK, UNITY);
+}
+
+/*
+ * @name   rising_crossings
+ * @brief  Rising zero crossings of a signal, with the fraction of the sample each falls at
+ *
+ * @param  const int32_t *s, uint32_t count, double *first, double *last (out, crossing times)
+ * @return uint32_t crossings
+ */
+static uint32_t rising_crossings(const int32_t *s, uint32_t count, double *first, double *last)
+{
+	uint32_t crossings = 0;
+
+	for(uint32_t i = 1; i < count; i++)
+	{
+		if(s[i - 1] < 0 && s[i] >= 0)
+		{
+			double t = i - 1 + (double)-s[i - 1] / (s[i] - s[i - 1]);
+
+			if(crossings++ == 0)
+				*first = t;
+			*last = t;
+		}
+	}
+	return crossings;
+}
+
+/*
+ * @name   encoder_checks
+ * @brief  Round trip of a sine through the encoder and the decoder
+ *
+ * @param  void
+ * @return void
+ */
+static void encoder_checks()
+{
+	static int16_t pcm[TEST_SAMPLES], decoded[TEST_SAMPLES];
+	static int32_t out[TEST_SAMPLES + BLOCK];
+	adpcm_clip_t clip = { NULL, TEST_SAMPLES, TEST_RATE, 0, ADPCM_NO_LOOP };
+	adpcm_voice_t voice;
+	adpcm_state_t state;
+	double signal = 0, noise = 0, snr;
+	int exact = 1, replay = 1;
+	uint8_t *codes;
+
+	for(int i = 0; i < TEST_SAMPLES; i++)
+		pcm[i] = (int16_t)lround(TEST_LEVEL * sin(2 * M_PI * TEST_HZ * i / TEST_RATE));
+	codes = adpcm_encode(pcm, TEST_SAMPLES, 0, &clip.start, &clip.loop, decoded);
+	for(int i = 0; i < TEST_SAMPLES; i++)
+	{
+		signal += (double)pcm[i] * pcm[i];
+		noise += (double)(decoded[i] - pcm[i]) * (decoded[i] - pcm[i]);
+	}
+	snr = 10 * log10(signal / noise);
+	printf("Round trip of a %.0f Hz sine at %d Hz: %.1f dB SNR, 4 bits/sample\n", TEST_HZ, TEST_RATE, snr);
+	check(snr > SNR_MIN_DB, "the round trip SNR is that of IMA-ADPCM");
+
+	state = clip.start;
+	for(int i = 0; i < TEST_SAMPLES; i++)
+		replay &= (adpcm_decode(&state, (codes[i >> 1] >> ((i & 1) ? 4 : 0)) & 0x0F) == decoded[i]);
+	check(replay, "decoding the codes gives the encoder's reconstruction");
+
+	//At the clip rate the voice plays each decoded sample one sample late, the first interpolated from 0
+	clip.data = codes;
+	output_sample_rate = TEST_RATE;
+	adpcm_voice_start(&voice, &clip, UNITY, 0);
+	play(&voice, out, TEST_SAMPLES + BLOCK);
+	for(int i = 0; i < TEST_SAMPLES; i++)
+		exact &= (out[i + 1] == decoded[i]);
+	check(exact && out[0] == 0, "a voice at the clip rate plays the encoder's reconstruction bit exact");
+	check(!voice.active && out[TEST_SAMPLES + 1] == 0, "a one-shot voice ends with its clip");
+	free(codes);
+}
+
+/*
+ * @name   bank_checks
+ * @brief  Loop states of the clip bank and a held loop at the clip rate
+ *
+ * @param  void
+ * @return void
+ */
+static void bank_checks()
+{
+	uint32_t pcm_bytes = 0, adpcm_bytes = 0;
+
+	for(uint32_t c = 0; c < adpcm_clip_count; c++)
+	{
+		const adpcm_clip_t *clip = adpcm_clips[c];
+		adpcm_state_t state = clip->start;
+		uint32_t length = clip->loop_end - clip->loop_start, count, seam = 0;
+		int32_t *out, largest = 0;
+		adpcm_voice_t voice;
+		int repeats = 1;
+
+		adpcm_bytes += (clip->samples + 1) / 2;
+		pcm_bytes += clip->samples * sizeof(int16_t);
+		for(uint32_t i = 0; i < clip->loop_start; i++)
+			adpcm_decode(&state, (clip->data[i >> 1] >> ((i & 1) ? 4 : 0)) & 0x0F);
+		check(state.predictor == clip->loop.predictor && state.index == clip->loop.index,
+				"a clip's loop state is the decoder state its codes reach at loop_start");
+		if(clip->loop_end == ADPCM_NO_LOOP)
+			continue;
+
+		count = clip->loop_end + LOOPS * length;
+		out = calloc(count + BLOCK, sizeof(out[0]));
+		output_sample_rate = clip->rate;
+		adpcm_voice_start(&voice, clip, UNITY, 1);
+		play(&voice, out, count);
+		//Output sample n + 1 is clip sample n, so the loop body starts at output loop_start + 1
+		for(uint32_t i = clip->loop_end + 1; i < count; i++)
+			repeats &= (out[i] == out[i - length]);
+		for(uint32_t i = clip->loop_start + 2; i <= clip->loop_end; i++)
+		{
+			int32_t d = abs(out[i] - out[i - 1]);
+
+			if(d > largest)
+				largest = d;
+		}
+		seam = abs(out[clip->loop_end + 1] - out[clip->loop_end]);
+		printf("%s: %u sample loop held %d times, seam step %u against the largest step %d in the loop\n",
+				adpcm_clip_names[c], length, LOOPS, seam, largest);
+		check(repeats && voice.active, "a held loop repeats exactly");
+		check((int32_t)seam <= largest, "the loop seam is no larger a step than the loop body, so it does not click");
+		free(out);
+	}
+	printf("Clip bank: %u clips, %u bytes of flash against %u bytes of 16-bit PCM\n", adpcm_clip_count, adpcm_bytes,
+			pcm_bytes);
+	check(adpcm_bytes * 4 <= pcm_bytes + 4 * adpcm_clip_count && adpcm_bytes <= FLASH_BUDGET,
+			"the clip bank takes a quarter of PCM and fits its flash budget");
+}
+
+/*
+ * @name   crossing_rate
+ * @brief  Rising zero crossings per second of a held loop played at an output sample rate
+ *
+ * Harmonics add crossings, but as many at every rate, so the rate follows the pitch
+ *
+ * @param  const adpcm_clip_t *clip, uint32_t rate
+ * @return double crossings per second
+ */
+static double crossing_rate(const adpcm_clip_t *clip, uint32_t rate)
+{
+	uint32_t count = rate, skip = (uint32_t)((uint64_t)clip->loop_end * rate / clip->rate);
+	int32_t *out = calloc(skip + count + BLOCK, sizeof(out[0]));
+	adpcm_voice_t voice;
+	double first = 0, last = 0;
+	uint32_t crossings;
+
+	output_sample_rate = rate;
+	adpcm_voice_start(&voice, clip, UNITY, 1);
+	play(&voice, out, skip + count);
+	crossings = rising_crossings(out + skip, count, &first, &last);
+	free(out);
+	return (crossings > 1) ? (crossings - 1) * rate / (last - first) : 0;
+}
+
+/*
+ * @name   rate_checks
+ * @brief  Pitch and length of the clips at 8 and 48 kHz, and a rate switch while playing
+ *
+ * @param  void
+ * @return void
+ */
+static void rate_checks()
+{
+	static const uint32_t rates[] = { OUTPUT_RATE_MIN, OUTPUT_SAMPLE_RATE };
+	const adpcm_clip_t *loop = NULL, *shot = NULL;
+
+	for(uint32_t c = 0; c < adpcm_clip_count; c++)
+	{
+		if(adpcm_clips[c]->loop_end != ADPCM_NO_LOOP)
+			loop = adpcm_clips[c];
+		else
+			shot = adpcm_clips[c];
+	}
+	if(loop != NULL)
+	{
+		double native = crossing_rate(loop, loop->rate);
+
+		for(uint32_t r = 0; r < sizeof(rates) / sizeof(rates[0]); r++)
+		{
+			double hz = crossing_rate(loop, rates[r]);
+
+			printf("Held loop at %u Hz: %.2f rising crossings/s, %.2f at the clip rate\n", rates[r], hz, native);
+			check(fabs(hz / native - 1) < PITCH_ERROR, "a clip keeps its pitch at any output rate");
+		}
+	}
+	if(shot != NULL)
+	{
+		for(uint32_t r = 0; r < sizeof(rates) / sizeof(rates[0]); r++)
+		{
+			uint32_t expected = (uint32_t)((uint64_t)shot->samples * rates[r] / shot->rate), length = 0;
+			int32_t block[BLOCK];
+			adpcm_voice_t voice;
+
+			output_sample_rate = rates[r];
+			adpcm_voice_start(&voice, shot, UNITY, 0);
+			while(voice.active && length < 2 * expected)
+			{
+				memset(block, 0, sizeof(block));
+				adpcm_voice_mix(&voice, block, BLOCK, UNITY);
+				length += BLOCK;
+			}
+			check(length >= expected && length <= expected + 2 * BLOCK, "a one-shot clip lasts its length at any output rate");
+		}
+	}
+
+	//A rate switch rescales the clip step as starting the clip at the new rate does, but for the
+	//rounding of the old step, scaled by the rate ratio
+	if(loop != NULL)
+	{
+		int v;
+		uint32_t step;
+		uint16_t out[BLOCK];
+
+		mixer_reset();
+		output_sample_rate = OUTPUT_SAMPLE_RATE;
+		v = mixer_sample_on(loop, MIXER_VELOCITY_MAX, 1);
+		mixer_fill(out, BLOCK);
+		mixer_rescale(OUTPUT_SAMPLE_RATE, OUTPUT_RATE_MIN);
+		output_sample_rate = OUTPUT_RATE_MIN;
+		step = (uint32_t)(((uint64_t)loop->rate << ADPCM_PHASE_SHIFT) / OUTPUT_RATE_MIN);
+		check(abs((int32_t)(mixer_samples[v].step - step)) <= OUTPUT_SAMPLE_RATE / OUTPUT_RATE_MIN, "a rate switch keeps the pitch of a playing clip");
+		mixer_reset();
+		output_sample_rate = OUTPUT_SAMPLE_RATE;
+	}
+}
+
+/*
+ * @name   mixer_checks
+ * @brief  Sample voices in the mixer: level, release, stealing and all notes off
+ *
+ * @param  void
+ * @return void
+ */
+static void mixer_checks()
+{
+	const adpcm_clip_t *loop = NULL;
+	uint16_t out[BLOCK];
+	uint32_t played = 0, tail;
+	int first, second, third;
+
+	for(uint32_t c = 0; c < adpcm_clip_count; c++)
+	{
+		if(adpcm_clips[c]->loop_end != ADPCM_NO_LOOP)
+			loop = adpcm_clips[c];
+	}
+	if(loop == NULL)
+		return;
+	output_sample_rate = OUTPUT_SAMPLE_RATE;
+	mixer_reset();
+
+	first = mixer_sample_on(loop, MIXER_VELOCITY_MAX, 1);
+	for(uint32_t n = 0; n < 4 * OUTPUT_SAMPLE_RATE; n += BLOCK)
+		mixer_fill(out, BLOCK);
+	check(mixer_active_voices() == 1 && mixer_samples[first].looping, "a held loop plays until released");
+
+	//Released in its loop, the rest of the clip plays out
+	mixer_sample_release(first);
+	tail = (uint32_t)((uint64_t)(loop->samples - loop->loop_start) * OUTPUT_SAMPLE_RATE / loop->rate) + 2 * BLOCK;
+	while(mixer_active_voices() && played <= tail)
+	{
+		mixer_fill(out, BLOCK);
+		played += BLOCK;
+	}
+	printf("Released loop played out in %u samples, within %u\n", played, tail);
+	check(mixer_active_voices() == 0 && played <= tail, "a released voice plays the clip out and frees itself");
+
+	first = mixer_sample_on(loop, MIXER_VELOCITY_MAX, 1);
+	second = mixer_sample_on(loop, MIXER_VELOCITY_MAX, 1);
+	third = mixer_sample_on(loop, MIXER_VELOCITY_MAX, 1);
+	check(MIXER_SAMPLE_VOICES != 2 || (first != second && third == first), "the oldest sample voice is stolen");
+	mixer_all_notes_off();
+	check(mixer_samples[second].active && !mixer_samples[second].looping, "all notes off releases the sample voices");
+	mixer_reset();
+	check(mixer_active_voices() == 0, "a reset silences the sample voices");
+}
+
+/*
+ * @name   time_fill
+ * @brief  Times mixer_fill() over BENCH_SAMPLES with the voices as they are
+ *
+ * @param  double *tsc (out, TSC per sample)
+ * @return double ns per sample
+ */
+static double time_fill(double *tsc)
+{
+	static uint16_t out[BLOCK];
+	struct timespec t0, t1;
+	uint64_t c0 = 0, c1 = 0;
+
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+#if defined(__x86_64__) || defined(__i386__)
+	c0 = __rdtsc();
+#endif
+	for(uint32_t n = 0; n < BENCH_SAMPLES; n += BLOCK)
+		mixer_fill(out, BLOCK);
+#if defined(__x86_64__) || defined(__i386__)
+	c1 = __rdtsc();
+#endif
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	*tsc = (double)(c1 - c0) / BENCH_SAMPLES;
+	return ((t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec)) / BENCH_SAMPLES;
+}
+
+/*
+ * @name   time_voices
+ * @brief  Cost of a sample voice and of an oscillator voice over the empty mixer
+ *
+ * @param  void
+ * @return void
+ */
+static void time_voices()
+{
+	const adpcm_clip_t *loop = adpcm_clips[0];
+	tone_t tone = { 440, 0 };
+	double base, osc, sample, base_tsc, osc_tsc, sample_tsc;
+
+	for(uint32_t c = 0; c < adpcm_clip_count; c++)
+	{
+		if(adpcm_clips[c]->loop_end != ADPCM_NO_LOOP)
+			loop = adpcm_clips[c];
+	}
+	output_sample_rate = OUTPUT_SAMPLE_RATE;
+	tone_init(&tone);
+	mixer_reset();
+	base = time_fill(&base_tsc);
+	mixer_note_on(0, &tone, MIXER_VELOCITY_MAX);
+	osc = time_fill(&osc_tsc) - base;
+	mixer_reset();
+	mixer_sample_on(loop, MIXER_VELOCITY_MAX, 1);
+	sample = time_fill(&sample_tsc) - base;
+	mixer_reset();
+	printf("Sample voice, %u Hz clip at %d Hz: %.2f ns/sample %.2f TSC/sample\n", loop->rate, OUTPUT_SAMPLE_RATE, sample,
+			sample_tsc - base_tsc);
+	printf("Oscillator voice:                    %.2f ns/sample %.2f TSC/sample\n", osc, osc_tsc - base_tsc);
+}
+
+int main()
+{
+	encoder_checks();
+	bank_checks();
+	rate_checks();
+	mixer_checks();
+	time_voices();
+
+	printf("%s\n", failures ? "ADPCM checks FAILED" : "ADPCM checks passed");
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,258 @@
+/*
+ * @file        bench_crossfade.c
+ * @brief       Host test of the step size at note transitions
+ *
+ * Plays every tune through sequencer_fill() one ring half at a time, as DMA0_IRQHandler does,
+ * for the shortest and the default crossfade. Two step sizes are measured:
+ *  - the mixer's worst gain step, mixer_worst_step, which the crossfade has to hold to full scale
+ *    over the crossfade length; a hard switch between notes is a full scale gain step
+ *  - the largest sample-to-sample step of the output in DAC codes, which must stay within what the
+ *    notes sounding can make on their own: for each voice its peak level times the steepest slope
+ *    of its table at its tuning word, plus its fastest envelope step. The worst step in the
+ *    crossfade after each note start is reported.
+ *
+ * For comparison the output bound is also applied to a hard switch between two notes, the way the
+ * old DMA source reload swapped buffers, which it has to flag. Square and saw tables step by
+ * nearly full scale on their own, so that comparison is made on the smooth waves only.
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       gcc
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "tunes.h"
+#include "sequencer.h"
+#include "mixer.h"
+#include "tone_cache.h"
+#include "dma.h"
+#include "tpm.h"
+
+#define SECONDS       (4)
+#define ROUNDING      (2)    //DAC codes of rounding in the mix and the Q15 to DAC conversion
+#define SWITCH_POINTS (64)   //Hard switch positions tried across the outgoing note's cycle
+#define SMOOTH_TUNES  (2)    //Tunes 1 and 2 play sine and triangle
+
+/*
+ * @name   table_slope
+ * @brief  Largest difference between neighbouring entries of a table, wrapping, Q15
+ *
+ * @param  const int16_t *table
+ * @return int32_t
+ */
+static int32_t table_slope(const int16_t *table)
+{
+	int32_t slope = 0;
+
+	for(int i = 0; i < DDS_TABLE_SIZE; i++)
+	{
+		int32_t d = abs(table[(i + 1) & DDS_TABLE_MASK] - table[i]);
+		if(d > slope)
+			slope = d;
+	}
+	return slope;
+}
+
+/*
+ * @name   voice_bound
+ * @brief  Largest step a voice can make on its own, in DAC codes
+ *
+ * Interpolation is linear between entries, so the wave moves at most the steepest slope per
+ * table index; the tuning word gives the indices advanced per sample. The envelope adds at most
+ * its fastest step times full scale.
+ *
+ * @param  const voice_t *voice
+ * @return double
+ */
+static double voice_bound(const voice_t *voice)
+{
+	const adsr_rates_t *r = &voice->env.rates;
+	int32_t env_step = r->attack_step;
+	double gain = voice->velocity / 32767.0;
+
+	if(r->decay_step > env_step)
+		env_step = r->decay_step;
+	if(r->release_step > env_step)
+		env_step = r->release_step;
+	return gain * (table_slope(voice->osc.table) * (voice->osc.tuning_word / (double)(1UL << DDS_INDEX_SHIFT)) +
+			32767.0 * env_step / ENV_ONE) / (1 << DDS_DAC_SHIFT);
+}
+
+/*
+ * @name   mix_bound
+ * @brief  Largest step the voices sounding before or after a refill can make together
+ *
+ * @param  const voice_t *before (copy of mixer_voices from before the refill)
+ * @return double DAC codes
+ */
+static double mix_bound(const voice_t *before)
+{
+	double bound = ROUNDING;
+
+	for(int v = 0; v < MIXER_NUM_VOICES; v++)
+	{
+		double a = before[v].active ? voice_bound(&before[v]) : 0;
+		double b = mixer_voices[v].active ? voice_bound(&mixer_voices[v]) : 0;
+		bound += (a > b) ? a : b;
+	}
+	return bound;
+}
+
+/*
+ * @name   play_tune
+ * @brief  Streams a tune and measures the steps at its note transitions
+ *
+ * @param  int tune, uint32_t crossfade (samples), double *worst (DAC codes), double *ratio
+ *         (worst step over its bound), int *peak_voices
+ * @return int failures: ring halves with a step over the bound, and a gain step too steep
+ */
+static int play_tune(int tune, uint32_t crossfade, double *worst, double *ratio, int *peak_voices)
+{
+	static uint16_t out[AUDIO_HALF_SIZE];
+	static voice_t before[MIXER_NUM_VOICES];
+	uint32_t samples = SECONDS * output_sample_rate, last_age = 0, since_note = UINT32_MAX;
+	int32_t previous = DDS_DAC_MIDSCALE;
+	int failures = 0;
+
+	*worst = 0;
+	*ratio = 0;
+	*peak_voices = 0;
+	mixer_reset();
+	mixer_set_crossfade(crossfade);
+	mixer_worst_step = 0;
+	sequencer_play(tune_pattern(tune));
+	for(uint32_t done = 0; done + AUDIO_HALF_SIZE <= samples; done += AUDIO_HALF_SIZE)
+	{
+		double bound, step = 0;
+		int active = 0;
+
+		for(int v = 0; v < MIXER_NUM_VOICES; v++)
+			before[v] = mixer_voices[v];
+		sequencer_fill(out, AUDIO_HALF_SIZE);
+		bound = mix_bound(before);
+		for(int i = 0; i < AUDIO_HALF_SIZE; i++)
+		{
+			double d = abs((int32_t)out[i] - previous);
+			if(d > step)
+				step = d;
+			previous = out[i];
+		}
+
+		for(int v = 0; v < MIXER_NUM_VOICES; v++)
+		{
+			if(mixer_voices[v].active)
+				active++;
+			if(mixer_voices[v].active && (int32_t)(mixer_voices[v].age - last_age) > 0)
+			{
+				last_age = mixer_voices[v].age;
+				since_note = 0;
+			}
+		}
+		if(active > *peak_voices)
+			*peak_voices = active;
+		if(step > bound)
+		{
+			printf("FAIL: tune %d, step of %.0f codes at %.4f s, the notes sounding make at most %.1f\n",
+					tune, step, (double)done / output_sample_rate, bound);
+			failures++;
+		}
+		if(since_note <= crossfade + AUDIO_HALF_SIZE && last_age > 1) //A transition, not the first note
+		{
+			if(step > *worst)
+				*worst = step;
+			if(step / bound > *ratio)
+				*ratio = step / bound;
+		}
+		since_note += AUDIO_HALF_SIZE;
+	}
+	sequencer_stop();
+	if(mixer_worst_step > (1UL << 15) / crossfade)
+	{
+		printf("FAIL: tune %d, gain step %u/32768 is steeper than a %u sample crossfade\n", tune,
+				mixer_worst_step, crossfade);
+		failures++;
+	}
+	return failures;
+}
+
+/*
+ * @name   hard_switch
+ * @brief  Worst step of switching between two notes of a tune at full level with no fade
+ *
+ * The outgoing note stops anywhere in its cycle and the incoming note starts at phase 0
+ *
+ * @param  int tune, double *bound (DAC codes, the two voices together)
+ * @return double DAC codes
+ */
+static double hard_switch(int tune, double *bound)
+{
+	const seq_pattern_t *p = tune_pattern(tune);
+	voice_t from, to;
+	double worst = 0;
+
+	mixer_reset();
+	mixer_set_envelope(p->envelope);
+	from = mixer_voices[mixer_note_on(0, tone_cache_get(p->steps[0].frequency, p->wave), MIXER_VELOCITY_MAX)];
+	to = mixer_voices[mixer_note_on(1, tone_cache_get(p->steps[1].frequency, p->wave), MIXER_VELOCITY_MAX)];
+	mixer_reset();
+	*bound = voice_bound(&from) + voice_bound(&to) + ROUNDING;
+
+	for(int k = 0; k < SWITCH_POINTS; k++)
+	{
+		dds_osc_t a = from.osc, b = to.osc;
+		int32_t last, first;
+
+		a.phase = (uint32_t)k * (UINT32_MAX / SWITCH_POINTS);
+		b.phase = 0;
+		last = dds_sample(&a) >> DDS_DAC_SHIFT;
+		first = dds_sample(&b) >> DDS_DAC_SHIFT;
+		if(abs(first - last) > worst)
+			worst = abs(first - last);
+	}
+	return worst;
+}
+
+int main()
+{
+	static const uint32_t fades[] = { ENV_MIN_SAMPLES, MIXER_XFADE_SAMPLES };
+	static const uint32_t rates[] = { 16000, OUTPUT_SAMPLE_RATE };
+	int failures = 0;
+
+	for(uint32_t r = 0; r < sizeof(rates) / sizeof(rates[0]); r++)
+	{
+		sequencer_set_sample_rate(rates[r]);
+		printf("Step at note transitions, %u Hz, %d voices\n", output_sample_rate, MIXER_NUM_VOICES);
+		for(int tune = 1; tune <= NUM_TUNES; tune++)
+		{
+			for(uint32_t f = 0; f < sizeof(fades) / sizeof(fades[0]); f++)
+			{
+				double worst, ratio;
+				int peak;
+
+				failures += play_tune(tune, fades[f], &worst, &ratio, &peak);
+				printf("  tune %d, crossfade %4u samples: gain step %3u/32768, worst step %4.0f codes, %3.0f%% of bound, "
+						"peak %d voices\n", tune, fades[f], mixer_worst_step, worst, 100 * ratio, peak);
+			}
+		}
+	}
+
+	//The metric has to catch the click it is meant to prove gone
+	for(int tune = 1; tune <= SMOOTH_TUNES; tune++)
+	{
+		double bound, worst = hard_switch(tune, &bound);
+
+		printf("  tune %d, hard switch:          gain step 32768/32768, worst step %4.0f codes, %3.0f%% of bound\n",
+				tune, worst, 100 * worst / bound);
+		if(worst <= bound)
+		{
+			printf("FAIL: a hard switch in tune %d is within the bound\n", tune);
+			failures++;
+		}
+	}
+	mixer_set_crossfade(MIXER_XFADE_SAMPLES);
+
+	printf("%s\n", failures ? "Crossfade checks FAILED" : "Crossfade checks passed");
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,134 @@
+/*
+ * @file        bench_dds.c
+ * @brief       Host benchmark of the DDS oscillator
+ *
+ * Reports the pitch error of every note in tone_to_sample.h, for the DDS tuning word and for
+ * the old whole-samples-per-period buffers, and measures the cost of dds_render() per sample.
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       gcc
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <math.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "dds.h"
+#include "wavetable.h"
+#include "tone_to_sample.h"
+#include "dma.h"
+#include "tpm.h"
+
+#define BENCH_SAMPLES   (10000000)
+#define BENCH_BLOCK     (AUDIO_HALF_SIZE)
+#define MEASURE_SECONDS (10)
+
+static const int notes[] =
+{
+	WAVEFORM1_FREQ, WAVEFORM2_FREQ, WAVEFORM3_FREQ,
+	WAVEFORM4_FREQ, WAVEFORM5_FREQ, WAVEFORM6_FREQ,
+	WAVEFORM7_FREQ, WAVEFORM8_FREQ, WAVEFORM9_FREQ,
+	WAVEFORM10_FREQ, WAVEFORM11_FREQ, WAVEFORM12_FREQ
+};
+
+/*
+ * @name   cents
+ * @brief  Pitch difference between two frequencies in cents
+ *
+ * @param  double actual, double target
+ * @return double cents
+ */
+static double cents(double actual, double target)
+{
+	return 1200.0 * log2(actual / target);
+}
+
+/*
+ * @name   measured_frequency
+ * @brief  Frequency of rendered DDS output from its rising zero crossings
+ *
+ * @param  uint32_t tuning_word
+ * @return double frequency in Hz
+ */
+static double measured_frequency(uint32_t tuning_word)
+{
+	dds_osc_t osc = { 0, tuning_word, dds_sine_table };
+	uint32_t total = OUTPUT_SAMPLE_RATE * MEASURE_SECONDS;
+	int16_t prev = dds_sample(&osc);
+	double first = -1, last = 0;
+	int crossings = 0;
+
+	for(uint32_t i = 1; i < total; i++)
+	{
+		int16_t s = dds_sample(&osc);
+		if(prev < 0 && s >= 0)
+		{
+			//Interpolate the crossing to a fraction of a sample
+			double t = (i - 1) + (double)-prev / (s - prev);
+			if(first < 0)
+				first = t;
+			else
+				crossings++;
+			last = t;
+		}
+		prev = s;
+	}
+	return crossings * (double)OUTPUT_SAMPLE_RATE / (last - first);
+}
+
+int main()
+{
+	int count = sizeof(notes) / sizeof(notes[0]);
+	double worst_dds = 0;
+
+	printf("Pitch accuracy at %d Hz\n", OUTPUT_SAMPLE_RATE);
+	printf("%8s %14s %12s %14s %12s %14s\n", "note Hz", "DDS Hz", "DDS cents", "measured Hz", "old Hz", "old cents");
+	for(int i = 0; i < count; i++)
+	{
+		uint32_t tw = dds_tuning_word(DDS_HZ(notes[i]), OUTPUT_SAMPLE_RATE);
+		double dds_hz = dds_frequency(tw, OUTPUT_SAMPLE_RATE) / 65536.0;
+		double exact_hz = (double)tw * OUTPUT_SAMPLE_RATE / 4294967296.0;
+		double old_hz = (double)OUTPUT_SAMPLE_RATE / (OUTPUT_SAMPLE_RATE / notes[i]);
+		double err = cents(exact_hz, notes[i]);
+
+		if(fabs(err) > worst_dds)
+			worst_dds = fabs(err);
+		printf("%8d %14.6f %12.6f %14.6f %12.3f %14.3f\n", notes[i], dds_hz, err,
+				measured_frequency(tw), old_hz, cents(old_hz, notes[i]));
+	}
+	printf("Worst DDS error: %.6f cents\n\n", worst_dds);
+
+	//Cost of rendering DAC samples
+	static uint16_t block[BENCH_BLOCK];
+	dds_osc_t osc = { 0, dds_tuning_word(DDS_HZ(WAVEFORM1_FREQ), OUTPUT_SAMPLE_RATE), dds_sine_table };
+	struct timespec t0, t1;
+	uint32_t checksum = 0;
+
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+#if defined(__x86_64__) || defined(__i386__)
+	uint64_t c0 = __rdtsc();
+#endif
+	for(uint32_t n = 0; n < BENCH_SAMPLES; n += BENCH_BLOCK)
+	{
+		dds_render(&osc, block, BENCH_BLOCK);
+		checksum += block[n % BENCH_BLOCK];
+	}
+#if defined(__x86_64__) || defined(__i386__)
+	uint64_t c1 = __rdtsc();
+#endif
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+
+	double ns = (t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec);
+	printf("dds_render: %.2f ns/sample", ns / BENCH_SAMPLES);
+#if defined(__x86_64__) || defined(__i386__)
+	printf(", %.2f TSC cycles/sample", (double)(c1 - c0) / BENCH_SAMPLES);
+#endif
+	printf(" (checksum %u)\n", checksum);
+	printf("Ring RAM: %d bytes, wavetable bank flash: %d bytes\n", (int)(AUDIO_RING_SIZE * sizeof(uint16_t)),
+			(int)(sizeof(dds_sine_table) + sizeof(wavetable_triangle) + sizeof(wavetable_square) + sizeof(wavetable_saw)));
+	return 0;
+}
@@ -0,0 +1,340 @@
+/*
+ * @file        bench_effects.c
+ * @brief       Host test and benchmark of the effects chain
+ *
+ * Measures the low-pass and high-pass responses of the fixed-point biquad against the floating
+ * point design across the cutoff range at 8 and 48 kHz, checks that it decays to silence, that a
+ * mix beyond full scale saturates instead of wrapping and that a rate switch keeps the cutoff.
+ * Checks the echo's repeats sample by sample, its delay limit and tail, and times both.
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       gcc
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "effects.h"
+#include "mixer.h"
+#include "tpm.h"
+#include "check.h"
+
+#define BLOCK          (MIXER_BLOCK_SIZE)
+#define AMPLITUDE      (16000)        //Test sine, Q15
+#define SETTLE_MS      (200)
+#define MEASURE_MS     (200)
+#define CUTOFF_DB      (0.5)          //Largest error of the response against the design, dB
+#define STOP_DB        (-30.0)        //Three octaves past the cutoff
+#define DECAY_SAMPLES  (OUTPUT_SAMPLE_RATE)
+#define BENCH_SAMPLES  (4800000)      //100 s of audio
+#define FULL_SCALE     (32767)
+#define HALF           (EFFECTS_LEVEL_MAX / 2)
+
+/*
+ * @name   configure
+ * @brief  Sets the effects at a sample rate
+ *
+ * @param  uint32_t rate, uint8_t filter, uint32_t cutoff, uint32_t q, uint32_t echo_ms, int32_t feedback, int32_t wet
+ * @return void
+ */
+static void configure(uint32_t rate, uint8_t filter, uint32_t cutoff, uint32_t q, uint32_t echo_ms, int32_t feedback,
+		int32_t wet)
+{
+	effects_settings_t s = { filter, (uint16_t)cutoff, (uint16_t)q, (uint16_t)echo_ms, (int16_t)feedback, (int16_t)wet };
+
+	output_sample_rate = rate;
+	effects_configure(&s);
+}
+
+/*
+ * @name   design_db
+ * @brief  Gain of the floating point cookbook filter at a frequency
+ *
+ * @param  uint8_t filter, double cutoff, double q, double hz, double rate
+ * @return double dB
+ */
+static double design_db(uint8_t filter, double cutoff, double q, double hz, double rate)
+{
+	double w0 = 2 * M_PI * cutoff / rate, w = 2 * M_PI * hz / rate, alpha = sin(w0) / (2 * q), c = cos(w0);
+	double b0 = (filter == FILTER_LOWPASS) ? (1 - c) / 2 : (1 + c) / 2, b1 = (filter == FILTER_LOWPASS) ? 1 - c : -(1 + c);
+	double a1 = -2 * c, a2 = 1 - alpha, a0 = 1 + alpha;
+	double nr = b0 + b1 * cos(w) + b0 * cos(2 * w), ni = -b1 * sin(w) - b0 * sin(2 * w);
+	double dr = a0 + a1 * cos(w) + a2 * cos(2 * w), di = -a1 * sin(w) - a2 * sin(2 * w);
+
+	return 10 * log10((nr * nr + ni * ni) / (dr * dr + di * di));
+}
+
+/*
+ * @name   measure_db
+ * @brief  Gain of the effects on a sine, from the RMS after settling
+ *
+ * @param  double hz, uint32_t rate
+ * @return double dB
+ */
+static double measure_db(double hz, uint32_t rate)
+{
+	int32_t block[BLOCK];
+	uint32_t settle = rate * SETTLE_MS / 1000, total = settle + rate * MEASURE_MS / 1000;
+	double in = 0, out = 0;
+
+	for(uint32_t n = 0; n < total; n += BLOCK)
+	{
+		double x[BLOCK];
+
+		for(int i = 0; i < BLOCK; i++)
+		{
+			x[i] = AMPLITUDE * sin(2 * M_PI * hz * (n + i) / rate);
+			block[i] = (int32_t)lround(x[i]);
+		}
+		effects_process(block, BLOCK);
+		for(int i = 0; i < BLOCK && n >= settle; i++)
+		{
+			in += x[i] * x[i];
+			out += (double)block[i] * block[i];
+		}
+	}
+	return 10 * log10(out / in);
+}
+
+/*
+ * @name   response_checks
+ * @brief  Fixed-point response against the design across the cutoff range
+ *
+ * At each cutoff the gain is measured at the cutoff, three octaves into the passband and, where
+ * it is below the limit, three octaves into the stopband
+ *
+ * @param  uint8_t filter, uint32_t rate
+ * @return void
+ */
+static void response_checks(uint8_t filter, uint32_t rate)
+{
+	uint32_t cutoffs[] = { rate / EFFECTS_CUTOFF_DIV, rate / 32, 1000, rate / 8, rate / 4, rate * EFFECTS_CUTOFF_MAX / 100 };
+	double worst = 0, stop = -1000;
+
+	for(uint32_t c = 0; c < sizeof(cutoffs) / sizeof(cutoffs[0]); c++)
+	{
+		double f[3] = { cutoffs[c], cutoffs[c] / 8.0, cutoffs[c] * 8.0 };
+
+		if(filter == FILTER_HIGHPASS)
+		{
+			f[1] = cutoffs[c] * 8.0;
+			f[2] = cutoffs[c] / 8.0;
+		}
+		for(int k = 0; k < 3; k++)
+		{
+			double got, want;
+
+			if(f[k] >= rate * 0.45 || f[k] < 20)
+				continue;
+			configure(rate, filter, cutoffs[c], EFFECTS_Q_DEFAULT, 0, 0, 0);
+			got = measure_db(f[k], rate);
+			want = design_db(filter, cutoffs[c], EFFECTS_Q_DEFAULT / 100.0, f[k], rate);
+			if(k < 2 && fabs(got - want) > worst)
+				worst = fabs(got - want);
+			if(k == 2 && got > stop)
+				stop = got;
+			if((k < 2 && fabs(got - want) > CUTOFF_DB) || (k == 2 && got > STOP_DB))
+			{
+				printf("FAIL: %s %u Hz at %u Hz: %.1f Hz is %.2f dB, designed %.2f dB\n", effects_filter_names[filter],
+						cutoffs[c], rate, f[k], got, want);
+				failures++;
+			}
+		}
+	}
+	printf("%s at %5u Hz: %u..%u Hz cutoffs within %.2f dB of the design, %.1f dB three octaves out\n",
+			effects_filter_names[filter], rate, cutoffs[0], cutoffs[5], worst, stop);
+}
+
+/*
+ * @name   filter_checks
+ * @brief  Decay to silence, saturation, rate switch and the bypass
+ *
+ * @param  void
+ * @return void
+ */
+static void filter_checks()
+{
+	int32_t block[BLOCK], peak = 0;
+	int wrapped = 0, same = 1;
+	double before, after;
+
+	//A loud low note, then silence: nothing above a DAC step may linger
+	configure(OUTPUT_SAMPLE_RATE, FILTER_LOWPASS, OUTPUT_SAMPLE_RATE / EFFECTS_CUTOFF_DIV, EFFECTS_Q_MAX, 0, 0, 0);
+	measure_db(OUTPUT_SAMPLE_RATE / EFFECTS_CUTOFF_DIV, OUTPUT_SAMPLE_RATE);
+	for(uint32_t n = 0; n < DECAY_SAMPLES; n += BLOCK)
+	{
+		memset(block, 0, sizeof(block));
+		effects_process(block, BLOCK);
+		for(int i = 0; i < BLOCK && n >= DECAY_SAMPLES / 2; i++)
+			peak = (abs(block[i]) > peak) ? abs(block[i]) : peak;
+	}
+	printf("Filter tail half a second after the input stops: %d, under a DAC step of %d\n", peak, 1 << DDS_DAC_SHIFT);
+	check(peak < (1 << DDS_DAC_SHIFT), "the filter decays to silence");
+
+	//Four voices in phase at full scale through a resonant low-pass
+	configure(OUTPUT_SAMPLE_RATE, FILTER_LOWPASS, 2000, EFFECTS_Q_MAX, 0, 0, 0);
+	effects_stats.filter_clips = 0;
+	for(uint32_t n = 0; n < OUTPUT_SAMPLE_RATE / 10; n += BLOCK)
+	{
+		for(int i = 0; i < BLOCK; i++)
+		{
+			int32_t x = (int32_t)(MIXER_NUM_VOICES * FULL_SCALE * sin(2 * M_PI * 2000 * (n + i) / OUTPUT_SAMPLE_RATE));
+
+			block[i] = x;
+		}
+		effects_process(block, BLOCK);
+		for(int i = 1; i < BLOCK; i++)
+			wrapped |= abs(block[i] - block[i - 1]) > 2 * FULL_SCALE;
+	}
+	printf("Four voices at full scale into Q %.2f: %u samples saturated, none wrapped\n", EFFECTS_Q_MAX / 100.0,
+			effects_stats.filter_clips);
+	check(!wrapped && effects_stats.filter_clips, "a mix beyond full scale saturates instead of wrapping");
+
+	//The cutoff stays put across a rate switch
+	configure(OUTPUT_SAMPLE_RATE, FILTER_LOWPASS, 1000, EFFECTS_Q_DEFAULT, 0, 0, 0);
+	before = measure_db(1000, OUTPUT_SAMPLE_RATE);
+	output_sample_rate = 16000;
+	effects_set_sample_rate(16000);
+	after = measure_db(1000, 16000);
+	printf("1 kHz low-pass at its cutoff: %.2f dB at %d Hz, %.2f dB after switching to 16000 Hz\n", before,
+			OUTPUT_SAMPLE_RATE, after);
+	check(fabs(before - after) < CUTOFF_DB && effects_current()->cutoff_hz == 1000, "a rate switch keeps the cutoff");
+
+	configure(OUTPUT_SAMPLE_RATE, FILTER_OFF, 1000, EFFECTS_Q_DEFAULT, 0, 0, 0);
+	for(int i = 0; i < BLOCK; i++)
+		block[i] = i * 7919 - 200000;
+	effects_process(block, BLOCK);
+	for(int i = 0; i < BLOCK; i++)
+		same &= (block[i] == i * 7919 - 200000);
+	check(same, "with the effects off the mix passes untouched");
+}
+
+/*
+ * @name   echo_checks
+ * @brief  Repeats of an impulse, the delay limit, saturation and the tail
+ *
+ * @param  void
+ * @return void
+ */
+static void echo_checks()
+{
+	static int32_t out[OUTPUT_SAMPLE_RATE];
+	uint32_t delay, ms = 20, repeats = 0;
+	int32_t block[BLOCK], expect = AMPLITUDE;
+	int exact = 1, wrapped = 0;
+
+	configure(OUTPUT_SAMPLE_RATE, FILTER_OFF, 1000, EFFECTS_Q_DEFAULT, ms, HALF, HALF);
+	delay = ms * OUTPUT_SAMPLE_RATE / 1000;
+	for(uint32_t n = 0; n < OUTPUT_SAMPLE_RATE; n += BLOCK)
+	{
+		memset(block, 0, sizeof(block));
+		if(n == 0)
+			block[0] = AMPLITUDE;
+		effects_process(block, BLOCK);
+		memcpy(&out[n], block, sizeof(block));
+	}
+	//Repeat k is the impulse times wet times feedback^(k-1), each product truncated
+	for(uint32_t i = 0; i < OUTPUT_SAMPLE_RATE; i++)
+	{
+		int32_t want = 0;
+
+		if(i == 0)
+			want = AMPLITUDE;
+		else if(i % delay == 0)
+		{
+			if(i / delay > 1)
+				expect = (expect * HALF) >> 15;
+			want = (expect * HALF) >> 15;
+			repeats += (want != 0);
+		}
+		if(out[i] != want)
+		{
+			if(exact)
+				printf("FAIL: echo sample %u is %d, expected %d\n", i, out[i], want);
+			exact = 0;
+		}
+	}
+	check(exact, "echo repeats land on the delay with the feedback level");
+	printf("Echo %u ms, feedback and mix 50%%: %u repeats exact to the sample, ringing %s after %u ms\n", ms, repeats,
+			effects_ringing() ? "yes" : "no", 1000);
+	check(!effects_ringing(), "the echo stops ringing once its repeats fall under a DAC step");
+
+	configure(OUTPUT_SAMPLE_RATE, FILTER_OFF, 1000, EFFECTS_Q_DEFAULT, 1000, HALF, HALF);
+	printf("Echo delay line: %d samples, %u ms at %d Hz, %u ms at %d Hz\n", EFFECTS_DELAY_SIZE, effects_current()->echo_ms,
+			OUTPUT_SAMPLE_RATE, (uint32_t)EFFECTS_DELAY_SIZE * 1000 / OUTPUT_RATE_MIN, OUTPUT_RATE_MIN);
+	check(effects_current()->echo_ms == effects_delay_max_ms() && effects_delay_max_ms() * OUTPUT_SAMPLE_RATE / 1000 <= EFFECTS_DELAY_SIZE,
+			"the delay is limited to the delay line");
+
+	//Full scale square into the most feedback
+	configure(OUTPUT_SAMPLE_RATE, FILTER_OFF, 1000, EFFECTS_Q_DEFAULT, 10, EFFECTS_FEEDBACK_MAX, EFFECTS_LEVEL_MAX);
+	effects_stats.echo_clips = 0;
+	for(uint32_t n = 0; n < OUTPUT_SAMPLE_RATE; n += BLOCK)
+	{
+		for(int i = 0; i < BLOCK; i++)
+			block[i] = ((n / BLOCK) & 1) ? FULL_SCALE : -FULL_SCALE;
+		effects_process(block, BLOCK);
+		for(int i = 0; i < BLOCK; i++)
+			wrapped |= (block[i] > 2 * FULL_SCALE + 1 || block[i] < -2 * FULL_SCALE - 2);
+	}
+	check(!wrapped && effects_stats.echo_clips, "a full delay line saturates instead of wrapping");
+}
+
+/*
+ * @name   time_effects
+ * @brief  Times effects_process() over BENCH_SAMPLES
+ *
+ * @param  const char *name
+ * @return void
+ */
+static void time_effects(const char *name)
+{
+	int32_t block[BLOCK];
+	struct timespec t0, t1;
+	uint64_t c0 = 0, c1 = 0;
+	double ns;
+
+	for(int i = 0; i < BLOCK; i++)
+		block[i] = (int16_t)(i * 1024);
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+#if defined(__x86_64__) || defined(__i386__)
+	c0 = __rdtsc();
+#endif
+	for(uint32_t n = 0; n < BENCH_SAMPLES; n += BLOCK)
+		effects_process(block, BLOCK);
+#if defined(__x86_64__) || defined(__i386__)
+	c1 = __rdtsc();
+#endif
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	ns = ((t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec)) / BENCH_SAMPLES;
+	printf("%-14s %.2f ns/sample %.2f TSC/sample\n", name, ns, (double)(c1 - c0) / BENCH_SAMPLES);
+}
+
+int main()
+{
+	static const uint32_t rates[] = { OUTPUT_RATE_MIN, OUTPUT_SAMPLE_RATE };
+
+	for(uint32_t r = 0; r < sizeof(rates) / sizeof(rates[0]); r++)
+	{
+		response_checks(FILTER_LOWPASS, rates[r]);
+		response_checks(FILTER_HIGHPASS, rates[r]);
+	}
+	filter_checks();
+	echo_checks();
+
+	configure(OUTPUT_SAMPLE_RATE, FILTER_LOWPASS, 1000, EFFECTS_Q_DEFAULT, 0, 0, 0);
+	time_effects("Filter:");
+	configure(OUTPUT_SAMPLE_RATE, FILTER_OFF, 1000, EFFECTS_Q_DEFAULT, 40, HALF, HALF);
+	time_effects("Echo:");
+	configure(OUTPUT_SAMPLE_RATE, FILTER_LOWPASS, 1000, EFFECTS_Q_DEFAULT, 40, HALF, HALF);
+	time_effects("Filter + echo:");
+
+	printf("%s\n", failures ? "Effects checks FAILED" : "Effects checks passed");
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,128 @@
+/*
+ * @file        bench_envelope.c
+ * @brief       Host test and benchmark of the fixed-point ADSR envelope
+ *
+ * Runs one note through every stage and checks it reaches full scale, settles on the sustain
+ * level and fades to idle with no step larger than one stage rate allows. Retriggers a voice at
+ * full level with the shortest attack, which must stay within 0..ENV_ONE.
+ * Then measures envelope_block() cost per block.
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       gcc
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "envelope.h"
+#include "mixer.h"
+#include "tpm.h"
+
+#define BENCH_BLOCKS   (10000000)
+#define SUSTAIN_BLOCKS (100)
+
+int main()
+{
+	static const adsr_params_t params = { 20, 200, ENV_Q15(0.6), 300 };
+	adsr_rates_t rates;
+	envelope_t env = { 0 };
+	int32_t level, step, peak = 0, max_step, previous = 0;
+	uint32_t blocks = 0, sustain_blocks = 0;
+	int failures = 0;
+
+	envelope_rates(&rates, &params, OUTPUT_SAMPLE_RATE);
+	max_step = rates.attack_step;
+	if(rates.decay_step > max_step)
+		max_step = rates.decay_step;
+	if(rates.release_step > max_step)
+		max_step = rates.release_step;
+
+	envelope_trigger(&env, &rates);
+	while(env.stage != ENV_IDLE && blocks < 1000000)
+	{
+		if(env.stage == ENV_SUSTAIN && ++sustain_blocks == SUSTAIN_BLOCKS)
+			envelope_release(&env);
+		level = envelope_block(&env, MIXER_BLOCK_SIZE, &step);
+		if(level != previous)
+		{
+			printf("FAIL: block %u starts at %d, previous block ended at %d\n", blocks, level, previous);
+			failures++;
+		}
+		if(abs(step) > max_step)
+		{
+			printf("FAIL: block %u step %d larger than any stage rate\n", blocks, step);
+			failures++;
+		}
+		previous = level + step * MIXER_BLOCK_SIZE;
+		if(previous > peak)
+			peak = previous;
+		if(env.stage == ENV_SUSTAIN && env.level != rates.sustain_level)
+		{
+			printf("FAIL: sustain level %d, expected %d\n", env.level, rates.sustain_level);
+			failures++;
+		}
+		blocks++;
+	}
+	if(peak < ENV_ONE - MIXER_BLOCK_SIZE || peak > ENV_ONE)
+	{
+		printf("FAIL: attack peaked at %d\n", peak);
+		failures++;
+	}
+	if(env.stage != ENV_IDLE || env.level != 0)
+	{
+		printf("FAIL: release did not end at idle\n");
+		failures++;
+	}
+	printf("ADSR %u/%u/%.2f/%u ms: %u blocks of %d samples, %.1f ms\n", params.attack_ms, params.decay_ms,
+			params.sustain / 32767.0, params.release_ms, blocks, MIXER_BLOCK_SIZE,
+			blocks * MIXER_BLOCK_SIZE * 1000.0 / OUTPUT_SAMPLE_RATE);
+
+	//A voice stolen or retriggered the block its attack ends, at full level, with the shortest attack
+	static const adsr_params_t fast = { 0, 0, ENV_Q15(0.5), 0 };
+	int32_t lowest = ENV_ONE, highest = 0;
+
+	envelope_rates(&rates, &fast, OUTPUT_SAMPLE_RATE);
+	env.stage = ENV_DECAY;
+	env.level = ENV_ONE;
+	envelope_trigger(&env, &rates);
+	for(blocks = 0; blocks < 4; blocks++)
+	{
+		level = envelope_block(&env, MIXER_BLOCK_SIZE, &step);
+		previous = level + step * MIXER_BLOCK_SIZE;
+		lowest = (level < lowest) ? level : lowest;
+		lowest = (previous < lowest) ? previous : lowest;
+		highest = (level > highest) ? level : highest;
+		highest = (previous > highest) ? previous : highest;
+	}
+	printf("Retrigger at full level, %d sample attack: level %d..%d, stage %u\n", ENV_MIN_SAMPLES, lowest, highest, env.stage);
+	if(lowest < 0 || highest > ENV_ONE || env.stage != ENV_SUSTAIN)
+	{
+		printf("FAIL: a retriggered full-level voice leaves 0..ENV_ONE\n");
+		failures++;
+	}
+
+	//Cost per block while ramping, the common case
+	static const adsr_params_t slow = { 60000, 0, ENV_Q15(0.5), 60000 };
+	struct timespec t0, t1;
+	int64_t sink = 0;
+
+	envelope_rates(&rates, &slow, OUTPUT_SAMPLE_RATE);
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+	for(uint32_t b = 0; b < BENCH_BLOCKS; b++)
+	{
+		if(env.stage != ENV_ATTACK)
+		{
+			env.stage = ENV_IDLE;
+			envelope_trigger(&env, &rates);
+		}
+		sink += envelope_block(&env, MIXER_BLOCK_SIZE, &step);
+	}
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	printf("envelope_block: %.2f ns/block (%lld)\n",
+			((t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec)) / BENCH_BLOCKS, (long long)(sink & 1));
+
+	printf("%s\n", failures ? "Envelope checks FAILED" : "Envelope checks passed");
+	return failures ? 1 : 0;
+}
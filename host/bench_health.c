@@ -0,0 +1,194 @@
+/*
+ * @file        bench_health.c
+ * @brief       Host test and benchmark of the audio engine health counters
+ *
+ * Feeds health_refill() refills of known length and spacing and checks the shortest, mean and
+ * longest refill, the late refill test, the CPU load of each window and its peak, across a wrap of
+ * the cycle counter. Checks the binary frame round trip, saturation, rejection of corrupt frames
+ * and finding a frame in command line output. Times health_refill().
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       gcc
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "health.h"
+#include "check.h"
+
+#define HALF_CYCLES    (64000)        //A 64-sample half at 48 kHz, 48 MHz core clock
+#define WRAP_START     (0xFFF00000UL) //Cycle count a million cycles before it wraps
+#define WINDOWS        (8)
+#define BENCH_REFILLS  (100000000)
+
+/*
+ * @name   run
+ * @brief  Feeds refills of one length, a half apart
+ *
+ * @param  audio_stream_stats_t *stats, uint32_t *now (cycle count, advanced), uint32_t refills, uint32_t cycles
+ * @return void
+ */
+static void run(audio_stream_stats_t *stats, uint32_t *now, uint32_t refills, uint32_t cycles)
+{
+	for(uint32_t i = 0; i < refills; i++)
+	{
+		*now += HALF_CYCLES;
+		health_refill(stats, *now, *now + cycles);
+	}
+}
+
+/*
+ * @name   refill_checks
+ * @brief  Refill times, late refills, load and peak, starting a little before the cycle count wraps
+ *
+ * @param  void
+ * @return void
+ */
+static void refill_checks()
+{
+	audio_stream_stats_t stats;
+	uint32_t now = WRAP_START, per_window = HEALTH_WINDOW_CYCLES / HALF_CYCLES + 1, late;
+
+	memset(&stats, 0, sizeof(stats)); //As the counters are before the first reset
+	health_refill(&stats, now, now + 500);
+	check(stats.refill_min == 500 && stats.refill_max == 500, "the first refill is the shortest and the longest");
+
+	health_reset(&stats, now);
+	run(&stats, &now, 10, 1000);
+	run(&stats, &now, 10, 3000);
+	run(&stats, &now, 10, 2000);
+	printf("Refills of 1000, 3000 and 2000 cycles: min %u, mean %u, max %u, late %u\n", stats.refill_min,
+			health_mean(&stats), stats.refill_max, stats.late_refills);
+	check(stats.refill_min == 1000 && stats.refill_max == 3000 && health_mean(&stats) == 2000 && stats.refills == 30,
+			"the shortest, mean and longest refill are exact");
+	check(stats.late_refills == 0, "refills well inside the half are not late");
+
+	late = stats.late_refills;
+	run(&stats, &now, 1, HALF_CYCLES * 7 / 10);
+	check(stats.late_refills == late, "a refill taking 70% of the half is not late");
+	run(&stats, &now, 1, HALF_CYCLES * 8 / 10);
+	check(stats.late_refills == late + 1, "a refill taking 80% of the half is late");
+
+	//25% load for WINDOWS windows, then at least one window at 50%
+	health_reset(&stats, now);
+	run(&stats, &now, WINDOWS * per_window, HALF_CYCLES / 4);
+	printf("Load at 25%% of every half: %u permille, peak %u, across a wrap: %s\n", stats.load, stats.load_peak,
+			(now < WRAP_START) ? "yes" : "no");
+	check(stats.load >= 249 && stats.load <= 251 && stats.load_peak == stats.load, "the load is the refill share of the window");
+	run(&stats, &now, 2 * per_window, HALF_CYCLES / 2); //Two windows, so one lies wholly at 50%
+	run(&stats, &now, 2 * per_window, HALF_CYCLES / 4);
+	printf("After a window at 50%%: load %u permille, peak %u\n", stats.load, stats.load_peak);
+	check(stats.load <= 251 && stats.load_peak >= 499 && stats.load_peak <= 501, "the peak keeps the busiest window");
+	check(now < WRAP_START && stats.refill_max == HALF_CYCLES / 2 && stats.busy_cycles, "the counters carry over the cycle count wrap");
+
+	health_reset(&stats, now);
+	check(stats.completions == 0 && stats.refills == 0 && stats.load_peak == 0 && health_mean(&stats) == 0,
+			"a reset clears the counters");
+}
+
+/*
+ * @name   frame_checks
+ * @brief  Binary frame round trip, saturation, corruption and finding a frame in text
+ *
+ * @param  void
+ * @return void
+ */
+static void frame_checks()
+{
+	static const char text[] = "\r\nHalves played: 1234\r\n> ";
+	audio_stream_stats_t stats, back;
+	uint8_t frame[HEALTH_FRAME_BYTES], stream[2 * sizeof(text) + HEALTH_FRAME_BYTES], window[HEALTH_FRAME_BYTES] = { 0 };
+	int found = 0, corrupt = 1;
+
+	memset(&stats, 0, sizeof(stats));
+	stats.completions = 0x12345678;
+	stats.underruns = 3;
+	stats.deadline_misses = 2;
+	stats.late_refills = 70000;
+	stats.refill_min = 1500;
+	stats.refill_max = 100000;  //Saturates
+	stats.refill_total = 2500 * 4;
+	stats.refills = 4;
+	stats.load = 123;
+	stats.load_peak = 456;
+	health_pack(&stats, frame);
+	check(health_unpack(frame, &back), "a frame unpacks");
+	check(back.completions == stats.completions && back.underruns == 3 && back.deadline_misses == 2 &&
+			back.late_refills == 70000 && back.refill_min == 1500 && health_mean(&back) == 2500 &&
+			back.refill_max == HEALTH_CYCLES_MAX && back.load == 123 && back.load_peak == 456,
+			"the frame carries every counter, with refill cycles saturated to 16 bits");
+
+	for(int i = 2; i < HEALTH_FRAME_BYTES; i++)
+	{
+		uint8_t bad[HEALTH_FRAME_BYTES];
+
+		memcpy(bad, frame, sizeof(bad));
+		bad[i] ^= 0x10;
+		corrupt &= !health_unpack(bad, &back);
+	}
+	check(corrupt, "a frame with any byte corrupted is rejected");
+	frame[1] ^= 1;
+	check(!health_unpack(frame, &back), "a frame without its sync bytes is rejected");
+	frame[1] ^= 1;
+
+	//The answer arrives after the echo of the command line, as query_health reads it
+	memcpy(stream, text, sizeof(text));
+	memcpy(stream + sizeof(text), frame, sizeof(frame));
+	memcpy(stream + sizeof(text) + sizeof(frame), text, sizeof(text));
+	for(uint32_t i = 0; i < sizeof(stream) && !found; i++)
+	{
+		memmove(window, window + 1, HEALTH_FRAME_BYTES - 1);
+		window[HEALTH_FRAME_BYTES - 1] = stream[i];
+		found = health_unpack(window, &back) && i == sizeof(text) + HEALTH_FRAME_BYTES - 1;
+	}
+	check(found && back.completions == stats.completions, "a frame is found in command line output");
+	printf("Binary health frame: %d bytes, %.1f ms at 38400 baud\n", HEALTH_FRAME_BYTES,
+			HEALTH_FRAME_BYTES * 11 * 1000.0 / 38400);
+}
+
+/*
+ * @name   time_refill
+ * @brief  Times health_refill() over BENCH_REFILLS refills a half apart
+ *
+ * @param  void
+ * @return void
+ */
+static void time_refill()
+{
+	audio_stream_stats_t stats;
+	struct timespec t0, t1;
+	uint64_t c0 = 0, c1 = 0;
+	uint32_t now = 0;
+	double ns;
+
+	health_reset(&stats, now);
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+#if defined(__x86_64__) || defined(__i386__)
+	c0 = __rdtsc();
+#endif
+	run(&stats, &now, BENCH_REFILLS, HALF_CYCLES / 4);
+#if defined(__x86_64__) || defined(__i386__)
+	c1 = __rdtsc();
+#endif
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	ns = ((t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec)) / BENCH_REFILLS;
+	printf("health_refill: %.2f ns/refill %.2f TSC/refill, load %u permille\n", ns, (double)(c1 - c0) / BENCH_REFILLS,
+			stats.load);
+}
+
+int main()
+{
+	refill_checks();
+	frame_checks();
+	time_refill();
+
+	printf("%s\n", failures ? "Health checks FAILED" : "Health checks passed");
+	return failures ? 1 : 0;
+}
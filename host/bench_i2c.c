@@ -0,0 +1,736 @@
+/*
+ * @file        bench_i2c.c
+ * @brief       Host test of the interrupt driven I2C transaction engine against a model of I2C0
+ *
+ * The model plays the KL25's I2C0 and an MMA8451 on the bus: after each engine call it reads the
+ * control register as the module would, clocks the START, address, data byte or STOP that the
+ * engine asked for, sets the status flags and calls i2c_engine_irq() as the interrupt would.
+ * Reading D in receive mode is modelled as happening whenever the handler returns in master
+ * receive mode, as the engine must. The device auto-increments its register pointer.
+ * With DMAEN set a byte received requests the model's DMA channel instead of the interrupt; its
+ * read of D clocks in the next byte, and i2c_engine_dma_done() is called when its count is done.
+ * Checks write, write-then-read and burst read transactions of every length, the queue and
+ * callbacks, NACKs, lost arbitration and timeouts, and the bus protocol the engine produces:
+ * interrupt flags cleared, the last byte read NACKed and nothing read after it. Every check runs
+ * with bytes read in the interrupt and again with the receive DMA.
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       gcc
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "i2c_engine.h"
+#include "check.h"
+
+//I2C0 register bits, KL25 Sub-Family Reference Manual chapter 38
+#define C1_IICEN    (0x80)
+#define C1_IICIE    (0x40)
+#define C1_MST      (0x20)
+#define C1_TX       (0x10)
+#define C1_TXAK     (0x08)
+#define C1_RSTA     (0x04)
+#define C1_DMAEN    (0x01)
+#define S_TCF       (0x80)
+#define S_BUSY      (0x20)
+#define S_ARBL      (0x10)
+#define S_SRW       (0x04)
+#define S_IICIF     (0x02)
+#define S_RXAK      (0x01)
+#define FLT_STOPF   (0x40)
+#define FLT_STOPIE  (0x20)
+
+#define MMA_ADDR        (0x3A)
+#define OTHER_ADDR      (0x3C)   //Nobody answers
+#define REG_XHI         (0x01)
+#define REG_WHOAMI      (0x0D)
+#define XYZ_BYTES       (6)
+#define BIT_US_100K     (10.0)   //SCL period at 100 kHz, the slowest the engine's timeouts allow for
+#define BITS_PER_BYTE   (9)      //Eight data bits and the acknowledge
+#define QUEUED          (4)
+#define CHAINED         (100)
+#define RANDOM_XFERS    (20000)
+#define MAX_LEN         (32)
+#define FIFO_BYTES      (192)    //The MMA8451 FIFO, 32 samples of X, Y and Z
+
+static i2c_regs_t regs;
+
+//Bus and device model
+static uint8_t mem[256];        //MMA8451 registers
+static uint8_t pointer;         //Register pointer, auto-incremented
+static int first_byte;          //Next byte written is the register pointer
+static int master;              //The module holds the bus
+static int addressed;           //The device acknowledged its address
+static int reading;
+static int last_acked = 0;      //The master acknowledged the last byte it read
+static int released;            //The master NACKed a byte; it must not read another
+static int hung;                //The device holds the bus, no more interrupts
+static uint32_t bytes;          //Bytes on the bus, for the faults below
+static uint32_t nack_at, arb_at, hang_at;
+static double now_us, deadline_us = -1, bit_us = BIT_US_100K;
+static uint32_t armed_us, overruns, violations, irqs;
+static int use_dma;             //The engine has the receive DMA
+static uint8_t *dma_dst;        //Receive DMA channel
+static uint32_t dma_count, dma_irqs;
+
+/*
+ * @name   violation
+ * @brief  Counts and prints a bus protocol error, once per kind
+ *
+ * @param  const char *what
+ * @return void
+ */
+static void violation(const char *what)
+{
+	if(violations++ < 8)
+		printf("Protocol: %s\n", what);
+}
+
+/*
+ * @name   sim_timer
+ * @brief  The engine's timeout timer, in model time
+ *
+ * @param  uint32_t us
+ * @return void
+ */
+static void sim_timer(uint32_t us)
+{
+	armed_us = us;
+	deadline_us = us ? now_us + us : -1;
+}
+
+/*
+ * @name   sim_dma
+ * @brief  The engine's receive DMA channel
+ *
+ * @param  uint8_t *dst, uint32_t count
+ * @return void
+ */
+static void sim_dma(uint8_t *dst, uint32_t count)
+{
+	dma_dst = dst;
+	dma_count = count;
+}
+
+/*
+ * @name   clear_flags
+ * @brief  Applies the engine's write-1-to-clear writes to the status flags
+ *
+ * @param  void
+ * @return void
+ */
+static void clear_flags()
+{
+	regs.S = 0;
+	regs.FLT &= ~FLT_STOPF;
+}
+
+/*
+ * @name   interrupt
+ * @brief  Raises the I2C0 interrupt with the status flags given
+ *
+ * The engine must clear IICIF (write 1) before it returns. Its write-1-to-clear writes are
+ * applied to the model afterwards.
+ *
+ * @param  uint8_t status
+ * @return void
+ */
+static void interrupt(uint8_t status)
+{
+	if(!(regs.C1 & C1_IICIE))
+		violation("interrupt disabled");
+	regs.S = status;
+	irqs++;
+	i2c_engine_irq();
+	if(regs.S != S_IICIF && regs.S != S_ARBL)
+		violation("interrupt flag not cleared");
+	clear_flags();
+}
+
+/*
+ * @name   address
+ * @brief  An address byte after START or repeated START
+ *
+ * @param  uint8_t byte
+ * @return uint8_t status flags
+ */
+static uint8_t address(uint8_t byte)
+{
+	if(reading && last_acked)
+		violation("repeated START after acknowledging the last byte read");
+	addressed = (byte & ~I2C_READ_BIT) == MMA_ADDR;
+	reading = byte & I2C_READ_BIT;
+	first_byte = 1;
+	released = 0;
+	last_acked = 0;
+	return addressed ? 0 : S_RXAK;
+}
+
+/*
+ * @name   write_byte
+ * @brief  A data byte from the master: the register pointer, then register contents
+ *
+ * @param  uint8_t byte
+ * @return uint8_t status flags
+ */
+static uint8_t write_byte(uint8_t byte)
+{
+	if(!addressed || reading)
+	{
+		violation("byte written without a write address acknowledged");
+		return S_RXAK;
+	}
+	if(first_byte)
+		pointer = byte;
+	else
+		mem[pointer++] = byte;
+	first_byte = 0;
+	return 0;
+}
+
+/*
+ * @name   read_byte
+ * @brief  A data byte from the device into D, acknowledged as TXAK says
+ *
+ * @param  int nack
+ * @return uint8_t status flags
+ */
+static uint8_t read_byte(int nack)
+{
+	if(!addressed || !reading || released)
+		violation("byte read without a read address acknowledged, or after a NACK");
+	regs.D = mem[pointer++];
+	last_acked = !nack;
+	released = nack;
+	return S_SRW;
+}
+
+/*
+ * @name   dma_request
+ * @brief  A byte received with DMAEN set: the DMA channel reads D, which clocks in the next byte
+ *
+ * Raises the DMA interrupt, which calls i2c_engine_dma_done(), when the count is done
+ *
+ * @param  void
+ * @return void
+ */
+static void dma_request()
+{
+	if(regs.C1 & C1_IICIE)
+		violation("interrupt and DMA request both enabled");
+	if(dma_count == 0)
+	{
+		violation("DMA request with no DMA armed");
+		hung = 1;
+		return;
+	}
+	*dma_dst++ = regs.D;
+	if(--dma_count)
+		return;
+	dma_irqs++;
+	if(i2c_engine_dma_done())
+		violation("byte already in when the DMA is done, in a model without latency");
+	if(regs.C1 & C1_DMAEN || !(regs.C1 & C1_IICIE))
+		violation("the interrupt does not take over from the DMA");
+	clear_flags();
+}
+
+/*
+ * @name   stop_interrupt
+ * @brief  A STOP on the bus: ends the device's transaction and raises STOPF
+ *
+ * @param  void
+ * @return void
+ */
+static void stop_interrupt()
+{
+	if(reading && last_acked)
+		violation("STOP after acknowledging the last byte read");
+	addressed = 0;
+	reading = 0;
+	last_acked = 0;
+	master = 0;
+	if(regs.FLT & FLT_STOPIE)
+	{
+		regs.FLT |= FLT_STOPF;
+		interrupt(S_IICIF);
+	}
+}
+
+/*
+ * @name   bus_run
+ * @brief  Clocks what the engine asked for until the bus is idle or hung
+ *
+ * @param  void
+ * @return void
+ */
+static void bus_run()
+{
+	for(;;)
+	{
+		uint8_t c1 = regs.C1, status;
+
+		if(hung || !(c1 & C1_IICEN))
+			return;
+		if(master && !(c1 & C1_MST))
+		{
+			stop_interrupt();
+			continue;
+		}
+		if(!(c1 & C1_MST))
+			return;
+
+		if(++bytes == hang_at)
+		{
+			hung = 1;
+			return;
+		}
+		now_us += bit_us * BITS_PER_BYTE;
+		if(deadline_us >= 0 && now_us > deadline_us)
+			overruns++;
+		if(!master)
+		{
+			if(!(c1 & C1_TX))
+				violation("START in receive mode");
+			master = 1;
+			status = address(regs.D);
+		}
+		else if(c1 & C1_RSTA)
+		{
+			regs.C1 &= ~C1_RSTA; //Reads as 0
+			status = address(regs.D);
+		}
+		else if(c1 & C1_TX)
+			status = write_byte(regs.D);
+		else
+			status = read_byte(c1 & C1_TXAK);
+		if((c1 & C1_DMAEN) && (c1 & C1_TX))
+			violation("DMA request enabled in transmit mode");
+
+		if(bytes == nack_at)
+			status |= S_RXAK;
+		if(bytes == arb_at)
+		{
+			//The module drops to slave mode; the other master's STOP follows
+			regs.C1 &= ~C1_MST;
+			master = 0;
+			interrupt(status | S_ARBL | S_TCF);
+			stop_interrupt();
+			continue;
+		}
+		if((c1 & C1_DMAEN) && !(c1 & C1_TX))
+			dma_request();
+		else
+			interrupt(status | S_TCF | S_BUSY);
+	}
+}
+
+/*
+ * @name   submit
+ * @brief  Queues a transaction, as i2c_queue() does with interrupts masked, then runs the bus
+ *
+ * @param  i2c_xfer_t *xfer
+ * @return int as i2c_engine_submit()
+ */
+static int submit(i2c_xfer_t *xfer)
+{
+	int queued = i2c_engine_submit(xfer);
+
+	bus_run();
+	return queued;
+}
+
+/*
+ * @name   expire
+ * @brief  Runs model time on to the timeout and calls the engine as the timer interrupt would
+ *
+ * @param  void
+ * @return void
+ */
+static void expire()
+{
+	if(deadline_us < 0)
+		return;
+	now_us = deadline_us;
+	hung = 0;
+	master = 0;
+	addressed = 0;
+	reading = 0;
+	last_acked = 0;
+	i2c_engine_timeout();
+	clear_flags();
+	if(dma_count)
+		violation("DMA left armed after a timeout");
+	bus_run();
+}
+
+/*
+ * @name   reset_model
+ * @brief  Fresh registers, device contents and engine, no faults, the receive DMA as use_dma says
+ *
+ * @param  void
+ * @return void
+ */
+static void reset_model()
+{
+	memset(&regs, 0, sizeof(regs));
+	for(int i = 0; i < (int)sizeof(mem); i++)
+		mem[i] = (uint8_t)(i * 7 + 3);
+	pointer = 0;
+	master = addressed = reading = last_acked = released = hung = 0;
+	bytes = nack_at = arb_at = hang_at = 0;
+	dma_dst = NULL;
+	dma_count = 0;
+	now_us = 0;
+	deadline_us = -1;
+	i2c_engine_init(&regs, sim_timer);
+	i2c_engine_set_dma(use_dma ? sim_dma : NULL);
+	clear_flags();
+}
+
+/*
+ * @name   setup
+ * @brief  Fills in a transaction
+ *
+ * @param  i2c_xfer_t *xfer, uint8_t dev, const uint8_t *tx, uint8_t tx_len, uint8_t *rx, uint8_t rx_len, i2c_done_t done
+ * @return void
+ */
+static void setup(i2c_xfer_t *xfer, uint8_t dev, const uint8_t *tx, uint8_t tx_len, uint8_t *rx, uint8_t rx_len,
+		i2c_done_t done)
+{
+	memset(xfer, 0, sizeof(*xfer));
+	xfer->dev = dev;
+	xfer->tx = tx;
+	xfer->tx_len = tx_len;
+	xfer->rx = rx;
+	xfer->rx_len = rx_len;
+	xfer->done = done;
+}
+
+static uint32_t order[QUEUED], completed;
+
+/*
+ * @name   log_done
+ * @brief  Callback noting the order transactions complete in; arg holds their number
+ *
+ * @param  i2c_xfer_t *xfer
+ * @return void
+ */
+static void log_done(i2c_xfer_t *xfer)
+{
+	if(completed < QUEUED)
+		order[completed] = (uint32_t)(uintptr_t)xfer->arg;
+	completed++;
+}
+
+static uint8_t chain_reg = REG_XHI, chain_data[XYZ_BYTES];
+static uint32_t chained, chain_errors;
+
+/*
+ * @name   chain_done
+ * @brief  Callback of a reading that queues the next one, as a sensor stream would
+ *
+ * Changes the device's data registers for the next reading
+ *
+ * @param  i2c_xfer_t *xfer
+ * @return void
+ */
+static void chain_done(i2c_xfer_t *xfer)
+{
+	for(int i = 0; i < XYZ_BYTES; i++)
+		chain_errors += (chain_data[i] != (uint8_t)(chained + i));
+	chained++;
+	for(int i = 0; i < XYZ_BYTES; i++)
+		mem[REG_XHI + i] = (uint8_t)(chained + i);
+	if(chained < CHAINED)
+		check(i2c_engine_submit(xfer), "a callback queues the next transaction");
+}
+
+/*
+ * @name   kind_checks
+ * @brief  Write, write-then-read and burst read transactions
+ *
+ * @param  void
+ * @return void
+ */
+static void kind_checks()
+{
+	uint8_t tx[MAX_LEN + 1], rx[MAX_LEN];
+	i2c_xfer_t xfer;
+	uint32_t ok = 1, before, dma_before;
+	double start;
+
+	reset_model();
+	tx[0] = REG_XHI;
+	setup(&xfer, MMA_ADDR, tx, 1, rx, XYZ_BYTES, NULL);
+	before = irqs;
+	dma_before = dma_irqs;
+	start = now_us;
+	submit(&xfer);
+	check(xfer.status == I2C_DONE && memcmp(rx, &mem[REG_XHI], XYZ_BYTES) == 0, "a 6-byte write-then-read reads X, Y and Z");
+	printf("6-byte reading%s: %u I2C interrupts, %u DMA, %.0f us of bus at 100 kHz the CPU is free for, timeout %u us\n",
+			use_dma ? " by DMA" : "", irqs - before, dma_irqs - dma_before, now_us - start, i2c_engine_timeout_us(&xfer));
+	if(use_dma)
+		check(irqs - before == 1 + 1 + 1 + 2 + 1 && dma_irqs - dma_before == 1,
+				"interrupts for the addresses, the last two bytes and the STOP, one for the DMA");
+	else
+		check(irqs - before == 1 + 1 + 1 + XYZ_BYTES + 1, "one interrupt a byte and one at the STOP");
+
+	//Every length of each kind
+	for(int len = 1; len <= MAX_LEN; len++)
+	{
+		uint8_t reg = (uint8_t)(0x40 + len);
+
+		tx[0] = reg;
+		for(int i = 1; i <= len; i++)
+			tx[i] = (uint8_t)(len * 31 + i);
+		setup(&xfer, MMA_ADDR, tx, (uint8_t)(len + 1), NULL, 0, NULL);
+		submit(&xfer);
+		ok &= xfer.status == I2C_DONE && memcmp(&mem[reg], &tx[1], len) == 0;
+
+		setup(&xfer, MMA_ADDR, tx, 1, rx, (uint8_t)len, NULL);
+		submit(&xfer);
+		ok &= xfer.status == I2C_DONE && memcmp(rx, &tx[1], len) == 0 && pointer == (uint8_t)(reg + len);
+
+		pointer = reg;
+		setup(&xfer, MMA_ADDR, NULL, 0, rx, (uint8_t)len, NULL);
+		submit(&xfer);
+		ok &= xfer.status == I2C_DONE && memcmp(rx, &tx[1], len) == 0;
+	}
+	check(ok, "writes, write-then-reads and burst reads of 1 to 32 bytes");
+	check(i2c_stats.transfers >= 3 * MAX_LEN && !i2c_stats.nacks && !i2c_stats.timeouts, "every transaction counted as completed");
+	check(use_dma ? (dma_irqs > 0 && i2c_stats.dma_reads == dma_irqs) : dma_irqs == 0, "reads of 4 bytes or more, and only those, use the DMA");
+
+	setup(&xfer, MMA_ADDR, NULL, 0, NULL, 0, NULL);
+	check(!i2c_engine_submit(&xfer) && xfer.status == I2C_IDLE, "a transaction moving no bytes is refused");
+}
+
+/*
+ * @name   queue_checks
+ * @brief  Transactions queued together complete in order; a callback queues the next
+ *
+ * @param  void
+ * @return void
+ */
+static void queue_checks()
+{
+	static const uint8_t write_cmd[] = { 0x2A, 0x01 }, whoami = REG_WHOAMI, xhi = REG_XHI;
+	uint8_t id = 0, xyz[XYZ_BYTES], burst[3];
+	i2c_xfer_t xfer[QUEUED];
+	int in_order = 1;
+
+	reset_model();
+	completed = 0;
+	mem[REG_WHOAMI] = 0x1A;
+	setup(&xfer[0], MMA_ADDR, write_cmd, sizeof(write_cmd), NULL, 0, log_done);
+	setup(&xfer[1], MMA_ADDR, &whoami, 1, &id, 1, log_done);
+	setup(&xfer[2], MMA_ADDR, NULL, 0, burst, sizeof(burst), log_done); //From the register after WHO_AM_I
+	setup(&xfer[3], MMA_ADDR, &xhi, 1, xyz, sizeof(xyz), log_done);
+	for(int i = 0; i < QUEUED; i++)
+		xfer[i].arg = (void *)(uintptr_t)i;
+
+	//Interrupts masked: all four are queued before the first byte moves
+	for(int i = 0; i < QUEUED; i++)
+		check(i2c_engine_submit(&xfer[i]), "a transaction is queued");
+	check(!i2c_engine_submit(&xfer[1]), "a transaction already queued is refused");
+	check(i2c_engine_busy(), "the engine is busy with a queue");
+	bus_run();
+	for(int i = 0; i < QUEUED; i++)
+		in_order &= order[i] == (uint32_t)i && xfer[i].status == I2C_DONE;
+	check(completed == QUEUED && in_order, "queued transactions complete in order, each with its callback");
+	check(mem[0x2A] == 0x01 && id == 0x1A && memcmp(burst, &mem[REG_WHOAMI + 1], sizeof(burst)) == 0 &&
+			memcmp(xyz, &mem[REG_XHI], sizeof(xyz)) == 0, "each queued transaction moves its own bytes");
+	check(!i2c_engine_busy() && deadline_us < 0, "the engine is idle and the timer stopped once the queue is empty");
+
+	reset_model();
+	chained = chain_errors = 0;
+	for(int i = 0; i < XYZ_BYTES; i++)
+		mem[REG_XHI + i] = (uint8_t)i;
+	setup(&xfer[0], MMA_ADDR, &chain_reg, 1, chain_data, XYZ_BYTES, chain_done);
+	submit(&xfer[0]);
+	check(chained == CHAINED && chain_errors == 0, "readings queued from their callbacks stream back to back");
+}
+
+/*
+ * @name   fault_checks
+ * @brief  NACKs, lost arbitration and timeouts end one transaction and the next goes ahead
+ *
+ * @param  void
+ * @return void
+ */
+static void fault_checks()
+{
+	static const uint8_t xhi = REG_XHI, write_cmd[] = { 0x2A, 0x01, 0x02 };
+	uint8_t rx[XYZ_BYTES], rx2[XYZ_BYTES];
+	i2c_xfer_t bad, good;
+	i2c_stats_t before;
+	double armed_at;
+
+	reset_model();
+	setup(&bad, OTHER_ADDR, &xhi, 1, rx, XYZ_BYTES, NULL);
+	setup(&good, MMA_ADDR, &xhi, 1, rx2, XYZ_BYTES, NULL);
+	i2c_engine_submit(&bad);
+	i2c_engine_submit(&good);
+	bus_run();
+	check(bad.status == I2C_NACK && good.status == I2C_DONE, "an address nobody acknowledges ends in I2C_NACK");
+
+	reset_model();
+	setup(&bad, MMA_ADDR, write_cmd, sizeof(write_cmd), NULL, 0, NULL);
+	nack_at = 2;
+	i2c_engine_submit(&bad);
+	i2c_engine_submit(&good);
+	bus_run();
+	check(bad.status == I2C_NACK && good.status == I2C_DONE && mem[0x2A] != 0x01, "a data byte not acknowledged ends the write");
+
+	reset_model();
+	setup(&bad, MMA_ADDR, &xhi, 1, rx, XYZ_BYTES, NULL);
+	arb_at = 3;
+	before = i2c_stats;
+	i2c_engine_submit(&bad);
+	i2c_engine_submit(&good);
+	bus_run();
+	check(bad.status == I2C_ARB_LOST && good.status == I2C_DONE && i2c_stats.arbitration_lost == before.arbitration_lost + 1,
+			"lost arbitration ends the transaction, the next starts at the other master's STOP");
+
+	//The device stops answering in the middle of a read
+	for(uint32_t at = 1; at <= 1 + 1 + 1 + XYZ_BYTES; at++)
+	{
+		reset_model();
+		hang_at = at;
+		before = i2c_stats;
+		i2c_engine_submit(&bad);
+		armed_at = now_us;
+		i2c_engine_submit(&good);
+		bus_run();
+		check(bad.status == I2C_PENDING && hung, "a hung bus leaves the transaction pending");
+		check(armed_us == i2c_engine_timeout_us(&bad) && deadline_us == armed_at + armed_us, "the timer runs from the START");
+		expire();
+		if(bad.status != I2C_TIMEOUT || good.status != I2C_DONE || i2c_stats.timeouts != before.timeouts + 1 ||
+				memcmp(rx2, &mem[REG_XHI], XYZ_BYTES) != 0)
+		{
+			check(0, "a timeout resets the bus and the next transaction completes");
+			break;
+		}
+	}
+	check(deadline_us < 0, "the timer is stopped after the last transaction");
+}
+
+/*
+ * @name   timing_checks
+ * @brief  No healthy transaction times out, at 100 kHz, up to the MMA8451 FIFO
+ *
+ * @param  void
+ * @return void
+ */
+static void timing_checks()
+{
+	static const uint8_t xhi = REG_XHI;
+	static uint8_t fifo[FIFO_BYTES];
+	i2c_xfer_t xfer;
+	uint32_t before;
+	double start;
+
+	reset_model();
+	overruns = 0;
+	setup(&xfer, MMA_ADDR, &xhi, 1, fifo, FIFO_BYTES, NULL);
+	start = now_us;
+	before = irqs;
+	submit(&xfer);
+	printf("%d-byte FIFO read%s: %u I2C interrupts, %.0f us at 100 kHz against a %u us timeout\n", FIFO_BYTES,
+			use_dma ? " by DMA" : "", irqs - before, now_us - start, i2c_engine_timeout_us(&xfer));
+	check(xfer.status == I2C_DONE && overruns == 0 && memcmp(fifo, &mem[REG_XHI], FIFO_BYTES) == 0,
+			"a FIFO read at 100 kHz finishes inside its timeout");
+}
+
+/*
+ * @name   random_checks
+ * @brief  Random transactions queued in random batches against a copy of the device registers
+ *
+ * Also times the engine and model on the host
+ *
+ * @param  void
+ * @return void
+ */
+static void random_checks()
+{
+	static uint8_t tx[QUEUED][MAX_LEN + 1], rx[QUEUED][MAX_LEN], expect[QUEUED][MAX_LEN];
+	uint8_t shadow[sizeof(mem)], shadow_pointer = 0;
+	i2c_xfer_t xfer[QUEUED];
+	uint32_t errors = 0, done = 0, irqs_before;
+	struct timespec t0, t1;
+	double ns;
+
+	reset_model();
+	memcpy(shadow, mem, sizeof(mem));
+	srand(21);
+	irqs_before = irqs;
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+	while(done < RANDOM_XFERS)
+	{
+		int batch = 1 + rand() % QUEUED;
+
+		for(int b = 0; b < batch; b++)
+		{
+			int kind = rand() % 3, len = 1 + rand() % MAX_LEN;
+			uint8_t reg = (uint8_t)rand();
+
+			tx[b][0] = reg;
+			for(int i = 1; i <= len; i++)
+				tx[b][i] = (uint8_t)rand();
+			if(kind == 0) //Write
+			{
+				setup(&xfer[b], MMA_ADDR, tx[b], (uint8_t)(len + 1), NULL, 0, NULL);
+				for(int i = 0; i < len; i++)
+					shadow[(uint8_t)(reg + i)] = tx[b][i + 1];
+				shadow_pointer = (uint8_t)(reg + len);
+			}
+			else
+			{
+				if(kind == 1) //Write-then-read
+				{
+					setup(&xfer[b], MMA_ADDR, tx[b], 1, rx[b], (uint8_t)len, NULL);
+					shadow_pointer = reg;
+				}
+				else          //Burst read
+					setup(&xfer[b], MMA_ADDR, NULL, 0, rx[b], (uint8_t)len, NULL);
+				for(int i = 0; i < len; i++)
+					expect[b][i] = shadow[shadow_pointer++];
+			}
+			i2c_engine_submit(&xfer[b]);
+		}
+		bus_run();
+		for(int b = 0; b < batch; b++)
+		{
+			errors += xfer[b].status != I2C_DONE;
+			if(xfer[b].rx_len)
+				errors += memcmp(rx[b], expect[b], xfer[b].rx_len) != 0;
+		}
+		done += batch;
+	}
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	ns = ((t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec)) / (irqs - irqs_before);
+	check(errors == 0 && memcmp(shadow, mem, sizeof(mem)) == 0, "random queued transactions match a copy of the registers");
+	printf("%u random transactions%s: %u errors, %.1f ns/interrupt with the model\n", done, use_dma ? " by DMA" : "", errors,
+			ns);
+}
+
+int main()
+{
+	for(use_dma = 0; use_dma <= 1; use_dma++)
+	{
+		memset(&i2c_stats, 0, sizeof(i2c_stats));
+		kind_checks();
+		queue_checks();
+		fault_checks();
+		timing_checks();
+		random_checks();
+	}
+	check(violations == 0, "the engine keeps to the bus protocol");
+
+	printf("%s\n", failures ? "I2C checks FAILED" : "I2C checks passed");
+	return failures ? 1 : 0;
+}
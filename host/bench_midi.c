@@ -0,0 +1,560 @@
+/*
+ * @file        bench_midi.c
+ * @brief       Host test of the MIDI parser and of its note on latency
+ *
+ * Checks the parser on hand made byte sequences: running status, real time bytes inside a
+ * message, system exclusive, stray data bytes, velocity 0 note offs, sustain and controllers.
+ * Checks note tuning against equal temperament and every pitch bend value against the
+ * exponential.
+ *
+ * Then replays Standard MIDI Files as the bytes UART0 would receive at MIDI_BAUD_RATE, with a
+ * real time clock byte slipped in after every few bytes, through midi_rx() and mixer_fill() one
+ * ring half at a time, as UART0_IRQHandler and DMA0_IRQHandler interleave them. A note on starts
+ * at the first refill after its last byte, which renders the half that plays next; its latency
+ * runs from its first byte going on the line to the first sample of that half, measured the way
+ * midi_uart.c measures it on the board. It has to stay under 2 ms at every output rate with the
+ * ring midi_ring_half() picks; the default ring is shown for comparison.
+ * The built-in file is format 1 with running status, tempo changes, system exclusive, bends and
+ * the sustain pedal; a file given on the command line is replayed at the default rate too.
+ *
+ * usage: bench_midi [file.mid]
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       gcc
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "midi.h"
+#include "mixer.h"
+#include "wavetable.h"
+#include "dma.h"
+#include "tpm.h"
+#include "smf.h"
+#include "check.h"
+
+#define LATENCY_US      (2000.0)   //Note on to first sample budget
+#define TUNING_CENTS    (0.01)     //Largest note tuning error
+#define BEND_CENTS      (0.05)     //Largest pitch bend error
+#define CLOCK_EVERY     (5)        //A timing clock byte ahead of every 5th byte on the line
+#define DIVISION        (96)       //Ticks per quarter note of the built-in file
+#define SIXTEENTH       (DIVISION / 4)
+#define BAR             (4 * DIVISION)
+#define BARS            (8)
+#define TRACK_BYTES     (8192)
+
+//A track of the built-in file being written
+typedef struct track
+{
+	uint8_t data[TRACK_BYTES];
+	uint32_t length;
+	uint32_t tick;       //Of the last event written
+	uint8_t running;     //Status of the last channel event, left out of the next one if equal
+} track_t;
+
+//An event to be written at a tick, so a track can be sorted before writing
+typedef struct timed
+{
+	uint32_t tick;
+	uint8_t bytes[3];
+	uint8_t length;
+} timed_t;
+
+//Latency of a replay
+typedef struct replay_stats
+{
+	uint32_t notes;
+	uint32_t stolen;     //Note ons whose voice a later note took before they were rendered
+	double worst_us;
+	double total_us;
+	double worst_byte_us; //From the last byte of the note on
+} replay_stats_t;
+
+/*
+ * @name   send
+ * @brief  Feeds bytes to the parser
+ *
+ * @param  const uint8_t *bytes, uint32_t n
+ * @return void
+ */
+static void send(const uint8_t *bytes, uint32_t n)
+{
+	for(uint32_t i = 0; i < n; i++)
+		midi_rx(bytes[i]);
+}
+
+#define SEND(...) do { static const uint8_t b_[] = { __VA_ARGS__ }; send(b_, sizeof(b_)); } while(0)
+
+/*
+ * @name   voice_of
+ * @brief  First voice sounding a note, released or not
+ *
+ * @param  uint8_t note
+ * @return int voice index, -1 for none
+ */
+static int voice_of(uint8_t note)
+{
+	for(int v = 0; v < MIXER_NUM_VOICES; v++)
+		if(mixer_voices[v].active && mixer_voices[v].note == note)
+			return v;
+	return -1;
+}
+
+/*
+ * @name   held
+ * @brief  Whether a note is sounding and not released
+ *
+ * @param  uint8_t note
+ * @return int
+ */
+static int held(uint8_t note)
+{
+	for(int v = 0; v < MIXER_NUM_VOICES; v++)
+		if(mixer_voices[v].active && mixer_voices[v].note == note && mixer_voices[v].env.stage != ENV_RELEASE)
+			return 1;
+	return 0;
+}
+
+/*
+ * @name   parser_checks
+ * @brief  Runs hand made byte sequences through the parser
+ *
+ * @param  void
+ * @return void
+ */
+static void parser_checks()
+{
+	output_sample_rate = OUTPUT_SAMPLE_RATE;
+	mixer_reset();
+	midi_reset();
+
+	SEND(0x3C, 0x40);
+	check(midi_stats.stray == 2 && midi_stats.messages == 0, "data bytes before any status are stray");
+	SEND(0x90, 0x3C, 0x64);
+	check(held(60) && midi_stats.note_ons == 1, "note on");
+	SEND(0x3E, 0x64);
+	check(held(62) && midi_stats.running == 1, "note on with running status");
+	SEND(0x40, 0xF8, 0x64);
+	check(held(64) && midi_stats.messages == 3, "real time byte inside a message");
+	SEND(0x3C, 0x00);
+	check(!held(60) && voice_of(60) >= 0 && midi_stats.note_offs == 1, "velocity 0 note on releases");
+	SEND(0x80, 0x3E, 0x40);
+	check(!held(62) && midi_stats.note_offs == 2, "note off");
+	SEND(0xF0, 0x7E, 0x7F, 0x09, 0x01, 0xF7, 0x43, 0x64);
+	check(!held(67) && midi_stats.note_ons == 3 && midi_stats.stray == 2,
+			"system exclusive is skipped and cancels running status");
+	SEND(0xC0, 0x02, 0x03);
+	check(midi_stats.programs == 2 && midi_wave() == 3 % WAVE_COUNT, "program change with running status");
+	SEND(0x90, 0x45, 0x50);
+	check(held(69) && mixer_voices[voice_of(69)].wave == 3 % WAVE_COUNT, "note plays the program's wave");
+
+	SEND(0xB0, 0x40, 0x7F, 0x90, 0x48, 0x64, 0x80, 0x48, 0x40);
+	check(held(72), "sustain pedal holds a released note");
+	SEND(0x90, 0x48, 0x64, 0x48, 0x00);
+	check(held(72), "sustain pedal holds a note struck again");
+	SEND(0xB0, 0x40, 0x00);
+	check(!held(72) && voice_of(72) >= 0, "sustain pedal up releases held notes");
+	SEND(0xB0, 0x07, 0x40);
+	check(mixer_master() == 64 * MIXER_VOLUME_MAX / MIXER_VELOCITY_MAX, "volume controller sets the master volume");
+	SEND(0xB0, 0x07, 0x7F);
+
+	SEND(0xE0, 0x7F, 0x7F);
+	check(midi_tuning_word(69) > dds_tuning_word(DDS_HZ(440), output_sample_rate) &&
+			mixer_voices[voice_of(69)].osc.tuning_word == midi_tuning_word(69), "pitch bend retunes sounding notes");
+	SEND(0xB0, 0x79, 0x00);
+	check(mixer_voices[voice_of(69)].osc.tuning_word == midi_tuning_word(69) &&
+			midi_tuning_word(69) == dds_tuning_word(DDS_HZ(440), output_sample_rate), "reset controllers centres the bend");
+	SEND(0xB0, 0x7B, 0x00);
+	check(!held(64) && !held(69), "all notes off");
+
+	output_sample_rate = OUTPUT_RATE_MIN;
+	midi_reset();
+	SEND(0x90, 0x6C, 0x64, 0x60, 0x64);
+	check(midi_stats.dropped == 1 && midi_stats.note_ons == 1 && held(96),
+			"notes above the Nyquist frequency are dropped");
+	output_sample_rate = OUTPUT_SAMPLE_RATE;
+	midi_reset();
+	printf("Parser: %s\n", failures ? "FAILED" : "running status, real time, sysex, sustain and controllers pass");
+}
+
+/*
+ * @name   tuning_checks
+ * @brief  Checks note tuning at several output rates and every pitch bend value
+ *
+ * @param  void
+ * @return void
+ */
+static void tuning_checks()
+{
+	static const uint32_t rates[] = { OUTPUT_RATE_MIN, 16000, 24000, 32000, OUTPUT_SAMPLE_RATE };
+	double worst = 0, worst_bend = 0;
+	uint32_t bad_bends = 0;
+	uint8_t bend[3] = { MIDI_PITCH_BEND };
+
+	for(uint32_t r = 0; r < sizeof(rates) / sizeof(rates[0]); r++)
+	{
+		output_sample_rate = rates[r];
+		midi_reset();
+		for(int note = 0; note < MIDI_NOTES; note++)
+		{
+			double hz = 440.0 * pow(2, (note - 69) / 12.0);
+			double exact = hz / rates[r] * 4294967296.0;
+			uint32_t word = midi_tuning_word(note);
+
+			if(2 * hz >= rates[r])
+			{
+				check(word == 0, "a note at or above the Nyquist frequency has no tuning word");
+				continue;
+			}
+			if(fabs(1200 * log2(word / exact)) > worst)
+				worst = fabs(1200 * log2(word / exact));
+		}
+	}
+	output_sample_rate = OUTPUT_SAMPLE_RATE;
+	midi_reset();
+	for(uint32_t value = 0; value < 2 * MIDI_BEND_CENTRE; value++)
+	{
+		double cents = MIDI_BEND_SEMITONES * 100.0 * ((double)value - MIDI_BEND_CENTRE) / MIDI_BEND_CENTRE;
+		double exact = 440.0 * pow(2, cents / 1200) / OUTPUT_SAMPLE_RATE * 4294967296.0;
+		double error;
+
+		bend[1] = value & 0x7F;
+		bend[2] = value >> 7;
+		send(bend, sizeof(bend));
+		error = fabs(1200 * log2(midi_tuning_word(69) / exact));
+		if(error > worst_bend)
+			worst_bend = error;
+		if(error > BEND_CENTS)
+			bad_bends++;
+	}
+	midi_reset();
+	printf("Tuning: worst note %.4f cents, worst of %d bend values %.4f cents\n", worst, 2 * MIDI_BEND_CENTRE, worst_bend);
+	check(worst <= TUNING_CENTS, "notes are within 0.01 cent of equal temperament");
+	check(bad_bends == 0, "pitch bends are within 0.05 cent");
+}
+
+/*
+ * @name   put_vlq
+ * @brief  Writes a variable length quantity
+ *
+ * @param  track_t *t, uint32_t value
+ * @return void
+ */
+static void put_vlq(track_t *t, uint32_t value)
+{
+	uint8_t groups[5];
+	int n = 0;
+
+	do
+	{
+		groups[n++] = value & 0x7F;
+		value >>= 7;
+	} while(value);
+	while(n--)
+		t->data[t->length++] = groups[n] | (n ? 0x80 : 0);
+}
+
+/*
+ * @name   put_event
+ * @brief  Writes an event at a tick, leaving out a repeated channel status
+ *
+ * @param  track_t *t, uint32_t tick, const uint8_t *bytes, uint32_t n
+ * @return void
+ */
+static void put_event(track_t *t, uint32_t tick, const uint8_t *bytes, uint32_t n)
+{
+	uint32_t first = 0;
+
+	put_vlq(t, tick - t->tick);
+	t->tick = tick;
+	if(bytes[0] < MIDI_SYSEX && bytes[0] == t->running)
+		first = 1;
+	t->running = (bytes[0] < MIDI_SYSEX) ? bytes[0] : 0;
+	memcpy(&t->data[t->length], bytes + first, n - first);
+	t->length += n - first;
+}
+
+/*
+ * @name   by_tick
+ * @brief  qsort() order of timed events, note offs first at the same tick
+ *
+ * @param  const void *a, const void *b
+ * @return int
+ */
+static int by_tick(const void *a, const void *b)
+{
+	const timed_t *x = a, *y = b;
+	int x_off = (x->bytes[0] & 0xF0) == MIDI_NOTE_OFF || ((x->bytes[0] & 0xF0) == MIDI_NOTE_ON && x->bytes[2] == 0);
+	int y_off = (y->bytes[0] & 0xF0) == MIDI_NOTE_OFF || ((y->bytes[0] & 0xF0) == MIDI_NOTE_ON && y->bytes[2] == 0);
+
+	if(x->tick != y->tick)
+		return (x->tick < y->tick) ? -1 : 1;
+	return y_off - x_off;
+}
+
+/*
+ * @name   put_timed
+ * @brief  Sorts timed events and writes them, then the end of track
+ *
+ * @param  track_t *t, timed_t *events, uint32_t n
+ * @return void
+ */
+static void put_timed(track_t *t, timed_t *events, uint32_t n)
+{
+	static const uint8_t end[] = { 0xFF, 0x2F, 0x00 };
+
+	qsort(events, n, sizeof(timed_t), by_tick);
+	for(uint32_t i = 0; i < n; i++)
+		put_event(t, events[i].tick, events[i].bytes, events[i].length);
+	put_event(t, BARS * BAR, end, sizeof(end));
+}
+
+/*
+ * @name   add
+ * @brief  Appends a timed channel event
+ *
+ * @param  timed_t *events, uint32_t *n, uint32_t tick, uint8_t status, uint8_t d0, uint8_t d1
+ * @return void
+ */
+static void add(timed_t *events, uint32_t *n, uint32_t tick, uint8_t status, uint8_t d0, uint8_t d1)
+{
+	uint8_t type = status & 0xF0;
+
+	events[*n].tick = tick;
+	events[*n].bytes[0] = status;
+	events[*n].bytes[1] = d0;
+	events[*n].bytes[2] = d1;
+	events[*n].length = (type == MIDI_PROGRAM || type == MIDI_CHANNEL_PRESSURE) ? 2 : 3;
+	(*n)++;
+}
+
+/*
+ * @name   build_test_file
+ * @brief  Writes the built-in format 1 file
+ *
+ * Track 0 is the tempo map: 120 bpm, then 200 bpm from bar 5. Track 1 plays two note chords,
+ * a bar each, released with velocity 0 note ons, with bend sweeps in bars 2 and 6, the sustain
+ * pedal in bar 3 and a GM reset up front. Track 2 plays sixteenth notes on channel 2 released
+ * with note offs.
+ *
+ * @param  uint32_t *size
+ * @return uint8_t * file, malloc'd
+ */
+static uint8_t *build_test_file(uint32_t *size)
+{
+	static const uint8_t tempo_map[][6] = {
+		{ 0xFF, 0x51, 0x03, 0x07, 0xA1, 0x20 },   //500000 us per quarter note
+		{ 0xFF, 0x51, 0x03, 0x04, 0x93, 0xE0 }    //300000
+	};
+	static const uint8_t gm_reset[] = { 0xF0, 0x05, 0x7E, 0x7F, 0x09, 0x01, 0xF7 };
+	static const uint8_t chords[BARS] = { 48, 53, 55, 48, 45, 50, 55, 48 };
+	static const uint8_t scale[] = { 72, 74, 76, 77, 79, 81, 83, 84 };
+	static track_t tracks[3];
+	static timed_t events[1024];
+	uint8_t header[] = { 'M', 'T', 'h', 'd', 0, 0, 0, 6, 0, 1, 0, 3, 0, DIVISION };
+	uint32_t n = 0, offset;
+	uint8_t *file;
+
+	memset(tracks, 0, sizeof(tracks));
+	put_event(&tracks[0], 0, tempo_map[0], sizeof(tempo_map[0]));
+	put_event(&tracks[0], 4 * BAR, tempo_map[1], sizeof(tempo_map[1]));
+	put_timed(&tracks[0], events, 0);
+
+	put_event(&tracks[1], 0, gm_reset, sizeof(gm_reset));
+	add(events, &n, 0, MIDI_PROGRAM, 1, 0);
+	add(events, &n, 0, MIDI_CONTROL, MIDI_CC_VOLUME, 100);
+	for(uint32_t bar = 0; bar < BARS; bar++)
+	{
+		uint32_t start = bar * BAR;
+
+		add(events, &n, start, MIDI_NOTE_ON, chords[bar], 80);
+		add(events, &n, start, MIDI_NOTE_ON, chords[bar] + 7, 70);
+		add(events, &n, start + BAR, MIDI_NOTE_ON, chords[bar], 0);
+		add(events, &n, start + BAR, MIDI_NOTE_ON, chords[bar] + 7, 0);
+		if(bar == 2 || bar == 6)
+		{
+			for(uint32_t t = 0; t <= BAR; t += 6)
+			{
+				uint32_t value = (uint32_t)(MIDI_BEND_CENTRE + (2 * MIDI_BEND_CENTRE - 1 - MIDI_BEND_CENTRE) *
+						sin(M_PI * t / BAR));
+
+				add(events, &n, start + t, MIDI_PITCH_BEND, value & 0x7F, value >> 7);
+			}
+		}
+		if(bar == 3)
+		{
+			add(events, &n, start + 1, MIDI_CONTROL, MIDI_CC_SUSTAIN, 127);
+			add(events, &n, start + BAR - 1, MIDI_CONTROL, MIDI_CC_SUSTAIN, 0);
+		}
+	}
+	put_timed(&tracks[1], events, n);
+
+	n = 0;
+	for(uint32_t t = 0; t < BARS * BAR; t += SIXTEENTH)
+	{
+		uint8_t note = scale[(t / SIXTEENTH) % sizeof(scale)];
+
+		add(events, &n, t, MIDI_NOTE_ON | 1, note, 90);
+		add(events, &n, t + SIXTEENTH * 3 / 4, MIDI_NOTE_OFF | 1, note, 64);
+	}
+	put_timed(&tracks[2], events, n);
+
+	*size = sizeof(header);
+	for(int t = 0; t < 3; t++)
+		*size += 8 + tracks[t].length;
+	file = malloc(*size);
+	memcpy(file, header, sizeof(header));
+	offset = sizeof(header);
+	for(int t = 0; t < 3; t++)
+	{
+		uint32_t length = tracks[t].length;
+		uint8_t chunk[] = { 'M', 'T', 'r', 'k', length >> 24, length >> 16, length >> 8, length };
+
+		memcpy(file + offset, chunk, sizeof(chunk));
+		memcpy(file + offset + sizeof(chunk), tracks[t].data, length);
+		offset += sizeof(chunk) + length;
+	}
+	return file;
+}
+
+/*
+ * @name   replay
+ * @brief  Replays bytes on the line through the parser and the mixer, one ring half at a time
+ *
+ * @param  const smf_wire_byte_t *wire, uint32_t n, uint32_t rate, uint32_t half, replay_stats_t *stats
+ * @return void
+ */
+static void replay(const smf_wire_byte_t *wire, uint32_t n, uint32_t rate, uint32_t half, replay_stats_t *stats)
+{
+	static uint16_t out[AUDIO_HALF_SIZE];
+	static struct { uint8_t note; double start_us, end_us; } pending[MIDI_NOTES];
+	double half_us = 1e6 * half / rate, sample_us = 1e6 / rate;
+	uint32_t next = 0, waiting = 0, note_ons;
+	uint8_t previous = 0;
+
+	memset(stats, 0, sizeof(*stats));
+	output_sample_rate = rate;
+	mixer_reset();
+	midi_reset();
+	for(uint64_t refill = 1; next < n || waiting; refill++)
+	{
+		double now = refill * half_us;
+
+		for(; next < n && wire[next].end_us <= now; next++)
+		{
+			if(next % CLOCK_EVERY == CLOCK_EVERY - 1)
+				midi_rx(MIDI_REAL_TIME);
+			note_ons = midi_stats.note_ons;
+			midi_rx(wire[next].byte);
+			if(midi_stats.note_ons != note_ons && waiting < MIDI_NOTES)
+			{
+				pending[waiting].note = previous;
+				pending[waiting].start_us = wire[next].start_us;
+				pending[waiting++].end_us = wire[next].end_us;
+			}
+			if(wire[next].byte < MIDI_REAL_TIME)
+				previous = wire[next].byte;
+		}
+		//This refill renders the half DMA0 plays next, from one half on
+		for(uint32_t i = 0; i < waiting; i++)
+		{
+			double first = now + half_us + sample_us;
+			int v = voice_of(pending[i].note);
+
+			if(v < 0 || mixer_voices[v].env.stage != ENV_ATTACK)
+			{
+				stats->stolen++;
+				continue;
+			}
+			stats->notes++;
+			stats->total_us += first - pending[i].start_us;
+			if(first - pending[i].start_us > stats->worst_us)
+				stats->worst_us = first - pending[i].start_us;
+			if(first - pending[i].end_us > stats->worst_byte_us)
+				stats->worst_byte_us = first - pending[i].end_us;
+		}
+		waiting = 0;
+		mixer_fill(out, half);
+	}
+}
+
+/*
+ * @name   replay_file
+ * @brief  Replays a parsed file at output rates with the MIDI ring and the default ring
+ *
+ * @param  const smf_t *smf, const uint32_t *rates, uint32_t count, int strict (no stolen notes)
+ * @return void
+ */
+static void replay_file(const smf_t *smf, const uint32_t *rates, uint32_t count, int strict)
+{
+	smf_wire_byte_t *wire;
+	uint32_t n = smf_wire(smf, MIDI_BAUD_RATE, MIDI_UART_BITS, &wire);
+
+	printf("  %u messages, %u channel, %u tempo changes, %u bytes on the line at %d baud, %.2f s\n", smf->count,
+			smf->channel_messages, smf->tempo_changes, n, MIDI_BAUD_RATE, n ? wire[n - 1].end_us / 1e6 : 0);
+	for(uint32_t r = 0; r < count; r++)
+	{
+		uint32_t half = midi_ring_half(rates[r]);
+		replay_stats_t s, d;
+
+		replay(wire, n, rates[r], AUDIO_HALF_SIZE, &d);
+		replay(wire, n, rates[r], half, &s);
+		printf("  %5u Hz, ring 2 x %2u: %4u notes, latency mean %6.1f us, worst %6.1f us (%6.1f from the last byte); "
+				"2 x %d ring worst %6.1f us\n", rates[r], half, s.notes, s.notes ? s.total_us / s.notes : 0, s.worst_us,
+				s.worst_byte_us, AUDIO_HALF_SIZE, d.worst_us);
+		if(s.worst_us >= LATENCY_US)
+		{
+			printf("FAIL: note on latency %.1f us at %u Hz\n", s.worst_us, rates[r]);
+			failures++;
+		}
+		if(strict)
+		{
+			check(s.stolen == 0, "every note on is rendered");
+			check(midi_stats.messages == smf->channel_messages && midi_stats.stray == 0 && midi_stats.running > 0,
+					"every channel message is parsed, with running status");
+		}
+		else if(s.stolen)
+			printf("  %u note ons had their voice taken before they were rendered\n", s.stolen);
+	}
+	free(wire);
+}
+
+int main(int argc, char *argv[])
+{
+	static const uint32_t rates[] = { OUTPUT_RATE_MIN, 16000, 24000, 32000, OUTPUT_SAMPLE_RATE };
+	uint32_t size;
+	uint8_t *file;
+	smf_t smf;
+
+	parser_checks();
+	tuning_checks();
+
+	file = build_test_file(&size);
+	check(smf_parse(file, size, &smf), "the built-in file parses");
+	printf("Built-in format 1 file, %u bytes:\n", size);
+	replay_file(&smf, rates, sizeof(rates) / sizeof(rates[0]), 1);
+	smf_free(&smf);
+	free(file);
+
+	if(argc > 1)
+	{
+		if(!smf_load(argv[1], &smf))
+		{
+			printf("FAIL: %s is not a format 0 or 1 MIDI file\n", argv[1]);
+			failures++;
+		}
+		else
+		{
+			printf("%s:\n", argv[1]);
+			replay_file(&smf, &rates[sizeof(rates) / sizeof(rates[0]) - 1], 1, 0);
+			smf_free(&smf);
+		}
+	}
+
+	printf("%s\n", failures ? "MIDI checks FAILED" : "MIDI checks passed");
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,297 @@
+/*
+ * @file        bench_mixer.c
+ * @brief       Host benchmark of the polyphonic voice mixer
+ *
+ * Measures mixer_fill() cost for 0..MIXER_NUM_VOICES active voices, checks that the sum
+ * saturates instead of wrapping and that voice stealing takes the oldest note.
+ * Checks the output gain stage: the soft clip curve, voice and master volume, and the level
+ * and cost of TPDF dither.
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       gcc
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <time.h>
+#include <math.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "mixer.h"
+#include "wavetable.h"
+#include "tone_to_sample.h"
+#include "tpm.h"
+
+#define BENCH_SAMPLES  (4800000) //100 s of audio
+#define CLIP_RANGE     (4 * 32768)
+#define BEND_CODES     (512)         //Least DAC codes of input the soft clip bends over
+#define DITHER_SAMPLES (480000)
+#define DITHER_LOW     (120.0 / 256) //Share of TPDF draws below 0: sums of two 4-bit draws under 15
+
+/*
+ * @name   time_fill
+ * @brief  Times mixer_fill() over BENCH_SAMPLES
+ *
+ * @param  double *ns (per sample), double *tsc (cycles per sample)
+ * @return void
+ */
+static void time_fill(double *ns, double *tsc)
+{
+	static uint16_t out[MIXER_BLOCK_SIZE];
+	struct timespec t0, t1;
+	uint64_t c0 = 0, c1 = 0;
+
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+#if defined(__x86_64__) || defined(__i386__)
+	c0 = __rdtsc();
+#endif
+	for(uint32_t n = 0; n < BENCH_SAMPLES; n += MIXER_BLOCK_SIZE)
+		mixer_fill(out, MIXER_BLOCK_SIZE);
+#if defined(__x86_64__) || defined(__i386__)
+	c1 = __rdtsc();
+#endif
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	*ns = ((t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec)) / BENCH_SAMPLES;
+	*tsc = (double)(c1 - c0) / BENCH_SAMPLES;
+}
+
+/*
+ * @name   peak
+ * @brief  Largest distance from midscale of the DAC codes mixed over a number of blocks
+ *
+ * @param  int blocks
+ * @return int DAC codes
+ */
+static int peak(int blocks)
+{
+	uint16_t out[MIXER_BLOCK_SIZE];
+	int largest = 0;
+
+	for(int b = 0; b < blocks; b++)
+	{
+		mixer_fill(out, MIXER_BLOCK_SIZE);
+		for(int j = 0; j < MIXER_BLOCK_SIZE; j++)
+		{
+			int d = abs((int)out[j] - DDS_DAC_MIDSCALE);
+			if(d > largest)
+				largest = d;
+		}
+	}
+	return largest;
+}
+
+/*
+ * @name   span
+ * @brief  Checks one voice at full level peaks at the knee, on the straight line
+ *
+ * Each code of a sustained sine must be the straight conversion of the oscillator's sample scaled
+ * by MIXER_HEADROOM, give or take the rounding of its Q15 level, so the soft clip leaves it alone.
+ *
+ * @param  const tone_t *tone (a sine, sounding at full level)
+ * @return int failures
+ */
+static int span(const tone_t *tone)
+{
+	uint16_t out[MIXER_BLOCK_SIZE];
+	int lowest = 4095, highest = 0, bent = 0, reach = MIXER_HEADROOM >> DDS_DAC_SHIFT;
+	double phase_step = (double)mixer_voices[0].osc.tuning_word / 4294967296.0;
+
+	for(int b = 0; b < 40; b++)
+	{
+		uint32_t phase = mixer_voices[0].osc.phase;
+
+		mixer_fill(out, MIXER_BLOCK_SIZE);
+		for(int j = 0; j < MIXER_BLOCK_SIZE; j++)
+		{
+			double x = MIXER_HEADROOM * sin(2 * M_PI * ((double)phase / 4294967296.0 + j * phase_step));
+			int line = (int)floor(x / (1 << DDS_DAC_SHIFT)) + DDS_DAC_MIDSCALE;
+
+			if(out[j] < lowest)
+				lowest = out[j];
+			if(out[j] > highest)
+				highest = out[j];
+			if(abs((int)out[j] - line) > 1)
+				bent++;
+		}
+	}
+	printf("One voice at full level: codes %d to %d, %d off the straight line\n", lowest, highest, bent);
+	if(abs(lowest - (DDS_DAC_MIDSCALE - reach - 1)) > 1 || abs(highest - (DDS_DAC_MIDSCALE + reach)) > 1 || bent)
+	{
+		printf("FAIL: one full-level voice does not reach the knee undistorted\n");
+		return 1;
+	}
+	return 0;
+}
+
+/*
+ * @name   check_gain_stage
+ * @brief  Checks soft clipping, volumes and dither
+ *
+ * @param  const tone_t *tone (a sine)
+ * @return int failures
+ */
+static int check_gain_stage(const tone_t *tone)
+{
+	static uint16_t out[MIXER_BLOCK_SIZE];
+	int failures = 0, full, half, quarter, voice_half;
+	int32_t flat;
+	uint32_t low = 0;
+	double ns, tsc, dither_ns, dither_tsc;
+
+	//Soft clip: unchanged below the knee, then rising no faster than 1:1 onto full scale, odd
+	for(int32_t x = -CLIP_RANGE; x < CLIP_RANGE; x++)
+	{
+		int32_t y = mixer_soft_clip(x), next = mixer_soft_clip(x + 1);
+		if((x >= -MIXER_CLIP_KNEE && x <= MIXER_CLIP_KNEE && y != x) || next < y || next - y > 1 ||
+				y > 32767 || y < -32767 || mixer_soft_clip(-x) != -y)
+		{
+			printf("FAIL: soft clip %d -> %d, %d -> %d\n", x, y, x + 1, next);
+			failures++;
+			break;
+		}
+	}
+	//A soft knee: the bend takes several hundred DAC codes of input to flatten onto full scale
+	for(flat = MIXER_CLIP_KNEE; flat < CLIP_RANGE && mixer_soft_clip(flat) < 32767; flat++);
+	printf("Soft clip: knee %d, %d -> %d, full scale from %d, %d DAC codes past the knee\n", MIXER_CLIP_KNEE, 32767,
+			mixer_soft_clip(32767), flat, (flat - MIXER_CLIP_KNEE) >> DDS_DAC_SHIFT);
+	if(((flat - MIXER_CLIP_KNEE) >> DDS_DAC_SHIFT) < BEND_CODES)
+	{
+		printf("FAIL: the soft clip flattens within %d DAC codes of the knee\n", BEND_CODES);
+		failures++;
+	}
+
+	//Volumes scale a sustained sine; a full-level voice peaks at the knee and below it the output is linear in them
+	mixer_reset();
+	mixer_note_on(0, tone, MIXER_VELOCITY_MAX);
+	peak(20);                                  //Attack
+	full = peak(20);
+	if(span(tone) != 0)
+		failures++;
+	mixer_set_master(MIXER_VOLUME_MAX / 2);
+	half = peak(20);
+	mixer_set_master(MIXER_VOLUME_MAX / 4);
+	quarter = peak(20);
+	mixer_set_master(MIXER_VOLUME_MAX);
+	mixer_set_volume(0, MIXER_VOLUME_MAX / 2);
+	voice_half = peak(20);
+	mixer_set_volume(0, MIXER_VOLUME_MAX);
+	printf("Volume peaks: full %d, master 1/2 %d, master 1/4 %d, voice 1/2 %d DAC codes\n", full, half,
+			quarter, voice_half);
+	if(abs(half - 2 * quarter) > 2 || abs(voice_half - half) > 1 || abs(full - 2 * half) > 2 ||
+			abs(full - (MIXER_HEADROOM >> DDS_DAC_SHIFT)) > 1)
+	{
+		printf("FAIL: volume is not a linear gain\n");
+		failures++;
+	}
+
+	//Silence: dither off is exact midscale, on is 1 LSB of triangular noise
+	mixer_reset();
+	mixer_set_dither(1);
+	for(uint32_t n = 0; n < DITHER_SAMPLES; n += MIXER_BLOCK_SIZE)
+	{
+		mixer_fill(out, MIXER_BLOCK_SIZE);
+		for(int j = 0; j < MIXER_BLOCK_SIZE; j++)
+		{
+			if(out[j] == DDS_DAC_MIDSCALE - 1)
+				low++;
+			else if(out[j] != DDS_DAC_MIDSCALE)
+			{
+				printf("FAIL: dithered silence gave %u\n", out[j]);
+				failures++;
+				break;
+			}
+		}
+	}
+	printf("Dither: %.4f of silent samples one code low, expected %.4f\n", (double)low / DITHER_SAMPLES, DITHER_LOW);
+	if((double)low / DITHER_SAMPLES < DITHER_LOW - 0.01 || (double)low / DITHER_SAMPLES > DITHER_LOW + 0.01)
+	{
+		printf("FAIL: dither is not triangular over 1 LSB\n");
+		failures++;
+	}
+
+	//Output stage cost: no voices, so each sample is the clip test, the dither and the conversion
+	time_fill(&dither_ns, &dither_tsc);
+	mixer_set_dither(0);
+	time_fill(&ns, &tsc);
+	printf("Output stage: %.2f ns/sample %.2f TSC/sample, dither adds %.2f ns %.2f TSC\n", ns, tsc,
+			dither_ns - ns, dither_tsc - tsc);
+	mixer_fill(out, MIXER_BLOCK_SIZE);
+	for(int j = 0; j < MIXER_BLOCK_SIZE; j++)
+	{
+		if(out[j] != DDS_DAC_MIDSCALE)
+		{
+			printf("FAIL: undithered silence gave %u\n", out[j]);
+			failures++;
+			break;
+		}
+	}
+	return failures;
+}
+
+int main()
+{
+	static const int freqs[] = { WAVEFORM1_FREQ, WAVEFORM2_FREQ, WAVEFORM3_FREQ, WAVEFORM4_FREQ,
+			WAVEFORM5_FREQ, WAVEFORM6_FREQ, WAVEFORM7_FREQ, WAVEFORM8_FREQ };
+	tone_t tones[MIXER_NUM_VOICES + 1];
+	double ns, tsc, base_ns = 0, base_tsc = 0;
+	int failures = 0;
+
+	for(int i = 0; i <= MIXER_NUM_VOICES; i++)
+	{
+		tones[i].frequency = freqs[i % 8];
+		tones[i].wave = WAVE_SINE;
+		tone_init(&tones[i]);
+	}
+
+	printf("Mixer, %d voices, %d samples per block\n", MIXER_NUM_VOICES, MIXER_BLOCK_SIZE);
+	for(int v = 0; v <= MIXER_NUM_VOICES; v++)
+	{
+		if(v > 0)
+			mixer_note_on(v, &tones[v - 1], MIXER_VELOCITY_MAX);
+		time_fill(&ns, &tsc);
+		if(v == 0)
+		{
+			base_ns = ns;
+			base_tsc = tsc;
+			printf("%d voices: %6.2f ns/sample %6.2f TSC/sample\n", v, ns, tsc);
+		}
+		else
+		{
+			printf("%d voices: %6.2f ns/sample %6.2f TSC/sample, per voice %5.2f ns %5.2f TSC\n", v,
+					ns, tsc, (ns - base_ns) / v, (tsc - base_tsc) / v);
+		}
+	}
+
+	//All voices in phase at full scale must clip, not wrap
+	uint16_t out[MIXER_BLOCK_SIZE];
+	mixer_reset();
+	for(int v = 0; v < MIXER_NUM_VOICES; v++)
+		mixer_note_on(v, &tones[0], MIXER_VELOCITY_MAX);
+	for(int b = 0; b < 100; b++)
+	{
+		mixer_fill(out, MIXER_BLOCK_SIZE);
+		for(int j = 0; j < MIXER_BLOCK_SIZE; j++)
+		{
+			if(out[j] > 4095)
+			{
+				printf("FAIL: sample %u out of DAC range\n", out[j]);
+				failures++;
+			}
+		}
+	}
+
+	//With every voice busy the next note must steal the oldest (note 0, started first)
+	int stolen = mixer_note_on(99, &tones[1], MIXER_VELOCITY_MAX);
+	if(stolen != 0 || mixer_voices[0].note != 99)
+	{
+		printf("FAIL: stole voice %d instead of the oldest\n", stolen);
+		failures++;
+	}
+	failures += check_gain_stage(&tones[0]);
+
+	printf("%s\n", failures ? "Mixer checks FAILED" : "Mixer checks passed");
+	return failures ? 1 : 0;
+}
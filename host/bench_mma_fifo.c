@@ -0,0 +1,552 @@
+/*
+ * @file        bench_mma_fifo.c
+ * @brief       Host test and benchmark of the MMA8451 FIFO batch ring
+ *
+ * Checks the 14-bit axis decode over its whole range, the batch mean and the ring's order and
+ * full detection. Then runs a model of the sensor's 800 Hz FIFO in circular watermark mode with
+ * the target's drain logic: a level watermark interrupt disarmed while a drain is queued, a
+ * drain of F_STATUS and one batch taking bus time while samples keep coming, an immediate drain
+ * again when F_STATUS showed a second batch, and a main loop consuming batches with stalls.
+ * Every sample must reach the main loop in order unless a batch reports a FIFO overflow.
+ * Counts I2C transactions per sample against one single reading per main loop pass.
+ * Then checks the output data rate selection, and models spells of a still and a moving board
+ * read at the rate it selects: bus bytes and transactions against a fixed 800 Hz, the delay to
+ * 800 Hz once the board moves, main loop passes that find nothing to read, and the interrupt to
+ * reading latency. Times the batch mean.
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       gcc
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <math.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "mma_fifo.h"
+#include "check.h"
+
+#define AXIS_MIN      (-8192)
+#define AXIS_MAX      (8191)
+#define SAMPLE_US     (1250)      //800 Hz output data rate
+#define DRAIN_BYTES   (3 + sizeof(mma_batch_t)) //Addresses and register pointer, then the burst
+#define BYTE_US       (90)        //A byte and its acknowledge at 100 kHz, the slowest bus
+#define MODEL_US      (60000000)  //One minute of sensor time
+#define LOOP_MIN_US   (200)       //A main loop pass without a batch to process
+#define LOOP_MAX_US   (2000)
+#define STALL_EVERY   (5000)      //Passes between stalls: a command printing, a blocking benchmark
+#define STALL_US      (150000)    //Longer than the ring and the FIFO hold together
+#define SEQ_MASK      (0x1FFF)    //Z carries the sample number modulo 8192
+#define BENCH_BATCHES (10000000)
+#define READ_BYTES    (3 + 1 + sizeof(mma_sample_t)) //A data-ready read: the status and one sample
+#define RATE_BYTES    (6 * 3)     //Register writes of a rate change, address, register and value
+#define RATE_WRITES   (6)
+#define STILL_SPELL_MS  (10000)   //The board lies still, then is waved about
+#define MOVING_SPELL_MS (5000)
+#define WAVE_MS       (1000)      //Period of the waving
+#define WAVE_COUNTS   (2048)      //Amplitude of the waving, half a g
+#define NOISE_COUNTS  (40)        //Sensor noise of a reading, peak
+#define COUNTS_PER_G  (4096)
+
+/*
+ * @name   encode
+ * @brief  Data registers of a 14-bit count, left-justified as the MMA8451 outputs it
+ *
+ * @param  int32_t count, uint8_t *msb, uint8_t *lsb
+ * @return void
+ */
+static void encode(int32_t count, uint8_t *msb, uint8_t *lsb)
+{
+	uint16_t raw = (uint16_t)(count * 4);
+
+	*msb = (uint8_t)(raw >> 8);
+	*lsb = (uint8_t)raw;
+}
+
+/*
+ * @name   make_sample
+ * @brief  Sample number n of the model: Z holds n modulo 8192, X and Y sweep the full range
+ *
+ * @param  uint32_t n, mma_sample_t *s
+ * @return void
+ */
+static void make_sample(uint32_t n, mma_sample_t *s)
+{
+	encode((int32_t)((n * 37) % 16384) + AXIS_MIN, &s->x_msb, &s->x_lsb);
+	encode(AXIS_MAX - (int32_t)((n * 101) % 16384), &s->y_msb, &s->y_lsb);
+	encode((int32_t)(n & SEQ_MASK), &s->z_msb, &s->z_lsb);
+}
+
+/*
+ * @name   decode_checks
+ * @brief  Every 14-bit count decodes back, and batch means round towards zero
+ *
+ * @param  void
+ * @return void
+ */
+static void decode_checks()
+{
+	mma_batch_t batch;
+	uint32_t errors = 0;
+	int16_t x, y, z;
+
+	for(int32_t v = AXIS_MIN; v <= AXIS_MAX; v++)
+	{
+		uint8_t msb, lsb;
+
+		encode(v, &msb, &lsb);
+		errors += mma_axis(msb, lsb) != v;
+	}
+	check(errors == 0, "every 14-bit count decodes from its left-justified registers");
+
+	errors = 0;
+	srand(23);
+	for(int trial = 0; trial < 10000; trial++)
+	{
+		double sum[3] = { 0, 0, 0 };
+
+		for(int i = 0; i < MMA_FIFO_WATERMARK; i++)
+		{
+			int32_t v[3];
+
+			for(int a = 0; a < 3; a++)
+			{
+				v[a] = AXIS_MIN + rand() % (AXIS_MAX - AXIS_MIN + 1);
+				if(trial < 2) //All at one end of the range
+					v[a] = trial ? AXIS_MAX : AXIS_MIN;
+				sum[a] += v[a];
+			}
+			encode(v[0], &batch.sample[i].x_msb, &batch.sample[i].x_lsb);
+			encode(v[1], &batch.sample[i].y_msb, &batch.sample[i].y_lsb);
+			encode(v[2], &batch.sample[i].z_msb, &batch.sample[i].z_lsb);
+		}
+		mma_batch_mean(&batch, MMA_FIFO_WATERMARK, &x, &y, &z);
+		errors += x != (int32_t)(sum[0] / MMA_FIFO_WATERMARK) || y != (int32_t)(sum[1] / MMA_FIFO_WATERMARK) ||
+				z != (int32_t)(sum[2] / MMA_FIFO_WATERMARK);
+	}
+	check(errors == 0, "batch means match, rounded towards zero, at the ends of the range too");
+	mma_batch_mean(&batch, 1, &x, &y, &z);
+	check(x == mma_axis(batch.sample[0].x_msb, batch.sample[0].x_lsb) && z == mma_axis(batch.sample[0].z_msb,
+			batch.sample[0].z_lsb), "a single sample is its own mean");
+	check(sizeof(mma_batch_t) == 1 + 6 * MMA_FIFO_WATERMARK, "a batch is laid out as the burst from F_STATUS");
+}
+
+/*
+ * @name   ring_checks
+ * @brief  Batches come out in the order drained; a full ring refuses a slot and counts it
+ *
+ * @param  void
+ * @return void
+ */
+static void ring_checks()
+{
+	static mma_ring_t ring;
+	uint32_t in = 0, out = 0, errors = 0;
+	uint8_t samples;
+
+	mma_ring_reset(&ring);
+	memset(&mma_fifo_stats, 0, sizeof(mma_fifo_stats));
+	check(mma_ring_oldest(&ring, &samples) == NULL, "an empty ring has no batch");
+	for(int i = 0; i < MMA_RING_BATCHES; i++)
+	{
+		mma_batch_t *slot = mma_ring_slot(&ring);
+
+		slot->f_status = MMA_FIFO_WATERMARK;
+		mma_ring_drained(&ring, (in & 1) ? MMA_FIFO_WATERMARK : 1);
+		slot->sample[0].z_lsb = (uint8_t)in++;
+	}
+	check(mma_ring_slot(&ring) == NULL && mma_fifo_stats.ring_full == 1, "a full ring refuses a slot and counts it");
+
+	srand(24);
+	for(int i = 0; i < 100000; i++)
+	{
+		if(rand() & 1)
+		{
+			mma_batch_t *slot = mma_ring_slot(&ring);
+
+			if(slot)
+			{
+				uint8_t size = (in & 1) ? MMA_FIFO_WATERMARK : 1;
+
+				slot->f_status = (uint8_t)(MMA_FIFO_WATERMARK + rand() % (MMA_FIFO_SAMPLES - MMA_FIFO_WATERMARK + 1));
+				slot->sample[0].z_lsb = (uint8_t)in++;
+				errors += mma_ring_drained(&ring, size) != (size == MMA_FIFO_WATERMARK &&
+						(slot->f_status & MMA_F_CNT_MASK) >= 2 * MMA_FIFO_WATERMARK);
+			}
+		}
+		else
+		{
+			const mma_batch_t *batch = mma_ring_oldest(&ring, &samples);
+
+			if(batch)
+			{
+				errors += samples != ((out & 1) ? MMA_FIFO_WATERMARK : 1);
+				errors += batch->sample[0].z_lsb != (uint8_t)out++;
+				mma_ring_processed(&ring);
+			}
+		}
+		errors += ring.drained - ring.processed > MMA_RING_BATCHES;
+	}
+	check(errors == 0, "batches come out in order with their sizes, and only a second FIFO batch is reported");
+	check(mma_fifo_stats.batches == in, "every batch drained is counted");
+}
+
+//Sensor, bus and main loop model
+static mma_ring_t ring;
+static uint32_t fifo[MMA_FIFO_SAMPLES], fifo_head, fifo_count;
+static int f_ovf;                        //Dropped a sample since F_STATUS was last read
+static int armed, drain_queued;
+static mma_batch_t *drain_slot;
+static uint64_t drain_end_us;
+static uint32_t transactions;
+
+/*
+ * @name   sensor_sample
+ * @brief  The sensor adds sample n to its FIFO, dropping the oldest when full (circular mode)
+ *
+ * @param  uint32_t n
+ * @return void
+ */
+static void sensor_sample(uint32_t n)
+{
+	if(fifo_count == MMA_FIFO_SAMPLES)
+	{
+		fifo_head = (fifo_head + 1) % MMA_FIFO_SAMPLES;
+		fifo_count--;
+		f_ovf = 1;
+	}
+	fifo[(fifo_head + fifo_count) % MMA_FIFO_SAMPLES] = n;
+	fifo_count++;
+}
+
+/*
+ * @name   drain
+ * @brief  As the target's drain(): queues a drain into the ring unless it is full
+ *
+ * The status and samples are taken when the drain starts; the bus is busy until drain_end_us
+ *
+ * @param  uint64_t now
+ * @return void
+ */
+static void drain(uint64_t now)
+{
+	drain_slot = mma_ring_slot(&ring);
+	if(drain_slot == NULL)
+		return;
+	drain_slot->f_status = (uint8_t)((f_ovf ? MMA_F_OVF : 0) | fifo_count);
+	f_ovf = 0;
+	for(int i = 0; i < MMA_FIFO_WATERMARK; i++)
+	{
+		make_sample(fifo[fifo_head], &drain_slot->sample[i]);
+		fifo_head = (fifo_head + 1) % MMA_FIFO_SAMPLES;
+		fifo_count--;
+	}
+	drain_queued = 1;
+	drain_end_us = now + DRAIN_BYTES * BYTE_US;
+	transactions++;
+}
+
+/*
+ * @name   arm
+ * @brief  As the target's arm(): the watermark interrupt back on unless a drain is queued
+ *
+ * @param  void
+ * @return void
+ */
+static void arm()
+{
+	if(!drain_queued)
+		armed = 1;
+}
+
+/*
+ * @name   model_checks
+ * @brief  A minute of the sensor, the drains and a main loop with stalls
+ *
+ * @param  void
+ * @return void
+ */
+static void model_checks()
+{
+	uint64_t now = 0, next_sample = SAMPLE_US, next_pass = LOOP_MIN_US;
+	uint32_t produced = 0, consumed = 0, gaps = 0, unexplained = 0, errors = 0, passes = 0, polled_new = 0;
+	uint32_t expect = 0, last_polled = 0;
+
+	mma_ring_reset(&ring);
+	memset(&mma_fifo_stats, 0, sizeof(mma_fifo_stats));
+	armed = 1;
+	srand(25);
+	while(now < MODEL_US)
+	{
+		//Next event: a sample, the end of a drain or a main loop pass
+		now = next_sample;
+		if(drain_queued && drain_end_us < now)
+			now = drain_end_us;
+		if(next_pass < now)
+			now = next_pass;
+
+		if(now == next_sample)
+		{
+			sensor_sample(produced++);
+			next_sample += SAMPLE_US;
+		}
+		if(drain_queued && now == drain_end_us)
+		{
+			drain_queued = 0;
+			if(mma_ring_drained(&ring, MMA_FIFO_WATERMARK))
+				drain(now);
+			arm();
+		}
+		if(armed && fifo_count >= MMA_FIFO_WATERMARK)
+		{
+			armed = 0;
+			mma_fifo_stats.watermarks++;
+			drain(now);
+		}
+		if(now == next_pass)
+		{
+			uint8_t samples;
+			const mma_batch_t *batch = mma_ring_oldest(&ring, &samples);
+
+			passes++;
+			if(produced != last_polled) //A single reading this pass would have found a new sample
+				polled_new++;
+			last_polled = produced;
+			if(batch)
+			{
+				int16_t x, y, z;
+
+				if(((uint32_t)mma_axis(batch->sample[0].z_msb, batch->sample[0].z_lsb) & SEQ_MASK) != (expect & SEQ_MASK))
+				{
+					gaps++;
+					unexplained += !(batch->f_status & MMA_F_OVF);
+					expect = (uint32_t)mma_axis(batch->sample[0].z_msb, batch->sample[0].z_lsb);
+				}
+				for(int i = 0; i < MMA_FIFO_WATERMARK; i++)
+					errors += ((uint32_t)mma_axis(batch->sample[i].z_msb, batch->sample[i].z_lsb) & SEQ_MASK) !=
+							((expect + i) & SEQ_MASK);
+				mma_batch_mean(batch, samples, &x, &y, &z);
+				expect += MMA_FIFO_WATERMARK;
+				consumed += MMA_FIFO_WATERMARK;
+				mma_ring_processed(&ring);
+				arm();
+			}
+			next_pass = now + LOOP_MIN_US + rand() % (LOOP_MAX_US - LOOP_MIN_US);
+			if(passes % STALL_EVERY == 0)
+				next_pass += STALL_US;
+		}
+	}
+
+	check(errors == 0, "the samples of each batch are consecutive");
+	check(unexplained == 0, "every gap between batches is reported as a FIFO overflow");
+	check(gaps > 0 && gaps <= passes / STALL_EVERY + 1, "samples are only lost across the main loop stalls");
+	check(mma_fifo_stats.ring_full > 0, "a stall fills the ring");
+	check(produced - consumed < (uint32_t)(passes / STALL_EVERY + 1) * (STALL_US / SAMPLE_US + MMA_FIFO_SAMPLES),
+			"everything else reaches the main loop");
+	check(transactions * MMA_FIFO_WATERMARK == consumed + (ring.drained - ring.processed) * MMA_FIFO_WATERMARK,
+			"one I2C transaction a batch");
+	printf("FIFO: %u samples in %u batches, %u I2C transactions, %.3f a sample; %u losses across %u stalls\n", consumed,
+			consumed / MMA_FIFO_WATERMARK, transactions, (double)transactions / consumed, gaps, passes / STALL_EVERY);
+	printf("Single readings: %u transactions, one a main loop pass, for %u new samples, %.3f a new sample\n", passes,
+			polled_new, (double)passes / polled_new);
+	check((double)transactions / consumed * 10 <= (double)passes / polled_new, "an order of magnitude fewer transactions a sample");
+}
+
+/*
+ * @name   motion_checks
+ * @brief  Rate selection: still after MMA_STILL_MS, moving at once, slow drifts caught, noise not
+ *
+ * @param  void
+ * @return void
+ */
+static void motion_checks()
+{
+	mma_motion_t motion;
+	uint32_t ms, errors = 0;
+	int16_t z = COUNTS_PER_G;
+
+	mma_motion_reset(&motion, MMA_RATE_MOVING, 0, 0, z);
+	for(ms = MMA_MOVING_MS; ms < MMA_STILL_MS; ms += MMA_MOVING_MS)
+		errors += mma_motion_update(&motion, (ms & 1) ? MMA_MOTION_COUNTS : -MMA_MOTION_COUNTS, 0, z,
+				MMA_MOVING_MS) != MMA_RATE_MOVING;
+	check(errors == 0, "noise up to the threshold keeps the fast rate until MMA_STILL_MS");
+	check(mma_motion_update(&motion, 0, 0, z, MMA_MOVING_MS) == MMA_RATE_STILL, "MMA_STILL_MS still selects the slow rate");
+	check(mma_motion_update(&motion, 0, MMA_MOTION_COUNTS, z, MMA_STILL_READ_MS) == MMA_RATE_STILL,
+			"a change of the threshold is not motion");
+	check(mma_motion_update(&motion, 0, 0, z - MMA_MOTION_COUNTS - 1, MMA_STILL_READ_MS) == MMA_RATE_MOVING,
+			"a change past the threshold on any axis is motion at once");
+
+	mma_motion_reset(&motion, MMA_RATE_STILL, 0, 0, z);
+	errors = 0;
+	for(int16_t x = 10; mma_motion_update(&motion, x, 0, z, MMA_STILL_READ_MS) == MMA_RATE_STILL; x += 10)
+		errors += x > MMA_MOTION_COUNTS;
+	check(errors == 0, "a slow drift is motion once it adds up to the threshold");
+}
+
+/*
+ * @name   board_y
+ * @brief  Y reading of the rate model: noise while still, waved half a g either way while moving
+ *
+ * @param  uint64_t us, int *moving (set in a moving spell)
+ * @return int16_t
+ */
+static int16_t board_y(uint64_t us, int *moving)
+{
+	uint64_t spell = (us / 1000) % (STILL_SPELL_MS + MOVING_SPELL_MS);
+	int16_t noise = (int16_t)(rand() % (2 * NOISE_COUNTS + 1) - NOISE_COUNTS);
+
+	*moving = spell >= STILL_SPELL_MS;
+	if(!*moving)
+		return noise;
+	return (int16_t)(WAVE_COUNTS * sin(2 * 3.14159265358979 * (spell - STILL_SPELL_MS) / WAVE_MS)) + noise;
+}
+
+/*
+ * @name   rate_model
+ * @brief  Still and moving spells read at the selected rate against a fixed 800 Hz
+ *
+ * A reading is drained at the end of each batch at 800 Hz, or each sample at 12.5 Hz, and stored
+ * by the next main loop pass. A rate change takes the bus for its register writes and starts the
+ * new rate afresh.
+ *
+ * @param  void
+ * @return void
+ */
+static void rate_model()
+{
+	mma_motion_t motion;
+	mma_rate_t rate = MMA_RATE_MOVING;
+	uint64_t now = 0, next_reading = MMA_MOVING_MS * 1000, next_pass = LOOP_MIN_US, reading_us = 0;
+	uint64_t bytes = 0, fixed_bytes, still_us = 0, moved_us = 0, worst_delay_us = 0, latency_total_us = 0;
+	uint32_t transactions = 0, fixed_transactions, readings = 0, changes = 0, passes = 0, avoided = 0;
+	uint32_t latency_worst_us = 0, slow_spells = 0, spells = 0;
+	int pending = 0, was_moving = 0;
+
+	srand(26);
+	mma_motion_reset(&motion, MMA_RATE_MOVING, 0, 0, COUNTS_PER_G);
+	while(now < MODEL_US)
+	{
+		int moving;
+		int16_t y;
+
+		now = next_reading < next_pass ? next_reading : next_pass;
+		y = board_y(now, &moving);
+		if(moving && !was_moving)
+		{
+			moved_us = now;
+			spells++;
+		}
+		if(!moving && was_moving) //A still spell began: the slow rate must follow
+			still_us = now;
+		was_moving = moving;
+
+		if(now == next_reading)
+		{
+			pending = 1;
+			reading_us = now;
+			transactions++;
+			bytes += rate == MMA_RATE_MOVING ? DRAIN_BYTES : READ_BYTES;
+			next_reading += (rate == MMA_RATE_MOVING ? MMA_MOVING_MS : MMA_STILL_READ_MS) * 1000;
+		}
+		if(now == next_pass)
+		{
+			passes++;
+			if(pending)
+			{
+				mma_rate_t selected;
+				uint32_t latency = (uint32_t)(now - reading_us);
+
+				pending = 0;
+				readings++;
+				latency_total_us += latency;
+				if(latency > latency_worst_us)
+					latency_worst_us = latency;
+				selected = mma_motion_update(&motion, 0, y, COUNTS_PER_G, rate == MMA_RATE_MOVING ? MMA_MOVING_MS :
+						MMA_STILL_READ_MS);
+				if(selected != rate)
+				{
+					if(selected == MMA_RATE_MOVING && now - moved_us > worst_delay_us && moving)
+						worst_delay_us = now - moved_us;
+					if(selected == MMA_RATE_STILL && !moving && now - still_us >= MMA_STILL_MS * 1000)
+						slow_spells++;
+					rate = selected;
+					changes++;
+					transactions += RATE_WRITES;
+					bytes += RATE_BYTES;
+					next_reading = now + (rate == MMA_RATE_MOVING ? MMA_MOVING_MS : MMA_STILL_READ_MS) * 1000;
+				}
+			}
+			else
+				avoided++;
+			next_pass = now + LOOP_MIN_US + rand() % (LOOP_MAX_US - LOOP_MIN_US);
+		}
+	}
+
+	fixed_transactions = MODEL_US / (MMA_MOVING_MS * 1000);
+	fixed_bytes = (uint64_t)fixed_transactions * DRAIN_BYTES;
+	check(slow_spells == spells, "every still spell drops to the slow rate after MMA_STILL_MS");
+	check(changes == 2 * spells || changes == 2 * spells - 1, "one change into and out of each still spell");
+	check(worst_delay_us <= 2 * MMA_STILL_READ_MS * 1000, "motion brings back 800 Hz within two slow readings");
+	check(bytes * 2 < fixed_bytes, "under half the bus bytes of a fixed 800 Hz");
+	printf("Adaptive rate: %u transactions, %llu bus bytes; fixed 800 Hz: %u transactions, %llu bus bytes (%.0f%%)\n",
+			transactions, (unsigned long long)bytes, fixed_transactions, (unsigned long long)fixed_bytes,
+			100.0 * bytes / fixed_bytes);
+	printf("%u rate changes, 800 Hz back %.1f ms after motion at worst; %u readings, %u of %u passes avoided a read\n",
+			changes, worst_delay_us / 1000.0, readings, avoided, passes);
+	printf("Interrupt to reading: mean %llu us, worst %u us\n", (unsigned long long)(latency_total_us / readings),
+			latency_worst_us);
+}
+
+/*
+ * @name   bench
+ * @brief  Times the batch mean
+ *
+ * @param  void
+ * @return void
+ */
+static void bench()
+{
+	static mma_batch_t batch;
+	struct timespec t0, t1;
+	uint64_t c0 = 0, c1 = 0;
+	int16_t x, y, z;
+	int32_t sink = 0;
+	double ns;
+
+	for(int i = 0; i < MMA_FIFO_WATERMARK; i++)
+		make_sample((uint32_t)i * 977, &batch.sample[i]);
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+#if defined(__x86_64__) || defined(__i386__)
+	c0 = __rdtsc();
+#endif
+	for(uint32_t i = 0; i < BENCH_BATCHES; i++)
+	{
+		batch.sample[i & (MMA_FIFO_WATERMARK - 1)].x_lsb = (uint8_t)(i << 2);
+		mma_batch_mean(&batch, MMA_FIFO_WATERMARK, &x, &y, &z);
+		sink += x + y + z;
+	}
+#if defined(__x86_64__) || defined(__i386__)
+	c1 = __rdtsc();
+#endif
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	ns = ((t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec)) / BENCH_BATCHES;
+	printf("mma_batch_mean: %.2f ns/batch %.2f TSC/batch (%d)\n", ns, (double)(c1 - c0) / BENCH_BATCHES, sink & 1);
+}
+
+int main()
+{
+	decode_checks();
+	ring_checks();
+	model_checks();
+	motion_checks();
+	rate_model();
+	bench();
+
+	printf("%s\n", failures ? "FIFO checks FAILED" : "FIFO checks passed");
+	return failures ? 1 : 0;
+}
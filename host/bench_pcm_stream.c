@@ -0,0 +1,336 @@
+/*
+ * @file        bench_pcm_stream.c
+ * @brief       Host test of the PCM stream receiver against the stream_pcm sender over a PTY
+ *
+ * Writes a test WAV file, runs ./stream_pcm on the slave side of a pseudo terminal and plays the
+ * board on the master side in real time: every ring half period the bytes the line could have
+ * carried at the baud rate go to pcm_stream_rx(), as UART0_IRQHandler does, pcm_stream_fill()
+ * renders a ring half, as DMA0_IRQHandler does, and the running credit count goes back the way
+ * pcm_uart_stream() sends it. The line stalls for STALL_MS every STALL_EVERY_MS to stand in for
+ * a late sender.
+ *
+ * Checks that the samples played are bit exact with no underrun, overrun or bad frame for 12-bit
+ * and 8-bit streams, that corrupted checksums are counted and their frames dropped, that a sender
+ * ignoring its credits is caught as overruns, and that a line too slow for the stream underruns.
+ * Reports the fewest samples left in the buffer and the baud rate each stream needs.
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       gcc
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <termios.h>
+#include <time.h>
+#include <math.h>
+#include <sys/wait.h>
+
+#include "pcm_stream.h"
+#include "dma.h"
+
+#define TEST_WAV        "pcm_test.wav"
+#define SECONDS         (1)
+#define STALL_EVERY_MS  (250)
+#define STALL_MS        (40)
+#define TIMEOUT_FACTOR  (4)      //Real time allowed per second of audio
+#define LINE_BUFFER     (1 << 16)
+#define CORRUPT_EVERY   (10)
+#define CREDIT_RESEND_US (62500)  //pcm_uart_stream() repeats the credit once a SysTick tick
+#define BYTE_BUDGET     ((uint64_t)PCM_UART_BITS * 1000000)  //Line budget of a byte, baud times microseconds
+
+//A stream to play
+typedef struct pcm_case
+{
+	const char *name;
+	uint32_t rate;           //Hz
+	int bits;                //8 or 12
+	uint32_t baud;           //Line rate the bytes are delivered at
+	int corrupt_every;       //stream_pcm -c, 0 for none
+	int flood;               //stream_pcm -f
+} pcm_case_t;
+
+static int16_t wav[SECONDS * 48000];
+static uint16_t played[SECONDS * 48000 + AUDIO_HALF_SIZE];
+static uint8_t line[LINE_BUFFER];
+
+/*
+ * @name   write_test_wav
+ * @brief  Writes a chirp with noise, so every bit of every sample is exercised
+ *
+ * @param  uint32_t rate, uint32_t samples
+ * @return int 1 on success
+ */
+static int write_test_wav(uint32_t rate, uint32_t samples)
+{
+	FILE *f = fopen(TEST_WAV, "wb");
+	uint32_t data_bytes = samples * 2, riff_bytes = 36 + data_bytes, fmt_bytes = 16, byte_rate = rate * 2;
+	uint16_t pcm = 1, channels = 1, block_align = 2, bits = 16;
+	uint32_t seed = 1;
+
+	if(f == NULL)
+		return 0;
+	for(uint32_t i = 0; i < samples; i++)
+	{
+		double t = (double)i / rate;
+		seed = seed * 1664525 + 1013904223;
+		wav[i] = (int16_t)(24000 * sin(2 * M_PI * (200 + 1500 * t) * t) + (int16_t)(seed >> 16) / 8);
+	}
+	fwrite("RIFF", 1, 4, f);
+	fwrite(&riff_bytes, 4, 1, f);
+	fwrite("WAVEfmt ", 1, 8, f);
+	fwrite(&fmt_bytes, 4, 1, f);
+	fwrite(&pcm, 2, 1, f);
+	fwrite(&channels, 2, 1, f);
+	fwrite(&rate, 4, 1, f);
+	fwrite(&byte_rate, 4, 1, f);
+	fwrite(&block_align, 2, 1, f);
+	fwrite(&bits, 2, 1, f);
+	fwrite("data", 1, 4, f);
+	fwrite(&data_bytes, 4, 1, f);
+	fwrite(wav, 2, samples, f);
+	return fclose(f) == 0;
+}
+
+/*
+ * @name   expected_code
+ * @brief  DAC code sample i of the test file should play as
+ *
+ * @param  uint32_t i, int bits
+ * @return uint16_t
+ */
+static uint16_t expected_code(uint32_t i, int bits)
+{
+	return (bits == 8) ? (uint16_t)(((wav[i] >> 8) + 128) << 4) : (uint16_t)((wav[i] >> 4) + 2048);
+}
+
+/*
+ * @name   start_sender
+ * @brief  Opens a PTY and runs ./stream_pcm on its slave side
+ *
+ * @param  const pcm_case_t *c, int *master, pid_t *pid
+ * @return int 1 on success
+ */
+static int start_sender(const pcm_case_t *c, int *master, pid_t *pid)
+{
+	struct termios tio;
+	char bits[4], corrupt[12];
+	char *argv[10];
+	const char *slave;
+	int argc = 0;
+
+	*master = posix_openpt(O_RDWR | O_NOCTTY);
+	if(*master < 0 || grantpt(*master) || unlockpt(*master) || (slave = ptsname(*master)) == NULL)
+		return 0;
+	//Raw before the sender opens it, so no credit byte is held for a line discipline
+	if(tcgetattr(*master, &tio) == 0)
+	{
+		cfmakeraw(&tio);
+		tcsetattr(*master, TCSANOW, &tio);
+	}
+	snprintf(bits, sizeof(bits), "%d", c->bits);
+	snprintf(corrupt, sizeof(corrupt), "%d", c->corrupt_every);
+	argv[argc++] = "stream_pcm";
+	argv[argc++] = "-d";
+	argv[argc++] = (char *)slave;
+	argv[argc++] = "-w";
+	argv[argc++] = bits;
+	argv[argc++] = "-c";
+	argv[argc++] = corrupt;
+	if(c->flood)
+		argv[argc++] = "-f";
+	argv[argc++] = TEST_WAV;
+	argv[argc] = NULL;
+	fflush(stdout);
+	*pid = fork();
+	if(*pid == 0)
+	{
+		close(*master);
+		execv("./stream_pcm", argv);
+		_exit(127);
+	}
+	fcntl(*master, F_SETFL, O_NONBLOCK);
+	return *pid > 0;
+}
+
+/*
+ * @name   elapsed_us
+ * @brief  Microseconds since t0
+ *
+ * @param  const struct timespec *t0
+ * @return int64_t
+ */
+static int64_t elapsed_us(const struct timespec *t0)
+{
+	struct timespec t;
+
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return (int64_t)(t.tv_sec - t0->tv_sec) * 1000000 + (t.tv_nsec - t0->tv_nsec) / 1000;
+}
+
+/*
+ * @name   play_case
+ * @brief  Plays one stream from the sender in real time
+ *
+ * @param  const pcm_case_t *c, uint32_t *count (samples played), int *status (sender's exit status)
+ * @return void
+ */
+static void play_case(const pcm_case_t *c, uint32_t *count, int *status)
+{
+	uint32_t period_us = AUDIO_HALF_SIZE * 1000000ULL / c->rate;
+	uint32_t samples = SECONDS * c->rate, line_pos = 0, line_len = 0, sent = 0;
+	uint32_t resend = CREDIT_RESEND_US / period_us;
+	uint64_t line_budget = 0;
+	uint16_t out[AUDIO_HALF_SIZE];
+	struct timespec t0, next;
+	int master, first = 1;
+	pid_t pid;
+
+	*count = 0;
+	*status = -1;
+	pcm_stream_reset();
+	if(!start_sender(c, &master, &pid))
+		return;
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+	next = t0;
+	for(uint32_t tick = 0; !pcm_stream_ended() && elapsed_us(&t0) < (int64_t)TIMEOUT_FACTOR * SECONDS * 1000000 + 1000000; tick++)
+	{
+		uint32_t ms = (uint32_t)((uint64_t)tick * period_us / 1000), before = pcm_stream_stats.played, granted;
+		ssize_t n;
+
+		//The line: bytes the sender wrote, delivered no faster than the baud rate allows
+		if(line_pos == line_len)
+			line_pos = line_len = 0;
+		n = read(master, line + line_len, sizeof(line) - line_len);
+		if(n > 0)
+			line_len += n;
+		if(ms % STALL_EVERY_MS >= STALL_MS)
+			line_budget += (uint64_t)c->baud * period_us;
+		while(line_pos < line_len && line_budget >= BYTE_BUDGET)
+		{
+			pcm_stream_rx(line[line_pos++]);
+			line_budget -= BYTE_BUDGET;
+		}
+		if(line_pos == line_len)
+			line_budget %= BYTE_BUDGET; //An idle line carries nothing
+
+		//The DMA refill
+		pcm_stream_fill(out, AUDIO_HALF_SIZE);
+		for(uint32_t i = 0; i < pcm_stream_stats.played - before && *count < samples + AUDIO_HALF_SIZE; i++)
+			played[(*count)++] = out[i];
+
+		//The credit, when it changes and once a tick
+		granted = pcm_stream_credits();
+		if(first || granted != sent || tick % resend == 0)
+		{
+			uint8_t credit = (uint8_t)granted;
+			if(write(master, &credit, 1) == 1)
+				sent = granted;
+			first = 0;
+		}
+
+		next.tv_nsec += period_us * 1000;
+		while(next.tv_nsec >= 1000000000)
+		{
+			next.tv_nsec -= 1000000000;
+			next.tv_sec++;
+		}
+		clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL);
+	}
+	close(master);
+	waitpid(pid, status, 0);
+}
+
+int main()
+{
+	static const pcm_case_t cases[] = {
+		{ "12-bit, 16 kHz", 16000, 12, PCM_BAUD_RATE, 0, 0 },
+		{ "8-bit, 32 kHz", 32000, 8, PCM_BAUD_RATE, 0, 0 },
+		{ "12-bit, 16 kHz, bad checksums", 16000, 12, PCM_BAUD_RATE, CORRUPT_EVERY, 0 },
+		{ "12-bit, 16 kHz, credits ignored", 16000, 12, PCM_BAUD_RATE, 0, 1 },
+		{ "12-bit, 32 kHz, line too slow", 32000, 12, PCM_BAUD_RATE, 0, 0 },
+	};
+	static const uint32_t rates[] = { 8000, 16000, 24000, 32000, 48000 };
+	int failures = 0;
+
+	printf("Baud rate needed for a stream, %d sample frames, %d line bits per byte, UART0 at %d\n",
+			PCM_FRAME_SAMPLES, PCM_UART_BITS, PCM_BAUD_RATE);
+	for(uint32_t r = 0; r < sizeof(rates) / sizeof(rates[0]); r++)
+	{
+		double b12 = (PCM_FRAME_BYTES(PCM_FRAME_12, PCM_FRAME_SAMPLES) + PCM_OVERHEAD) * (double)rates[r] / PCM_FRAME_SAMPLES * PCM_UART_BITS;
+		double b8 = (PCM_FRAME_BYTES(PCM_FRAME_8, PCM_FRAME_SAMPLES) + PCM_OVERHEAD) * (double)rates[r] / PCM_FRAME_SAMPLES * PCM_UART_BITS;
+
+		printf("  %5u Hz: 12-bit %7.0f baud%s, 8-bit %7.0f baud%s\n", rates[r], b12, b12 > PCM_BAUD_RATE ? " (too fast)" : "",
+				b8, b8 > PCM_BAUD_RATE ? " (too fast)" : "");
+	}
+
+	for(uint32_t k = 0; k < sizeof(cases) / sizeof(cases[0]); k++)
+	{
+		const pcm_case_t *c = &cases[k];
+		uint32_t samples = SECONDS * c->rate, count, mismatches = 0, dropped = 0;
+		int status;
+
+		if(!write_test_wav(c->rate, samples))
+		{
+			printf("FAIL: cannot write %s\n", TEST_WAV);
+			return 1;
+		}
+		play_case(c, &count, &status);
+		printf("%s: %u frames, %u bad, %u overruns, %u underruns, %u samples played, lowest buffer %u of %d\n",
+				c->name, pcm_stream_stats.frames, pcm_stream_stats.bad_frames, pcm_stream_stats.overruns,
+				pcm_stream_stats.underruns, count, pcm_stream_stats.low_water, PCM_BUFFER_SIZE);
+		if(!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+		{
+			printf("FAIL: %s: stream_pcm did not finish\n", c->name);
+			failures++;
+			continue;
+		}
+
+		//Played samples against the file, less the frames the test drops on purpose
+		for(uint32_t i = 0, j = 0; i < samples; i++)
+		{
+			uint32_t frame = i / PCM_FRAME_SAMPLES;
+
+			if(c->corrupt_every && (frame + 1) % c->corrupt_every == 0)
+			{
+				dropped++;
+				continue;
+			}
+			if(c->flood)
+				break;
+			if(j >= count || played[j++] != expected_code(i, c->bits))
+				mismatches++;
+		}
+		if(c->flood)
+		{
+			if(pcm_stream_stats.overruns == 0)
+			{
+				printf("FAIL: %s: no overrun counted\n", c->name);
+				failures++;
+			}
+		}
+		else if(c->baud * 1.0 < (PCM_FRAME_BYTES(c->bits == 8 ? PCM_FRAME_8 : PCM_FRAME_12, PCM_FRAME_SAMPLES) +
+				PCM_OVERHEAD) * (double)c->rate / PCM_FRAME_SAMPLES * PCM_UART_BITS)
+		{
+			if(pcm_stream_stats.underruns == 0)
+			{
+				printf("FAIL: %s: no underrun counted\n", c->name);
+				failures++;
+			}
+		}
+		else if(mismatches || count != samples - dropped || pcm_stream_stats.underruns || pcm_stream_stats.overruns ||
+				pcm_stream_stats.bad_frames != (c->corrupt_every ? samples / PCM_FRAME_SAMPLES / c->corrupt_every : 0))
+		{
+			printf("FAIL: %s: %u samples differ, %u of %u played\n", c->name, mismatches, count, samples - dropped);
+			failures++;
+		}
+	}
+	remove(TEST_WAV);
+
+	printf("%s\n", failures ? "PCM stream checks FAILED" : "PCM stream checks passed");
+	return failures ? 1 : 0;
+}
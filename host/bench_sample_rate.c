@@ -0,0 +1,159 @@
+/*
+ * @file        bench_sample_rate.c
+ * @brief       Host test of switching the output sample rate while a tune plays
+ *
+ * Plays a pattern at 48 kHz, switches rate in the middle of a note with sequencer_set_sample_rate(),
+ * as audio_set_sample_rate() does on the target, and checks that the sounding note keeps its pitch,
+ * band-limited table and envelope times, that the next step starts at the same time in seconds,
+ * that later notes are tuned for the new rate, and that switching back restores every tuning word.
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       gcc
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "sequencer.h"
+#include "mixer.h"
+#include "tone_cache.h"
+#include "wavetable.h"
+#include "tpm.h"
+
+#define SWITCH_AT    (10000)  //Samples played at 48 kHz before the switch
+#define MAX_SAMPLES  (48000)
+
+/*
+ * @name   sounding_voice
+ * @brief  Newest active voice
+ *
+ * @param  void
+ * @return voice_t *, NULL when nothing sounds
+ */
+static voice_t *sounding_voice()
+{
+	voice_t *newest = NULL;
+
+	for(int v = 0; v < MIXER_NUM_VOICES; v++)
+	{
+		if(mixer_voices[v].active && (newest == NULL || (int32_t)(mixer_voices[v].age - newest->age) > 0))
+			newest = &mixer_voices[v];
+	}
+	return newest;
+}
+
+/*
+ * @name   check_voice
+ * @brief  Checks a voice plays a frequency at the current rate from the right table
+ *
+ * @param  const voice_t *voice, int frequency (Hz), uint8_t wave
+ * @return int failures
+ */
+static int check_voice(const voice_t *voice, int frequency, uint8_t wave)
+{
+	double hz = dds_frequency(voice->osc.tuning_word, output_sample_rate) / 65536.0;
+
+	printf("  %5u Hz: %4d Hz note plays %.4f Hz\n", output_sample_rate, frequency, hz);
+	if(hz < frequency - 0.01 || hz > frequency + 0.01 || voice->osc.table != wavetable_select(wave, voice->osc.tuning_word))
+	{
+		printf("FAIL: %d Hz note is off pitch or on the wrong band\n", frequency);
+		return 1;
+	}
+	return 0;
+}
+
+/*
+ * @name   play_until_note
+ * @brief  Renders one sample at a time until a new note starts
+ *
+ * A step starts inside the sequencer_fill() call that renders its first sample, so that sample
+ * is included in the count
+ *
+ * @param  uint32_t age (of the note sounding)
+ * @return uint32_t samples rendered, MAX_SAMPLES when no note started
+ */
+static uint32_t play_until_note(uint32_t age)
+{
+	uint16_t out;
+	uint32_t n;
+
+	for(n = 0; n < MAX_SAMPLES; n++)
+	{
+		voice_t *voice = sounding_voice();
+		if(voice != NULL && voice->age != age)
+			break;
+		sequencer_fill(&out, 1);
+	}
+	return n;
+}
+
+int main()
+{
+	static const adsr_params_t env = { 10, 100, ENV_Q15(0.5), 200 };
+	static const seq_step_t steps[] = { { 1175, 4, 127 }, { 587, 4, 127 } };
+	static const seq_pattern_t square = { steps, SEQ_LENGTH(steps), 1, WAVE_SQUARE, 120, &env };
+	static const uint32_t rates[] = { 16000, 24000, 32000, OUTPUT_SAMPLE_RATE };
+	uint16_t out[SWITCH_AT];
+	int failures = 0;
+
+	for(uint32_t r = 0; r < sizeof(rates) / sizeof(rates[0]); r++)
+	{
+		adsr_rates_t expected;
+		voice_t *voice;
+		uint32_t age, first, second;
+		double step_seconds = 60.0 / 120;  //4 ticks at 4 ticks a beat
+
+		sequencer_set_sample_rate(OUTPUT_SAMPLE_RATE);
+		mixer_reset();
+		sequencer_play(&square);
+		first = play_until_note(0);  //The first step is already sounding
+		sequencer_fill(out, SWITCH_AT);
+		voice = sounding_voice();
+		age = voice->age;
+
+		sequencer_set_sample_rate(rates[r]);
+		printf("48000 -> %u Hz after %d samples:\n", rates[r], SWITCH_AT);
+		failures += check_voice(voice, steps[0].frequency, WAVE_SQUARE);
+		envelope_rates(&expected, &env, rates[r]);
+		if(abs(voice->env.rates.release_step - expected.release_step) > 1 ||
+				abs(voice->env.rates.decay_step - expected.decay_step) > 1)
+		{
+			printf("FAIL: envelope steps %d/%d, expected %d/%d\n", voice->env.rates.decay_step,
+					voice->env.rates.release_step, expected.decay_step, expected.release_step);
+			failures++;
+		}
+
+		//The second step is due half a second after the first, whatever the rate in between
+		second = play_until_note(age);
+		{
+			double at = (double)(first + SWITCH_AT) / OUTPUT_SAMPLE_RATE + (double)(second - 1) / rates[r];
+			printf("  next step at %.5f s, expected %.5f s\n", at, step_seconds);
+			if(at < step_seconds - 1.0 / rates[r] || at > step_seconds + 1.0 / rates[r])
+			{
+				printf("FAIL: tempo changed across the switch\n");
+				failures++;
+			}
+		}
+		failures += check_voice(sounding_voice(), steps[1].frequency, WAVE_SQUARE);
+	}
+
+	//Round trip through every rate lands on the tuning words computed directly at 48 kHz
+	{
+		const tone_t *cached = tone_cache_get(1175, WAVE_SQUARE);
+		tone_t fresh = { 1175, WAVE_SQUARE };
+
+		for(uint32_t r = 0; r < sizeof(rates) / sizeof(rates[0]); r++)
+			sequencer_set_sample_rate(rates[r]);
+		tone_init(&fresh);
+		if(cached->tuning_word != fresh.tuning_word || cached->table != fresh.table)
+		{
+			printf("FAIL: cached tone %u after round trip, expected %u\n", cached->tuning_word, fresh.tuning_word);
+			failures++;
+		}
+	}
+	sequencer_stop();
+
+	printf("%s\n", failures ? "Sample rate checks FAILED" : "Sample rate checks passed");
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,145 @@
+/*
+ * @file        bench_sequencer.c
+ * @brief       Host test of the pattern sequencer
+ *
+ * Streams patterns through sequencer_fill() in DMA refill sized blocks, as DMA0_IRQHandler does,
+ * and recovers the exact sample each note started on from its oscillator phase. Checks step
+ * timing against the tempo, rests, velocity, looping, the end of a one-shot pattern, and that a
+ * tempo with a fractional number of samples per tick does not drift.
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       gcc
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "sequencer.h"
+#include "mixer.h"
+#include "wavetable.h"
+#include "dma.h"
+#include "tpm.h"
+
+#define MAX_EVENTS   (64)
+
+//A note on seen on the mixer
+typedef struct event
+{
+	uint32_t sample;     //Output sample the note started on
+	uint8_t note;
+	int32_t velocity;
+	int frequency;
+} event_t;
+
+static event_t events[MAX_EVENTS];
+static int event_count;
+static uint32_t worst_drift;  //Largest distance from the ideal start sample, for the tempo check
+
+/*
+ * @name   stream
+ * @brief  Renders samples through sequencer_fill() and records every new note on
+ *
+ * A fresh voice starts at phase 0, so its phase at the end of a block gives the start sample.
+ * With period set, also checks that note k started within a sample of k * period.
+ *
+ * @param  uint32_t samples, double period (samples between notes, 0 to skip the check)
+ * @return void
+ */
+static void stream(uint32_t samples, double period)
+{
+	static uint16_t out[AUDIO_HALF_SIZE];
+	uint32_t last_age = 0;
+
+	event_count = 0;
+	worst_drift = 0;
+	for(uint32_t end = AUDIO_HALF_SIZE; end <= samples; end += AUDIO_HALF_SIZE)
+	{
+		sequencer_fill(out, AUDIO_HALF_SIZE);
+		for(int v = 0; v < MIXER_NUM_VOICES; v++)
+		{
+			voice_t *voice = &mixer_voices[v];
+			if(!voice->active || (int32_t)(voice->age - last_age) <= 0)
+				continue;
+			uint32_t start = end - (voice->osc.phase + voice->osc.tuning_word / 2) / voice->osc.tuning_word;
+			if(event_count < MAX_EVENTS)
+			{
+				events[event_count].sample = start;
+				events[event_count].note = voice->note;
+				events[event_count].velocity = voice->velocity;
+				events[event_count].frequency = (int)((dds_frequency(voice->osc.tuning_word, OUTPUT_SAMPLE_RATE) + 0x8000) >> 16);
+			}
+			if(period > 0)
+			{
+				uint32_t drift = abs((int32_t)start - (int32_t)(event_count * period));
+				if(drift > worst_drift)
+					worst_drift = drift;
+			}
+			event_count++; //Counts past MAX_EVENTS, only the first are kept
+			last_age = voice->age;
+		}
+	}
+}
+
+int main()
+{
+	static const seq_step_t steps[] = { { 440, 4, 127 }, { SEQ_REST, 2, 0 }, { 587, 2, 64 } };
+	static const seq_pattern_t looped = { steps, SEQ_LENGTH(steps), 1, WAVE_SINE, 120, NULL };
+	static const seq_pattern_t once = { steps, SEQ_LENGTH(steps), 0, WAVE_SINE, 120, NULL };
+	static const seq_step_t beats[] = { { 440, 1, 127 } };
+	static const seq_pattern_t odd_tempo = { beats, 1, 1, WAVE_SINE, 110, NULL };
+	//120 bpm, 4 ticks a beat: 6000 samples a tick; steps at 0, 24000 (rest), 36000, loop at 48000
+	static const uint32_t expected[] = { 0, 36000, 48000, 84000, 96000, 132000 };
+	int count = sizeof(expected) / sizeof(expected[0]);
+	int failures = 0;
+
+	sequencer_play(&looped);
+	stream(140000, 0);
+	printf("Looped pattern at 120 bpm, %d-sample refills:\n", AUDIO_HALF_SIZE);
+	for(int i = 0; i < event_count && i < MAX_EVENTS; i++)
+	{
+		printf("  sample %6u: note %u %d Hz velocity %d\n", events[i].sample, events[i].note, events[i].frequency,
+				events[i].velocity);
+	}
+	if(event_count != count)
+	{
+		printf("FAIL: %d note ons, expected %d\n", event_count, count);
+		failures++;
+	}
+	for(int i = 0; i < event_count && i < count; i++)
+	{
+		int step = (i % 2) ? 2 : 0;
+		if(events[i].sample != expected[i] || events[i].note != step || events[i].frequency != steps[step].frequency ||
+				events[i].velocity != (int32_t)steps[step].velocity * 32767 / MIXER_VELOCITY_MAX)
+		{
+			printf("FAIL: event %d is not step %d at sample %u\n", i, step, expected[i]);
+			failures++;
+		}
+	}
+
+	//A one-shot pattern plays each step once and stops
+	mixer_reset();
+	sequencer_play(&once);
+	stream(100000, 0);
+	if(event_count != 2 || sequencer_current() != NULL)
+	{
+		printf("FAIL: one-shot pattern made %d note ons and is %s\n", event_count,
+				sequencer_current() ? "still playing" : "stopped");
+		failures++;
+	}
+
+	//110 bpm sixteenths are 6545.45 samples apart; after a minute every note must still be on time
+	mixer_reset();
+	sequencer_play(&odd_tempo);
+	stream(OUTPUT_SAMPLE_RATE * 60 - AUDIO_HALF_SIZE, OUTPUT_SAMPLE_RATE * 60.0 / (110 * SEQ_TICKS_PER_BEAT));
+	printf("110 bpm sixteenths: %d in 60 s, worst start %u samples from ideal\n", event_count, worst_drift);
+	if(event_count != 440 || worst_drift > 1)
+	{
+		printf("FAIL: tempo drifts\n");
+		failures++;
+	}
+	sequencer_stop();
+
+	printf("%s\n", failures ? "Sequencer checks FAILED" : "Sequencer checks passed");
+	return failures ? 1 : 0;
+}
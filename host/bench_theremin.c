@@ -0,0 +1,424 @@
+/*
+ * @file        bench_theremin.c
+ * @brief       Host test and benchmark of the theremin
+ *
+ * Checks the scale quantiser (nearest note and hysteresis at the midpoints), the tuning of every
+ * cent of the range, the angle mappings, and that dds_mix_glide() moves the tuning word every
+ * sample exactly as a per-sample retune would. Measures the portamento time constant from the
+ * output's zero crossings, checks the output never steps further between samples than the
+ * highest pitch sounding can, and times theremin_fill().
+ * Replays a reading arriving at every point of a ring half through the producer, one ring half
+ * at a time as DMA0_IRQHandler calls it, to find the first sample that changes: the producer's
+ * share of the sensor to pitch latency, which the board adds its I2C read time to.
+ * Plays the voice at full volume through a full echo and a resonant filter and checks the output
+ * stage keeps every code within the DAC's range.
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       gcc
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "theremin.h"
+#include "mixer.h"
+#include "effects.h"
+#include "wavetable.h"
+#include "dma.h"
+#include "tpm.h"
+#include "check.h"
+
+#define BENCH_SAMPLES  (4800000)   //100 s of audio
+#define GLIDE_SAMPLES  (OUTPUT_SAMPLE_RATE / 2)
+#define TUNING_CENTS   (0.05)
+#define GLIDE_ERROR    (0.15)      //Largest error of the measured time constant
+#define ROUNDING       (3)         //DAC codes of rounding and volume ramp between two samples
+#define FULL_ROLL      (THEREMIN_ROLL_SPAN)
+#define OCTAVE_ROLL    (THEREMIN_ROLL_SPAN / 2)
+#define LOUD           (THEREMIN_PITCH_FULL)
+#define DAC_MAX        (4095)      //Highest 12-bit DAC code
+
+static uint16_t out[GLIDE_SAMPLES];
+
+/*
+ * @name   quantiser_checks
+ * @brief  Every cent of the range snaps to its nearest scale note; midpoints hold the last note
+ *
+ * @param  void
+ * @return void
+ */
+static void quantiser_checks()
+{
+	static const int16_t notes[SCALE_COUNT][13] = {
+		{ 0 },
+		{ 0, 100, 200, 300, 400, 500, 600, 700, 800, 900, 1000, 1100, -1 },
+		{ 0, 200, 400, 500, 700, 900, 1100, -1 },
+		{ 0, 200, 400, 700, 900, -1 }
+	};
+	int32_t last = 0;
+
+	for(uint8_t scale = SCALE_CHROMATIC; scale < SCALE_COUNT; scale++)
+	{
+		for(int32_t cents = 0; cents <= THEREMIN_SPAN_CENTS; cents++)
+		{
+			int32_t q = theremin_quantise(cents, scale, -1), best = INT32_MAX, in_scale = 0;
+
+			for(int32_t octave = 0; octave <= THEREMIN_SPAN_CENTS; octave += 1200)
+			{
+				for(int i = 0; notes[scale][i] >= 0 && (i == 0 || notes[scale][i]); i++)
+				{
+					int32_t note = octave + notes[scale][i];
+
+					if(abs(cents - note) < best)
+						best = abs(cents - note);
+					if(note == q)
+						in_scale = 1;
+				}
+			}
+			if(!in_scale || abs(cents - q) != best)
+			{
+				printf("FAIL: %s scale puts %d cents on %d\n", theremin_scale_names[scale], cents, q);
+				failures++;
+				break;
+			}
+		}
+	}
+	check(theremin_quantise(1234, SCALE_OFF, -1) == 1234, "no quantiser passes the pitch through");
+
+	//Noise around the midpoint of C and C#, then a clear move
+	for(int32_t cents = 40; cents <= 56; cents += 2)
+		last = theremin_quantise(cents, SCALE_CHROMATIC, last);
+	check(last == 0, "hysteresis holds the last note near the midpoint");
+	last = theremin_quantise(60, SCALE_CHROMATIC, last);
+	check(last == 100, "a clear move changes the note");
+	last = theremin_quantise(44, SCALE_CHROMATIC, last);
+	check(last == 100, "hysteresis holds on the way back");
+	printf("Quantiser: chromatic, major and pentatonic snap every cent to the nearest note, %d cent hysteresis\n",
+			THEREMIN_HYSTERESIS);
+}
+
+/*
+ * @name   tuning_checks
+ * @brief  Checks the tuning word of every cent of the range against the exponential
+ *
+ * @param  void
+ * @return void
+ */
+static void tuning_checks()
+{
+	static const uint32_t rates[] = { OUTPUT_RATE_MIN, OUTPUT_SAMPLE_RATE };
+	double worst = 0;
+
+	for(uint32_t r = 0; r < sizeof(rates) / sizeof(rates[0]); r++)
+	{
+		output_sample_rate = rates[r];
+		theremin_start(SCALE_OFF, 0);
+		for(int32_t cents = 0; cents <= THEREMIN_SPAN_CENTS; cents++)
+		{
+			double exact = THEREMIN_BASE_HZ_Q16 / 65536.0 * pow(2, cents / 1200.0) / rates[r] * 4294967296.0;
+			double error = fabs(1200 * log2(theremin_tuning_word(cents) / exact));
+
+			if(error > worst)
+				worst = error;
+		}
+	}
+	output_sample_rate = OUTPUT_SAMPLE_RATE;
+	printf("Tuning: worst %.4f cents over %d cents at %d and %d Hz\n", worst, THEREMIN_SPAN_CENTS,
+			OUTPUT_RATE_MIN, OUTPUT_SAMPLE_RATE);
+	check(worst <= TUNING_CENTS, "every cent is within 0.05 cent");
+}
+
+/*
+ * @name   mapping_checks
+ * @brief  Checks the roll to pitch and pitch angle to volume mappings
+ *
+ * @param  void
+ * @return void
+ */
+static void mapping_checks()
+{
+	theremin_start(SCALE_CHROMATIC, 0);
+	check(theremin_set(0, 0) == 0, "level is C4");
+	check(theremin_set(FULL_ROLL, 0) == THEREMIN_SPAN_CENTS && theremin_set(-FULL_ROLL, 0) == THEREMIN_SPAN_CENTS,
+			"full roll either way is two octaves up");
+	check(theremin_set(2 * FULL_ROLL, 0) == THEREMIN_SPAN_CENTS, "roll past the span holds the top");
+	check(theremin_set(OCTAVE_ROLL, 0) == 1200, "half the roll span is an octave");
+
+	//Silent within the dead zone: the output stays at midscale
+	theremin_start(SCALE_CHROMATIC, 0);
+	theremin_set(OCTAVE_ROLL, THEREMIN_PITCH_DEAD);
+	theremin_fill(out, OUTPUT_SAMPLE_RATE / 10);
+	for(uint32_t i = 0; i < OUTPUT_SAMPLE_RATE / 10; i++)
+	{
+		if(out[i] != DDS_DAC_MIDSCALE)
+		{
+			check(0, "level pitch angle is silent");
+			break;
+		}
+	}
+	theremin_set(OCTAVE_ROLL, -LOUD);
+	theremin_fill(out, OUTPUT_SAMPLE_RATE / 10);
+	{
+		uint16_t lo = UINT16_MAX, hi = 0;
+
+		for(uint32_t i = OUTPUT_SAMPLE_RATE / 20; i < OUTPUT_SAMPLE_RATE / 10; i++)
+		{
+			lo = (out[i] < lo) ? out[i] : lo;
+			hi = (out[i] > hi) ? out[i] : hi;
+		}
+		printf("Mapping: %d degrees of roll an octave, full volume %u..%u DAC codes from %d degrees of pitch\n",
+				OCTAVE_ROLL / 100, lo, hi, LOUD / 100);
+		check(hi - lo > 2 * (MIXER_HEADROOM >> DDS_DAC_SHIFT) * 39 / 40, "full pitch angle is full volume, peaking at the knee");
+	}
+}
+
+/*
+ * @name   glide_sample_checks
+ * @brief  dds_mix_glide() against dds_sample() with the tuning word moved every sample
+ *
+ * @param  void
+ * @return void
+ */
+static void glide_sample_checks()
+{
+	int32_t mix[64] = { 0 };
+	dds_osc_t a = { 0x12345678, 40000000, dds_sine_table }, b = a;
+	int32_t word_step = -123457;
+	int same = 1;
+
+	dds_mix_glide(&a, mix, 64, 1 << 30, 0, word_step);
+	for(int i = 0; i < 64; i++)
+	{
+		int32_t s = dds_sample(&b);
+
+		b.tuning_word += word_step;
+		if(((s * ((1 << 30) >> 15)) >> 15) != mix[i])
+			same = 0;
+	}
+	check(same && a.phase == b.phase && a.tuning_word == b.tuning_word,
+			"dds_mix_glide() retunes every sample, phase continuously");
+}
+
+/*
+ * @name   period_hz
+ * @brief  Pitch of each cycle of the output from its rising zero crossings
+ *
+ * @param  const uint16_t *x, uint32_t n, double *at (sample of the middle of each cycle), double *hz
+ * @return uint32_t cycles found
+ */
+static uint32_t period_hz(const uint16_t *x, uint32_t n, double *at, double *hz)
+{
+	double last = -1;
+	uint32_t cycles = 0;
+
+	for(uint32_t i = 1; i < n; i++)
+	{
+		if(x[i - 1] < DDS_DAC_MIDSCALE && x[i] >= DDS_DAC_MIDSCALE)
+		{
+			double t = i - 1 + (double)(DDS_DAC_MIDSCALE - x[i - 1]) / (x[i] - x[i - 1]);
+
+			if(last >= 0)
+			{
+				at[cycles] = (t + last) / 2;
+				hz[cycles++] = output_sample_rate / (t - last);
+			}
+			last = t;
+		}
+	}
+	return cycles;
+}
+
+/*
+ * @name   glide_checks
+ * @brief  Measures the portamento time constant and the largest step between output samples
+ *
+ * Glides up an octave at full volume and finds when the pitch of a cycle has covered 1 - 1/e of
+ * the way, to within the two cycles either side of it
+ *
+ * @param  uint32_t glide_ms
+ * @return void
+ */
+static void glide_checks(uint32_t glide_ms)
+{
+	static double at[GLIDE_SAMPLES / 8], hz[GLIDE_SAMPLES / 8];
+	double from = THEREMIN_BASE_HZ_Q16 / 65536.0, to = 2 * from, target = from + (to - from) * (1 - exp(-1));
+	double tau_ms = -1, cycle_ms = 1000 / from + 1000 / to, bound = 2 * M_PI * to / OUTPUT_SAMPLE_RATE * 2047 + ROUNDING;
+	uint32_t cycles, worst = 0;
+
+	theremin_start(SCALE_CHROMATIC, glide_ms);
+	theremin_set(0, LOUD);
+	theremin_fill(out, OUTPUT_SAMPLE_RATE / 5);  //Volume up at C4
+	theremin_set(OCTAVE_ROLL, LOUD);
+	theremin_fill(out, GLIDE_SAMPLES);
+	cycles = period_hz(out, GLIDE_SAMPLES, at, hz);
+	for(uint32_t i = 1; i < cycles && tau_ms < 0; i++)
+	{
+		if(hz[i] >= target)
+		{
+			double t = (hz[i - 1] >= target) ? at[i] : at[i - 1] + (at[i] - at[i - 1]) * (target - hz[i - 1]) / (hz[i] - hz[i - 1]);
+
+			tau_ms = t * 1000.0 / OUTPUT_SAMPLE_RATE;
+		}
+	}
+	for(uint32_t i = 1; i < GLIDE_SAMPLES; i++)
+	{
+		uint32_t d = abs((int32_t)out[i] - out[i - 1]);
+
+		worst = (d > worst) ? d : worst;
+	}
+	printf("Glide %4u ms: C4 to C5 covers 63%% in %6.1f ms, worst step %u DAC codes of %.0f the pitch allows\n",
+			glide_ms, tau_ms, worst, bound);
+	if(tau_ms < glide_ms * (1 - GLIDE_ERROR) - cycle_ms || tau_ms > glide_ms * (1 + GLIDE_ERROR) + cycle_ms)
+	{
+		printf("FAIL: glide time constant %.1f ms, set to %u ms\n", tau_ms, glide_ms);
+		failures++;
+	}
+	check(worst <= bound, "the pitch changes without a step in the output");
+}
+
+/*
+ * @name   latency_checks
+ * @brief  Replays a reading at every point of a ring half and finds the first sample it changes
+ *
+ * The stream is rendered one ring half per refill; the half rendered at a refill plays from the
+ * next refill on, so output sample i reaches the DAC half + 1 sample periods after refill time i.
+ * A glide starts from the old pitch, so the first sample that differs is a few into the block.
+ *
+ * @param  uint32_t half (samples)
+ * @return void
+ */
+static void latency_checks(uint32_t half)
+{
+	static uint16_t base[4 * AUDIO_HALF_SIZE + OUTPUT_SAMPLE_RATE / 10], moved[4 * AUDIO_HALF_SIZE + OUTPUT_SAMPLE_RATE / 10];
+	uint32_t lead = OUTPUT_SAMPLE_RATE / 10, worst = 0, best = UINT32_MAX;
+	double total = 0;
+
+	for(uint32_t t = 0; t < half; t++)
+	{
+		uint32_t done = 0, first;
+
+		for(int run = 0; run < 2; run++)
+		{
+			uint16_t *x = run ? moved : base;
+
+			theremin_start(SCALE_OFF, THEREMIN_GLIDE_MS);
+			theremin_set(0, LOUD);
+			for(done = 0; done < lead + 4 * half; done += half)
+			{
+				//The reading arrives t samples into the ring half after the lead in
+				if(run && done == lead + half)
+					theremin_set(OCTAVE_ROLL, LOUD);
+				theremin_fill(&x[done], half);
+			}
+		}
+		for(first = lead; first < done && base[first] == moved[first]; first++);
+		//Reading at refill time lead + t, change rendered at refill lead + half
+		first = first + half + 1 - (lead + t);
+		worst = (first > worst) ? first : worst;
+		best = (first < best) ? first : best;
+		total += first;
+	}
+	printf("Reading to first changed sample, ring 2 x %2u at %d Hz: %.2f..%.2f ms, mean %.2f ms\n", half,
+			OUTPUT_SAMPLE_RATE, best * 1000.0 / OUTPUT_SAMPLE_RATE, worst * 1000.0 / OUTPUT_SAMPLE_RATE,
+			total / half * 1000.0 / OUTPUT_SAMPLE_RATE);
+	check(worst <= 2 * half + THEREMIN_BLOCK_SIZE, "a reading is heard within two ring halves and a glide block");
+}
+
+/*
+ * @name   effects_range_checks
+ * @brief  A full-level note through the loudest echo and a resonant low-pass stays within 0..4095
+ *
+ * The filter peaks at the note's pitch and the echo repeats it at unity, so the effects output is
+ * well over full scale and only the output stage keeps the codes from wrapping
+ *
+ * @param  void
+ * @return void
+ */
+static void effects_range_checks()
+{
+	effects_settings_t loud = { FILTER_LOWPASS, 262, EFFECTS_Q_MAX, 100, EFFECTS_FEEDBACK_MAX, EFFECTS_LEVEL_MAX };
+	effects_settings_t off = { FILTER_OFF, 0, EFFECTS_Q_DEFAULT, 0, 0, 0 };
+	uint32_t top = 0, highest = 0;
+
+	effects_set_sample_rate(OUTPUT_SAMPLE_RATE);
+	effects_configure(&loud);
+	for(int dither = 0; dither < 2; dither++)
+	{
+		mixer_set_dither(dither);
+		theremin_start(SCALE_OFF, 0);
+		theremin_set(0, LOUD);
+		for(uint32_t done = 0; done < 4 * GLIDE_SAMPLES; done += GLIDE_SAMPLES)
+		{
+			theremin_fill(out, GLIDE_SAMPLES);
+			for(uint32_t i = 0; i < GLIDE_SAMPLES; i++)
+			{
+				highest = (out[i] > highest) ? out[i] : highest;
+				top += (out[i] == DAC_MAX);
+			}
+		}
+	}
+	mixer_set_dither(0);
+	effects_configure(&off);
+	printf("Echo at unity and a Q %.2f low-pass: highest code %u, %u samples at full scale, %u filter and %u echo clips\n",
+			EFFECTS_Q_MAX / 100.0, highest, top, effects_stats.filter_clips, effects_stats.echo_clips);
+	check(highest <= DAC_MAX && top, "the output stage clips the effects to the DAC range");
+}
+
+/*
+ * @name   time_fill
+ * @brief  Times theremin_fill() gliding over BENCH_SAMPLES
+ *
+ * @param  void
+ * @return void
+ */
+static void time_fill()
+{
+	static uint16_t block[AUDIO_HALF_SIZE];
+	struct timespec t0, t1;
+	uint64_t c0 = 0, c1 = 0;
+	double ns;
+
+	theremin_start(SCALE_OFF, THEREMIN_GLIDE_MS);
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+#if defined(__x86_64__) || defined(__i386__)
+	c0 = __rdtsc();
+#endif
+	for(uint32_t n = 0; n < BENCH_SAMPLES; n += AUDIO_HALF_SIZE)
+	{
+		if(n % (OUTPUT_SAMPLE_RATE / 10) == 0) //Ten readings a second keep it gliding
+			theremin_set((n / (OUTPUT_SAMPLE_RATE / 10)) % 2 ? FULL_ROLL : 0, LOUD);
+		theremin_fill(block, AUDIO_HALF_SIZE);
+	}
+#if defined(__x86_64__) || defined(__i386__)
+	c1 = __rdtsc();
+#endif
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	ns = ((t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec)) / BENCH_SAMPLES;
+	printf("theremin_fill: %.2f ns/sample %.2f TSC/sample gliding\n", ns, (double)(c1 - c0) / BENCH_SAMPLES);
+}
+
+int main()
+{
+	static const uint32_t glides[] = { 0, 20, THEREMIN_GLIDE_MS, 250 };
+
+	output_sample_rate = OUTPUT_SAMPLE_RATE;
+	quantiser_checks();
+	tuning_checks();
+	mapping_checks();
+	glide_sample_checks();
+	for(uint32_t g = 0; g < sizeof(glides) / sizeof(glides[0]); g++)
+		glide_checks(glides[g]);
+	latency_checks(AUDIO_HALF_SIZE);
+	effects_range_checks();
+	time_fill();
+
+	printf("%s\n", failures ? "Theremin checks FAILED" : "Theremin checks passed");
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,254 @@
+/*
+ * @file        bench_tilt.c
+ * @brief       Host accuracy sweep and benchmark of the integer roll and pitch angles
+ *
+ * Sweeps tilt_atan2() over a grid of the 14-bit range, every direction at several lengths, and
+ * the axes and diagonals, against libm's atan2(); tilt_isqrt() over every value up to 2^24, the
+ * squares and their midpoints, and random values to 2^32; and tilt_roll() and tilt_pitch() over
+ * orientations of the board at 1 g, as the soft-float angles of accelerometer.c computed them.
+ * Prints the worst error of each against the bounds in tilt.h, then times the integer angles
+ * against the float ones.
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       gcc
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "tilt.h"
+#include "check.h"
+
+#define AXIS_MIN      (-8192)
+#define AXIS_MAX      (8191)
+#define GRID_STEP     (7)         //Grid of the atan2 sweep, 5.5 million vectors
+#define DIRECTIONS    (360000)    //Directions a length, a thousandth of a degree apart
+#define COUNTS_PER_G  (4096)
+#define ORIENT_STEP   (0.25)      //Degrees between roll and pitch angles of the board
+#define NOISE_COUNTS  (64)        //Added to each axis of the board's orientations
+#define ISQRT_RANDOM  (10000000)
+#define BENCH_READINGS (10000000)
+#define ATAN2_BOUND   (1.0)       //Hundredths of a degree, as tilt.h states
+#define PITCH_BOUND   (2.0)
+
+/*
+ * @name   exact
+ * @brief  atan2(y, x) from libm, in hundredths of a degree, 18000 along the negative x axis
+ *
+ * @param  double y, double x
+ * @return double
+ */
+static double exact(double y, double x)
+{
+	double a = atan2(y, x) * TILT_HALF_TURN / M_PI;
+
+	return (a <= -TILT_HALF_TURN) ? a + 2 * TILT_HALF_TURN : a;
+}
+
+/*
+ * @name   atan2_error
+ * @brief  Error of tilt_atan2() at (x, y), the wrap at 180 degrees taken out
+ *
+ * @param  int32_t y, int32_t x
+ * @return double hundredths of a degree
+ */
+static double atan2_error(int32_t y, int32_t x)
+{
+	double e = fabs(tilt_atan2(y, x) - exact(y, x));
+
+	return (e > TILT_HALF_TURN) ? 2 * TILT_HALF_TURN - e : e;
+}
+
+/*
+ * @name   atan2_sweep
+ * @brief  tilt_atan2() over the 14-bit grid, around circles and along the axes and diagonals
+ *
+ * @param  void
+ * @return void
+ */
+static void atan2_sweep()
+{
+	static const int32_t lengths[] = { 1, 3, 100, 4096, 11585, TILT_INPUT_MAX };
+	double worst = 0, e;
+	int32_t range = 0;
+
+	for(int32_t y = AXIS_MIN; y <= AXIS_MAX; y += GRID_STEP)
+		for(int32_t x = AXIS_MIN; x <= AXIS_MAX; x += GRID_STEP)
+		{
+			int32_t a = tilt_atan2(y, x);
+
+			if(a <= -TILT_HALF_TURN || a > TILT_HALF_TURN)
+				range++;
+			e = atan2_error(y, x);
+			if(e > worst)
+				worst = e;
+		}
+	printf("tilt_atan2: 14-bit grid, worst %.3f hundredths of a degree\n", worst);
+	check(worst <= ATAN2_BOUND && range == 0, "tilt_atan2 over the 14-bit grid");
+
+	for(unsigned l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++)
+	{
+		worst = 0;
+		for(int32_t d = 0; d < DIRECTIONS; d++)
+		{
+			double r = d * 2 * M_PI / DIRECTIONS;
+			int32_t y = (int32_t)lround(lengths[l] * sin(r)), x = (int32_t)lround(lengths[l] * cos(r));
+
+			e = atan2_error(y, x);
+			if(e > worst)
+				worst = e;
+		}
+		printf("tilt_atan2: length %ld, every 0.001 degrees, worst %.3f\n", (long)lengths[l], worst);
+		check(worst <= ATAN2_BOUND, "tilt_atan2 in every direction");
+	}
+
+	check(tilt_atan2(0, 0) == 0 && tilt_atan2(0, 1) == 0 && tilt_atan2(1, 0) == 9000 && tilt_atan2(-1, 0) == -9000 &&
+			tilt_atan2(0, -1) == TILT_HALF_TURN && tilt_atan2(-1, -TILT_INPUT_MAX) == TILT_HALF_TURN &&
+			tilt_atan2(1, 1) == 4500 && tilt_atan2(-AXIS_MAX, -AXIS_MAX) == -13500, "tilt_atan2 along the axes and diagonals");
+}
+
+/*
+ * @name   isqrt_sweep
+ * @brief  tilt_isqrt() rounds to the nearest integer everywhere
+ *
+ * @param  void
+ * @return void
+ */
+static void isqrt_sweep()
+{
+	uint32_t errors = 0;
+
+	for(uint32_t v = 0; v < (1UL << 24); v++)
+		errors += tilt_isqrt(v) != (uint32_t)lround(sqrt(v));
+	for(uint64_t r = 0; r < 65536; r++) //Squares, and either side of the midpoints, r^2 + r
+	{
+		errors += tilt_isqrt((uint32_t)(r * r)) != r;
+		errors += tilt_isqrt((uint32_t)(r * r + r)) != r;
+		errors += tilt_isqrt((uint32_t)(r * r + r + 1)) != r + 1;
+	}
+	srand(25);
+	for(uint32_t i = 0; i < ISQRT_RANDOM; i++)
+	{
+		uint32_t v = ((uint32_t)rand() << 16) ^ (uint32_t)rand();
+
+		errors += tilt_isqrt(v) != (uint32_t)lround(sqrt(v));
+	}
+	errors += tilt_isqrt(UINT32_MAX) != 65536;
+	check(errors == 0, "tilt_isqrt rounds to the nearest integer");
+}
+
+/*
+ * @name   orientation_sweep
+ * @brief  tilt_roll() and tilt_pitch() against the soft-float angles, the board at 1 g with noise
+ *
+ * Every roll and pitch of the board ORIENT_STEP apart, gravity resolved onto the axes and
+ * rounded to counts, compared with the angles libm takes from the same counts
+ *
+ * @param  void
+ * @return void
+ */
+static void orientation_sweep()
+{
+	double worst_roll = 0, worst_pitch = 0, e;
+	uint32_t readings = 0;
+
+	srand(26);
+	for(double p = -90; p <= 90; p += ORIENT_STEP)
+		for(double r = -180; r < 180; r += ORIENT_STEP)
+		{
+			double pr = p * M_PI / 180, rr = r * M_PI / 180;
+			int16_t x = (int16_t)lround(COUNTS_PER_G * sin(pr)) + rand() % (2 * NOISE_COUNTS + 1) - NOISE_COUNTS;
+			int16_t y = (int16_t)lround(COUNTS_PER_G * cos(pr) * sin(rr)) + rand() % (2 * NOISE_COUNTS + 1) - NOISE_COUNTS;
+			int16_t z = (int16_t)lround(COUNTS_PER_G * cos(pr) * cos(rr)) + rand() % (2 * NOISE_COUNTS + 1) - NOISE_COUNTS;
+
+			e = fabs(tilt_roll(y, z) - exact(y, z));
+			e = (e > TILT_HALF_TURN) ? 2 * TILT_HALF_TURN - e : e;
+			if(e > worst_roll)
+				worst_roll = e;
+			e = fabs(tilt_pitch(x, y, z) - exact(x, sqrt((double)y * y + (double)z * z)));
+			if(e > worst_pitch)
+				worst_pitch = e;
+			readings++;
+		}
+	printf("Board at 1 g, %u orientations: roll worst %.3f, pitch worst %.3f hundredths of a degree\n", readings,
+			worst_roll, worst_pitch);
+	check(worst_roll <= ATAN2_BOUND, "tilt_roll matches the soft-float roll");
+	check(worst_pitch <= PITCH_BOUND, "tilt_pitch matches the soft-float pitch");
+	check(tilt_pitch(AXIS_MAX, 0, 0) == 9000 && tilt_pitch(-AXIS_MAX, 0, 0) == -9000 && tilt_pitch(0, 0, 0) == 0,
+			"tilt_pitch straight up and down");
+}
+
+/*
+ * @name   bench
+ * @brief  Times a roll and pitch reading, integer against float as accelerometer.c did it
+ *
+ * Host timings only compare the two; the target has no FPU, see BENCH tilt
+ *
+ * @param  void
+ * @return void
+ */
+static void bench()
+{
+	static int16_t ax[1024], ay[1024], az[1024];
+	struct timespec t0, t1;
+	uint64_t c0 = 0, c1 = 0;
+	volatile int32_t isink = 0;
+	volatile float fsink = 0;
+	double ns;
+
+	srand(27);
+	for(int i = 0; i < 1024; i++)
+	{
+		ax[i] = (int16_t)(rand() % 8192 - 4096);
+		ay[i] = (int16_t)(rand() % 8192 - 4096);
+		az[i] = (int16_t)(rand() % 8192 - 4096);
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+#if defined(__x86_64__) || defined(__i386__)
+	c0 = __rdtsc();
+#endif
+	for(uint32_t i = 0; i < BENCH_READINGS; i++)
+		isink += tilt_roll(ay[i & 1023], az[i & 1023]) + tilt_pitch(ax[i & 1023], ay[i & 1023], az[i & 1023]);
+#if defined(__x86_64__) || defined(__i386__)
+	c1 = __rdtsc();
+#endif
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	ns = ((t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec)) / BENCH_READINGS;
+	printf("Integer roll and pitch: %.2f ns/reading %.2f TSC/reading\n", ns, (double)(c1 - c0) / BENCH_READINGS);
+
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+#if defined(__x86_64__) || defined(__i386__)
+	c0 = __rdtsc();
+#endif
+	for(uint32_t i = 0; i < BENCH_READINGS; i++)
+	{
+		float x = ax[i & 1023] / 4096.0f, y = ay[i & 1023] / 4096.0f, z = az[i & 1023] / 4096.0f;
+
+		fsink += atan2(y, z) * 180 / M_PI + atan2(x, sqrt(y * y + z * z)) * 180 / M_PI;
+	}
+#if defined(__x86_64__) || defined(__i386__)
+	c1 = __rdtsc();
+#endif
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	ns = ((t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec)) / BENCH_READINGS;
+	printf("Float roll and pitch:   %.2f ns/reading %.2f TSC/reading (%d)\n", ns, (double)(c1 - c0) / BENCH_READINGS,
+			(int)(isink & 1) ^ (fsink > 0));
+}
+
+int main()
+{
+	atan2_sweep();
+	isqrt_sweep();
+	orientation_sweep();
+	bench();
+
+	printf("%s\n", failures ? "Tilt checks FAILED" : "Tilt checks passed");
+	return failures ? 1 : 0;
+}
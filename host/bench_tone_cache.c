@@ -0,0 +1,109 @@
+/*
+ * @file        bench_tone_cache.c
+ * @brief       Host test and benchmark of the tone cache
+ *
+ * Replays the zone changes of play_tunes() and checks that each tone is computed once,
+ * that the least recently used tone is the one evicted, and compares a lookup with tone_init().
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       gcc
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <time.h>
+
+#include "tone_cache.h"
+#include "wavetable.h"
+
+#define PASSES        (1000)
+#define BENCH_CALLS   (10000000)
+
+static const int tunes[4][3] =
+{
+	{ WAVEFORM1_FREQ, WAVEFORM2_FREQ, WAVEFORM3_FREQ },
+	{ WAVEFORM4_FREQ, WAVEFORM5_FREQ, WAVEFORM6_FREQ },
+	{ WAVEFORM7_FREQ, WAVEFORM8_FREQ, WAVEFORM9_FREQ },
+	{ WAVEFORM10_FREQ, WAVEFORM11_FREQ, WAVEFORM12_FREQ }
+};
+
+/*
+ * @name   elapsed_ns
+ * @brief  Nanoseconds between two timestamps
+ *
+ * @param  const struct timespec *t0, const struct timespec *t1
+ * @return double ns
+ */
+static double elapsed_ns(const struct timespec *t0, const struct timespec *t1)
+{
+	return (t1->tv_sec - t0->tv_sec) * 1e9 + (t1->tv_nsec - t0->tv_nsec);
+}
+
+int main()
+{
+	struct timespec t0, t1;
+	int failures = 0;
+
+	//Every tune with its own waveform, as play_tuneN() does, zone after zone
+	for(int pass = 0; pass < PASSES; pass++)
+	{
+		int t = pass % 4;
+		for(int n = 0; n < 3; n++)
+		{
+			const tone_t *tone = tone_cache_get(tunes[t][n], t);
+			if(tone->frequency != tunes[t][n] || tone->wave != t)
+			{
+				printf("FAIL: looked up %d Hz wave %d, got %d Hz wave %d\n", tunes[t][n], t, tone->frequency, tone->wave);
+				failures++;
+			}
+		}
+	}
+	printf("%d passes: %u hits, %u misses, %u evictions, %u of %d entries\n", PASSES, tone_cache_stats.hits,
+			tone_cache_stats.misses, tone_cache_stats.evictions, tone_cache_used(), TONE_CACHE_SIZE);
+	if(tone_cache_stats.misses != 12 || tone_cache_stats.evictions != 0)
+	{
+		printf("FAIL: the 12 tune tones should each miss once and fit without eviction\n");
+		failures++;
+	}
+
+	//Fill with new tones; the tune tones go in least recently used order, so tune 4 survives longest
+	tone_cache_flush();
+	for(int t = 0; t < 4; t++)
+		for(int n = 0; n < 3; n++)
+			tone_cache_get(tunes[t][n], t);
+	tone_cache_get(tunes[0][0], 0); //Touch tune 1's first tone, it becomes the most recent
+	tone_cache_stats = (tone_cache_stats_t){ 0 };
+	for(int f = 0; f < TONE_CACHE_SIZE - 12 + 2; f++)
+		tone_cache_get(2000 + f, WAVE_SINE);
+	tone_cache_stats = (tone_cache_stats_t){ 0 };
+	tone_cache_get(tunes[0][1], 0); //Second least recently used, must be gone
+	tone_cache_get(tunes[0][0], 0); //Touched, must still be there
+	if(tone_cache_stats.misses != 1 || tone_cache_stats.hits != 1)
+	{
+		printf("FAIL: eviction is not least recently used (%u hits, %u misses)\n", tone_cache_stats.hits,
+				tone_cache_stats.misses);
+		failures++;
+	}
+
+	//Lookup against recomputing
+	uint32_t sink = 0;
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+	for(int i = 0; i < BENCH_CALLS; i++)
+		sink += tone_cache_get(tunes[i & 3][i % 3], i & 3)->tuning_word;
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	double hit_ns = elapsed_ns(&t0, &t1) / BENCH_CALLS;
+
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+	for(int i = 0; i < BENCH_CALLS; i++)
+	{
+		tone_t tone = { tunes[i & 3][i % 3], i & 3 };
+		tone_init(&tone);
+		sink += tone.tuning_word;
+	}
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	printf("tone_cache_get hit: %.2f ns, tone_init: %.2f ns (%u)\n", hit_ns, elapsed_ns(&t0, &t1) / BENCH_CALLS,
+			sink & 1);
+
+	printf("%s\n", failures ? "Tone cache checks FAILED" : "Tone cache checks passed");
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,132 @@
+/*
+ * @file        bench_tone_fit.c
+ * @brief       Host test of pitch-accurate looped buffer fitting
+ *
+ * Fits every note in tone_to_sample.h into a looped buffer and reports the error in cents against
+ * the old one-period-rounded buffers. The fitted loop is played back repeatedly and its pitch
+ * measured from zero crossings, to check the recorded error and that the wrap is seamless.
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       gcc
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "dds.h"
+#include "tone_to_sample.h"
+#include "tpm.h"
+
+#define PLAY_SECONDS    (10)
+#define MAX_CENTS       (0.5)    //Fitted error limit
+
+static const int notes[] =
+{
+	WAVEFORM1_FREQ, WAVEFORM2_FREQ, WAVEFORM3_FREQ,
+	WAVEFORM4_FREQ, WAVEFORM5_FREQ, WAVEFORM6_FREQ,
+	WAVEFORM7_FREQ, WAVEFORM8_FREQ, WAVEFORM9_FREQ,
+	WAVEFORM10_FREQ, WAVEFORM11_FREQ, WAVEFORM12_FREQ
+};
+
+/*
+ * @name   cents
+ * @brief  Pitch difference between two frequencies in cents
+ *
+ * @param  double actual, double target
+ * @return double cents
+ */
+static double cents(double actual, double target)
+{
+	return 1200.0 * log2(actual / target);
+}
+
+/*
+ * @name   played_frequency
+ * @brief  Frequency of a looped buffer played for PLAY_SECONDS, from its rising zero crossings
+ *
+ * @param  const tone_buffer_t *buf
+ * @return double frequency in Hz
+ */
+static double played_frequency(const tone_buffer_t *buf)
+{
+	uint32_t total = OUTPUT_SAMPLE_RATE * PLAY_SECONDS;
+	int prev = buf->dac_buffer[0] - DDS_DAC_MIDSCALE;
+	double first = -1, last = 0;
+	int crossings = 0;
+
+	for(uint32_t i = 1; i < total; i++)
+	{
+		int s = buf->dac_buffer[i % buf->sample_count] - DDS_DAC_MIDSCALE;
+		if(prev < 0 && s >= 0)
+		{
+			double t = (i - 1) + (double)-prev / (s - prev);
+			if(first < 0)
+				first = t;
+			else
+				crossings++;
+			last = t;
+		}
+		prev = s;
+	}
+	return crossings * (double)OUTPUT_SAMPLE_RATE / (last - first);
+}
+
+/*
+ * @name   largest_step
+ * @brief  Largest sample to sample step inside the loop and across its wrap
+ *
+ * @param  const tone_buffer_t *buf, int *wrap_step
+ * @return int largest step inside the loop
+ */
+static int largest_step(const tone_buffer_t *buf, int *wrap_step)
+{
+	int inner = 0;
+
+	for(int i = 1; i < buf->sample_count; i++)
+	{
+		int step = abs(buf->dac_buffer[i] - buf->dac_buffer[i - 1]);
+		if(step > inner)
+			inner = step;
+	}
+	*wrap_step = abs(buf->dac_buffer[0] - buf->dac_buffer[buf->sample_count - 1]);
+	return inner;
+}
+
+int main()
+{
+	static tone_buffer_t buf;
+	int count = sizeof(notes) / sizeof(notes[0]);
+	double worst = 0;
+	int failures = 0;
+
+	printf("Looped buffer pitch at %d Hz, at most %d samples\n", OUTPUT_SAMPLE_RATE, BUFFER_SIZE);
+	printf("%8s %10s %12s %12s %12s %14s %12s\n", "note Hz", "old cents", "cycles/len", "fit Hz", "fit cents",
+			"played cents", "wrap step");
+	for(int i = 0; i < count; i++)
+	{
+		double old_hz = (double)OUTPUT_SAMPLE_RATE / (OUTPUT_SAMPLE_RATE / notes[i]);
+		double played, recorded;
+		int inner, wrap;
+
+		tone_fit(&buf, DDS_HZ(notes[i]), OUTPUT_SAMPLE_RATE);
+		tone_render_loop(&buf, dds_sine_table);
+		played = cents(played_frequency(&buf), notes[i]);
+		recorded = buf.error_mcents / 1000.0;
+		inner = largest_step(&buf, &wrap);
+
+		printf("%8d %10.3f %7u/%-4u %12.4f %12.4f %14.4f %7d/%-4d\n", notes[i], cents(old_hz, notes[i]),
+				buf.cycles, buf.sample_count, buf.achieved_q16 / 65536.0, recorded, played, wrap, inner);
+		if(fabs(recorded) > worst)
+			worst = fabs(recorded);
+		if(fabs(recorded) > MAX_CENTS || fabs(played - recorded) > 0.01 || wrap > inner + 1)
+		{
+			printf("FAIL: %d Hz fitted %.4f cents, played %.4f cents, wrap step %d\n", notes[i], recorded, played, wrap);
+			failures++;
+		}
+	}
+	printf("Worst fitted error: %.4f cents\n", worst);
+	printf("%s\n", failures ? "Tone fit checks FAILED" : "Tone fit checks passed");
+	return failures ? 1 : 0;
+}
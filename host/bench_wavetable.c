@@ -0,0 +1,95 @@
+/*
+ * @file        bench_wavetable.c
+ * @brief       Host test of the flash wavetable bank
+ *
+ * Plays every waveform through the DDS at the tune frequencies and measures how much of the
+ * output power is not on a harmonic of the note, i.e. aliasing and interpolation error.
+ * Square and saw are also played from the lowest band table at every pitch, to show what the bands remove.
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       gcc
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <math.h>
+
+#include "dds.h"
+#include "wavetable.h"
+#include "tone_to_sample.h"
+#include "tpm.h"
+
+#define SECONDS          (1)                                //Integer Hz notes land exactly on DFT bins
+#define SAMPLES          (OUTPUT_SAMPLE_RATE * SECONDS)
+#define ALIAS_LIMIT_DB   (-50.0)                            //Worst allowed non-harmonic power
+
+/*
+ * @name   inharmonic_db
+ * @brief  Power off the harmonics of a note relative to the total, in dB
+ *
+ * Goertzel at every harmonic below Nyquist; the rest of the AC power is aliasing and error
+ *
+ * @param  const int16_t *table, int frequency
+ * @return double dB
+ */
+static double inharmonic_db(const int16_t *table, int frequency)
+{
+	static double x[SAMPLES];
+	dds_osc_t osc = { 0, dds_tuning_word(DDS_HZ(frequency), OUTPUT_SAMPLE_RATE), table };
+	double mean = 0, total = 0, harmonic = 0;
+
+	for(int n = 0; n < SAMPLES; n++)
+	{
+		x[n] = dds_sample(&osc);
+		mean += x[n];
+	}
+	mean /= SAMPLES;
+	for(int n = 0; n < SAMPLES; n++)
+		total += (x[n] - mean) * (x[n] - mean) / SAMPLES;
+
+	for(int h = frequency; h < OUTPUT_SAMPLE_RATE / 2; h += frequency)
+	{
+		double coeff = 2 * cos(2 * M_PI * h * SECONDS / SAMPLES), s1 = 0, s2 = 0;
+
+		for(int n = 0; n < SAMPLES; n++)
+		{
+			double s0 = x[n] + coeff * s1 - s2;
+			s2 = s1;
+			s1 = s0;
+		}
+		harmonic += 2 * (s1 * s1 + s2 * s2 - coeff * s1 * s2) / ((double)SAMPLES * SAMPLES);
+	}
+	return 10 * log10(fmax(total - harmonic, 1e-12) / total);
+}
+
+int main()
+{
+	static const int freqs[] = { WAVEFORM4_FREQ, WAVEFORM1_FREQ, WAVEFORM2_FREQ, WAVEFORM5_FREQ,
+			WAVEFORM6_FREQ, WAVEFORM3_FREQ, WAVEFORM7_FREQ, WAVEFORM8_FREQ, WAVEFORM9_FREQ, 3136 };
+	int failures = 0;
+
+	printf("Inharmonic power at %d Hz, %d-sample tables, dB (limit %.0f)\n", OUTPUT_SAMPLE_RATE, DDS_TABLE_SIZE,
+			ALIAS_LIMIT_DB);
+	printf(" note Hz band     sine triangle   square      saw | unbanded square  saw\n");
+	for(unsigned i = 0; i < sizeof(freqs) / sizeof(freqs[0]); i++)
+	{
+		uint32_t tw = dds_tuning_word(DDS_HZ(freqs[i]), OUTPUT_SAMPLE_RATE);
+		double db[WAVE_COUNT];
+
+		for(int w = 0; w < WAVE_COUNT; w++)
+		{
+			db[w] = inharmonic_db(wavetable_select(w, tw), freqs[i]);
+			if(db[w] > ALIAS_LIMIT_DB)
+			{
+				printf("FAIL: %s at %d Hz %.1f dB\n", wavetable_name(w), freqs[i], db[w]);
+				failures++;
+			}
+		}
+		printf("%8d %4d %8.1f %8.1f %8.1f %8.1f | %15.1f %6.1f\n", freqs[i], wavetable_band(tw),
+				db[WAVE_SINE], db[WAVE_TRIANGLE], db[WAVE_SQUARE], db[WAVE_SAW],
+				inharmonic_db(wavetable_square[WAVETABLE_BANDS - 1], freqs[i]),
+				inharmonic_db(wavetable_saw[WAVETABLE_BANDS - 1], freqs[i]));
+	}
+	printf("%s\n", failures ? "Wavetable checks FAILED" : "Wavetable checks passed");
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,36 @@
+/*
+ * @file        check.h
+ * @brief       Pass/fail fixture shared by the host benchmarks
+ *
+ * Each benchmark is a single translation unit that includes this once, counts its failed checks
+ * in failures and exits non-zero when any failed, so make run stops on it.
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       gcc
+ */
+
+#ifndef CHECK_H_
+#define CHECK_H_
+
+#include <stdio.h>
+#include <stdint.h>
+
+static uint32_t failures;
+
+/*
+ * @name   check
+ * @brief  Counts and prints a failed check
+ *
+ * @param  int ok, const char *what
+ * @return void
+ */
+static inline void check(int ok, const char *what)
+{
+	if(!ok)
+	{
+		printf("FAIL: %s\n", what);
+		failures++;
+	}
+}
+
+#endif /* CHECK_H_ */
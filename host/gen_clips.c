@@ -0,0 +1,122 @@
+/*
+ * @file        gen_clips.c
+ * @brief       Generates the example clips of the SAMPLE command as WAV files
+ *
+ * pluck.wav is a Karplus-Strong plucked string on C4 whose string keeps ringing through the
+ * loop section and fades out after it; drum.wav is a one-shot kick drum, a falling sine with a
+ * click. Both are 16 kHz. make clips encodes them into ../source/adpcm_clips.c with wav2adpcm.
+ * Usage: gen_clips [directory]
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       gcc
+ * @references  K. Karplus, A. Strong "Digital Synthesis of Plucked-String and Drum Timbres"
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "adpcm_encode.h"
+
+#define CLIP_RATE      (16000)
+#define PLUCK_SAMPLES  (CLIP_RATE)            //1 s
+#define PLUCK_DELAY    (61)                   //String length: 16000 / 61.5 = 260 Hz with the averaging
+#define PLUCK_FADE     (7968)                 //Fade out from the end of the loop section on
+#define PLUCK_LEVEL    (24000.0)
+#define DRUM_SAMPLES   (CLIP_RATE * 35 / 100) //0.35 s
+#define DRUM_START_HZ  (150.0)
+#define DRUM_END_HZ    (45.0)
+#define DRUM_DECAY_S   (0.08)
+#define CLICK_DECAY_S  (0.004)
+#define DRUM_LEVEL     (28000.0)
+#define CLICK_LEVEL    (6000.0)
+#define NOISE_SEED     (12345)
+#define PATH_BYTES     (512)
+
+/*
+ * @name   noise
+ * @brief  Uniform noise in -1..1 from a fixed seed, so the clips are the same on every host
+ *
+ * @param  uint32_t *seed
+ * @return double
+ */
+static double noise(uint32_t *seed)
+{
+	*seed = *seed * 1664525UL + 1013904223UL;
+	return (int32_t)*seed / 2147483648.0;
+}
+
+/*
+ * @name   pluck
+ * @brief  Karplus-Strong string: a noise burst recirculating through a two-point average
+ *
+ * @param  int16_t *pcm
+ * @return void
+ */
+static void pluck(int16_t *pcm)
+{
+	double string[PLUCK_DELAY], last = 0;
+	uint32_t seed = NOISE_SEED;
+
+	for(int i = 0; i < PLUCK_DELAY; i++) //Burst softened by a one-pole low-pass, a rounder pluck
+	{
+		last = 0.5 * last + 0.5 * noise(&seed);
+		string[i] = last;
+	}
+	for(uint32_t i = 0; i < PLUCK_SAMPLES; i++)
+	{
+		double s = string[i % PLUCK_DELAY];
+		double fade = (i < PLUCK_FADE) ? 1.0 : (double)(PLUCK_SAMPLES - i) / (PLUCK_SAMPLES - PLUCK_FADE);
+
+		string[i % PLUCK_DELAY] = 0.5 * (s + string[(i + 1) % PLUCK_DELAY]);
+		pcm[i] = (int16_t)lround(PLUCK_LEVEL * s * fade);
+	}
+}
+
+/*
+ * @name   drum
+ * @brief  Kick drum: a sine falling exponentially in pitch and level, with a noise click
+ *
+ * @param  int16_t *pcm
+ * @return void
+ */
+static void drum(int16_t *pcm)
+{
+	double phase = 0;
+	uint32_t seed = NOISE_SEED;
+
+	for(uint32_t i = 0; i < DRUM_SAMPLES; i++)
+	{
+		double t = (double)i / CLIP_RATE;
+		double hz = DRUM_END_HZ + (DRUM_START_HZ - DRUM_END_HZ) * exp(-t / DRUM_DECAY_S);
+		double tail = (double)(DRUM_SAMPLES - i) / DRUM_SAMPLES;
+
+		phase += 2 * M_PI * hz / CLIP_RATE;
+		pcm[i] = (int16_t)lround((DRUM_LEVEL * sin(phase) * exp(-t / DRUM_DECAY_S / 2) +
+				CLICK_LEVEL * noise(&seed) * exp(-t / CLICK_DECAY_S)) * tail);
+	}
+}
+
+int main(int argc, char *argv[])
+{
+	static int16_t pcm[PLUCK_SAMPLES];
+	const char *dir = (argc > 1) ? argv[1] : ".";
+	char path[PATH_BYTES];
+
+	pluck(pcm);
+	snprintf(path, sizeof(path), "%s/pluck.wav", dir);
+	if(!wav_write(path, pcm, PLUCK_SAMPLES, CLIP_RATE))
+	{
+		fprintf(stderr, "gen_clips: cannot write %s\n", path);
+		return 1;
+	}
+	drum(pcm);
+	snprintf(path, sizeof(path), "%s/drum.wav", dir);
+	if(!wav_write(path, pcm, DRUM_SAMPLES, CLIP_RATE))
+	{
+		fprintf(stderr, "gen_clips: cannot write %s\n", path);
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,167 @@
+/*
+ * @file        gen_wavetables.c
+ * @brief       Generates the flash wavetable bank source/wavetable_data.c
+ *
+ * Writes one cycle of sine, and one band-limited cycle of triangle, square and sawtooth
+ * per octave band, as const Q15 tables. Band b is used for tuning words below 2^(31-b), so it
+ * holds harmonics up to 2^b and none of them reach Nyquist at any sample rate. The top harmonic is
+ * kept to MIN_POINTS samples per cycle, so longer tables give low notes more harmonics.
+ * Usage: gen_wavetables [table_bits] > ../source/wavetable_data.c (or make wavetables TABLE_BITS=n)
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       gcc
+ * @references  T. Stilson, J. Smith "Alias-Free Digital Synthesis of Classic Analog Waveforms"
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "wavetable.h"
+
+#define MIN_BITS   (4)
+#define MAX_BITS   (12)
+#define Q15_PEAK   (32767.0)
+#define MIN_POINTS (8)      //Table samples per cycle of the top harmonic, keeps linear interpolation error below -50 dB
+
+/*
+ * @name   band_harmonics
+ * @brief  Highest harmonic stored in an octave band
+ *
+ * @param  int band, int size (table length)
+ * @return int harmonic count
+ */
+static int band_harmonics(int band, int size)
+{
+	int harmonics = 1 << band;
+
+	return (harmonics > size / MIN_POINTS) ? size / MIN_POINTS : harmonics;
+}
+
+/*
+ * @name   harmonic_amplitude
+ * @brief  Fourier series coefficient of harmonic k of a waveform, in phase with the sine
+ *
+ * @param  int wave (WAVE_TRIANGLE, WAVE_SQUARE or WAVE_SAW), int k
+ * @return double amplitude
+ */
+static double harmonic_amplitude(int wave, int k)
+{
+	switch(wave)
+	{
+	case WAVE_TRIANGLE:
+		return (k & 1) ? ((k & 2) ? -1.0 : 1.0) / ((double)k * k) : 0; //Odd harmonics, alternating 1/k^2
+	case WAVE_SQUARE:
+		return (k & 1) ? 1.0 / k : 0;                                  //Odd harmonics, 1/k
+	default:
+		return ((k & 1) ? 1.0 : -1.0) / k;                             //All harmonics, alternating 1/k
+	}
+}
+
+/*
+ * @name   additive
+ * @brief  Sums the Fourier series of a waveform up to a harmonic
+ *
+ * @param  double *out, int size, int harmonics, int wave
+ * @return void
+ */
+static void additive(double *out, int size, int harmonics, int wave)
+{
+	for(int i = 0; i < size; i++)
+	{
+		double x = 2.0 * M_PI * i / size, s = 0;
+
+		for(int k = 1; k <= harmonics; k++)
+			s += harmonic_amplitude(wave, k) * sin(k * x);
+		out[i] = s;
+	}
+}
+
+/*
+ * @name   print_table
+ * @brief  Prints one table body, 8 values per line, scaled to Q15
+ *
+ * @param  const double *table, int size, double scale, const char *indent
+ * @return void
+ */
+static void print_table(const double *table, int size, double scale, const char *indent)
+{
+	for(int i = 0; i < size; i++)
+	{
+		printf("%s%6ld,", (i % 8) ? " " : indent, lround(table[i] * scale));
+		if(i % 8 == 7)
+			printf("\n");
+	}
+}
+
+/*
+ * @name   print_bank
+ * @brief  Prints a band-limited table per octave, all scaled by the same factor so loudness does not jump between bands
+ *
+ * @param  const char *name, int bits, int wave
+ * @return void
+ */
+static void print_bank(const char *name, int bits, int wave)
+{
+	int size = 1 << bits, bands = bits - 2;      //As WAVETABLE_BANDS, the last band reaches size / MIN_POINTS
+	double *bank = malloc(sizeof(double) * size * bands);
+	double peak = 0;
+
+	for(int b = 0; b < bands; b++)
+	{
+		additive(&bank[b * size], size, band_harmonics(b, size), wave);
+		for(int i = 0; i < size; i++)
+			peak = fmax(peak, fabs(bank[b * size + i]));
+	}
+
+	printf("\nconst int16_t wavetable_%s[WAVETABLE_BANDS][DDS_TABLE_SIZE] =\n{\n", name);
+	for(int b = 0; b < bands; b++)
+	{
+		printf("\t//Band %d: harmonics 1..%d, tuning words below 2^%d\n\t{\n", b, band_harmonics(b, size), 31 - b);
+		print_table(&bank[b * size], size, Q15_PEAK / peak, "\t\t");
+		printf("\t},\n");
+	}
+	printf("};\n");
+	free(bank);
+}
+
+int main(int argc, char *argv[])
+{
+	int bits = (argc > 1) ? atoi(argv[1]) : 8;
+	int size;
+	double *table;
+
+	if(bits < MIN_BITS || bits > MAX_BITS)
+	{
+		fprintf(stderr, "table_bits must be %d..%d\n", MIN_BITS, MAX_BITS);
+		return 1;
+	}
+	size = 1 << bits;
+	table = malloc(sizeof(double) * size);
+
+	printf("/*\n"
+			" * @file        wavetable_data.c\n"
+			" * @brief       Flash wavetable bank, %d samples per cycle\n"
+			" *\n"
+			" * Generated by host/gen_wavetables.c, do not edit. Rebuild with make -C host wavetables TABLE_BITS=%d\n"
+			" * and build the target with DDS_TABLE_BITS=%d.\n"
+			" *\n"
+			" * @author      Swathi Venkatachalam\n"
+			" * @tools       gcc\n"
+			" */\n\n"
+			"#include \"wavetable.h\"\n\n"
+			"#if DDS_TABLE_BITS != %d\n"
+			"#error \"wavetable_data.c was generated for DDS_TABLE_BITS %d, rerun make -C host wavetables\"\n"
+			"#endif\n", size, bits, bits, bits, bits);
+
+	for(int i = 0; i < size; i++)
+		table[i] = sin(2.0 * M_PI * i / size);
+	printf("\n//One cycle of sin(2*pi*i/%d) * 32767\nconst int16_t dds_sine_table[DDS_TABLE_SIZE] =\n{\n", size);
+	print_table(table, size, Q15_PEAK, "\t");
+	printf("};\n");
+
+	print_bank("triangle", bits, WAVE_TRIANGLE);
+	print_bank("square", bits, WAVE_SQUARE);
+	print_bank("saw", bits, WAVE_SAW);
+	free(table);
+	return 0;
+}
@@ -0,0 +1,146 @@
+/*
+ * @file        query_health.c
+ * @brief       Host reader of the board's audio health counters over a serial port
+ *
+ * Sends the HEALTH_QUERY byte to the command line and prints the binary frame the board
+ * answers with: halves played, underruns, missed and late refills, refill cycles and CPU load.
+ * The frame is found by its sync bytes and checksum, so command line output around it is skipped.
+ *
+ * usage: query_health -d device [-i ms]
+ *        -i  repeats the query every ms until interrupted
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       gcc
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <termios.h>
+
+#include "health.h"
+
+#define REPLY_MS   (500)   //Longest wait for a frame
+#define US_PER_MS  (1000)
+
+/*
+ * @name   open_port
+ * @brief  Opens a serial port raw at the command line's 38400 baud, 8 data bits and even parity
+ *
+ * @param  const char *device
+ * @return int file descriptor, or -1
+ */
+static int open_port(const char *device)
+{
+	int fd = open(device, O_RDWR | O_NOCTTY);
+	struct termios tio;
+
+	if(fd < 0)
+		return -1;
+	if(tcgetattr(fd, &tio) != 0)
+	{
+		close(fd);
+		return -1;
+	}
+	cfmakeraw(&tio);
+	tio.c_cflag |= CS8 | PARENB | CLOCAL | CREAD;
+	tio.c_cflag &= ~(PARODD | CSTOPB | CRTSCTS);
+	cfsetspeed(&tio, B38400);
+	if(tcsetattr(fd, TCSANOW, &tio) != 0)
+	{
+		close(fd);
+		return -1;
+	}
+	tcflush(fd, TCIOFLUSH);
+	return fd;
+}
+
+/*
+ * @name   query
+ * @brief  Sends a query and waits for the frame
+ *
+ * Keeps the last HEALTH_FRAME_BYTES bytes received and tries them as a frame after each byte
+ *
+ * @param  int fd, audio_stream_stats_t *stats (out)
+ * @return int 1 when a frame arrived in time
+ */
+static int query(int fd, audio_stream_stats_t *stats)
+{
+	uint8_t enq = HEALTH_QUERY, window[HEALTH_FRAME_BYTES] = { 0 }, byte;
+	struct pollfd pfd = { fd, POLLIN, 0 };
+
+	if(write(fd, &enq, 1) != 1)
+		return 0;
+	while(poll(&pfd, 1, REPLY_MS) > 0 && read(fd, &byte, 1) == 1)
+	{
+		memmove(window, window + 1, HEALTH_FRAME_BYTES - 1);
+		window[HEALTH_FRAME_BYTES - 1] = byte;
+		if(health_unpack(window, stats))
+			return 1;
+	}
+	return 0;
+}
+
+/*
+ * @name   usage
+ * @brief  Prints the command line
+ *
+ * @param  void
+ * @return int exit status
+ */
+static int usage()
+{
+	fprintf(stderr, "usage: query_health -d device [-i ms]\n");
+	return 2;
+}
+
+int main(int argc, char *argv[])
+{
+	const char *device = NULL;
+	uint32_t interval = 0;
+	int opt, fd;
+
+	while((opt = getopt(argc, argv, "d:i:")) != -1)
+	{
+		switch(opt)
+		{
+		case 'd': device = optarg; break;
+		case 'i': interval = (uint32_t)strtoul(optarg, NULL, 10); break;
+		default: return usage();
+		}
+	}
+	if(device == NULL || optind != argc)
+		return usage();
+	fd = open_port(device);
+	if(fd < 0)
+	{
+		fprintf(stderr, "query_health: cannot open %s\n", device);
+		return 2;
+	}
+
+	do
+	{
+		audio_stream_stats_t stats;
+
+		if(!query(fd, &stats))
+		{
+			fprintf(stderr, "query_health: no answer from %s\n", device);
+			close(fd);
+			return 1;
+		}
+		printf("halves %u underruns %u missed %u late %u refill min/mean/max %u/%u/%u cycles load %u.%u%% peak %u.%u%%\n",
+				stats.completions, stats.underruns, stats.deadline_misses, stats.late_refills, stats.refill_min,
+				health_mean(&stats), stats.refill_max, stats.load / 10, stats.load % 10, stats.load_peak / 10,
+				stats.load_peak % 10);
+		fflush(stdout);
+		if(interval)
+			usleep(interval * US_PER_MS);
+	} while(interval);
+	close(fd);
+	return 0;
+}
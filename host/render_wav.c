@@ -0,0 +1,345 @@
+/*
+ * @file        render_wav.c
+ * @brief       Host offline renderer of the tunes to WAV
+ *
+ * Runs the target synthesis path - tunes, sequencer, tone cache, mixer, envelopes and DDS -
+ * with DMA0 and DAC0 replaced by a loop that asks the sequencer for one ring half at a time,
+ * as DMA0_IRQHandler does, and keeps the 12-bit DAC codes. Renders one tune, or follows a roll
+ * angle trace the way play_tunes() does, and writes a 16-bit mono WAV file.
+ *
+ * Reports rendering throughput in samples per second, and the pitch of every note measured
+ * from the spectrum of the rendered audio against the note's frequency in the pattern.
+ * Exits with 1 when a note is more than PITCH_LIMIT_CENTS off.
+ *
+ * usage: render_wav [-r rate] [-s seconds] [-t tune | -a trace] [-o out.wav]
+ *        A trace is a text file of "milliseconds roll_degrees" lines in time order.
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       gcc
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+#include <math.h>
+
+#include "tunes.h"
+#include "sequencer.h"
+#include "mixer.h"
+#include "dma.h"
+#include "tpm.h"
+
+#define MAX_NOTES          (1024)
+#define MAX_TRACE          (1024)
+#define ATTACK_SKIP_MS     (30)     //Onset left out of the pitch measurement
+#define MIN_ANALYSIS_MS    (100)    //Shorter notes are not measured
+#define MAX_ANALYSIS_MS    (1000)
+#define SEARCH_SPAN        (0.01)   //Peak search within 1% (17 cents) of the note
+#define SEARCH_POINTS      (41)
+#define PITCH_LIMIT_CENTS  (1.0)
+
+//A note on seen on the mixer
+typedef struct note
+{
+	uint32_t start;      //First output sample of the ring half the note started in
+	int frequency;       //Hz, from the pattern
+	double measured;     //Hz, from the spectrum
+} note_t;
+
+//A point of a roll angle trace
+typedef struct roll_point
+{
+	uint32_t ms;
+	int roll;
+} roll_point_t;
+
+static note_t notes[MAX_NOTES];
+static int note_count;
+static roll_point_t trace[MAX_TRACE];
+static int trace_length;
+
+/*
+ * @name   load_trace
+ * @brief  Reads a roll angle trace
+ *
+ * @param  const char *path
+ * @return int 1 on success
+ */
+static int load_trace(const char *path)
+{
+	FILE *f = fopen(path, "r");
+	unsigned ms;
+	int roll;
+
+	if(f == NULL)
+		return 0;
+	trace_length = 0;
+	while(trace_length < MAX_TRACE && fscanf(f, "%u %d", &ms, &roll) == 2)
+	{
+		trace[trace_length].ms = ms;
+		trace[trace_length].roll = roll;
+		trace_length++;
+	}
+	fclose(f);
+	return trace_length > 0;
+}
+
+/*
+ * @name   follow_roll
+ * @brief  Starts or stops the tune for a roll angle, as play_tunes() does
+ *
+ * @param  int roll (degrees)
+ * @return void
+ */
+static void follow_roll(int roll)
+{
+	int zone = roll_zone(roll < 0 ? -roll : roll);
+
+	if(zone == ROLL_SILENT)
+		sequencer_stop();
+	else if(zone > ROLL_SILENT && sequencer_current() != tune_pattern(zone))
+		sequencer_play(tune_pattern(zone));
+}
+
+/*
+ * @name   record_notes
+ * @brief  Records the notes started during the last ring half
+ *
+ * Notes are placed at the start of the ring half they began in, which is close enough for
+ * choosing the analysis window. The note id the sequencer gives the mixer is the step index
+ * of the pattern playing.
+ *
+ * @param  uint32_t end (samples rendered so far), uint32_t *last_age
+ * @return void
+ */
+static void record_notes(uint32_t end, uint32_t *last_age)
+{
+	const seq_pattern_t *p = sequencer_current();
+
+	for(int v = 0; v < MIXER_NUM_VOICES; v++)
+	{
+		voice_t *voice = &mixer_voices[v];
+
+		if(!voice->active || (int32_t)(voice->age - *last_age) <= 0 || p == NULL)
+			continue;
+		if(note_count < MAX_NOTES)
+		{
+			notes[note_count].start = end - AUDIO_HALF_SIZE;
+			notes[note_count].frequency = p->steps[voice->note].frequency;
+			note_count++;
+		}
+		*last_age = voice->age;
+	}
+}
+
+/*
+ * @name   render
+ * @brief  Streams the sequencer into a sample buffer one ring half at a time
+ *
+ * @param  uint16_t *dac, uint32_t samples
+ * @return uint32_t samples rendered, a whole number of ring halves
+ */
+static uint32_t render(uint16_t *dac, uint32_t samples)
+{
+	uint32_t done = 0, last_age = 0;
+	int next_point = 0;
+
+	note_count = 0;
+	while(done + AUDIO_HALF_SIZE <= samples)
+	{
+		while(next_point < trace_length &&
+				(uint64_t)trace[next_point].ms * output_sample_rate / 1000 <= done)
+		{
+			follow_roll(trace[next_point].roll);
+			next_point++;
+		}
+		sequencer_fill(&dac[done], AUDIO_HALF_SIZE);
+		done += AUDIO_HALF_SIZE;
+		record_notes(done, &last_age);
+	}
+	return done;
+}
+
+/*
+ * @name   magnitude
+ * @brief  Hann windowed DFT magnitude of a block of DAC codes at any frequency
+ *
+ * @param  const uint16_t *dac, uint32_t n, double frequency (Hz)
+ * @return double
+ */
+static double magnitude(const uint16_t *dac, uint32_t n, double frequency)
+{
+	double w = 2 * M_PI * frequency / output_sample_rate;
+	double re = 0, im = 0;
+
+	for(uint32_t i = 0; i < n; i++)
+	{
+		double x = ((double)dac[i] - DDS_DAC_MIDSCALE) * (0.5 - 0.5 * cos(2 * M_PI * i / n));
+		re += x * cos(w * i);
+		im -= x * sin(w * i);
+	}
+	return sqrt(re * re + im * im);
+}
+
+/*
+ * @name   measure_pitch
+ * @brief  Finds the spectral peak near a note's frequency
+ *
+ * Scans SEARCH_SPAN either side of the note, then narrows in on the largest magnitude by
+ * ternary search, which converges since the window's main lobe is wider than the scan step
+ *
+ * @param  const uint16_t *dac, uint32_t n, int frequency (Hz)
+ * @return double peak frequency (Hz)
+ */
+static double measure_pitch(const uint16_t *dac, uint32_t n, int frequency)
+{
+	double low = frequency * (1 - SEARCH_SPAN), high = frequency * (1 + SEARCH_SPAN);
+	double step = (high - low) / (SEARCH_POINTS - 1);
+	double best = low, best_mag = -1;
+
+	for(int i = 0; i < SEARCH_POINTS; i++)
+	{
+		double f = low + i * step;
+		double m = magnitude(dac, n, f);
+		if(m > best_mag)
+		{
+			best_mag = m;
+			best = f;
+		}
+	}
+	low = best - step;
+	high = best + step;
+	while(high - low > 1e-5)
+	{
+		double a = low + (high - low) / 3, b = high - (high - low) / 3;
+		if(magnitude(dac, n, a) < magnitude(dac, n, b))
+			low = a;
+		else
+			high = b;
+	}
+	return (low + high) / 2;
+}
+
+/*
+ * @name   write_wav
+ * @brief  Writes DAC codes as a 16-bit mono PCM WAV file
+ *
+ * @param  const char *path, const uint16_t *dac, uint32_t samples
+ * @return int 1 on success
+ */
+static int write_wav(const char *path, const uint16_t *dac, uint32_t samples)
+{
+	FILE *f = fopen(path, "wb");
+	uint32_t data_bytes = samples * 2, riff_bytes = 36 + data_bytes, fmt_bytes = 16;
+	uint32_t rate = output_sample_rate, byte_rate = output_sample_rate * 2;
+	uint16_t pcm = 1, channels = 1, block_align = 2, bits = 16;
+
+	if(f == NULL)
+		return 0;
+	fwrite("RIFF", 1, 4, f);
+	fwrite(&riff_bytes, 4, 1, f);
+	fwrite("WAVEfmt ", 1, 8, f);
+	fwrite(&fmt_bytes, 4, 1, f);
+	fwrite(&pcm, 2, 1, f);
+	fwrite(&channels, 2, 1, f);
+	fwrite(&rate, 4, 1, f);
+	fwrite(&byte_rate, 4, 1, f);
+	fwrite(&block_align, 2, 1, f);
+	fwrite(&bits, 2, 1, f);
+	fwrite("data", 1, 4, f);
+	fwrite(&data_bytes, 4, 1, f);
+	for(uint32_t i = 0; i < samples; i++)
+	{
+		int16_t s = (int16_t)(((int32_t)dac[i] - DDS_DAC_MIDSCALE) << DDS_DAC_SHIFT);
+		fwrite(&s, 2, 1, f);
+	}
+	return fclose(f) == 0;
+}
+
+int main(int argc, char *argv[])
+{
+	uint32_t rate = OUTPUT_SAMPLE_RATE, samples, rendered;
+	double seconds = 6, elapsed, worst = 0;
+	const char *out = "render.wav";
+	int tune = 1, opt, measured = 0;
+	struct timespec t0, t1;
+	uint16_t *dac;
+
+	while((opt = getopt(argc, argv, "r:s:t:a:o:")) != -1)
+	{
+		switch(opt)
+		{
+		case 'r': rate = strtoul(optarg, NULL, 10); break;
+		case 's': seconds = atof(optarg); break;
+		case 't': tune = atoi(optarg); break;
+		case 'o': out = optarg; break;
+		case 'a':
+			if(!load_trace(optarg))
+			{
+				fprintf(stderr, "render_wav: cannot read trace %s\n", optarg);
+				return 2;
+			}
+			break;
+		default:
+			fprintf(stderr, "usage: render_wav [-r rate] [-s seconds] [-t tune | -a trace] [-o out.wav]\n");
+			return 2;
+		}
+	}
+	if(rate < OUTPUT_RATE_MIN || rate > OUTPUT_RATE_MAX || (trace_length == 0 && tune_pattern(tune) == NULL))
+	{
+		fprintf(stderr, "render_wav: rate %u or tune %d out of range\n", rate, tune);
+		return 2;
+	}
+
+	sequencer_set_sample_rate(rate);
+	samples = (uint32_t)(seconds * rate);
+	dac = calloc(samples, sizeof(dac[0]));
+	if(dac == NULL)
+		return 2;
+	if(trace_length == 0)
+		sequencer_play(tune_pattern(tune));
+
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+	rendered = render(dac, samples);
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	elapsed = (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) * 1e-9;
+
+	if(trace_length)
+		printf("Roll trace of %d points, %u samples at %u Hz\n", trace_length, rendered, rate);
+	else
+		printf("Tune %d, %u samples at %u Hz\n", tune, rendered, rate);
+	printf("Rendered in %.3f s: %.0f samples/s, %.0fx real time\n", elapsed, rendered / elapsed,
+			rendered / elapsed / rate);
+
+	for(int i = 0; i < note_count; i++)
+	{
+		uint32_t from = notes[i].start + ATTACK_SKIP_MS * rate / 1000;
+		uint32_t to = (i + 1 < note_count) ? notes[i + 1].start : rendered;
+		double cents;
+
+		if(to > from + MAX_ANALYSIS_MS * rate / 1000)
+			to = from + MAX_ANALYSIS_MS * rate / 1000;
+		if(to < from + MIN_ANALYSIS_MS * rate / 1000)
+			continue;
+		notes[i].measured = measure_pitch(&dac[from], to - from, notes[i].frequency);
+		cents = 1200 * log2(notes[i].measured / notes[i].frequency);
+		printf("  %8.3f s: %4d Hz note measured %9.4f Hz, %+7.3f cents\n", (double)notes[i].start / rate,
+				notes[i].frequency, notes[i].measured, cents);
+		if(fabs(cents) > worst)
+			worst = fabs(cents);
+		measured++;
+	}
+	printf("Worst spectral pitch error: %.3f cents over %d notes (limit %.1f)\n", worst, measured, PITCH_LIMIT_CENTS);
+
+	if(!write_wav(out, dac, rendered))
+	{
+		fprintf(stderr, "render_wav: cannot write %s\n", out);
+		return 2;
+	}
+	printf("Wrote %s\n", out);
+	free(dac);
+	return (worst > PITCH_LIMIT_CENTS) ? 1 : 0;
+}
@@ -0,0 +1,141 @@
+/*
+ * @file        send_midi.c
+ * @brief       Host player of a MIDI file to the board's MIDI command over a serial port
+ *
+ * Plays a Standard MIDI File in real time on a serial port at the rate and frame format UART0
+ * uses in the MIDI command, then sends a system reset byte, which ends the command. Start the
+ * command on the board with "midi" first.
+ *
+ * usage: send_midi -d device [-k] file.mid
+ *        -k  keeps the board listening: no system reset at the end
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       gcc
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <termios.h>
+#include <time.h>
+
+#include "midi.h"
+#include "smf.h"
+
+#define NS_PER_US  (1000)
+#define NS_PER_S   (1000000000L)
+
+/*
+ * @name   open_port
+ * @brief  Opens a serial port raw at MIDI_BAUD_RATE, 8 data bits and even parity like UART0
+ *
+ * @param  const char *device
+ * @return int file descriptor, or -1
+ */
+static int open_port(const char *device)
+{
+	int fd = open(device, O_RDWR | O_NOCTTY);
+	struct termios tio;
+
+	if(fd < 0)
+		return -1;
+	if(tcgetattr(fd, &tio) != 0)
+	{
+		close(fd);
+		return -1;
+	}
+	cfmakeraw(&tio);
+	tio.c_cflag |= CS8 | PARENB | CLOCAL | CREAD;
+	tio.c_cflag &= ~(PARODD | CSTOPB | CRTSCTS);
+	cfsetspeed(&tio, B115200);
+	if(tcsetattr(fd, TCSANOW, &tio) != 0)
+	{
+		close(fd);
+		return -1;
+	}
+	tcflush(fd, TCIOFLUSH);
+	return fd;
+}
+
+/*
+ * @name   usage
+ * @brief  Prints the command line
+ *
+ * @param  void
+ * @return int exit status
+ */
+static int usage()
+{
+	fprintf(stderr, "usage: send_midi -d device [-k] file.mid\n");
+	return 2;
+}
+
+int main(int argc, char *argv[])
+{
+	const char *device = NULL;
+	smf_wire_byte_t *wire;
+	struct timespec t0;
+	uint32_t n, i = 0;
+	uint8_t reset = MIDI_SYSTEM_RESET;
+	int keep = 0, opt, fd;
+	smf_t smf;
+
+	while((opt = getopt(argc, argv, "d:k")) != -1)
+	{
+		switch(opt)
+		{
+		case 'd': device = optarg; break;
+		case 'k': keep = 1; break;
+		default: return usage();
+		}
+	}
+	if(device == NULL || optind != argc - 1)
+		return usage();
+	if(!smf_load(argv[optind], &smf))
+	{
+		fprintf(stderr, "send_midi: %s is not a format 0 or 1 MIDI file\n", argv[optind]);
+		return 2;
+	}
+	fd = open_port(device);
+	if(fd < 0)
+	{
+		fprintf(stderr, "send_midi: cannot open %s at %d baud\n", device, MIDI_BAUD_RATE);
+		return 2;
+	}
+
+	n = smf_wire(&smf, MIDI_BAUD_RATE, MIDI_UART_BITS, &wire);
+	printf("%u messages, %u bytes, %.1f s\n", smf.count, n, n ? wire[n - 1].end_us / 1e6 : 0);
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+	while(i < n)
+	{
+		uint8_t message[256];
+		uint32_t length = 0;
+		long ns = t0.tv_nsec + (long)(wire[i].start_us * NS_PER_US);
+		struct timespec at = { t0.tv_sec + ns / NS_PER_S, ns % NS_PER_S };
+
+		//A message goes out in one write, at its start on the line
+		while(i + length < n && length < sizeof(message) && wire[i + length].start_us == wire[i].start_us)
+		{
+			message[length] = wire[i + length].byte;
+			length++;
+		}
+		clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &at, NULL);
+		if(write(fd, message, length) != (ssize_t)length)
+		{
+			fprintf(stderr, "send_midi: write to %s failed\n", device);
+			return 1;
+		}
+		i += length;
+	}
+	if(!keep && write(fd, &reset, 1) != 1)
+		return 1;
+	tcdrain(fd);
+	free(wire);
+	smf_free(&smf);
+	close(fd);
+	return 0;
+}
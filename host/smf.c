@@ -0,0 +1,364 @@
+/*
+ * @file        smf.c
+ * @brief       Standard MIDI File reader function implementations for the host tools
+ *
+ * Tracks are read into one list of events stamped with their tick and their place in the file,
+ * sorted by tick with ties kept in file order, and the tempo changes among them are then applied
+ * in that order.
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       gcc
+ * @references  Standard MIDI Files 1.0, MIDI Manufacturers Association
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "smf.h"
+
+#define HEADER_BYTES      (14)
+#define CHUNK_BYTES       (8)
+#define DEFAULT_TEMPO     (500000)   //us per quarter note until a tempo event, 120 bpm
+#define META              (0xFF)
+#define META_TEMPO        (0x51)
+#define META_END          (0x2F)
+#define SYSEX             (0xF0)
+#define SYSEX_ESCAPE      (0xF7)     //Sysex continuation or raw bytes, sent as they are
+#define STATUS_BIT        (0x80)
+#define SMPTE_BIT         (0x8000)
+
+//Event of a track, before the merge
+typedef struct raw_event
+{
+	uint64_t tick;
+	uint32_t order;      //Place in the file, keeps ties in file order
+	uint32_t offset;
+	uint32_t length;
+	uint32_t tempo;      //us per quarter note for a tempo event, else 0
+} raw_event_t;
+
+typedef struct builder
+{
+	raw_event_t *events;
+	uint32_t count, capacity;
+	uint8_t *pool;
+	uint32_t used, pool_capacity;
+} builder_t;
+
+/*
+ * @name   read_be
+ * @brief  Reads a big endian number
+ *
+ * @param  const uint8_t *p, int bytes
+ * @return uint32_t
+ */
+static uint32_t read_be(const uint8_t *p, int bytes)
+{
+	uint32_t v = 0;
+
+	while(bytes--)
+		v = v << 8 | *p++;
+	return v;
+}
+
+/*
+ * @name   read_vlq
+ * @brief  Reads a variable length quantity
+ *
+ * @param  const uint8_t **p, const uint8_t *end, uint32_t *value
+ * @return int 1 on success, 0 past the end or longer than four bytes
+ */
+static int read_vlq(const uint8_t **p, const uint8_t *end, uint32_t *value)
+{
+	*value = 0;
+	for(int i = 0; i < 4 && *p < end; i++)
+	{
+		uint8_t b = *(*p)++;
+
+		*value = *value << 7 | (b & 0x7F);
+		if(!(b & STATUS_BIT))
+			return 1;
+	}
+	return 0;
+}
+
+/*
+ * @name   add_event
+ * @brief  Appends an event and its bytes, the status byte first
+ *
+ * @param  builder_t *b, uint64_t tick, uint8_t status, const uint8_t *data, uint32_t length,
+ *         uint32_t tempo
+ * @return int 1 on success, 0 out of memory
+ */
+static int add_event(builder_t *b, uint64_t tick, uint8_t status, const uint8_t *data, uint32_t length, uint32_t tempo)
+{
+	raw_event_t *e;
+
+	if(b->count == b->capacity)
+	{
+		b->capacity = b->capacity ? 2 * b->capacity : 256;
+		b->events = realloc(b->events, b->capacity * sizeof(raw_event_t));
+	}
+	while(b->used + length + 1 > b->pool_capacity)
+	{
+		b->pool_capacity = b->pool_capacity ? 2 * b->pool_capacity : 1024;
+		b->pool = realloc(b->pool, b->pool_capacity);
+	}
+	if(b->events == NULL || b->pool == NULL)
+		return 0;
+	e = &b->events[b->count];
+	e->tick = tick;
+	e->order = b->count++;
+	e->offset = b->used;
+	e->length = tempo ? 0 : length + 1;
+	e->tempo = tempo;
+	if(!tempo)
+	{
+		b->pool[b->used++] = status;
+		memcpy(&b->pool[b->used], data, length);
+		b->used += length;
+	}
+	return 1;
+}
+
+/*
+ * @name   read_track
+ * @brief  Reads the events of one track chunk
+ *
+ * @param  builder_t *b, const uint8_t *p, const uint8_t *end
+ * @return int 1 on success
+ */
+static int read_track(builder_t *b, const uint8_t *p, const uint8_t *end)
+{
+	uint64_t tick = 0;
+	uint8_t running = 0;
+
+	while(p < end)
+	{
+		uint32_t delta, length;
+		uint8_t status;
+
+		if(!read_vlq(&p, end, &delta) || p >= end)
+			return 0;
+		tick += delta;
+		status = *p;
+		if(status & STATUS_BIT)
+			p++;
+		else if(running)
+			status = running;
+		else
+			return 0;
+
+		if(status == META)
+		{
+			uint8_t type;
+
+			if(p >= end)
+				return 0;
+			type = *p++;
+			if(!read_vlq(&p, end, &length) || length > (uint32_t)(end - p))
+				return 0;
+			if(type == META_TEMPO && length == 3 && !add_event(b, tick, 0, NULL, 0, read_be(p, 3)))
+				return 0;
+			p += length;
+			running = 0;
+			if(type == META_END)
+				return 1;
+		}
+		else if(status == SYSEX || status == SYSEX_ESCAPE)
+		{
+			if(!read_vlq(&p, end, &length) || length > (uint32_t)(end - p))
+				return 0;
+			//An escape carries the bytes to send, status included
+			if(status == SYSEX_ESCAPE ? (length && !add_event(b, tick, p[0], p + 1, length - 1, 0)) :
+					!add_event(b, tick, status, p, length, 0))
+				return 0;
+			p += length;
+			running = 0;
+		}
+		else
+		{
+			uint8_t type = status & 0xF0;
+
+			length = (type == 0xC0 || type == 0xD0) ? 1 : 2;
+			if(status >= SYSEX || length > (uint32_t)(end - p) || !add_event(b, tick, status, p, length, 0))
+				return 0;
+			p += length;
+			running = status;
+		}
+	}
+	return 1;
+}
+
+/*
+ * @name   by_tick
+ * @brief  qsort() order of raw events: tick, then place in the file
+ *
+ * @param  const void *a, const void *b
+ * @return int
+ */
+static int by_tick(const void *a, const void *b)
+{
+	const raw_event_t *x = a, *y = b;
+
+	if(x->tick != y->tick)
+		return (x->tick < y->tick) ? -1 : 1;
+	return (x->order < y->order) ? -1 : (x->order > y->order);
+}
+
+/*
+ * @name   smf_parse
+ * @brief  Parses a Standard MIDI File held in memory
+ *
+ * @param  const uint8_t *file, size_t size, smf_t *smf (smf_free() it after)
+ * @return int 1 on success, 0 for a file that is not a format 0 or 1 MIDI file
+ */
+int smf_parse(const uint8_t *file, size_t size, smf_t *smf)
+{
+	const uint8_t *p = file + HEADER_BYTES, *end = file + size;
+	builder_t b = { 0 };
+	uint32_t format, tracks, division, tempo = DEFAULT_TEMPO;
+	double us = 0, us_per_tick;
+	uint64_t tick = 0;
+	int ok = 1;
+
+	memset(smf, 0, sizeof(*smf));
+	if(size < HEADER_BYTES || memcmp(file, "MThd", 4) || read_be(file + 4, 4) != 6)
+		return 0;
+	format = read_be(file + 8, 2);
+	tracks = read_be(file + 10, 2);
+	division = read_be(file + 12, 2);
+	if(format > 1 || division == 0)
+		return 0;
+	for(uint32_t t = 0; t < tracks && ok; t++)
+	{
+		uint32_t length;
+
+		//Chunks other than tracks are skipped
+		while(ok && (ok = (end - p >= CHUNK_BYTES)) && memcmp(p, "MTrk", 4))
+			p += CHUNK_BYTES + read_be(p + 4, 4);
+		if(!ok)
+			break;
+		length = read_be(p + 4, 4);
+		p += CHUNK_BYTES;
+		ok = length <= (uint32_t)(end - p) && read_track(&b, p, p + length);
+		p += length;
+	}
+	if(!ok)
+	{
+		free(b.events);
+		free(b.pool);
+		return 0;
+	}
+
+	qsort(b.events, b.count, sizeof(raw_event_t), by_tick);
+	smf->events = malloc((b.count ? b.count : 1) * sizeof(smf_event_t));
+	smf->pool = b.pool;
+	if(division & SMPTE_BIT) //Frames per second, negated, and ticks per frame
+		us_per_tick = 1e6 / ((256 - (division >> 8)) * (division & 0xFF));
+	else
+		us_per_tick = (double)tempo / division;
+	for(uint32_t i = 0; i < b.count && smf->events; i++)
+	{
+		raw_event_t *e = &b.events[i];
+
+		us += (e->tick - tick) * us_per_tick;
+		tick = e->tick;
+		if(e->tempo)
+		{
+			if(!(division & SMPTE_BIT))
+				us_per_tick = (double)e->tempo / division;
+			smf->tempo_changes++;
+			continue;
+		}
+		smf->events[smf->count].us = us;
+		smf->events[smf->count].offset = e->offset;
+		smf->events[smf->count].length = e->length;
+		if(b.pool[e->offset] < SYSEX)
+			smf->channel_messages++;
+		smf->count++;
+	}
+	free(b.events);
+	return smf->events != NULL;
+}
+
+/*
+ * @name   smf_load
+ * @brief  Reads and parses a Standard MIDI File
+ *
+ * @param  const char *path, smf_t *smf (smf_free() it after)
+ * @return int 1 on success
+ */
+int smf_load(const char *path, smf_t *smf)
+{
+	FILE *f = fopen(path, "rb");
+	uint8_t *file;
+	long size;
+	int ok;
+
+	if(f == NULL)
+		return 0;
+	fseek(f, 0, SEEK_END);
+	size = ftell(f);
+	rewind(f);
+	file = malloc(size > 0 ? size : 1);
+	ok = file != NULL && size > 0 && fread(file, 1, size, f) == (size_t)size && smf_parse(file, size, smf);
+	free(file);
+	fclose(f);
+	return ok;
+}
+
+/*
+ * @name   smf_free
+ * @brief  Frees a parsed file
+ *
+ * @param  smf_t *smf
+ * @return void
+ */
+void smf_free(smf_t *smf)
+{
+	free(smf->events);
+	free(smf->pool);
+	memset(smf, 0, sizeof(*smf));
+}
+
+/*
+ * @name   smf_wire
+ * @brief  Lays the messages out on a serial line
+ *
+ * @param  const smf_t *smf, uint32_t baud, uint32_t bits (line bits per byte),
+ *         smf_wire_byte_t **bytes (malloc'd)
+ * @return uint32_t bytes on the line
+ */
+uint32_t smf_wire(const smf_t *smf, uint32_t baud, uint32_t bits, smf_wire_byte_t **bytes)
+{
+	double byte_us = 1e6 * bits / baud, free_at = 0;
+	uint32_t n = 0, total = 0;
+	uint8_t running = 0;
+
+	for(uint32_t i = 0; i < smf->count; i++)
+		total += smf->events[i].length;
+	*bytes = malloc((total ? total : 1) * sizeof(smf_wire_byte_t));
+	if(*bytes == NULL)
+		return 0;
+	for(uint32_t i = 0; i < smf->count; i++)
+	{
+		const smf_event_t *e = &smf->events[i];
+		const uint8_t *m = &smf->pool[e->offset];
+		double start = (e->us > free_at) ? e->us : free_at;
+		uint32_t first = 0;
+
+		if(m[0] < SYSEX && m[0] == running)
+			first = 1;
+		running = (m[0] < SYSEX) ? m[0] : 0;
+		for(uint32_t k = first; k < e->length; k++)
+		{
+			free_at = start + (k - first + 1) * byte_us;
+			(*bytes)[n].start_us = start;
+			(*bytes)[n].end_us = free_at;
+			(*bytes)[n++].byte = m[k];
+		}
+	}
+	return n;
+}
@@ -0,0 +1,84 @@
+/*
+ * @file        smf.h
+ * @brief       Standard MIDI File reader declarations for the host tools
+ *
+ * Reads a format 0 or 1 file, merges its tracks in time order and converts tick times to
+ * microseconds through the tempo map. The merged messages can then be laid out on a serial line
+ * the way a sender would put them there: back to back at the line rate, with running status.
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       gcc
+ */
+
+#ifndef SMF_H_
+#define SMF_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+//A channel or system exclusive message, meta events are dropped
+typedef struct smf_event
+{
+	double us;           //Time from the start of the file
+	uint32_t offset;     //Bytes of the message in smf_t.pool, status included
+	uint32_t length;
+} smf_event_t;
+
+typedef struct smf
+{
+	smf_event_t *events;
+	uint32_t count;
+	uint8_t *pool;
+	uint32_t channel_messages;
+	uint32_t tempo_changes;
+} smf_t;
+
+//A byte on the line
+typedef struct smf_wire_byte
+{
+	double start_us;     //Start of the message the byte belongs to, on the line
+	double end_us;       //Byte received whole
+	uint8_t byte;
+} smf_wire_byte_t;
+
+/*
+ * @name   smf_parse
+ * @brief  Parses a Standard MIDI File held in memory
+ *
+ * @param  const uint8_t *file, size_t size, smf_t *smf (smf_free() it after)
+ * @return int 1 on success, 0 for a file that is not a format 0 or 1 MIDI file
+ */
+int smf_parse(const uint8_t *file, size_t size, smf_t *smf);
+
+/*
+ * @name   smf_load
+ * @brief  Reads and parses a Standard MIDI File
+ *
+ * @param  const char *path, smf_t *smf (smf_free() it after)
+ * @return int 1 on success
+ */
+int smf_load(const char *path, smf_t *smf);
+
+/*
+ * @name   smf_free
+ * @brief  Frees a parsed file
+ *
+ * @param  smf_t *smf
+ * @return void
+ */
+void smf_free(smf_t *smf);
+
+/*
+ * @name   smf_wire
+ * @brief  Lays the messages out on a serial line
+ *
+ * A message starts at its time or when the line is free, whichever is later; a channel status
+ * byte equal to the last one sent is left out.
+ *
+ * @param  const smf_t *smf, uint32_t baud, uint32_t bits (line bits per byte),
+ *         smf_wire_byte_t **bytes (malloc'd)
+ * @return uint32_t bytes on the line
+ */
+uint32_t smf_wire(const smf_t *smf, uint32_t baud, uint32_t bits, smf_wire_byte_t **bytes);
+
+#endif /* SMF_H_ */
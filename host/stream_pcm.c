@@ -0,0 +1,315 @@
+/*
+ * @file        stream_pcm.c
+ * @brief       Host sender of a WAV file to the board's PCM command over a serial port
+ *
+ * Reads a 16-bit mono WAV file, converts it to 12-bit or 8-bit DAC codes and sends it in the
+ * frames pcm_stream.h describes, as many as the latest credit byte grants, then the end frame.
+ * Start the stream on the board with "pcm <rate of the file>" first, then run this at the baud
+ * rate it switches to.
+ *
+ * usage: stream_pcm -d device [-b baud] [-w 8|12] [-c n] [-f] file.wav
+ *        -c n  corrupts the checksum of every nth frame
+ *        -f    floods: sends without waiting for credits
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       gcc
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <termios.h>
+#include <time.h>
+
+#include "pcm_stream.h"
+
+#define CREDIT_TIMEOUT_MS  (2000)   //Longest wait for a credit before giving up
+#define WAV_HEADER_BYTES   (12)
+#define CHUNK_HEADER_BYTES (8)
+
+//Line rates the tool can set
+static const struct { uint32_t baud; speed_t speed; } bauds[] = {
+	{ 115200, B115200 }, { 230400, B230400 }, { 460800, B460800 }, { 921600, B921600 }
+};
+
+/*
+ * @name   read_wav
+ * @brief  Reads the samples of a 16-bit mono PCM WAV file
+ *
+ * @param  const char *path, uint32_t *rate, uint32_t *samples
+ * @return int16_t * samples, malloc'd, or NULL
+ */
+static int16_t *read_wav(const char *path, uint32_t *rate, uint32_t *samples)
+{
+	FILE *f = fopen(path, "rb");
+	uint8_t header[WAV_HEADER_BYTES], chunk[CHUNK_HEADER_BYTES], fmt[16];
+	int16_t *pcm = NULL;
+	int have_fmt = 0;
+
+	if(f == NULL)
+		return NULL;
+	if(fread(header, 1, sizeof(header), f) != sizeof(header) || memcmp(header, "RIFF", 4) ||
+			memcmp(header + 8, "WAVE", 4))
+	{
+		fclose(f);
+		return NULL;
+	}
+	while(pcm == NULL && fread(chunk, 1, sizeof(chunk), f) == sizeof(chunk))
+	{
+		uint32_t size = chunk[4] | chunk[5] << 8 | chunk[6] << 16 | (uint32_t)chunk[7] << 24;
+
+		if(memcmp(chunk, "fmt ", 4) == 0 && size >= sizeof(fmt))
+		{
+			if(fread(fmt, 1, sizeof(fmt), f) != sizeof(fmt))
+				break;
+			fseek(f, size - sizeof(fmt) + (size & 1), SEEK_CUR);
+			//PCM format, one channel, 16 bits
+			if(fmt[0] != 1 || fmt[1] != 0 || fmt[2] != 1 || fmt[3] != 0 || fmt[14] != 16)
+				break;
+			*rate = fmt[4] | fmt[5] << 8 | fmt[6] << 16 | (uint32_t)fmt[7] << 24;
+			have_fmt = 1;
+		}
+		else if(memcmp(chunk, "data", 4) == 0 && have_fmt)
+		{
+			*samples = size / sizeof(int16_t);
+			pcm = malloc(size ? size : 1);
+			if(pcm != NULL && fread(pcm, sizeof(int16_t), *samples, f) != *samples)
+			{
+				free(pcm);
+				pcm = NULL;
+			}
+			break;
+		}
+		else
+			fseek(f, size + (size & 1), SEEK_CUR);
+	}
+	fclose(f);
+	return pcm;
+}
+
+/*
+ * @name   open_port
+ * @brief  Opens a serial port raw at a baud rate, 8 data bits and even parity like UART0
+ *
+ * @param  const char *device, uint32_t baud
+ * @return int file descriptor, or -1
+ */
+static int open_port(const char *device, uint32_t baud)
+{
+	int fd = open(device, O_RDWR | O_NOCTTY);
+	struct termios tio;
+	uint32_t i;
+
+	if(fd < 0)
+		return -1;
+	for(i = 0; i < sizeof(bauds) / sizeof(bauds[0]) && bauds[i].baud != baud; i++);
+	if(i == sizeof(bauds) / sizeof(bauds[0]) || tcgetattr(fd, &tio) != 0)
+	{
+		close(fd);
+		return -1;
+	}
+	cfmakeraw(&tio);
+	tio.c_cflag |= CS8 | PARENB | CLOCAL | CREAD;
+	tio.c_cflag &= ~(PARODD | CSTOPB | CRTSCTS);
+	tio.c_cc[VMIN] = 1;
+	tio.c_cc[VTIME] = 0;
+	cfsetspeed(&tio, bauds[i].speed);
+	if(tcsetattr(fd, TCSANOW, &tio) != 0)
+	{
+		close(fd);
+		return -1;
+	}
+	tcflush(fd, TCIOFLUSH);
+	return fd;
+}
+
+/*
+ * @name   dac_code
+ * @brief  Converts a signed 16-bit sample to an offset binary sample of the frame's width
+ *
+ * @param  int16_t s, int type (PCM_FRAME_8 or PCM_FRAME_12)
+ * @return uint16_t
+ */
+static uint16_t dac_code(int16_t s, int type)
+{
+	return (type == PCM_FRAME_8) ? (uint16_t)((s >> 8) + 128) : (uint16_t)((s >> 4) + 2048);
+}
+
+/*
+ * @name   build_frame
+ * @brief  Encodes up to PCM_FRAME_SAMPLES samples as a frame
+ *
+ * @param  uint8_t *out, int type, const int16_t *pcm, uint32_t n, int corrupt
+ * @return uint32_t frame bytes
+ */
+static uint32_t build_frame(uint8_t *out, int type, const int16_t *pcm, uint32_t n, int corrupt)
+{
+	uint32_t len = 0;
+	uint8_t sum;
+
+	out[len++] = PCM_SYNC0;
+	out[len++] = PCM_SYNC1;
+	out[len++] = (uint8_t)type;
+	out[len++] = (uint8_t)n;
+	for(uint32_t i = 0; i < n; i += 2)
+	{
+		uint16_t a = dac_code(pcm[i], type);
+		uint16_t b = (i + 1 < n) ? dac_code(pcm[i + 1], type) : 0;
+
+		if(type == PCM_FRAME_8)
+		{
+			out[len++] = (uint8_t)a;
+			if(i + 1 < n)
+				out[len++] = (uint8_t)b;
+			continue;
+		}
+		out[len++] = (uint8_t)a;
+		out[len++] = (uint8_t)((a >> 8) | (b & 0x0F) << 4);
+		out[len++] = (uint8_t)(b >> 4);
+	}
+	sum = 0;
+	for(uint32_t i = 2; i < len; i++)
+		sum += out[i];
+	out[len++] = corrupt ? (uint8_t)~sum : sum;
+	return len;
+}
+
+/*
+ * @name   write_all
+ * @brief  Writes a whole buffer to the port
+ *
+ * @param  int fd, const uint8_t *buf, uint32_t len
+ * @return int 1 on success
+ */
+static int write_all(int fd, const uint8_t *buf, uint32_t len)
+{
+	while(len)
+	{
+		ssize_t n = write(fd, buf, len);
+		if(n <= 0)
+			return 0;
+		buf += n;
+		len -= n;
+	}
+	return 1;
+}
+
+/*
+ * @name   read_credit
+ * @brief  Takes the latest credit byte received, waiting up to timeout_ms for one
+ *
+ * @param  int fd, int timeout_ms, uint8_t *granted (running count of frames granted, mod 256)
+ * @return int 1 when a credit byte arrived, 0 when none did, -1 on timeout or error
+ */
+static int read_credit(int fd, int timeout_ms, uint8_t *granted)
+{
+	struct pollfd p = { .fd = fd, .events = POLLIN };
+	uint8_t buf[256];
+	ssize_t n;
+
+	if(poll(&p, 1, timeout_ms) <= 0)
+		return timeout_ms ? -1 : 0;
+	n = read(fd, buf, sizeof(buf));
+	if(n <= 0)
+		return -1;
+	*granted = buf[n - 1];
+	return 1;
+}
+
+/*
+ * @name   usage
+ * @brief  Prints the command line
+ *
+ * @param  void
+ * @return int exit status
+ */
+static int usage()
+{
+	fprintf(stderr, "usage: stream_pcm -d device [-b baud] [-w 8|12] [-c n] [-f] file.wav\n");
+	return 2;
+}
+
+int main(int argc, char *argv[])
+{
+	const char *device = NULL;
+	uint32_t baud = PCM_BAUD_RATE, rate = 0, samples = 0, frames = 0, bytes = 0, sent = 0;
+	int type = PCM_FRAME_12, corrupt_every = 0, flood = 0, opt, fd;
+	uint8_t frame[PCM_OVERHEAD + PCM_FRAME_BYTES(PCM_FRAME_12, PCM_FRAME_SAMPLES)];
+	uint8_t granted = 0;
+	struct timespec t0, t1;
+	double elapsed, per_sample;
+	int16_t *pcm;
+
+	while((opt = getopt(argc, argv, "d:b:w:c:f")) != -1)
+	{
+		switch(opt)
+		{
+		case 'd': device = optarg; break;
+		case 'b': baud = strtoul(optarg, NULL, 10); break;
+		case 'w': type = (atoi(optarg) == 8) ? PCM_FRAME_8 : PCM_FRAME_12; break;
+		case 'c': corrupt_every = atoi(optarg); break;
+		case 'f': flood = 1; break;
+		default: return usage();
+		}
+	}
+	if(device == NULL || optind != argc - 1)
+		return usage();
+	pcm = read_wav(argv[optind], &rate, &samples);
+	if(pcm == NULL)
+	{
+		fprintf(stderr, "stream_pcm: %s is not a 16-bit mono PCM WAV file\n", argv[optind]);
+		return 2;
+	}
+	fd = open_port(device, baud);
+	if(fd < 0)
+	{
+		fprintf(stderr, "stream_pcm: cannot open %s at %u baud\n", device, baud);
+		return 2;
+	}
+
+	per_sample = (double)PCM_FRAME_BYTES(type, PCM_FRAME_SAMPLES) / PCM_FRAME_SAMPLES + (double)PCM_OVERHEAD / PCM_FRAME_SAMPLES;
+	printf("%u samples at %u Hz, %d-bit: needs %.0f baud of %u\n", samples, rate, (type == PCM_FRAME_8) ? 8 : 12,
+			per_sample * rate * PCM_UART_BITS, baud);
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+	while(sent < samples)
+	{
+		uint32_t n = (samples - sent < PCM_FRAME_SAMPLES) ? samples - sent : PCM_FRAME_SAMPLES;
+		int credits = (uint8_t)(granted - frames);
+		uint32_t len;
+
+		if(read_credit(fd, (flood || credits) ? 0 : CREDIT_TIMEOUT_MS, &granted) < 0)
+		{
+			fprintf(stderr, "stream_pcm: no credit for %d ms, is \"pcm %u\" running?\n", CREDIT_TIMEOUT_MS, rate);
+			return 1;
+		}
+		if(!flood && (uint8_t)(granted - frames) == 0)
+			continue;
+		len = build_frame(frame, type, &pcm[sent], n, corrupt_every && (frames + 1) % corrupt_every == 0);
+		if(!write_all(fd, frame, len))
+		{
+			fprintf(stderr, "stream_pcm: write to %s failed\n", device);
+			return 1;
+		}
+		frames++;
+		bytes += len;
+		sent += n;
+	}
+	frame[0] = PCM_SYNC0;
+	frame[1] = PCM_SYNC1;
+	frame[2] = PCM_FRAME_END;
+	frame[3] = 0;
+	frame[4] = PCM_FRAME_END;
+	if(!write_all(fd, frame, PCM_OVERHEAD))
+		return 1;
+	tcdrain(fd);
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	elapsed = (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) * 1e-9;
+	printf("Sent %u frames, %u bytes in %.3f s\n", frames, bytes + PCM_OVERHEAD, elapsed);
+	free(pcm);
+	close(fd);
+	return 0;
+}
@@ -0,0 +1,183 @@
+/*
+ * @file        wav2adpcm.c
+ * @brief       Converts WAV files into the flash IMA-ADPCM clip bank source/adpcm_clips.c
+ *
+ * Encodes each 16-bit mono WAV file into a const array of 4-bit codes with its adpcm_clip_t,
+ * and writes the bank table the SAMPLE command plays from. A loop section is crossfaded into
+ * the audio before it, so the jump from its end back to its start is seamless, and the
+ * decoder state at its start is stored for the jump.
+ * Usage: wav2adpcm [-x crossfade] name=file.wav[:loop_start:loop_end] ... > ../source/adpcm_clips.c
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       gcc
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <math.h>
+#include "adpcm_encode.h"
+
+#define MAX_CLIPS       (16)
+#define NAME_BYTES      (32)
+#define CROSSFADE       (256)   //Default crossfade of a loop's end into the audio before its start
+#define BYTES_PER_LINE  (16)
+
+typedef struct clip
+{
+	char name[NAME_BYTES];
+	const char *path;
+	uint32_t loop_start;
+	uint32_t loop_end;
+} clip_t;
+
+/*
+ * @name   parse_clip
+ * @brief  Splits name=file.wav[:loop_start:loop_end]
+ *
+ * @param  char *arg, clip_t *clip
+ * @return int 1 when valid
+ */
+static int parse_clip(char *arg, clip_t *clip)
+{
+	char *eq = strchr(arg, '='), *colon;
+
+	if(eq == NULL || eq == arg || eq - arg >= NAME_BYTES)
+		return 0;
+	memcpy(clip->name, arg, eq - arg);
+	clip->name[eq - arg] = '\0';
+	clip->path = eq + 1;
+	clip->loop_start = 0;
+	clip->loop_end = ADPCM_NO_LOOP;
+	colon = strchr(eq + 1, ':');
+	if(colon != NULL)
+	{
+		*colon = '\0';
+		if(sscanf(colon + 1, "%u:%u", &clip->loop_start, &clip->loop_end) != 2 || clip->loop_end <= clip->loop_start)
+			return 0;
+	}
+	return 1;
+}
+
+/*
+ * @name   crossfade_loop
+ * @brief  Fades the end of the loop into the audio before its start
+ *
+ * The last samples of the loop become a blend turning into the samples that lead up to
+ * loop_start, so the sample after loop_end - 1 is, in effect, loop_start
+ *
+ * @param  int16_t *pcm, uint32_t loop_start, uint32_t loop_end, uint32_t fade
+ * @return void
+ */
+static void crossfade_loop(int16_t *pcm, uint32_t loop_start, uint32_t loop_end, uint32_t fade)
+{
+	if(fade > loop_start)
+		fade = loop_start;
+	if(fade > loop_end - loop_start)
+		fade = loop_end - loop_start;
+	for(uint32_t i = 0; i < fade; i++)
+	{
+		double t = (i + 1.0) / fade;
+		uint32_t at = loop_end - fade + i;
+
+		pcm[at] = (int16_t)lround((1 - t) * pcm[at] + t * pcm[loop_start - fade + i]);
+	}
+}
+
+/*
+ * @name   usage
+ * @brief  Prints the command line
+ *
+ * @param  void
+ * @return int exit status
+ */
+static int usage()
+{
+	fprintf(stderr, "usage: wav2adpcm [-x crossfade] name=file.wav[:loop_start:loop_end] ...\n");
+	return 2;
+}
+
+int main(int argc, char *argv[])
+{
+	clip_t clips[MAX_CLIPS];
+	uint32_t count = 0, fade = CROSSFADE, total = 0;
+	int opt;
+
+	while((opt = getopt(argc, argv, "x:")) != -1)
+	{
+		if(opt != 'x')
+			return usage();
+		fade = (uint32_t)strtoul(optarg, NULL, 10);
+	}
+	if(optind == argc || argc - optind > MAX_CLIPS)
+		return usage();
+	for(int i = optind; i < argc; i++)
+	{
+		if(!parse_clip(argv[i], &clips[count++]))
+			return usage();
+	}
+
+	printf("/*\n");
+	printf(" * @file        adpcm_clips.c\n");
+	printf(" * @brief       Flash IMA-ADPCM clip bank\n");
+	printf(" *\n");
+	printf(" * Generated by host/wav2adpcm.c, do not edit. Rebuild with make -C host clips.\n");
+	printf(" *\n");
+	printf(" * @author      Swathi Venkatachalam\n");
+	printf(" * @tools       gcc\n");
+	printf(" */\n\n");
+	printf("#include \"adpcm.h\"\n");
+
+	for(uint32_t c = 0; c < count; c++)
+	{
+		uint32_t rate, samples, bytes;
+		adpcm_state_t start, loop;
+		int16_t *pcm = wav_read(clips[c].path, &rate, &samples);
+		uint8_t *codes;
+
+		if(pcm == NULL)
+		{
+			fprintf(stderr, "wav2adpcm: %s is not a 16-bit mono PCM WAV file\n", clips[c].path);
+			return 1;
+		}
+		if(clips[c].loop_end > samples)
+		{
+			fprintf(stderr, "wav2adpcm: loop of %s ends after its %u samples\n", clips[c].path, samples);
+			return 1;
+		}
+		if(clips[c].loop_end != ADPCM_NO_LOOP)
+			crossfade_loop(pcm, clips[c].loop_start, clips[c].loop_end, fade);
+		codes = adpcm_encode(pcm, samples, clips[c].loop_start, &start, &loop, NULL);
+		if(codes == NULL)
+			return 1;
+		bytes = (samples + 1) / 2;
+		total += bytes;
+
+		if(clips[c].loop_end != ADPCM_NO_LOOP)
+			printf("\n//%s: %u samples at %u Hz, loop %u..%u\n", clips[c].path, samples, rate, clips[c].loop_start,
+					clips[c].loop_end);
+		else
+			printf("\n//%s: %u samples at %u Hz, one shot\n", clips[c].path, samples, rate);
+		printf("static const uint8_t %s_codes[%u] =\n{", clips[c].name, bytes);
+		for(uint32_t i = 0; i < bytes; i++)
+			printf("%s0x%02x%s", (i % BYTES_PER_LINE) ? " " : "\n\t", codes[i], (i + 1 < bytes) ? "," : "\n");
+		printf("};\n\n");
+		printf("static const adpcm_clip_t %s =\n{\n", clips[c].name);
+		printf("\t%s_codes, %u, %u, %u, %u,\n", clips[c].name, samples, rate, clips[c].loop_start, clips[c].loop_end);
+		printf("\t{ %d, %u }, { %d, %u }\n};\n", start.predictor, start.index, loop.predictor, loop.index);
+		free(codes);
+		free(pcm);
+	}
+
+	printf("\n//%u bytes of codes\n", total);
+	printf("const adpcm_clip_t *const adpcm_clips[] = {");
+	for(uint32_t c = 0; c < count; c++)
+		printf(" &%s%s", clips[c].name, (c + 1 < count) ? "," : " };\n");
+	printf("const char *const adpcm_clip_names[] = {");
+	for(uint32_t c = 0; c < count; c++)
+		printf(" \"%s\"%s", clips[c].name, (c + 1 < count) ? "," : " };\n");
+	printf("const uint32_t adpcm_clip_count = %u;\n", count);
+	return 0;
+}
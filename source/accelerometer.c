@@ -13,7 +13,8 @@
 #include <MKL25Z4.H>
 #include "accelerometer.h"
 #include "i2c.h"
-#include <math.h> // Math library for trigonometric functions
+#include "systick.h"
+#include <musical_tones.h>
 
 //Linear acceleration is a measure of how quickly an object's velocity changes along a straight line (m/s²) rate of change of velocity
 //Velocity = displacement (change of position)/ time interval
@@ -37,20 +38,161 @@
 #define REG_CTRL1  (0x2A)
 // Control register 4 for additional configuration
 #define REG_CTRL4  (0x2D)
+// Control register 5, routes interrupts to INT1 or INT2
+#define REG_CTRL5  (0x2E)
+
+// FIFO setup register: mode and watermark
+#define REG_F_SETUP (0x09)
+
+// Motion detection registers
+#define REG_FF_MT_CFG   (0x15)
+#define REG_FF_MT_SRC   (0x16) // Reading it clears the latched event and releases INT1
+#define REG_FF_MT_THS   (0x17)
+#define REG_FF_MT_COUNT (0x18)
+
+#define CTRL1_ACTIVE    (0x01) // Active, 14-bit samples, 800 Hz output data rate
+#define CTRL1_ACTIVE_SLOW (0x29) // Active, 14-bit samples, 12.5 Hz output data rate
+#define CTRL1_STANDBY   (0x00) // Configuration registers are only writable in standby
+#define FF_MT_MOTION    (0xD8) // Latch events, motion (OR of axes), X and Y axes; Z carries gravity when flat
+#define FF_MT_THRESHOLD (0x01) // 0.063 g a count: about 3.6 degrees of tilt from flat
+#define FF_MT_DEBOUNCE  (0x04) // Samples over the threshold before an event, 5 ms at 800 Hz
+#define FF_MT_DEBOUNCE_SLOW (0x01) // 80 ms at 12.5 Hz
+#define INT_FF_MT       (0x04) // Motion interrupt enable in CTRL4, route to INT1 in CTRL5
+#define INT_FIFO        (0x40) // FIFO interrupt enable in CTRL4; left clear in CTRL5, so on INT2
+#define INT_DRDY        (0x01) // Data-ready interrupt enable in CTRL4; left clear in CTRL5, so on INT2
+#define CTRL4_INTS      (INT_FF_MT | INT_FIFO)
+#define CTRL4_INTS_SLOW (INT_FF_MT | INT_DRDY)
+#define F_MODE_CIRCULAR (0x40) // F_SETUP: the FIFO keeps the newest 32 samples, the watermark below
+#define F_MODE_OFF      (0x00) // F_SETUP: no FIFO, the data registers hold the newest sample
+#define PORT_IRQ_LOW    (0x8)  // PORT_PCR IRQC: interrupt while the pin is low; INT2 is active low
+#define PRIORITY        (3)    // PORTA, as the I2C0 interrupt it queues drains with
+#define BATCH_WAIT_MS   (200)  // read_full_xyz() gives up after two readings at 12.5 Hz
+#define MS_PER_SECOND   (1000)
+#define US_PER_SECOND   (1000000)
 
 // Expected device ID for MMA8451
 #define WHOAMI     (0x1A)
 
-// Conversion constants
-// Accelerometer sensitivity: counts per g (gravity unit)
-#define COUNTS_PER_G (4096.0)
-#define M_PI         (3.14159265)
-
 // Global variables for storing accelerometer readings
 // Raw data for X, Y, and Z axes
 int16_t acc_X=0, acc_Y=0, acc_Z=0;
-// Calculated roll and pitch angles
-float roll = 0.0, pitch = 0.0;
+// Calculated roll and pitch angles, hundredths of a degree
+int32_t roll = 0, pitch = 0;
+
+static void drain_done(i2c_xfer_t *xfer);
+static int process_batch();
+static mma_ring_t ring;                              // Batches of the FIFO, the I2C receive DMA writes them
+static const uint8_t fifo_register = MMA_REG_F_STATUS;
+static i2c_xfer_t drain_xfer = { .dev = MMA_ADDR, .tx = &fifo_register, .tx_len = ONE,
+		.rx_len = sizeof(mma_batch_t), .done = drain_done };
+static volatile uint8_t paused = ONE;                // No draining until init_mma()
+static volatile uint32_t drain_cycles[MMA_RING_BATCHES]; // Watermark time of each batch
+static uint32_t reading_cycles;
+static uint8_t drain_samples = MMA_FIFO_WATERMARK;  // A batch at 800 Hz, one sample at 12.5 Hz
+static mma_rate_t rate = MMA_RATE_MOVING;           // Output data rate the sensor is set to
+static mma_motion_t motion;
+static uint8_t hold_fast;                            // mma_hold_fast() nesting
+mma_read_stats_t mma_read_stats;
+
+/*
+ * @name   arm
+ * @brief  Turns the watermark interrupt back on, unless paused or a drain is queued
+ *
+ * INT2 is level triggered, so a watermark reached meanwhile interrupts straight away.
+ * Call with interrupts masked or from the PORTA or I2C0 interrupt.
+ *
+ * @param  void
+ * @return void
+ */
+static void arm()
+{
+	if(paused || drain_xfer.status == I2C_PENDING)
+		return;
+	PORTA->PCR[MMA_INT2_POS] = (PORTA->PCR[MMA_INT2_POS] & ~PORT_PCR_IRQC_MASK) | PORT_PCR_ISF_MASK |
+			PORT_PCR_IRQC(PORT_IRQ_LOW);
+}
+
+/*
+ * @name   disarm
+ * @brief  Turns the watermark interrupt off
+ *
+ * @param  void
+ * @return void
+ */
+static void disarm()
+{
+	PORTA->PCR[MMA_INT2_POS] = (PORTA->PCR[MMA_INT2_POS] & ~PORT_PCR_IRQC_MASK) | PORT_PCR_ISF_MASK;
+}
+
+/*
+ * @name   drain
+ * @brief  Queues a drain of one batch into the ring, unless the ring is full
+ *
+ * A full ring leaves the watermark waiting; read_xyz_batch() arms it again once a batch is freed.
+ * At 12.5 Hz the batch is the one sample the data-ready interrupt is for.
+ * Only called from the PORTA and I2C0 interrupts.
+ *
+ * @param  void
+ * @return void
+ */
+static void drain()
+{
+	mma_batch_t *slot = mma_ring_slot(&ring);
+
+	if(slot == NULL)
+		return;
+	drain_cycles[ring.drained & (MMA_RING_BATCHES - ONE)] = cycle_count();
+	drain_xfer.rx = (uint8_t *)slot;
+	drain_xfer.rx_len = ONE + sizeof(mma_sample_t) * drain_samples;
+	(void)i2c_engine_submit(&drain_xfer);
+}
+
+/*
+ * @name   drain_done
+ * @brief  Completion callback of a drain, runs in the I2C0 interrupt
+ *
+ * Drains again at once if the FIFO held another batch, otherwise waits for the watermark.
+ * A failed drain leaves its slot free and the level interrupt retries it.
+ *
+ * @param  i2c_xfer_t *xfer
+ * @return void
+ */
+static void drain_done(i2c_xfer_t *xfer)
+{
+	if(xfer->status == I2C_DONE && mma_ring_drained(&ring, drain_samples) && !paused)
+		drain();
+	arm();
+}
+
+/*
+ * @name   set_rate
+ * @brief  Sets the output data rate, and with it the interrupt and the drain size
+ *
+ * 800 Hz fills the FIFO and drains it in batches on the watermark; 12.5 Hz turns the FIFO off
+ * and reads each sample on data-ready. The motion debounce keeps to about the same time.
+ * Batches already in the ring keep their size. Called from the main loop.
+ *
+ * @param  mma_rate_t new_rate
+ * @return void
+ */
+static void set_rate(mma_rate_t new_rate)
+{
+	int moving = new_rate == MMA_RATE_MOVING;
+
+	mma_fifo_pause();
+	while(!i2c_idle()); //Let a drain queued at the old rate complete
+	i2c_write_byte(MMA_ADDR, REG_CTRL1, CTRL1_STANDBY);
+	i2c_write_byte(MMA_ADDR, REG_F_SETUP, F_MODE_OFF); //The mode only changes from off
+	if(moving)
+		i2c_write_byte(MMA_ADDR, REG_F_SETUP, F_MODE_CIRCULAR | MMA_FIFO_WATERMARK);
+	i2c_write_byte(MMA_ADDR, REG_FF_MT_COUNT, moving ? FF_MT_DEBOUNCE : FF_MT_DEBOUNCE_SLOW);
+	i2c_write_byte(MMA_ADDR, REG_CTRL4, moving ? CTRL4_INTS : CTRL4_INTS_SLOW);
+	i2c_write_byte(MMA_ADDR, REG_CTRL1, moving ? CTRL1_ACTIVE : CTRL1_ACTIVE_SLOW);
+	rate = new_rate;
+	drain_samples = moving ? MMA_FIFO_WATERMARK : ONE;
+	mma_read_stats.rate_changes++;
+	mma_fifo_resume();
+}
 
 /*
  * @name   Delay
@@ -73,60 +215,251 @@ void Delay (uint32_t dly)
  * @name   init_mma
  * @brief  Initializes the accelerometer
  *
- * Initializes the accelerometer: Configures the MMA8451 accelerometer by writing to its control register. 
+ * Initializes the accelerometer: Configures the MMA8451 accelerometer by writing to its control registers.
  * This sets the accelerometer in active mode with 14-bit samples and an output data rate of 800 Hz.
+ * The FIFO keeps the newest 32 samples and INT2 asserts while it holds MMA_FIFO_WATERMARK, which
+ * PTA15 takes as a level interrupt; configuration registers are only writable in standby.
+ * Readings drop the rate to 12.5 Hz once the board is still, see read_xyz_batch().
  *
  * @param  void
  * @return int
  */
 int init_mma()
 {
+	SIM->SCGC5 |= SIM_SCGC5_PORTA_MASK;
+	PORTA->PCR[MMA_INT2_POS] = PORT_PCR_ISF_MASK | PORT_PCR_MUX(ONE);
+	mma_ring_reset(&ring);
+	mma_motion_reset(&motion, MMA_RATE_MOVING, ZERO, ZERO, ZERO);
+	rate = MMA_RATE_MOVING;
+	drain_samples = MMA_FIFO_WATERMARK;
+
+	i2c_write_byte(MMA_ADDR, REG_CTRL1, CTRL1_STANDBY);
+	i2c_write_byte(MMA_ADDR, REG_F_SETUP, F_MODE_CIRCULAR | MMA_FIFO_WATERMARK);
+	i2c_write_byte(MMA_ADDR, REG_CTRL4, CTRL4_INTS);
 	// Set the accelerometer to active mode, with 14-bit samples and 800 Hz O data rate
-	i2c_write_byte(MMA_ADDR, REG_CTRL1, 0x01);
+	i2c_write_byte(MMA_ADDR, REG_CTRL1, CTRL1_ACTIVE);
+
+	NVIC_SetPriority(PORTA_IRQn, PRIORITY);
+	NVIC_ClearPendingIRQ(PORTA_IRQn);
+	NVIC_EnableIRQ(PORTA_IRQn);
+	mma_fifo_resume();
 	return 1;
 }
 
+/*
+ * @name   mma_enable_motion_wake
+ * @brief  Routes the accelerometer motion interrupt to INT1
+ *
+ * INT1 (PTA14 on the FRDM-KL25Z, active low) asserts when the board tilts away from flat
+ * on X or Y and stays asserted until mma_clear_motion(). Used to wake the core from VLPS.
+ * Keeps the output data rate and interrupts of the current rate.
+ *
+ * @param  void
+ * @return void
+ */
+void mma_enable_motion_wake()
+{
+	int moving = rate == MMA_RATE_MOVING;
+
+	i2c_write_byte(MMA_ADDR, REG_CTRL1, CTRL1_STANDBY);
+	i2c_write_byte(MMA_ADDR, REG_FF_MT_CFG, FF_MT_MOTION);
+	i2c_write_byte(MMA_ADDR, REG_FF_MT_THS, FF_MT_THRESHOLD);
+	i2c_write_byte(MMA_ADDR, REG_FF_MT_COUNT, moving ? FF_MT_DEBOUNCE : FF_MT_DEBOUNCE_SLOW);
+	i2c_write_byte(MMA_ADDR, REG_CTRL4, moving ? CTRL4_INTS : CTRL4_INTS_SLOW);
+	i2c_write_byte(MMA_ADDR, REG_CTRL5, INT_FF_MT);
+	i2c_write_byte(MMA_ADDR, REG_CTRL1, moving ? CTRL1_ACTIVE : CTRL1_ACTIVE_SLOW);
+}
+
+/*
+ * @name   mma_clear_motion
+ * @brief  Clears a latched motion event
+ *
+ * Reads FF_MT_SRC, which releases INT1 until the next event
+ *
+ * @param  void
+ * @return void
+ */
+void mma_clear_motion()
+{
+	(void)i2c_read_byte(MMA_ADDR, REG_FF_MT_SRC);
+}
+
 /*
  * @name   read_full_xyz
  * @brief  Read raw readings from accelerometer
  *
- * Initiates an I2C transaction to read the accelerometer's data registers for the X, Y, and Z axes.
- * Each axis reading consists of a high and low byte, which are combined to form a 14-bit value.
- * The raw data is stored in global variables for later processing.
+ * Waits for a batch of the FIFO, up to BATCH_WAIT_MS, and stores the mean of its samples for the
+ * X, Y, and Z axes. A batch already waiting is taken at once.
  *
  * @param  void
  * @return void
  */
 void read_full_xyz()
 {
-	/*Uses I2C to read 6 bytes from the accelerometer (high and low bytes for each of X, Y, Z).
-Combines these bytes to form 16-bit signed values, then adjusts for the 14-bit resolution of the accelerometer by dividing by 4.*/
-	int i;
-	uint8_t data[6]; // Array to store 6 bytes of raw accelerometer data
-	int16_t temp[3]; // Temporary storage for 16-bit signed data for each axis
+	uint32_t start = cycle_count();
 
-	i2c_start(); // Initiate I2C communication
-	i2c_read_setup(MMA_ADDR , REG_XHI); // Start reading from the X-axis high byte register
+	while(!process_batch() && cycle_count() - start < SystemCoreClock / MS_PER_SECOND * BATCH_WAIT_MS);
+}
 
-	// Read five bytes in repeated mode
-	for( i=0; i<5; i++)	{
-		data[i] = i2c_repeated_read(0); // Read byte without ending communication
-	}
-	// Read last byte ending repeated mode
-	data[i] = i2c_repeated_read(1); // Last read with stop condition
+/*
+ * @name   process_batch
+ * @brief  Stores the oldest batch drained and selects the rate from it
+ *
+ * Times the batch from its interrupt to here. Unless held fast, a change of rate is made before
+ * returning, which takes the bus for a few register writes.
+ *
+ * @param  void
+ * @return int 1 when a batch was stored
+ */
+static int process_batch()
+{
+	uint8_t samples;
+	const mma_batch_t *batch = mma_ring_oldest(&ring, &samples);
+	uint32_t latency_us;
+	mma_rate_t selected;
 
-	// Combine high and low bytes for each axis to form 16-bit values
-	for ( i=0; i<3; i++ ) {
-		//Value=(High Byte<<8)∣Low Byte
-		temp[i] = (int16_t) ((data[2*i]<<8) | data[2*i+1]); // Combine high and low bytes
+	if(batch == NULL)
+		return ZERO;
+	mma_batch_mean(batch, samples, &acc_X, &acc_Y, &acc_Z);
+	reading_cycles = drain_cycles[ring.processed & (MMA_RING_BATCHES - ONE)];
+	mma_ring_processed(&ring);
+	__disable_irq();
+	arm(); //In case the ring was full
+	__enable_irq();
+
+	latency_us = (cycle_count() - reading_cycles) / (SystemCoreClock / US_PER_SECOND);
+	mma_read_stats.readings++;
+	mma_read_stats.latency_last_us = latency_us;
+	mma_read_stats.latency_total_us += latency_us;
+	if(latency_us > mma_read_stats.latency_worst_us)
+		mma_read_stats.latency_worst_us = latency_us;
+
+	selected = mma_motion_update(&motion, acc_X, acc_Y, acc_Z,
+			samples == MMA_FIFO_WATERMARK ? MMA_MOVING_MS : MMA_STILL_READ_MS);
+	if(hold_fast)
+		selected = MMA_RATE_MOVING;
+	if(selected != rate)
+		set_rate(selected);
+	return ONE;
+}
+
+/*
+ * @name   read_xyz_batch
+ * @brief  Processes a batch of the FIFO without waiting for one
+ *
+ * Stores the mean of the oldest batch drained, every sample of the 800 Hz stream in it, as
+ * acc_X, acc_Y and acc_Z, then frees its slot for the next drain. The batches are decoded here
+ * rather than in the interrupt, so acc_X, acc_Y and acc_Z only change under the caller.
+ * A call with nothing drained is a read the interrupts saved, counted in mma_read_stats.
+ *
+ * @param  void
+ * @return int 1 when a batch was stored
+ */
+int read_xyz_batch()
+{
+	if(process_batch())
+		return ONE;
+	mma_read_stats.reads_avoided++;
+	return ZERO;
+}
+
+/*
+ * @name   mma_hold_fast
+ * @brief  Keeps the 800 Hz rate while held, for readings that must not lag
+ *
+ * Holds nest. Released, the rate drops again after MMA_STILL_MS without motion.
+ *
+ * @param  int on (1 holds, 0 releases)
+ * @return void
+ */
+void mma_hold_fast(int on)
+{
+	if(on)
+	{
+		hold_fast++;
+		if(rate != MMA_RATE_MOVING)
+			set_rate(MMA_RATE_MOVING);
 	}
+	else if(hold_fast)
+		hold_fast--;
+	mma_motion_reset(&motion, MMA_RATE_MOVING, acc_X, acc_Y, acc_Z);
+}
+
+/*
+ * @name   mma_rate
+ * @brief  Output data rate the accelerometer is set to
+ *
+ * @param  void
+ * @return mma_rate_t
+ */
+mma_rate_t mma_rate()
+{
+	return rate;
+}
 
-	// Adjust readings for 14-bit accelerometer data (divide by 4 to convert to actual value)
-	// Align for 14 bits
-	//2^16/2^14 = 4
-	acc_X = temp[0]/4; // X-axis adjusted reading
-	acc_Y = temp[1]/4; // Y-axis adjusted reading
-	acc_Z = temp[2]/4; // Z-axis adjusted reading
+/*
+ * @name   mma_reading_cycles
+ * @brief  When the batch of the last reading stored reached the watermark
+ *
+ * Its newest sample was taken then; the mean lags it by half a batch
+ *
+ * @param  void
+ * @return uint32_t cycle_count() at its watermark interrupt
+ */
+uint32_t mma_reading_cycles()
+{
+	return reading_cycles;
+}
+
+/*
+ * @name   mma_fifo_irq
+ * @brief  Watermark or data-ready interrupt: drains a batch, called from PORTA_IRQHandler
+ *
+ * The pin interrupt stays off until the drain is done. Its cycles count with the I2C interrupts'.
+ *
+ * @param  void
+ * @return void
+ */
+void mma_fifo_irq()
+{
+	uint32_t start = cycle_count();
+
+	disarm();
+	mma_fifo_stats.watermarks++;
+	drain();
+	i2c_isr_cycles += cycle_count() - start;
+}
+
+/*
+ * @name   mma_fifo_pause
+ * @brief  Stops draining the FIFO, which keeps its newest samples meanwhile
+ *
+ * A drain already queued still completes
+ *
+ * @param  void
+ * @return void
+ */
+void mma_fifo_pause()
+{
+	__disable_irq();
+	paused = ONE;
+	disarm();
+	__enable_irq();
+}
+
+/*
+ * @name   mma_fifo_resume
+ * @brief  Drains the FIFO again
+ *
+ * @param  void
+ * @return void
+ */
+void mma_fifo_resume()
+{
+	__disable_irq();
+	paused = ZERO;
+	arm();
+	__enable_irq();
 }
 
 /*
@@ -136,20 +469,31 @@ Combines these bytes to form 16-bit signed values, then adjusts for the 14-bit r
  *  This function uses the accelerometer data to calculate the roll angle
  * of the device based on the arctangent of the Y and Z axis readings.
  * It also calculates the pitch angle for additional orientation information.
+ * Integer arithmetic only, see tilt.h for the error bounds; the counts need no scaling to g
+ * since only their ratios matter.
  *
  * @param  void
- * @return float roll
+ * @return int32_t roll (hundredths of a degree)
  */
-float convert_xyz_to_roll()
+int32_t convert_xyz_to_roll()
 {
-	// Convert raw accelerometer data to g-units by dividing by COUNTS_PER_G; axis in g-units
-	float ax = acc_X/COUNTS_PER_G,
-	      ay = acc_Y/COUNTS_PER_G,
-	      az = acc_Z/COUNTS_PER_G;
-
-	// Calculate roll angle (rotation around X-axis) in degrees
-	roll = atan2(ay, az)*180/M_PI;
-	// Calculate pitch angle (rotation around Y-axis) in degrees
-	pitch = atan2(ax, sqrt(ay*ay + az*az))*180/M_PI;
+	// Calculate roll angle (rotation around X-axis)
+	roll = tilt_roll(acc_Y, acc_Z);
+	// Calculate pitch angle (rotation around Y-axis)
+	pitch = tilt_pitch(acc_X, acc_Y, acc_Z);
 	return roll; // Return roll angle as the primary output
 }
+
+/*
+ * @name   get_pitch
+ * @brief  Pitch angle calculated by the last convert_xyz_to_roll()
+ *
+ * Rotation around the Y-axis, used by the theremin for volume
+ *
+ * @param  void
+ * @return int32_t pitch (hundredths of a degree)
+ */
+int32_t get_pitch()
+{
+	return pitch;
+}
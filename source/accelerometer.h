@@ -14,6 +14,23 @@
 #define ACCELEROMETER_H_
 
 #include <stdint.h>
+#include "mma_fifo.h"
+#include "tilt.h"
+
+#define MMA_INT2_POS      (15)   //PTA15, accelerometer INT2 on the FRDM-KL25Z: FIFO watermark or data-ready
+
+//Event driven reading counters
+typedef struct mma_read_stats
+{
+	uint32_t readings;           //Batches stored
+	uint32_t reads_avoided;      //read_xyz_batch() calls with nothing drained, each a read polling made
+	uint32_t rate_changes;       //Output data rate changes
+	uint32_t latency_last_us;    //Interrupt to reading stored
+	uint32_t latency_worst_us;
+	uint32_t latency_total_us;
+} mma_read_stats_t;
+
+extern mma_read_stats_t mma_read_stats;
 
 /*
  * @name   Delay
@@ -30,33 +47,134 @@ void Delay(uint32_t dlyTicks);
  * @name   init_mma
  * @brief  Initializes the accelerometer
  *
- * Initializes the accelerometer
+ * Initializes the accelerometer at 800 Hz with its FIFO in watermark mode, the watermark
+ * interrupt on INT2 draining batches from then on. Once the board is still the readings drop
+ * the rate to 12.5 Hz with a data-ready interrupt.
  *
  * @param  void
  * @return int
  */
 int init_mma();
 
+/*
+ * @name   mma_enable_motion_wake
+ * @brief  Routes the accelerometer motion interrupt to INT1
+ *
+ * INT1 asserts when the board tilts away from flat and stays asserted until mma_clear_motion()
+ *
+ * @param  void
+ * @return void
+ */
+void mma_enable_motion_wake();
+
+/*
+ * @name   mma_clear_motion
+ * @brief  Clears a latched motion event
+ *
+ * @param  void
+ * @return void
+ */
+void mma_clear_motion();
+
 /*
  * @name   read_full_xyz
  * @brief  Read raw readings from accelerometer
  *
- * Read raw readings from accelerometer
+ * Waits for a batch of the FIFO and stores its mean as the X, Y and Z readings
  *
  * @param  void
  * @return void
  */
 void read_full_xyz();
 
+/*
+ * @name   read_xyz_batch
+ * @brief  Processes a batch of the FIFO without waiting for one
+ *
+ * Stores the mean of the oldest batch drained as the X, Y and Z readings, and selects the output
+ * data rate from it: 800 Hz on motion, 12.5 Hz after MMA_STILL_MS without
+ *
+ * @param  void
+ * @return int 1 when a batch was stored
+ */
+int read_xyz_batch();
+
+/*
+ * @name   mma_hold_fast
+ * @brief  Keeps the 800 Hz rate while held, for readings that must not lag
+ *
+ * Holds nest. Released, the rate drops again after MMA_STILL_MS without motion.
+ *
+ * @param  int on (1 holds, 0 releases)
+ * @return void
+ */
+void mma_hold_fast(int on);
+
+/*
+ * @name   mma_rate
+ * @brief  Output data rate the accelerometer is set to
+ *
+ * @param  void
+ * @return mma_rate_t
+ */
+mma_rate_t mma_rate();
+
+/*
+ * @name   mma_reading_cycles
+ * @brief  When the batch of the last reading stored reached the watermark
+ *
+ * @param  void
+ * @return uint32_t cycle_count() at its watermark interrupt
+ */
+uint32_t mma_reading_cycles();
+
+/*
+ * @name   mma_fifo_irq
+ * @brief  Watermark or data-ready interrupt: drains a batch, called from PORTA_IRQHandler
+ *
+ * @param  void
+ * @return void
+ */
+void mma_fifo_irq();
+
+/*
+ * @name   mma_fifo_pause
+ * @brief  Stops draining the FIFO, which keeps its newest samples meanwhile
+ *
+ * A drain already queued still completes
+ *
+ * @param  void
+ * @return void
+ */
+void mma_fifo_pause();
+
+/*
+ * @name   mma_fifo_resume
+ * @brief  Drains the FIFO again
+ *
+ * @param  void
+ * @return void
+ */
+void mma_fifo_resume();
+
 /*
  * @name   convert_xyz_to_roll
  * @brief  Calculates the roll angle from readings
  *
- * Calculates the roll angle from readings
+ * Calculates the roll angle, and the pitch angle, from readings with integer arithmetic
+ *
+ * @param  void
+ * @return int32_t roll (hundredths of a degree)
+ */
+int32_t convert_xyz_to_roll();
+
+/*
+ * @name   get_pitch
+ * @brief  Pitch angle calculated by the last convert_xyz_to_roll()
  *
  * @param  void
- * @return float roll
+ * @return int32_t pitch (hundredths of a degree)
  */
-float convert_xyz_to_roll();
+int32_t get_pitch();
 
 #endif /* ACCELEROMETER_H_ */
@@ -0,0 +1,166 @@
+/*
+ * @file        adpcm.c
+ * @brief       IMA-ADPCM sample playback function implementations
+ *
+ * Each code is a sign and three magnitude bits of the difference from the last sample, in units
+ * of a step size that grows after large codes and shrinks after small ones. Decoding is a table
+ * lookup, three conditional adds and two clamps per sample, with no multiply.
+ * A voice keeps the last two decoded samples and a Q16 position between them: each output sample
+ * advances the position by the clip rate over the output rate, decoding as it crosses samples,
+ * and interpolates linearly, so a clip plays at its own pitch at any output rate.
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       MCUXpresso IDE, gcc
+ */
+
+#include "adpcm.h"
+#include "tone_to_sample.h"
+
+#define PHASE_ONE    (1UL << ADPCM_PHASE_SHIFT)
+#define SIGN_BIT     (8)
+#define INDEX_MAX    (ADPCM_STEPS - 1)
+#define Q15_MAX      (32767)
+#define Q15_MIN      (-32768)
+#define NIBBLE_BITS  (4)
+#define NIBBLE_MASK  (0x0F)
+
+const int16_t adpcm_step_table[ADPCM_STEPS] =
+{
+	7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45, 50, 55, 60, 66,
+	73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408,
+	449, 494, 544, 598, 658, 724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+	2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630,
+	9493, 10442, 11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+};
+
+//Step index change after each code; the sign bit does not matter
+const int8_t adpcm_index_table[16] = { -1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8 };
+
+/*
+ * @name   decode
+ * @brief  Decodes one 4-bit code and advances the decoder, inlined into the voice loop
+ *
+ * The difference is (code magnitude + 1/2) steps, built from step / 8 and a halving of the
+ * step per magnitude bit as the IMA reference does, so encoder and decoder round alike
+ *
+ * @param  adpcm_state_t *state, uint32_t code (0..15)
+ * @return int32_t sample, Q15
+ */
+static inline int32_t decode(adpcm_state_t *state, uint32_t code)
+{
+	int32_t step = adpcm_step_table[state->index];
+	int32_t diff = step >> 3;
+	int32_t sample = state->predictor;
+	int32_t index = state->index + adpcm_index_table[code];
+
+	if(code & 4)
+		diff += step;
+	if(code & 2)
+		diff += step >> 1;
+	if(code & 1)
+		diff += step >> 2;
+	sample += (code & SIGN_BIT) ? -diff : diff;
+	if(sample > Q15_MAX)
+		sample = Q15_MAX;
+	else if(sample < Q15_MIN)
+		sample = Q15_MIN;
+	state->predictor = (int16_t)sample;
+	state->index = (uint8_t)((index < 0) ? 0 : (index > INDEX_MAX) ? INDEX_MAX : index);
+	return sample;
+}
+
+/*
+ * @name   adpcm_decode
+ * @brief  Decodes one 4-bit code and advances the decoder
+ *
+ * @param  adpcm_state_t *state, uint8_t code (0..15)
+ * @return int32_t sample, Q15
+ */
+int32_t adpcm_decode(adpcm_state_t *state, uint8_t code)
+{
+	return decode(state, code & NIBBLE_MASK);
+}
+
+/*
+ * @name   adpcm_voice_start
+ * @brief  Starts a clip from its first sample at the output sample rate
+ *
+ * The voice is marked active last, so an interrupt never mixes a half set up voice
+ *
+ * @param  adpcm_voice_t *voice, const adpcm_clip_t *clip, int32_t gain (Q15), int loop (held on its loop)
+ * @return void
+ */
+void adpcm_voice_start(adpcm_voice_t *voice, const adpcm_clip_t *clip, int32_t gain, int loop)
+{
+	voice->active = 0;
+	voice->clip = clip;
+	voice->state = clip->start;
+	voice->position = 0;
+	voice->phase = 0;
+	voice->step = (uint32_t)(((uint64_t)clip->rate << ADPCM_PHASE_SHIFT) / output_sample_rate);
+	voice->previous = 0;
+	voice->current = 0;
+	voice->gain = gain;
+	voice->looping = (loop && clip->loop_end != ADPCM_NO_LOOP) ? 1 : 0;
+	voice->active = 1;
+}
+
+/*
+ * @name   adpcm_voice_mix
+ * @brief  Decodes and adds a block of a clip into a mix accumulator
+ *
+ * Decodes straight from the clip's flash bytes with the decoder state and position in locals.
+ * A held voice jumps back to loop_start at loop_end with the decoder state the encoder had
+ * there; a released one plays on to the end of the clip. The voice goes inactive when the
+ * clip ends, after the last sample has been interpolated out.
+ *
+ * @param  adpcm_voice_t *voice, int32_t *mix, uint32_t count (samples), int32_t gain (Q15)
+ * @return void
+ */
+void adpcm_voice_mix(adpcm_voice_t *voice, int32_t *mix, uint32_t count, int32_t gain)
+{
+	const adpcm_clip_t *clip = voice->clip;
+	const uint8_t *data = clip->data;
+	adpcm_state_t state = voice->state;
+	uint32_t position = voice->position, phase = voice->phase, step = voice->step;
+	int32_t previous = voice->previous, current = voice->current;
+
+	while(count--)
+	{
+		int32_t s;
+
+		phase += step;
+		while(phase >= PHASE_ONE)
+		{
+			phase -= PHASE_ONE;
+			previous = current;
+			if(voice->looping && position == clip->loop_end)
+			{
+				position = clip->loop_start;
+				state = clip->loop;
+			}
+			if(position < clip->samples)
+			{
+				uint32_t code = data[position >> 1];
+
+				code = (position & 1) ? (code >> NIBBLE_BITS) : (code & NIBBLE_MASK);
+				current = decode(&state, code);
+				position++;
+			}
+			else if(current == 0 && previous == 0)
+			{
+				voice->active = 0;
+				return;
+			}
+			else
+				current = 0;  //Ramps the last sample down to silence
+		}
+		s = previous + (((current - previous) * (int32_t)(phase >> 1)) >> (ADPCM_PHASE_SHIFT - 1));
+		*mix++ += (s * gain) >> 15;
+	}
+	voice->state = state;
+	voice->position = position;
+	voice->phase = phase;
+	voice->previous = previous;
+	voice->current = current;
+}
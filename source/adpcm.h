@@ -0,0 +1,99 @@
+/*
+ * @file        adpcm.h
+ * @brief       IMA-ADPCM sample playback function declarations
+ *
+ * Clips are stored in flash as 4-bit IMA-ADPCM, a quarter of 16-bit PCM, and decoded on the
+ * fly a block at a time into the mix, resampled to the output sample rate. A clip may loop a
+ * section while held and play the rest of the clip when released. host/wav2adpcm converts WAV
+ * files into the clip bank source/adpcm_clips.c.
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       MCUXpresso IDE, gcc
+ * @references  IMA Digital Audio Focus and Technical Working Groups, "Recommended Practices for
+ *              Enhancing Digital Audio Compatibility in Multimedia Systems", rev 3.00, 1992
+ */
+
+#ifndef ADPCM_H_
+#define ADPCM_H_
+
+#include <stdint.h>
+
+#define ADPCM_STEPS       (89)        //Quantiser step sizes
+#define ADPCM_PHASE_SHIFT (16)        //Voice position fraction, Q16
+#define ADPCM_NO_LOOP     (0)         //loop_end of a clip that does not loop
+
+//Decoder state: the last sample and the step size index
+typedef struct adpcm_state
+{
+	int16_t predictor;
+	uint8_t index;
+} adpcm_state_t;
+
+//A clip in flash
+typedef struct adpcm_clip
+{
+	const uint8_t *data;     //Two samples per byte, the earlier in the low nibble
+	uint32_t samples;
+	uint32_t rate;           //Hz
+	uint32_t loop_start;     //First sample of the loop
+	uint32_t loop_end;       //Sample after the loop, ADPCM_NO_LOOP for a one-shot clip
+	adpcm_state_t start;     //Decoder state before the first sample
+	adpcm_state_t loop;      //Decoder state before loop_start
+} adpcm_clip_t;
+
+//A clip playing
+typedef struct adpcm_voice
+{
+	const adpcm_clip_t *clip;
+	adpcm_state_t state;
+	uint32_t position;       //Next sample to decode
+	uint32_t phase;          //Q16 of the way from previous to current
+	uint32_t step;           //Q16 clip samples per output sample
+	int32_t previous;        //Last two decoded samples, interpolated between
+	int32_t current;
+	int32_t gain;            //Q15
+	uint32_t age;            //Start order, as voice_t
+	uint8_t looping;         //Held: wraps at loop_end
+	uint8_t active;
+} adpcm_voice_t;
+
+extern const int16_t adpcm_step_table[ADPCM_STEPS];
+extern const int8_t adpcm_index_table[16];
+
+//Clip bank, generated by host/wav2adpcm into adpcm_clips.c
+extern const adpcm_clip_t *const adpcm_clips[];
+extern const char *const adpcm_clip_names[];
+extern const uint32_t adpcm_clip_count;
+
+/*
+ * @name   adpcm_decode
+ * @brief  Decodes one 4-bit code and advances the decoder
+ *
+ * @param  adpcm_state_t *state, uint8_t code (0..15)
+ * @return int32_t sample, Q15
+ */
+int32_t adpcm_decode(adpcm_state_t *state, uint8_t code);
+
+/*
+ * @name   adpcm_voice_start
+ * @brief  Starts a clip from its first sample at the output sample rate
+ *
+ * The voice is marked active last, so an interrupt never mixes a half set up voice
+ *
+ * @param  adpcm_voice_t *voice, const adpcm_clip_t *clip, int32_t gain (Q15), int loop (held on its loop)
+ * @return void
+ */
+void adpcm_voice_start(adpcm_voice_t *voice, const adpcm_clip_t *clip, int32_t gain, int loop);
+
+/*
+ * @name   adpcm_voice_mix
+ * @brief  Decodes and adds a block of a clip into a mix accumulator
+ *
+ * The voice goes inactive when the clip ends
+ *
+ * @param  adpcm_voice_t *voice, int32_t *mix, uint32_t count (samples), int32_t gain (Q15)
+ * @return void
+ */
+void adpcm_voice_mix(adpcm_voice_t *voice, int32_t *mix, uint32_t count, int32_t gain);
+
+#endif /* ADPCM_H_ */
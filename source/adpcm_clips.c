@@ -0,0 +1,713 @@
+/*
+ * @file        adpcm_clips.c
+ * @brief       Flash IMA-ADPCM clip bank
+ *
+ * Generated by host/wav2adpcm.c, do not edit. Rebuild with make -C host clips.
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       gcc
+ */
+
+#include "adpcm.h"
+
+//pluck.wav: 16000 samples at 16000 Hz, loop 6000..7968
+static const uint8_t pluck_codes[8000] =
+{
+	0x80, 0x9b, 0x22, 0xc6, 0x09, 0x91, 0x11, 0x6a, 0xa1, 0xa2, 0xc8, 0x24, 0x18, 0x0e, 0x90, 0x92,
+	0x83, 0x0e, 0x90, 0x22, 0xca, 0x89, 0x48, 0x90, 0xa6, 0xb2, 0x0a, 0x06, 0xb1, 0x0b, 0x95, 0x99,
+	0x28, 0x83, 0x8d, 0x01, 0x18, 0x28, 0x86, 0x08, 0xaa, 0x70, 0x00, 0xaa, 0x91, 0x10, 0x31, 0xcd,
+	0x80, 0x41, 0xc8, 0x9b, 0x28, 0x83, 0x23, 0x88, 0xbf, 0x44, 0xa2, 0x9d, 0x22, 0xaa, 0x19, 0x24,
+	0xcb, 0x18, 0x10, 0x01, 0x26, 0x08, 0xba, 0x59, 0x14, 0xc9, 0x89, 0x00, 0x32, 0xf9, 0x0a, 0x20,
+	0xc3, 0x9d, 0x09, 0x13, 0x21, 0x80, 0xdc, 0x51, 0x02, 0xbc, 0x21, 0xb0, 0x0b, 0x34, 0xd8, 0x1a,
+	0x01, 0x01, 0x54, 0x00, 0xa9, 0x2b, 0x26, 0xb0, 0x9b, 0x08, 0x42, 0xd1, 0x9c, 0x20, 0x83, 0xce,
+	0x89, 0x22, 0x11, 0x02, 0xea, 0x39, 0x16, 0xc9, 0x19, 0xa2, 0x9a, 0x51, 0xb1, 0x8b, 0x11, 0x11,
+	0x63, 0x12, 0xa9, 0x8c, 0x54, 0x91, 0xab, 0x88, 0x31, 0xa2, 0xaf, 0x08, 0x23, 0xec, 0x9a, 0x21,
+	0x12, 0x12, 0xc9, 0x1c, 0x26, 0xb0, 0x0c, 0x82, 0xba, 0x30, 0x84, 0xac, 0x10, 0x11, 0x52, 0x24,
+	0x98, 0xbb, 0x73, 0x02, 0xbb, 0x89, 0x20, 0x84, 0xcc, 0x0a, 0x23, 0xf8, 0xac, 0x10, 0x22, 0x12,
+	0xb0, 0x9c, 0x64, 0x91, 0x9c, 0x11, 0xb9, 0x29, 0x14, 0xca, 0x09, 0x12, 0x32, 0x27, 0x91, 0xba,
+	0x40, 0x15, 0xb9, 0x9a, 0x28, 0x13, 0xfa, 0x8b, 0x31, 0xc0, 0xbe, 0x19, 0x22, 0x23, 0x91, 0xbd,
+	0x62, 0x03, 0xbc, 0x28, 0xb8, 0x8a, 0x25, 0xb8, 0x8b, 0x21, 0x43, 0x46, 0x01, 0xaa, 0x19, 0x26,
+	0xa0, 0xab, 0x19, 0x32, 0xd8, 0xad, 0x20, 0x92, 0xde, 0x89, 0x21, 0x22, 0x01, 0xcb, 0x48, 0x15,
+	0xc9, 0x09, 0xa1, 0x9a, 0x42, 0xb1, 0xab, 0x20, 0x43, 0x36, 0x04, 0xa8, 0x8a, 0x35, 0x92, 0xbc,
+	0x89, 0x32, 0xb1, 0xbf, 0x18, 0x02, 0xfc, 0x9a, 0x20, 0x32, 0x02, 0xc9, 0x2a, 0x36, 0xb8, 0x8c,
+	0x81, 0xab, 0x30, 0x84, 0xbc, 0x18, 0x42, 0x44, 0x24, 0x98, 0x9a, 0x52, 0x03, 0xcb, 0x9a, 0x21,
+	0x82, 0xdd, 0x89, 0x12, 0xe9, 0xac, 0x29, 0x32, 0x23, 0xb8, 0x8c, 0x45, 0x91, 0x9c, 0x08, 0xb9,
+	0x29, 0x14, 0xca, 0x0a, 0x32, 0x45, 0x34, 0x80, 0xaa, 0x40, 0x15, 0xb9, 0x9b, 0x28, 0x03, 0xfb,
+	0x9b, 0x21, 0xd0, 0xbe, 0x09, 0x32, 0x33, 0x90, 0x9c, 0x62, 0x02, 0xcb, 0x88, 0xa8, 0x0a, 0x43,
+	0xc8, 0x8b, 0x21, 0x45, 0x34, 0x02, 0xb9, 0x28, 0x36, 0xb0, 0xac, 0x19, 0x12, 0xd8, 0xac, 0x28,
+	0xa1, 0xcf, 0x9a, 0x22, 0x33, 0x82, 0xbb, 0x50, 0x15, 0xb9, 0x8b, 0x98, 0x9c, 0x42, 0x90, 0xac,
+	0x10, 0x44, 0x35, 0x13, 0xa8, 0x1a, 0x44, 0x92, 0xbc, 0x0a, 0x31, 0xb0, 0xbf, 0x19, 0x81, 0xdd,
+	0xab, 0x20, 0x34, 0x02, 0xa9, 0x3a, 0x36, 0xc0, 0xaa, 0x88, 0xab, 0x30, 0x84, 0xbc, 0x19, 0x44,
+	0x45, 0x23, 0x90, 0x9a, 0x53, 0x02, 0xca, 0x9b, 0x21, 0x91, 0xcd, 0x8a, 0x01, 0xfa, 0xad, 0x18,
+	0x32, 0x22, 0xa8, 0x0a, 0x45, 0x91, 0xbb, 0x99, 0xba, 0x29, 0x15, 0xca, 0x0b, 0x52, 0x45, 0x33,
+	0x92, 0xa9, 0x41, 0x24, 0xc9, 0xab, 0x10, 0x02, 0xfb, 0x8b, 0x00, 0xd8, 0xae, 0x0a, 0x32, 0x33,
+	0x90, 0x9a, 0x72, 0x02, 0xca, 0x99, 0x99, 0x0a, 0x32, 0xc8, 0x9c, 0x41, 0x54, 0x24, 0x02, 0xa8,
+	0x28, 0x34, 0xa0, 0xad, 0x09, 0x02, 0xc9, 0xad, 0x18, 0xa8, 0xcf, 0x9a, 0x31, 0x33, 0x82, 0x9a,
+	0x50, 0x14, 0xb9, 0xab, 0xaa, 0x9b, 0x42, 0xa1, 0xbd, 0x30, 0x56, 0x53, 0x12, 0x98, 0x08, 0x43,
+	0x91, 0xcb, 0x8a, 0x21, 0xb8, 0xbe, 0x89, 0x90, 0xcf, 0xab, 0x20, 0x34, 0x02, 0xa8, 0x28, 0x26,
+	0xb0, 0xbb, 0xa9, 0xab, 0x30, 0x83, 0xbe, 0x19, 0x55, 0x35, 0x24, 0x90, 0x88, 0x41, 0x02, 0xca,
+	0x9a, 0x10, 0x90, 0xcd, 0x8a, 0x90, 0xfb, 0xad, 0x18, 0x32, 0x13, 0x98, 0x19, 0x44, 0x91, 0xcb,
+	0x9a, 0xaa, 0x18, 0x12, 0xda, 0x0b, 0x73, 0x35, 0x25, 0x81, 0x89, 0x21, 0x13, 0xc8, 0xbb, 0x18,
+	0x81, 0xdc, 0x9c, 0x08, 0xda, 0xcd, 0x09, 0x31, 0x33, 0x80, 0x0a, 0x52, 0x02, 0xca, 0xab, 0xaa,
+	0x0a, 0x22, 0xd8, 0x9b, 0x61, 0x36, 0x35, 0x11, 0x89, 0x10, 0x33, 0xa0, 0xbd, 0x89, 0x11, 0xda,
+	0xad, 0x88, 0xb9, 0xcf, 0x9a, 0x31, 0x33, 0x02, 0x99, 0x41, 0x14, 0xb9, 0xbc, 0xaa, 0x8a, 0x30,
+	0xa0, 0xbd, 0x40, 0x56, 0x34, 0x13, 0x90, 0x18, 0x42, 0x81, 0xdb, 0x99, 0x10, 0xb8, 0xbd, 0x8b,
+	0xb8, 0xdf, 0xab, 0x20, 0x43, 0x12, 0x98, 0x20, 0x43, 0xb0, 0xbc, 0xab, 0xab, 0x20, 0x81, 0xcc,
+	0x19, 0x57, 0x34, 0x14, 0x81, 0x88, 0x32, 0x02, 0xda, 0xaa, 0x00, 0x90, 0xcd, 0x9a, 0x99, 0xdd,
+	0xcb, 0x08, 0x33, 0x14, 0x80, 0x08, 0x33, 0x92, 0xcc, 0xbb, 0xaa, 0x19, 0x02, 0xda, 0x0a, 0x74,
+	0x44, 0x24, 0x00, 0x08, 0x20, 0x22, 0xb9, 0xac, 0x09, 0x80, 0xdc, 0xab, 0x98, 0xdc, 0xbd, 0x0a,
+	0x32, 0x24, 0x81, 0x08, 0x42, 0x02, 0xda, 0xab, 0xba, 0x09, 0x11, 0xb9, 0x9c, 0x72, 0x46, 0x33,
+	0x03, 0x80, 0x20, 0x23, 0xb1, 0xbd, 0x8a, 0x00, 0xdb, 0xad, 0x9a, 0xda, 0xcd, 0x9a, 0x31, 0x33,
+	0x03, 0x88, 0x41, 0x13, 0xd8, 0xcb, 0xaa, 0x8a, 0x10, 0xa0, 0xbb, 0x70, 0x55, 0x34, 0x13, 0x00,
+	0x18, 0x32, 0x81, 0xbc, 0x9b, 0x08, 0xd9, 0xbd, 0x9a, 0xca, 0xce, 0xab, 0x20, 0x43, 0x12, 0x80,
+	0x20, 0x24, 0xa0, 0xbd, 0xab, 0xaa, 0x00, 0x91, 0xca, 0x39, 0x77, 0x43, 0x23, 0x00, 0x18, 0x21,
+	0x02, 0xca, 0xab, 0x08, 0xb8, 0xce, 0xaa, 0xaa, 0xce, 0xac, 0x19, 0x42, 0x22, 0x80, 0x10, 0x32,
+	0x92, 0xcc, 0xac, 0xaa, 0x08, 0x00, 0xb9, 0x0a, 0x57, 0x45, 0x23, 0x02, 0x80, 0x21, 0x12, 0xb8,
+	0xbc, 0x89, 0x98, 0xcd, 0xac, 0xa9, 0xdc, 0xbc, 0x0a, 0x41, 0x23, 0x82, 0x00, 0x42, 0x01, 0xca,
+	0xbc, 0xaa, 0x0a, 0x00, 0xb8, 0x8b, 0x74, 0x46, 0x43, 0x11, 0x00, 0x10, 0x12, 0xa0, 0xbb, 0x8b,
+	0x98, 0xfb, 0xcb, 0xaa, 0xdb, 0xcd, 0x8a, 0x20, 0x24, 0x02, 0x80, 0x21, 0x13, 0xc8, 0xbc, 0xac,
+	0x99, 0x00, 0x90, 0x9b, 0x61, 0x47, 0x43, 0x13, 0x00, 0x10, 0x22, 0x80, 0xca, 0x9b, 0x88, 0xca,
+	0xbd, 0xbb, 0xeb, 0xcc, 0xab, 0x28, 0x53, 0x12, 0x00, 0x20, 0x22, 0xa0, 0xcd, 0xba, 0x9a, 0x08,
+	0x90, 0xaa, 0x48, 0x67, 0x34, 0x23, 0x02, 0x00, 0x22, 0x82, 0xc9, 0xbb, 0x89, 0xb9, 0xbf, 0xbb,
+	0xdb, 0xdc, 0xbb, 0x19, 0x43, 0x23, 0x01, 0x10, 0x33, 0x81, 0xcd, 0xac, 0x9b, 0x09, 0x80, 0xa9,
+	0x19, 0x67, 0x44, 0x23, 0x12, 0x00, 0x21, 0x11, 0xb8, 0xac, 0x8a, 0xa9, 0xcd, 0xcb, 0xba, 0xdc,
+	0xbc, 0x0a, 0x31, 0x34, 0x11, 0x00, 0x32, 0x02, 0xea, 0xcb, 0xab, 0x89, 0x80, 0xa8, 0x89, 0x75,
+	0x54, 0x33, 0x12, 0x01, 0x20, 0x21, 0xa0, 0xcb, 0xaa, 0xa8, 0xeb, 0xbc, 0xba, 0xcd, 0xbc, 0x9b,
+	0x21, 0x25, 0x12, 0x10, 0x21, 0x12, 0xc8, 0xbd, 0xbb, 0x99, 0x08, 0xa8, 0x8a, 0x72, 0x47, 0x34,
+	0x22, 0x01, 0x10, 0x12, 0x81, 0xbb, 0x9c, 0x99, 0xda, 0xbc, 0xcb, 0xdb, 0xbc, 0xac, 0x10, 0x33,
+	0x14, 0x01, 0x21, 0x22, 0xa0, 0xbe, 0xac, 0x9a, 0x09, 0x88, 0xa9, 0x41, 0x67, 0x43, 0x23, 0x02,
+	0x01, 0x12, 0x01, 0xb9, 0xac, 0x99, 0xca, 0xcc, 0xbb, 0xbc, 0xbe, 0xac, 0x09, 0x42, 0x32, 0x01,
+	0x11, 0x32, 0x80, 0xdc, 0xcb, 0x9a, 0x89, 0x80, 0x99, 0x28, 0x67, 0x34, 0x24, 0x12, 0x10, 0x11,
+	0x11, 0xa8, 0xcb, 0xa9, 0xa9, 0xdc, 0xbb, 0xbc, 0xcd, 0xcb, 0x89, 0x31, 0x33, 0x13, 0x11, 0x32,
+	0x02, 0xeb, 0xbd, 0xaa, 0x8a, 0x88, 0x98, 0x19, 0x75, 0x35, 0x25, 0x22, 0x00, 0x11, 0x11, 0x90,
+	0xba, 0xab, 0xaa, 0xdc, 0xbc, 0xcb, 0xcc, 0xcb, 0x8b, 0x20, 0x43, 0x13, 0x11, 0x21, 0x12, 0xc9,
+	0xdc, 0xba, 0x99, 0x88, 0x98, 0x89, 0x73, 0x37, 0x44, 0x12, 0x11, 0x10, 0x11, 0x80, 0xaa, 0xab,
+	0xaa, 0xdb, 0xbd, 0xcb, 0xdb, 0xbc, 0xab, 0x18, 0x34, 0x23, 0x12, 0x21, 0x23, 0xa8, 0xbf, 0xbc,
+	0x9a, 0x88, 0x98, 0x89, 0x51, 0x57, 0x53, 0x22, 0x11, 0x10, 0x11, 0x81, 0xb8, 0xba, 0xaa, 0xda,
+	0xbc, 0xcc, 0xbb, 0xbe, 0xbb, 0x09, 0x43, 0x33, 0x12, 0x21, 0x23, 0x91, 0xdd, 0xcb, 0x9a, 0x99,
+	0x90, 0x98, 0x30, 0x67, 0x44, 0x23, 0x12, 0x11, 0x11, 0x01, 0x98, 0xcb, 0x9a, 0xba, 0xbd, 0xbd,
+	0xdb, 0xdb, 0xbb, 0x8a, 0x32, 0x34, 0x12, 0x12, 0x32, 0x81, 0xea, 0xbc, 0xbb, 0x9a, 0x88, 0x98,
+	0x29, 0x67, 0x54, 0x23, 0x13, 0x02, 0x21, 0x11, 0x98, 0xca, 0xaa, 0xaa, 0xcc, 0xbc, 0xbc, 0xbd,
+	0xad, 0x9a, 0x20, 0x33, 0x33, 0x21, 0x32, 0x12, 0xca, 0xce, 0xba, 0x9a, 0x88, 0x89, 0x19, 0x73,
+	0x47, 0x33, 0x33, 0x12, 0x11, 0x21, 0x80, 0xca, 0xba, 0xba, 0xeb, 0xbc, 0xbc, 0xcc, 0xcb, 0xab,
+	0x18, 0x43, 0x23, 0x12, 0x22, 0x12, 0xa8, 0xce, 0xbb, 0xaa, 0x99, 0x88, 0x89, 0x72, 0x46, 0x44,
+	0x22, 0x12, 0x11, 0x20, 0x00, 0xa9, 0xbb, 0xba, 0xdb, 0xcc, 0xcb, 0xdb, 0xcb, 0xbb, 0x08, 0x41,
+	0x33, 0x12, 0x22, 0x22, 0x90, 0xdc, 0xbc, 0xab, 0x99, 0x88, 0x89, 0x41, 0x57, 0x44, 0x33, 0x12,
+	0x12, 0x11, 0x01, 0xa8, 0xbb, 0xbb, 0xdb, 0xcc, 0xbc, 0xdb, 0xdb, 0xab, 0x8a, 0x31, 0x24, 0x13,
+	0x12, 0x22, 0x01, 0xdb, 0xcc, 0xab, 0x8a, 0x89, 0x89, 0x20, 0x57, 0x35, 0x34, 0x23, 0x12, 0x11,
+	0x11, 0x98, 0xba, 0xcb, 0xba, 0xbd, 0xbd, 0xcc, 0xcb, 0xcb, 0x9a, 0x20, 0x33, 0x33, 0x32, 0x22,
+	0x12, 0xda, 0xbd, 0xbc, 0x9a, 0x89, 0x89, 0x18, 0x74, 0x45, 0x34, 0x32, 0x11, 0x12, 0x11, 0x90,
+	0xb9, 0xbb, 0xbb, 0xcd, 0xcc, 0xbb, 0xbd, 0xad, 0x9b, 0x08, 0x33, 0x24, 0x12, 0x22, 0x02, 0xb0,
+	0xcd, 0xac, 0xaa, 0x99, 0x88, 0x09, 0x73, 0x45, 0x35, 0x23, 0x22, 0x11, 0x11, 0x01, 0xa9, 0xcb,
+	0xba, 0xcb, 0xbd, 0xcc, 0xcb, 0xbc, 0xab, 0x09, 0x32, 0x34, 0x23, 0x22, 0x12, 0x90, 0xdc, 0xbc,
+	0xab, 0x9a, 0x98, 0x88, 0x52, 0x47, 0x35, 0x43, 0x12, 0x11, 0x11, 0x01, 0x98, 0xab, 0xbb, 0xdb,
+	0xdb, 0xbc, 0xdb, 0xbc, 0xab, 0x8a, 0x30, 0x34, 0x23, 0x23, 0x22, 0x81, 0xeb, 0xcc, 0xaa, 0x9a,
+	0x89, 0x88, 0x30, 0x57, 0x44, 0x24, 0x13, 0x12, 0x11, 0x01, 0x90, 0xb9, 0xbb, 0xcb, 0xcc, 0xbc,
+	0xcc, 0xcb, 0xbb, 0x9b, 0x20, 0x53, 0x32, 0x21, 0x22, 0x01, 0xc9, 0xcc, 0xac, 0x9a, 0x89, 0x98,
+	0x20, 0x74, 0x44, 0x34, 0x23, 0x22, 0x21, 0x11, 0x80, 0xaa, 0xac, 0xbb, 0xcc, 0xbc, 0xbd, 0xbc,
+	0xbc, 0x9b, 0x19, 0x33, 0x34, 0x23, 0x22, 0x12, 0xb8, 0xce, 0xbb, 0x9c, 0x99, 0x89, 0x18, 0x73,
+	0x45, 0x44, 0x22, 0x22, 0x11, 0x11, 0x00, 0x99, 0xbb, 0xbb, 0xcc, 0xcc, 0xcb, 0xbc, 0xbc, 0xab,
+	0x89, 0x32, 0x34, 0x33, 0x22, 0x22, 0xa0, 0xdc, 0xbc, 0xbb, 0x9a, 0x99, 0x08, 0x72, 0x45, 0x35,
+	0x24, 0x23, 0x11, 0x11, 0x01, 0x98, 0xba, 0xcb, 0xcb, 0xdb, 0xdb, 0xcb, 0xcb, 0xab, 0x8a, 0x21,
+	0x43, 0x23, 0x23, 0x22, 0x80, 0xdb, 0xbd, 0xbb, 0x9b, 0x8a, 0x89, 0x42, 0x57, 0x44, 0x43, 0x22,
+	0x21, 0x11, 0x01, 0x88, 0xaa, 0xbb, 0xdb, 0xdb, 0xcb, 0xbc, 0xbc, 0xbc, 0x8a, 0x28, 0x42, 0x32,
+	0x22, 0x22, 0x01, 0xc9, 0xdc, 0xba, 0x9b, 0x99, 0x89, 0x30, 0x56, 0x45, 0x34, 0x32, 0x22, 0x11,
+	0x11, 0x80, 0xa9, 0xcb, 0xbb, 0xcc, 0xbc, 0xbd, 0xbc, 0xbc, 0xaa, 0x18, 0x32, 0x34, 0x32, 0x22,
+	0x11, 0xb8, 0xdd, 0xbb, 0xab, 0x9a, 0x99, 0x10, 0x65, 0x45, 0x34, 0x33, 0x33, 0x21, 0x12, 0x80,
+	0xa8, 0xac, 0xcb, 0xcb, 0xcc, 0xcb, 0xbc, 0xbc, 0xba, 0x88, 0x31, 0x34, 0x23, 0x23, 0x12, 0xa0,
+	0xdc, 0xdb, 0xaa, 0x9a, 0x89, 0x18, 0x52, 0x56, 0x53, 0x32, 0x23, 0x12, 0x11, 0x01, 0x98, 0xba,
+	0xbc, 0xcb, 0xcc, 0xdb, 0xcb, 0xcb, 0xba, 0x89, 0x20, 0x43, 0x32, 0x32, 0x12, 0x80, 0xea, 0xcb,
+	0xbb, 0xab, 0x99, 0x08, 0x42, 0x57, 0x44, 0x33, 0x33, 0x22, 0x12, 0x02, 0x88, 0xba, 0xbc, 0xbc,
+	0xcc, 0xbc, 0xcc, 0xcb, 0xba, 0x9a, 0x28, 0x42, 0x23, 0x23, 0x23, 0x81, 0xc9, 0xcd, 0xba, 0xab,
+	0x8a, 0x89, 0x31, 0x57, 0x44, 0x34, 0x33, 0x22, 0x22, 0x01, 0x80, 0xa9, 0xcb, 0xcb, 0xbc, 0xcc,
+	0xdb, 0xbb, 0xbc, 0x9b, 0x19, 0x32, 0x34, 0x23, 0x23, 0x02, 0xb8, 0xbe, 0xbd, 0xaa, 0x9a, 0x89,
+	0x10, 0x55, 0x55, 0x43, 0x23, 0x23, 0x12, 0x11, 0x81, 0xa8, 0xbb, 0xbc, 0xcc, 0xbc, 0xbc, 0xbd,
+	0xac, 0xab, 0x09, 0x21, 0x43, 0x33, 0x22, 0x12, 0x98, 0xcc, 0xbd, 0xba, 0x9a, 0x99, 0x18, 0x73,
+	0x45, 0x44, 0x33, 0x23, 0x22, 0x12, 0x00, 0x98, 0xba, 0xbc, 0xcc, 0xcb, 0xcc, 0xbb, 0xbd, 0xba,
+	0x99, 0x11, 0x43, 0x33, 0x23, 0x22, 0x80, 0xdb, 0xbd, 0xbb, 0xab, 0x9a, 0x08, 0x53, 0x47, 0x44,
+	0x43, 0x32, 0x12, 0x21, 0x00, 0x80, 0xaa, 0xbb, 0xbd, 0xbc, 0xbd, 0xcc, 0xbb, 0xac, 0x9a, 0x18,
+	0x42, 0x32, 0x23, 0x22, 0x01, 0xca, 0xcc, 0xac, 0xaa, 0x8a, 0x09, 0x40, 0x64, 0x44, 0x34, 0x23,
+	0x23, 0x12, 0x11, 0x80, 0xa9, 0xcb, 0xcb, 0xbc, 0xcc, 0xbc, 0xdb, 0xab, 0x9b, 0x08, 0x22, 0x34,
+	0x33, 0x22, 0x11, 0xb9, 0xcd, 0xbc, 0xba, 0x9a, 0x89, 0x20, 0x56, 0x54, 0x53, 0x32, 0x22, 0x21,
+	0x01, 0x00, 0x99, 0xba, 0xdb, 0xcb, 0xdb, 0xcb, 0xbc, 0xcb, 0xaa, 0x09, 0x30, 0x33, 0x34, 0x22,
+	0x12, 0x98, 0xcc, 0xbc, 0xac, 0x9a, 0x99, 0x10, 0x73, 0x54, 0x53, 0x33, 0x32, 0x22, 0x11, 0x01,
+	0x98, 0xab, 0xbc, 0xbd, 0xdb, 0xdb, 0xbb, 0xad, 0xab, 0x8a, 0x10, 0x43, 0x23, 0x33, 0x12, 0x90,
+	0xda, 0xcc, 0xab, 0xab, 0x99, 0x08, 0x63, 0x45, 0x35, 0x34, 0x33, 0x32, 0x21, 0x01, 0x88, 0xba,
+	0xcb, 0xcc, 0xcb, 0xdb, 0xcb, 0xcb, 0xbb, 0x8a, 0x18, 0x32, 0x34, 0x33, 0x22, 0x81, 0xc9, 0xbd,
+	0xbc, 0xab, 0x9a, 0x09, 0x41, 0x56, 0x44, 0x43, 0x33, 0x22, 0x22, 0x11, 0x88, 0xa9, 0xca, 0xcb,
+	0xbc, 0xbd, 0xbc, 0xbc, 0xbc, 0x9a, 0x19, 0x31, 0x43, 0x23, 0x23, 0x01, 0xa9, 0xcd, 0xcb, 0xab,
+	0xaa, 0x89, 0x31, 0x65, 0x35, 0x35, 0x43, 0x22, 0x12, 0x11, 0x80, 0x98, 0xab, 0xbc, 0xbc, 0xbd,
+	0xcc, 0xbb, 0xad, 0x9b, 0x89, 0x21, 0x33, 0x24, 0x23, 0x02, 0x98, 0xeb, 0xcb, 0xbb, 0xaa, 0x89,
+	0x28, 0x64, 0x45, 0x34, 0x34, 0x32, 0x22, 0x12, 0x00, 0x98, 0xba, 0xdb, 0xcb, 0xbc, 0xbd, 0xbc,
+	0xac, 0xbb, 0x99, 0x20, 0x33, 0x25, 0x23, 0x11, 0x80, 0xca, 0xbd, 0xbb, 0xbb, 0x9a, 0x18, 0x73,
+	0x55, 0x53, 0x33, 0x33, 0x33, 0x12, 0x11, 0x88, 0xba, 0xbc, 0xbd, 0xbc, 0xbd, 0xcc, 0xbb, 0xbb,
+	0x9b, 0x18, 0x43, 0x43, 0x32, 0x12, 0x81, 0xb9, 0xbe, 0xbc, 0xba, 0x9a, 0x08, 0x51, 0x55, 0x44,
+	0x43, 0x32, 0x23, 0x12, 0x11, 0x80, 0xa9, 0xcb, 0xcb, 0xbc, 0xcc, 0xdb, 0xbb, 0xcb, 0x9a, 0x09,
+	0x22, 0x43, 0x23, 0x23, 0x01, 0xa9, 0xcd, 0xcb, 0xba, 0x9a, 0x89, 0x31, 0x56, 0x54, 0x43, 0x32,
+	0x33, 0x22, 0x11, 0x00, 0x99, 0xbb, 0xbd, 0xbc, 0xbd, 0xcc, 0xbb, 0xbc, 0xab, 0x89, 0x21, 0x43,
+	0x43, 0x22, 0x01, 0xa0, 0xcb, 0xcc, 0xab, 0xab, 0x89, 0x20, 0x64, 0x45, 0x34, 0x24, 0x33, 0x22,
+	0x11, 0x81, 0x88, 0xba, 0xbc, 0xcc, 0xcb, 0xbc, 0xbd, 0xbb, 0xac, 0x89, 0x10, 0x32, 0x24, 0x23,
+	0x12, 0x80, 0xda, 0xbc, 0xcb, 0xaa, 0x9a, 0x10, 0x63, 0x45, 0x44, 0x43, 0x32, 0x22, 0x12, 0x01,
+	0x88, 0xa9, 0xcb, 0xbc, 0xbc, 0xbd, 0xcc, 0xbb, 0xbb, 0x9a, 0x18, 0x42, 0x33, 0x24, 0x22, 0x80,
+	0xb9, 0xcd, 0xcb, 0xaa, 0x9a, 0x08, 0x42, 0x46, 0x44, 0x34, 0x33, 0x32, 0x22, 0x11, 0x88, 0x99,
+	0xac, 0xbc, 0xbd, 0xbc, 0xcc, 0xcb, 0xba, 0xaa, 0x08, 0x31, 0x43, 0x23, 0x23, 0x01, 0xb8, 0xcd,
+	0xcb, 0xab, 0x9b, 0x89, 0x41, 0x55, 0x44, 0x34, 0x24, 0x23, 0x12, 0x02, 0x81, 0xa8, 0xba, 0xdb,
+	0xbc, 0xbc, 0xbd, 0xbc, 0xac, 0xaa, 0x89, 0x11, 0x33, 0x34, 0x32, 0x11, 0xa8, 0xdb, 0xcc, 0xba,
+	0xaa, 0x99, 0x30, 0x64, 0x45, 0x53, 0x33, 0x32, 0x23, 0x12, 0x00, 0x88, 0xca, 0xca, 0xdb, 0xcb,
+	0xcb, 0xbc, 0xcb, 0xab, 0x99, 0x10, 0x33, 0x34, 0x32, 0x12, 0x80, 0xdb, 0xbc, 0xbc, 0xaa, 0x9a,
+	0x10, 0x73, 0x54, 0x34, 0x34, 0x33, 0x33, 0x12, 0x01, 0x80, 0xba, 0xdb, 0xdb, 0xcb, 0xbc, 0xbc,
+	0xbc, 0xbb, 0x9a, 0x08, 0x32, 0x25, 0x33, 0x12, 0x81, 0xc9, 0xbc, 0xcc, 0xaa, 0x9a, 0x18, 0x51,
+	0x54, 0x44, 0x34, 0x32, 0x33, 0x12, 0x02, 0x80, 0xa8, 0xcb, 0xbc, 0xbd, 0xdb, 0xbc, 0xcb, 0xab,
+	0x9b, 0x09, 0x31, 0x43, 0x33, 0x33, 0x01, 0xb9, 0xcd, 0xbc, 0xbb, 0xaa, 0x09, 0x41, 0x46, 0x45,
+	0x43, 0x33, 0x33, 0x22, 0x12, 0x00, 0x99, 0xcb, 0xcb, 0xcc, 0xcb, 0xbc, 0xbc, 0xbb, 0xbb, 0x89,
+	0x21, 0x43, 0x34, 0x22, 0x02, 0xa0, 0xdb, 0xbc, 0xbc, 0xaa, 0x89, 0x21, 0x55, 0x54, 0x53, 0x23,
+	0x33, 0x23, 0x21, 0x00, 0x98, 0xb9, 0xcc, 0xcb, 0xcc, 0xbb, 0xbd, 0xcb, 0xaa, 0x8a, 0x18, 0x33,
+	0x43, 0x23, 0x12, 0x80, 0xcb, 0xbd, 0xac, 0xab, 0x8a, 0x18, 0x54, 0x45, 0x44, 0x33, 0x24, 0x22,
+	0x12, 0x01, 0x88, 0xa9, 0xbb, 0xcd, 0xcb, 0xbc, 0xbc, 0xbc, 0xab, 0x9b, 0x00, 0x32, 0x34, 0x33,
+	0x23, 0x80, 0xc9, 0xbd, 0xbc, 0xac, 0x99, 0x08, 0x52, 0x54, 0x44, 0x43, 0x33, 0x23, 0x22, 0x11,
+	0x80, 0xa9, 0xcb, 0xdb, 0xdb, 0xcb, 0xcb, 0xcb, 0xbb, 0x9a, 0x09, 0x21, 0x43, 0x33, 0x23, 0x02,
+	0xb9, 0xcd, 0xcb, 0xbb, 0xaa, 0x09, 0x41, 0x46, 0x35, 0x35, 0x43, 0x22, 0x22, 0x11, 0x00, 0x99,
+	0xba, 0xdb, 0xbc, 0xcc, 0xcb, 0xcb, 0xbb, 0xaa, 0x89, 0x20, 0x33, 0x25, 0x23, 0x11, 0x98, 0xdb,
+	0xbc, 0xac, 0xaa, 0x89, 0x30, 0x55, 0x54, 0x43, 0x24, 0x23, 0x22, 0x12, 0x00, 0x90, 0xaa, 0xbc,
+	0xcc, 0xdb, 0xcb, 0xbb, 0xad, 0x9b, 0x8a, 0x18, 0x32, 0x43, 0x23, 0x12, 0x90, 0xca, 0xcc, 0xbb,
+	0xbb, 0x9a, 0x10, 0x55, 0x45, 0x34, 0x25, 0x33, 0x22, 0x22, 0x10, 0x88, 0xa9, 0xbc, 0xdb, 0xbc,
+	0xcc, 0xbb, 0xad, 0xab, 0x9a, 0x18, 0x21, 0x24, 0x33, 0x22, 0x00, 0xba, 0xbe, 0xbc, 0xbb, 0x9a,
+	0x08, 0x44, 0x46, 0x44, 0x43, 0x32, 0x23, 0x13, 0x02, 0x80, 0xa8, 0xcb, 0xdb, 0xdb, 0xcb, 0xcb,
+	0xcb, 0xab, 0xaa, 0x88, 0x21, 0x43, 0x33, 0x23, 0x81, 0xb8, 0xdc, 0xcb, 0xbb, 0xaa, 0x88, 0x52,
+	0x64, 0x53, 0x34, 0x33, 0x33, 0x33, 0x21, 0x00, 0xa9, 0xca, 0xbc, 0xbd, 0xcc, 0xcb, 0xcb, 0xba,
+	0xab, 0x89, 0x20, 0x33, 0x34, 0x33, 0x02, 0xa8, 0xeb, 0xdb, 0xba, 0xaa, 0x8a, 0x31, 0x46, 0x45,
+	0x34, 0x24, 0x33, 0x32, 0x21, 0x00, 0x98, 0xb9, 0xbc, 0xbd, 0xbd, 0xbc, 0xbc, 0xac, 0xab, 0x8a,
+	0x00, 0x32, 0x34, 0x23, 0x12, 0x90, 0xca, 0xbd, 0xbc, 0xba, 0x99, 0x20, 0x64, 0x54, 0x43, 0x34,
+	0x23, 0x33, 0x12, 0x11, 0x88, 0xb9, 0xdb, 0xdb, 0xcb, 0xbc, 0xbc, 0xcb, 0xbb, 0x99, 0x19, 0x31,
+	0x43, 0x33, 0x13, 0x81, 0xca, 0xcc, 0xbb, 0xac, 0xaa, 0x00, 0x63, 0x54, 0x44, 0x33, 0x34, 0x23,
+	0x22, 0x11, 0x80, 0x99, 0xcb, 0xbc, 0xcc, 0xdb, 0xbb, 0xbc, 0xac, 0x9a, 0x88, 0x11, 0x33, 0x24,
+	0x13, 0x01, 0xa9, 0xeb, 0xcb, 0xab, 0xaa, 0x09, 0x52, 0x64, 0x53, 0x43, 0x43, 0x22, 0x22, 0x11,
+	0x00, 0x99, 0xb9, 0xbc, 0xbd, 0xcc, 0xcb, 0xcb, 0xba, 0xaa, 0x99, 0x11, 0x42, 0x33, 0x32, 0x11,
+	0xa8, 0xdb, 0xcc, 0xbb, 0xaa, 0x0a, 0x40, 0x64, 0x44, 0x53, 0x33, 0x23, 0x33, 0x12, 0x01, 0x98,
+	0xba, 0xcc, 0xbc, 0xcc, 0xdb, 0xca, 0xba, 0xaa, 0x8a, 0x18, 0x32, 0x43, 0x32, 0x12, 0x90, 0xca,
+	0xbd, 0xcb, 0xab, 0x99, 0x20, 0x64, 0x54, 0x43, 0x24, 0x33, 0x23, 0x22, 0x11, 0x88, 0xb9, 0xdb,
+	0xdb, 0xcb, 0xbc, 0xbc, 0xcb, 0xab, 0x9a, 0x08, 0x22, 0x43, 0x33, 0x12, 0x81, 0xba, 0xcd, 0xbc,
+	0xba, 0x9a, 0x18, 0x73, 0x44, 0x35, 0x34, 0x33, 0x24, 0x12, 0x02, 0x80, 0xa8, 0xba, 0xbd, 0xbd,
+	0xbc, 0xbc, 0xbc, 0xac, 0x9a, 0x88, 0x11, 0x33, 0x33, 0x14, 0x01, 0xa9, 0xdb, 0xbc, 0xcb, 0x9a,
+	0x08, 0x41, 0x46, 0x63, 0x33, 0x34, 0x32, 0x23, 0x21, 0x80, 0x98, 0xca, 0xcb, 0xcc, 0xcb, 0xbc,
+	0xcb, 0xbb, 0xaa, 0x8a, 0x20, 0x42, 0x33, 0x33, 0x11, 0xa8, 0xeb, 0xbc, 0xcb, 0xaa, 0x09, 0x30,
+	0x56, 0x44, 0x43, 0x24, 0x33, 0x22, 0x12, 0x01, 0x98, 0xb9, 0xbc, 0xbd, 0xbd, 0xdb, 0xcb, 0xba,
+	0xab, 0x99, 0x18, 0x32, 0x43, 0x33, 0x12, 0x90, 0xda, 0xbc, 0xbc, 0xba, 0x8a, 0x20, 0x65, 0x63,
+	0x43, 0x43, 0x33, 0x23, 0x22, 0x01, 0x90, 0xa9, 0xdb, 0xdb, 0xcb, 0xbc, 0xbc, 0xcb, 0xba, 0xa9,
+	0x18, 0x21, 0x33, 0x34, 0x22, 0x80, 0xc9, 0xdb, 0xac, 0xab, 0xaa, 0x10, 0x73, 0x44, 0x44, 0x43,
+	0x33, 0x33, 0x22, 0x11, 0x00, 0xa9, 0xcb, 0xcc, 0xcb, 0xcc, 0xca, 0xbb, 0xab, 0xab, 0x88, 0x21,
+	0x43, 0x33, 0x23, 0x82, 0xb8, 0xcd, 0xbc, 0xbb, 0x9b, 0x09, 0x63, 0x64, 0x53, 0x43, 0x33, 0x33,
+	0x32, 0x12, 0x00, 0xa8, 0xca, 0xdb, 0xbc, 0xcc, 0xbb, 0xbd, 0xba, 0xab, 0x89, 0x10, 0x33, 0x34,
+	0x23, 0x12, 0xa8, 0xcc, 0xbc, 0xac, 0xab, 0x09, 0x31, 0x47, 0x44, 0x34, 0x34, 0x33, 0x32, 0x12,
+	0x01, 0x88, 0xba, 0xcc, 0xbc, 0xbd, 0xdb, 0xbb, 0xbc, 0xaa, 0x9a, 0x00, 0x32, 0x43, 0x23, 0x22,
+	0x88, 0xcb, 0xcc, 0xcb, 0xaa, 0x8a, 0x20, 0x45, 0x36, 0x35, 0x53, 0x32, 0x22, 0x12, 0x11, 0x88,
+	0xa9, 0xcb, 0xdb, 0xbc, 0xcc, 0xbb, 0xbc, 0xba, 0x9a, 0x08, 0x21, 0x24, 0x33, 0x23, 0x80, 0xba,
+	0xcd, 0xbc, 0xab, 0x9a, 0x18, 0x54, 0x45, 0x44, 0x43, 0x33, 0x32, 0x23, 0x11, 0x80, 0x99, 0xcb,
+	0xcc, 0xdb, 0xbb, 0xbd, 0xcb, 0xab, 0xaa, 0x88, 0x11, 0x33, 0x34, 0x22, 0x01, 0xa9, 0xdc, 0xbb,
+	0xbc, 0xaa, 0x08, 0x53, 0x55, 0x34, 0x44, 0x33, 0x33, 0x23, 0x12, 0x81, 0x98, 0xbb, 0xbe, 0xbc,
+	0xbd, 0xbc, 0xbc, 0xbb, 0xab, 0x99, 0x20, 0x42, 0x33, 0x33, 0x11, 0xa8, 0xeb, 0xbc, 0xac, 0xaa,
+	0x89, 0x41, 0x45, 0x45, 0x43, 0x43, 0x32, 0x22, 0x22, 0x00, 0x90, 0xaa, 0xbc, 0xbd, 0xbd, 0xbc,
+	0xdb, 0xba, 0xaa, 0x9a, 0x00, 0x22, 0x43, 0x23, 0x12, 0x90, 0xca, 0xcc, 0xcb, 0xaa, 0x89, 0x20,
+	0x55, 0x44, 0x34, 0x34, 0x24, 0x23, 0x12, 0x01, 0x80, 0xa9, 0xcb, 0xbc, 0xbd, 0xcc, 0xbb, 0xcb,
+	0xab, 0x9a, 0x09, 0x21, 0x43, 0x33, 0x22, 0x80, 0xc9, 0xbc, 0xad, 0xbb, 0x9a, 0x10, 0x64, 0x44,
+	0x44, 0x33, 0x34, 0x33, 0x22, 0x11, 0x00, 0xa9, 0xcb, 0xbc, 0xcd, 0xbb, 0xbd, 0xbb, 0xac, 0x9b,
+	0x09, 0x10, 0x33, 0x24, 0x23, 0x00, 0xb8, 0xeb, 0xcb, 0xbb, 0xaa, 0x08, 0x63, 0x45, 0x44, 0x43,
+	0x43, 0x22, 0x13, 0x12, 0x00, 0x98, 0xba, 0xcc, 0xdb, 0xcb, 0xbc, 0xbb, 0xbc, 0xaa, 0x89, 0x18,
+	0x23, 0x34, 0x32, 0x11, 0xa8, 0xdb, 0xbc, 0xbc, 0xaa, 0x89, 0x42, 0x55, 0x44, 0x34, 0x43, 0x33,
+	0x32, 0x12, 0x01, 0x90, 0xaa, 0xbd, 0xcc, 0xcb, 0xbc, 0xbc, 0xbb, 0xab, 0x9a, 0x08, 0x32, 0x34,
+	0x33, 0x22, 0x90, 0xdb, 0xbc, 0xad, 0xab, 0x99, 0x21, 0x46, 0x35, 0x35, 0x34, 0x24, 0x32, 0x21,
+	0x01, 0x80, 0xa9, 0xcb, 0xbc, 0xbd, 0xbc, 0xcc, 0xba, 0xba, 0x9a, 0x08, 0x21, 0x42, 0x23, 0x22,
+	0x00, 0xba, 0xcd, 0xcb, 0xab, 0x9a, 0x10, 0x45, 0x45, 0x34, 0x35, 0x33, 0x33, 0x32, 0x11, 0x81,
+	0xa9, 0xcb, 0xbd, 0xcc, 0xdb, 0xca, 0xba, 0xbb, 0x9a, 0x89, 0x11, 0x42, 0x32, 0x23, 0x01, 0xa9,
+	0xdc, 0xcb, 0xab, 0xaa, 0x08, 0x63, 0x45, 0x44, 0x43, 0x33, 0x24, 0x22, 0x11, 0x81, 0x88, 0xba,
+	0xcc, 0xbc, 0xbc, 0xbd, 0xbb, 0xac, 0xab, 0x89, 0x10, 0x31, 0x43, 0x23, 0x11, 0xa8, 0xcb, 0xbd,
+	0xac, 0xab, 0x88, 0x42, 0x55, 0x44, 0x53, 0x42, 0x22, 0x22, 0x12, 0x00, 0x90, 0xa9, 0xdb, 0xcb,
+	0xbc, 0xad, 0xac, 0xbb, 0xba, 0x99, 0x18, 0x21, 0x24, 0x23, 0x13, 0x88, 0xcb, 0xcc, 0xcb, 0xaa,
+	0x89, 0x30, 0x55, 0x35, 0x35, 0x34, 0x43, 0x22, 0x12, 0x11, 0x90, 0xa8, 0xcb, 0xcc, 0xcb, 0xdb,
+	0xbb, 0xcb, 0xba, 0x99, 0x09, 0x11, 0x33, 0x24, 0x13, 0x00, 0xba, 0xbd, 0xbd, 0xba, 0x9a, 0x20,
+	0x64, 0x54, 0x53, 0x33, 0x34, 0x32, 0x22, 0x12, 0x80, 0xa8, 0xcb, 0xbc, 0xcd, 0xbb, 0xcc, 0xbb,
+	0xbb, 0xaa, 0x09, 0x10, 0x33, 0x34, 0x23, 0x01, 0xb8, 0xdc, 0xcb, 0xbb, 0x9b, 0x08, 0x54, 0x54,
+	0x44, 0x43, 0x33, 0x33, 0x33, 0x22, 0x00, 0x98, 0xcb, 0xcc, 0xdb, 0xcb, 0xcb, 0xcb, 0xba, 0xaa,
+	0x89, 0x18, 0x22, 0x24, 0x32, 0x01, 0xa0, 0xcb, 0xbd, 0xcb, 0xaa, 0x88, 0x42, 0x55, 0x44, 0x43,
+	0x24, 0x33, 0x32, 0x12, 0x11, 0x98, 0xb9, 0xcc, 0xbc, 0xcc, 0xcb, 0xcb, 0xba, 0xab, 0x99, 0x08,
+	0x22, 0x33, 0x24, 0x12, 0x90, 0xca, 0xcc, 0xbb, 0xbb, 0x8a, 0x41, 0x55, 0x35, 0x35, 0x34, 0x33,
+	0x33, 0x23, 0x02, 0x80, 0xb9, 0xcc, 0xbc, 0xbd, 0xbc, 0xbc, 0xac, 0xab, 0x9a, 0x08, 0x20, 0x32,
+	0x24, 0x22, 0x80, 0xb9, 0xdc, 0xbb, 0xac, 0x8a, 0x10, 0x45, 0x45, 0x34, 0x34, 0x34, 0x32, 0x32,
+	0x11, 0x80, 0xa8, 0xca, 0xcc, 0xcb, 0xbc, 0xbc, 0xac, 0xab, 0x9b, 0x89, 0x20, 0x22, 0x24, 0x23,
+	0x81, 0xa8, 0xcc, 0xbc, 0xbb, 0x9b, 0x29, 0x73, 0x45, 0x34, 0x35, 0x43, 0x32, 0x22, 0x12, 0x00,
+	0x98, 0xba, 0xcc, 0xcc, 0xcb, 0xcb, 0xbb, 0xac, 0x9b, 0x8a, 0x00, 0x22, 0x43, 0x22, 0x11, 0x98,
+	0xdb, 0xcb, 0xac, 0xaa, 0x08, 0x41, 0x46, 0x34, 0x35, 0x34, 0x33, 0x23, 0x13, 0x11, 0x98, 0xb9,
+	0xbd, 0xbd, 0xbd, 0xcb, 0xbc, 0xba, 0xbb, 0x99, 0x08, 0x31, 0x33, 0x34, 0x12, 0x90, 0xca, 0xbd,
+	0xbc, 0xaa, 0x8a, 0x41, 0x64, 0x44, 0x53, 0x33, 0x43, 0x32, 0x22, 0x01, 0x80, 0xa9, 0xdb, 0xdb,
+	0xcb, 0xcb, 0xbc, 0xca, 0xaa, 0x99, 0x88, 0x11, 0x22, 0x33, 0x13, 0x81, 0xba, 0xcd, 0xbc, 0xab,
+	0x9a, 0x20, 0x65, 0x44, 0x53, 0x43, 0x33, 0x23, 0x23, 0x12, 0x00, 0xa9, 0xcb, 0xcc, 0xbc, 0xcc,
+	0xbb, 0xbc, 0xbb, 0xaa, 0x88, 0x10, 0x32, 0x24, 0x23, 0x01, 0xa9, 0xcc, 0xbc, 0xac, 0x9a, 0x18,
+	0x63, 0x54, 0x34, 0x35, 0x33, 0x24, 0x23, 0x11, 0x01, 0x98, 0xba, 0xbd, 0xcc, 0xbc, 0xbc, 0xcb,
+	0xba, 0x9b, 0x8a, 0x18, 0x22, 0x43, 0x22, 0x02, 0x98, 0xdb, 0xdb, 0xbb, 0xaa, 0x09, 0x53, 0x55,
+	0x44, 0x43, 0x43, 0x32, 0x23, 0x12, 0x01, 0x90, 0xb9, 0xcc, 0xdb, 0xdb, 0xbb, 0xbc, 0xbb, 0xab,
+	0xaa, 0x00, 0x21, 0x24, 0x33, 0x22, 0x88, 0xcb, 0xbd, 0xbc, 0xab, 0x8a, 0x41, 0x46, 0x44, 0x44,
+	0x42, 0x32, 0x22, 0x13, 0x11, 0x80, 0xa9, 0xdb, 0xdb, 0xcb, 0xcb, 0xac, 0xbb, 0xbb, 0xaa, 0x88,
+	0x21, 0x42, 0x23, 0x13, 0x81, 0xba, 0xcd, 0xcb, 0xbb, 0x99, 0x20, 0x46, 0x45, 0x53, 0x43, 0x32,
+	0x33, 0x23, 0x12, 0x00, 0xa9, 0xcb, 0xcc, 0xbc, 0xcc, 0xbb, 0xbc, 0xba, 0xaa, 0x89, 0x10, 0x32,
+	0x43, 0x22, 0x01, 0xa9, 0xcc, 0xbc, 0xbb, 0x9b, 0x18, 0x55, 0x54, 0x34, 0x44, 0x33, 0x33, 0x23,
+	0x22, 0x81, 0x98, 0xca, 0xcc, 0xdb, 0xcb, 0xcb, 0xbb, 0xbb, 0xbb, 0x99, 0x18, 0x32, 0x53, 0x22,
+	0x11, 0x98, 0xdb, 0xcb, 0xac, 0xaa, 0x08, 0x42, 0x46, 0x35, 0x34, 0x34, 0x24, 0x22, 0x12, 0x01,
+	0x80, 0xaa, 0xbc, 0xbd, 0xcc, 0xcb, 0xbb, 0xcb, 0xaa, 0x9a, 0x08, 0x21, 0x33, 0x33, 0x12, 0x90,
+	0xda, 0xcc, 0xbb, 0xbb, 0x89, 0x42, 0x56, 0x34, 0x35, 0x34, 0x24, 0x23, 0x22, 0x01, 0x80, 0xa9,
+	0xdb, 0xdb, 0xcb, 0xbc, 0xcb, 0xba, 0xab, 0x9a, 0x08, 0x22, 0x34, 0x33, 0x33, 0x01, 0xa9, 0xcc,
+	0xbc, 0xbb, 0xab, 0x19, 0x62, 0x54, 0x34, 0x35, 0x43, 0x33, 0x23, 0x12, 0x01, 0xa9, 0xbc, 0xbe,
+	0xbc, 0xad, 0xcb, 0xaa, 0xaa, 0x88, 0x21, 0x43, 0x35, 0x33, 0x32, 0x02, 0x80, 0xba, 0xbd, 0xbc,
+	0xbc, 0xaa, 0xaa, 0x08, 0x31, 0x56, 0x43, 0x34, 0x43, 0x22, 0x11, 0x98, 0xba, 0xbe, 0xcc, 0xcb,
+	0xba, 0xab, 0x9a, 0x10, 0x44, 0x44, 0x34, 0x42, 0x12, 0x12, 0x80, 0x98, 0xba, 0xbc, 0xbd, 0xbb,
+	0xbc, 0xac, 0xaa, 0x88, 0x21, 0x44, 0x34, 0x43, 0x12, 0x81, 0xb9, 0xcc, 0xcc, 0xbb, 0xcb, 0x9a,
+	0x09, 0x32, 0x37, 0x45, 0x33, 0x24, 0x23, 0x12, 0x01, 0x88, 0xaa, 0xbc, 0xbd, 0xbc, 0xcc, 0xbb,
+	0xcb, 0xaa, 0x89, 0x10, 0x32, 0x34, 0x33, 0x12, 0xa8, 0xeb, 0xcc, 0xbb, 0xab, 0x9a, 0x20, 0x55,
+	0xa1, 0x89, 0x21, 0x33, 0x25, 0x22, 0x80, 0xb9, 0xbd, 0xbd, 0xba, 0x8a, 0x30, 0x56, 0x44, 0x34,
+	0x25, 0x43, 0x22, 0x22, 0x11, 0x00, 0x99, 0xca, 0xdb, 0xcb, 0xbc, 0xcb, 0xcb, 0xaa, 0xaa, 0x89,
+	0x10, 0x31, 0x32, 0x23, 0x01, 0xa9, 0xdc, 0xcb, 0xbb, 0x9a, 0x28, 0x64, 0x54, 0x34, 0x34, 0x34,
+	0x33, 0x32, 0x12, 0x01, 0x98, 0xca, 0xbc, 0xcd, 0xbb, 0xbd, 0xbb, 0xac, 0xaa, 0x99, 0x00, 0x21,
+	0x32, 0x33, 0x02, 0x98, 0xcc, 0xbc, 0xbc, 0xaa, 0x08, 0x63, 0x45, 0x44, 0x43, 0x43, 0x33, 0x32,
+	0x12, 0x02, 0x88, 0xba, 0xcc, 0xbc, 0xbd, 0xbc, 0xcb, 0xbb, 0xab, 0x9a, 0x08, 0x11, 0x33, 0x24,
+	0x12, 0x90, 0xca, 0xcc, 0xbb, 0xab, 0x89, 0x52, 0x55, 0x44, 0x53, 0x33, 0x43, 0x23, 0x22, 0x11,
+	0x80, 0xa9, 0xdb, 0xbc, 0xcc, 0xcb, 0xbb, 0xbc, 0xba, 0x9a, 0x09, 0x10, 0x32, 0x33, 0x23, 0x00,
+	0xca, 0xdc, 0xbb, 0xbb, 0x8a, 0x40, 0x55, 0x54, 0x43, 0x34, 0x33, 0x43, 0x22, 0x11, 0x00, 0xa8,
+	0xca, 0xbc, 0xcc, 0xbc, 0xcb, 0xbb, 0xbb, 0xab, 0x89, 0x10, 0x32, 0x43, 0x22, 0x01, 0xa9, 0xcc,
+	0xbc, 0xac, 0x9a, 0x10, 0x64, 0x44, 0x53, 0x24, 0x24, 0x23, 0x32, 0x21, 0x00, 0x98, 0xba, 0xdc,
+	0xcb, 0xbc, 0xbc, 0xcb, 0xba, 0xaa, 0x99, 0x18, 0x21, 0x32, 0x33, 0x02, 0x98, 0xcc, 0xcc, 0xba,
+	0x9b, 0x19, 0x73, 0x44, 0x44, 0x34, 0x43, 0x33, 0x33, 0x22, 0x01, 0x90, 0xba, 0xcc, 0xbd, 0xbc,
+	0xbc, 0xbc, 0xbb, 0xab, 0xaa, 0x08, 0x21, 0x42, 0x22, 0x12, 0x80, 0xca, 0xcc, 0xbb, 0xbb, 0x09,
+	0x52, 0x46, 0x44, 0x34, 0x34, 0x43, 0x32, 0x12, 0x02, 0x80, 0x99, 0xbc, 0xcc, 0xbc, 0xbc, 0xbc,
+	0xbb, 0xbb, 0xaa, 0x88, 0x10, 0x33, 0x43, 0x22, 0x80, 0xb9, 0xcd, 0xcb, 0xab, 0x8a, 0x31, 0x56,
+	0x44, 0x44, 0x33, 0x34, 0x32, 0x23, 0x12, 0x00, 0x99, 0xcb, 0xbd, 0xcc, 0xcb, 0xcb, 0xbb, 0xab,
+	0xab, 0x89, 0x00, 0x22, 0x24, 0x22, 0x01, 0xa9, 0xcc, 0xcb, 0xbb, 0x9b, 0x20, 0x46, 0x45, 0x44,
+	0x43, 0x33, 0x43, 0x22, 0x12, 0x00, 0x88, 0xba, 0xbd, 0xcc, 0xbc, 0xcb, 0xcb, 0xba, 0xaa, 0x89,
+	0x08, 0x21, 0x22, 0x33, 0x11, 0xa8, 0xdb, 0xcc, 0xab, 0xab, 0x18, 0x73, 0x54, 0x34, 0x44, 0x33,
+	0x43, 0x32, 0x12, 0x01, 0x90, 0xa9, 0xcc, 0xbc, 0xcc, 0xbb, 0xbc, 0xcb, 0xaa, 0x99, 0x08, 0x10,
+	0x32, 0x22, 0x12, 0x80, 0xcb, 0xcc, 0xbb, 0xbb, 0x09, 0x62, 0x45, 0x35, 0x35, 0x34, 0x33, 0x33,
+	0x23, 0x12, 0x80, 0xb9, 0xcc, 0xcc, 0xdb, 0xbb, 0xbc, 0xcb, 0xaa, 0x9a, 0x89, 0x01, 0x22, 0x23,
+	0x13, 0x81, 0xba, 0xcd, 0xcb, 0xab, 0x8a, 0x41, 0x64, 0x44, 0x34, 0x34, 0x24, 0x33, 0x22, 0x12,
+	0x81, 0xa8, 0xcb, 0xcc, 0xdb, 0xcb, 0xbb, 0xbc, 0xab, 0xaa, 0x99, 0x10, 0x21, 0x33, 0x23, 0x82,
+	0xb8, 0xcd, 0xbc, 0xbb, 0x9a, 0x20, 0x56, 0x54, 0x43, 0x34, 0x24, 0x33, 0x23, 0x22, 0x01, 0x98,
+	0xbb, 0xcd, 0xbc, 0xcc, 0xbb, 0xbc, 0xbb, 0xaa, 0x9a, 0x18, 0x21, 0x32, 0x33, 0x12, 0xa8, 0xcc,
+	0xbd, 0xbb, 0xab, 0x18, 0x55, 0x54, 0x44, 0x43, 0x33, 0x24, 0x23, 0x13, 0x11, 0x88, 0xaa, 0xcc,
+	0xcc, 0xcb, 0xcb, 0xbb, 0xcb, 0xaa, 0x99, 0x09, 0x20, 0x31, 0x32, 0x12, 0x90, 0xca, 0xbd, 0xac,
+	0xab, 0x88, 0x53, 0x55, 0x34, 0x35, 0x34, 0x43, 0x32, 0x22, 0x01, 0x00, 0xa9, 0xdb, 0xdb, 0xcb,
+	0xbc, 0xcb, 0xba, 0xbb, 0x9a, 0x89, 0x10, 0x32, 0x32, 0x23, 0x81, 0xca, 0xcc, 0xac, 0xbb, 0x89,
+	0x41, 0x55, 0x44, 0x44, 0x33, 0x34, 0x32, 0x23, 0x12, 0x81, 0xa8, 0xcb, 0xbd, 0xcc, 0xcb, 0xac,
+	0xbb, 0xbb, 0xaa, 0x99, 0x00, 0x22, 0x33, 0x23, 0x02, 0xb9, 0xcd, 0xbc, 0xbb, 0x9a, 0x20, 0x47,
+	0x35, 0x45, 0x43, 0x33, 0x43, 0x22, 0x12, 0x01, 0x98, 0xba, 0xbd, 0xbd, 0xbc, 0xbc, 0xbc, 0xba,
+	0xab, 0x99, 0x18, 0x20, 0x23, 0x33, 0x11, 0xa8, 0xeb, 0xdb, 0xba, 0xaa, 0x10, 0x73, 0x54, 0x34,
+	0x44, 0x33, 0x43, 0x32, 0x12, 0x11, 0x88, 0xaa, 0xcc, 0xbc, 0xcc, 0xbb, 0xbc, 0xcb, 0xaa, 0x99,
+	0x88, 0x20, 0x21, 0x23, 0x02, 0x80, 0xca, 0xcc, 0xbb, 0xba, 0x08, 0x62, 0x55, 0x53, 0x34, 0x43,
+	0x43, 0x22, 0x22, 0x11, 0x80, 0xa9, 0xda, 0xcb, 0xcc, 0xbb, 0xbc, 0xcb, 0xaa, 0x9a, 0x89, 0x10,
+	0x21, 0x23, 0x22, 0x80, 0xb9, 0xcd, 0xcb, 0xaa, 0x89, 0x31, 0x47, 0x35, 0x35, 0x34, 0x34, 0x32,
+	0x32, 0x11, 0x81, 0x98, 0xcb, 0xbd, 0xcc, 0xbb, 0xbd, 0xbb, 0xbb, 0xaa, 0x99, 0x18, 0x22, 0x33,
+	0x32, 0x01, 0xa9, 0xbe, 0xcc, 0xba, 0x8a, 0x20, 0x46, 0x45, 0x34, 0x44, 0x33, 0x33, 0x33, 0x22,
+	0x01, 0xa8, 0xca, 0xcc, 0xbc, 0xbd, 0xcb, 0xbb, 0xbb, 0xbb, 0x99, 0x08, 0x20, 0x33, 0x33, 0x12,
+	0xa8, 0xcc, 0xbd, 0xcb, 0x9a, 0x10, 0x73, 0x54, 0x53, 0x43, 0x33, 0x24, 0x23, 0x13, 0x11, 0x88,
+	0xb9, 0xcc, 0xcc, 0xcb, 0xcb, 0xbb, 0xcb, 0xaa, 0x99, 0x09, 0x10, 0x22, 0x22, 0x12, 0x90, 0xca,
+	0xbc, 0xad, 0x9b, 0x09, 0x53, 0x55, 0x44, 0x43, 0x43, 0x33, 0x33, 0x23, 0x12, 0x80, 0xb9, 0xeb,
+	0xbc, 0xcc, 0xbb, 0xad, 0xbb, 0xab, 0xaa, 0x89, 0x10, 0x22, 0x32, 0x13, 0x81, 0xba, 0xbe, 0xbc,
+	0xac, 0x09, 0x31, 0x47, 0x54, 0x43, 0x43, 0x33, 0x33, 0x33, 0x12, 0x81, 0xa8, 0xdb, 0xcc, 0xdb,
+	0xbb, 0xcc, 0xba, 0xba, 0xaa, 0x89, 0x18, 0x11, 0x23, 0x13, 0x82, 0xb8, 0xcc, 0xbc, 0xcb, 0x99,
+	0x21, 0x55, 0x45, 0x53, 0x43, 0x33, 0x33, 0x24, 0x21, 0x10, 0x98, 0xba, 0xdc, 0xcb, 0xbc, 0xcb,
+	0xcb, 0xba, 0x9a, 0x9a, 0x80, 0x11, 0x22, 0x23, 0x11, 0xa8, 0xcb, 0xbd, 0xcb, 0x9a, 0x10, 0x54,
+	0x45, 0x44, 0x43, 0x43, 0x33, 0x32, 0x22, 0x01, 0x80, 0xba, 0xcc, 0xcc, 0xcb, 0xbc, 0xbb, 0xac,
+	0xab, 0x99, 0x89, 0x11, 0x31, 0x22, 0x12, 0x90, 0xca, 0xcc, 0xbb, 0xab, 0x19, 0x73, 0x45, 0x44,
+	0x53, 0x33, 0x43, 0x32, 0x22, 0x11, 0x00, 0xa9, 0xbc, 0xbd, 0xbd, 0xbc, 0xcb, 0xbb, 0xab, 0x9b,
+	0x99, 0x10, 0x22, 0x23, 0x13, 0x81, 0xba, 0xbe, 0xcc, 0xaa, 0x09, 0x41, 0x55, 0x44, 0x34, 0x34,
+	0x43, 0x23, 0x23, 0x12, 0x00, 0xa8, 0xda, 0xdb, 0xcb, 0xbc, 0xcb, 0xbb, 0xbb, 0xba, 0x89, 0x08,
+	0x21, 0x33, 0x32, 0x01, 0xb9, 0xdc, 0xbc, 0xab, 0x9a, 0x31, 0x57, 0x44, 0x53, 0x43, 0x43, 0x32,
+	0x22, 0x22, 0x00, 0x90, 0xba, 0xcd, 0xcb, 0xbc, 0xbc, 0xcb, 0xba, 0xaa, 0x9a, 0x08, 0x11, 0x22,
+	0x23, 0x01, 0xa0, 0xdb, 0xdb, 0xab, 0x9b, 0x10, 0x55, 0x45, 0x34, 0x35, 0x43, 0x33, 0x23, 0x13,
+	0x02, 0x80, 0xba, 0xbd, 0xcd, 0xcb, 0xcb, 0xbb, 0xcb, 0xaa, 0xa9, 0x08, 0x00, 0x22, 0x22, 0x11,
+	0x80, 0xca, 0xbc, 0xbc, 0x9b, 0x19, 0x73, 0x54, 0x44, 0x43, 0x43, 0x33, 0x33, 0x23, 0x21, 0x80,
+	0xb9, 0xcc, 0xcc, 0xcb, 0xdb, 0xba, 0xbb, 0xbb, 0xab, 0x89, 0x10, 0x31, 0x32, 0x22, 0x81, 0xba,
+	0xce, 0xbb, 0xbb, 0x89, 0x53, 0x56, 0x34, 0x45, 0x33, 0x43, 0x33, 0x32, 0x12, 0x00, 0xa8, 0xcb,
+	0xdc, 0xcb, 0xcb, 0xcb, 0xab, 0xbb, 0xab, 0x89, 0x08, 0x21, 0x32, 0x22, 0x01, 0xa9, 0xbd, 0xbd,
+	0xbb, 0x99, 0x31, 0x57, 0x44, 0x44, 0x43, 0x33, 0x33, 0x33, 0x23, 0x01, 0x98, 0xcb, 0xdc, 0xcb,
+	0xbc, 0xcb, 0xbb, 0xac, 0xaa, 0x8a, 0x88, 0x11, 0x21, 0x22, 0x11, 0x98, 0xcb, 0xbd, 0xbb, 0x9a,
+	0x28, 0x56, 0x54, 0x34, 0x44, 0x33, 0x33, 0x24, 0x22, 0x01, 0x90, 0xa9, 0xcc, 0xbc, 0xcc, 0xbb,
+	0xbc, 0xcb, 0xaa, 0x99, 0x88, 0x10, 0x11, 0x22, 0x02, 0x80, 0xba, 0xcd, 0xab, 0xab, 0x18, 0x73,
+	0x45, 0x44, 0x53, 0x33, 0x43, 0x32, 0x22, 0x11, 0x80, 0xa9, 0xdb, 0xdb, 0xbc, 0xbc, 0xcb, 0xbb,
+	0xba, 0xaa, 0x89, 0x18, 0x21, 0x23, 0x22, 0x80, 0xc9, 0xdb, 0xac, 0xab, 0x09, 0x52, 0x55, 0x44,
+	0x34, 0x34, 0x43, 0x32, 0x23, 0x21, 0x00, 0x99, 0xcb, 0xcc, 0xbc, 0xbc, 0xbc, 0xcb, 0xaa, 0x9b,
+	0x99, 0x00, 0x20, 0x21, 0x22, 0x81, 0xa8, 0xbc, 0xbd, 0xbb, 0x8a, 0x41, 0x56, 0x44, 0x53, 0x43,
+	0x33, 0x24, 0x23, 0x12, 0x01, 0x98, 0xc9, 0xdb, 0xcb, 0xbc, 0xbc, 0xcb, 0xba, 0xaa, 0x99, 0x88,
+	0x11, 0x21, 0x22, 0x11, 0x98, 0xdb, 0xcb, 0xcb, 0x99, 0x10, 0x55, 0x44, 0x35, 0x34, 0x34, 0x33,
+	0x33, 0x23, 0x02, 0x80, 0xca, 0xdb, 0xcc, 0xcb, 0xcb, 0xbb, 0xbb, 0xbb, 0xaa, 0x89, 0x10, 0x32,
+	0x32, 0x12, 0x90, 0xda, 0xbc, 0xbc, 0x9b, 0x19, 0x64, 0x54, 0x44, 0x43, 0x43, 0x33, 0x23, 0x23,
+	0x12, 0x00, 0xb9, 0xcc, 0xcc, 0xcb, 0xcb, 0xac, 0xbb, 0xba, 0x9a, 0x99, 0x00, 0x12, 0x32, 0x21,
+	0x80, 0xb9, 0xbd, 0xbd, 0xaa, 0x09, 0x62, 0x54, 0x35, 0x44, 0x43, 0x33, 0x33, 0x23, 0x22, 0x00,
+	0xa8, 0xdb, 0xcc, 0xdb, 0xbb, 0xbc, 0xac, 0xab, 0xaa, 0x99, 0x08, 0x11, 0x22, 0x12, 0x01, 0xa8,
+	0xcc, 0xcb, 0xab, 0x99, 0x32, 0x57, 0x44, 0x44, 0x33, 0x34, 0x24, 0x22, 0x12, 0x01, 0x88, 0xba,
+	0xbd, 0xbd, 0xbc, 0xbc, 0xac, 0xbb, 0xaa, 0x99, 0x09, 0x10, 0x22, 0x12, 0x02, 0x98, 0xcb, 0xbd,
+	0xbb, 0x9a, 0x30, 0x66, 0x44, 0x44, 0x43, 0x33, 0x34, 0x32, 0x22, 0x11, 0x88, 0xb9, 0xbd, 0xbd,
+	0xcc, 0xbb, 0xbc, 0xbb, 0xbb, 0x9a, 0x89, 0x10, 0x21, 0x23, 0x12, 0x88, 0xcb, 0xcc, 0xbb, 0xab,
+	0x18, 0x55, 0x55, 0x53, 0x34, 0x43, 0x33, 0x33, 0x23, 0x12, 0x00, 0xaa, 0xcc, 0xcc, 0xbc, 0xdb,
+	0xba, 0xac, 0xaa, 0x9a, 0x89, 0x18, 0x20, 0x21, 0x11, 0x81, 0xb9, 0xeb, 0xbb, 0xba, 0x08, 0x72,
+	0x54, 0x44, 0x53, 0x33, 0x34, 0x23, 0x33, 0x12, 0x81, 0xa8, 0xcb, 0xbd, 0xbd, 0xbc, 0xbc, 0xbb,
+	0xac, 0xaa, 0x89, 0x08, 0x10, 0x22, 0x21, 0x00, 0x99, 0xbc, 0xcc, 0xaa, 0x89, 0x41, 0x55, 0x54,
+	0x43, 0x34, 0x33, 0x34, 0x23, 0x22, 0x10, 0x98, 0xca, 0xdb, 0xbc, 0xbd, 0xbb, 0xbc, 0xbb, 0xbb,
+	0x9a, 0x88, 0x11, 0x31, 0x22, 0x11, 0xa8, 0xdb, 0xbc, 0xac, 0x9a, 0x21, 0x56, 0x44, 0x44, 0x43,
+	0x24, 0x33, 0x23, 0x13, 0x02, 0x80, 0xba, 0xcc, 0xbd, 0xbc, 0xbc, 0xbc, 0xba, 0xbb, 0x9a, 0x89,
+	0x10, 0x21, 0x22, 0x12, 0x90, 0xca, 0xcc, 0xab, 0x9b, 0x18, 0x55, 0x45, 0x44, 0x34, 0x43, 0x43,
+	0x22, 0x22, 0x02, 0x81, 0xa9, 0xcb, 0xbd, 0xcc, 0xbb, 0xbc, 0xcb, 0xaa, 0xaa, 0x98, 0x00, 0x11,
+	0x21, 0x12, 0x80, 0xb9, 0xbc, 0xbd, 0xaa, 0x08, 0x63, 0x55, 0x53, 0x34, 0x34, 0x24, 0x33, 0x32,
+	0x12, 0x00, 0xa8, 0xda, 0xdb, 0xdb, 0xbb, 0xbc, 0xcb, 0xba, 0x9a, 0x8a, 0x08, 0x10, 0x12, 0x12,
+	0x01, 0x99, 0xbc, 0xcc, 0xaa, 0x89, 0x41, 0x46, 0x35, 0x45, 0x33, 0x34, 0x33, 0x33, 0x13, 0x02,
+	0x98, 0xcb, 0xcc, 0xcc, 0xbb, 0xad, 0xac, 0xaa, 0xaa, 0x8a, 0x09, 0x00, 0x12, 0x12, 0x01, 0x98,
+	0xca, 0xdb, 0xba, 0x99, 0x21, 0x56, 0x35, 0x45, 0x43, 0x33, 0x24, 0x23, 0x13, 0x02, 0x80, 0xba,
+	0xcc, 0xcc, 0xcb, 0xcb, 0xbb, 0xcb, 0xaa, 0x9a, 0x89, 0x10, 0x11, 0x12, 0x11, 0x90, 0xc9, 0xcb,
+	0xbb, 0xab, 0x20, 0x65, 0x45, 0x44, 0x43, 0x43, 0x33, 0x33, 0x23, 0x12, 0x80, 0xa9, 0xcc, 0xcc,
+	0xdb, 0xbb, 0xac, 0xac, 0xaa, 0x9a, 0x89, 0x08, 0x11, 0x12, 0x11, 0x00, 0xb9, 0xdb, 0xbb, 0xbb,
+	0x08, 0x64, 0x45, 0x35, 0x44, 0x43, 0x33, 0x33, 0x33, 0x22, 0x00, 0xa8, 0xdb, 0xcc, 0xbc, 0xbc,
+	0xac, 0xac, 0xaa, 0xaa, 0x99, 0x08, 0x10, 0x12, 0x21, 0x00, 0x99, 0xcb, 0xbc, 0xbb, 0x09, 0x52,
+	0x56, 0x34, 0x45, 0x33, 0x34, 0x24, 0x32, 0x21, 0x01, 0x98, 0xba, 0xdc, 0xcb, 0xbc, 0xcb, 0xcb,
+	0xaa, 0x9b, 0x9a, 0x88, 0x10, 0x11, 0x12, 0x11, 0x98, 0xbb, 0xcd, 0xba, 0x99, 0x31, 0x47, 0x45,
+	0x53, 0x43, 0x43, 0x32, 0x23, 0x23, 0x01, 0x80, 0xb9, 0xbd, 0xbd, 0xbd, 0xcb, 0xbb, 0xac, 0xab,
+	0x9a, 0x89, 0x00, 0x21, 0x21, 0x11, 0x90, 0xba, 0xcc, 0xbb, 0xab, 0x20, 0x47, 0x45, 0x44, 0x53,
+	0x42, 0x22, 0x33, 0x22, 0x11, 0x00, 0xa9, 0xbc, 0xbd, 0xbd, 0xbc, 0xcb, 0xbb, 0xba, 0xaa, 0x8a,
+	0x08, 0x11, 0x22, 0x12, 0x80, 0xb9, 0xcc, 0xac, 0xab, 0x18, 0x73, 0x45, 0x44, 0x53, 0x33, 0x34,
+	0x33, 0x32, 0x12, 0x01, 0xa8, 0xdb, 0xbc, 0xbd, 0xcc, 0xba, 0xac, 0xba, 0x9a, 0x99, 0x88, 0x01,
+	0x12, 0x21, 0x00, 0x99, 0xcb, 0xbc, 0xab, 0x0a, 0x62, 0x55, 0x44, 0x34, 0x34, 0x34, 0x33, 0x33,
+	0x22, 0x01, 0x98, 0xca, 0xcc, 0xbc, 0xbd, 0xbb, 0xad, 0xab, 0xaa, 0x9a, 0x88, 0x10, 0x11, 0x12,
+	0x01, 0x98, 0xca, 0xcb, 0xbb, 0x9a, 0x51, 0x55, 0x54, 0x43, 0x34, 0x34, 0x33, 0x33, 0x23, 0x02,
+	0x80, 0xba, 0xcd, 0xcc, 0xcb, 0xcb, 0xbb, 0xbb, 0xbb, 0xaa, 0x89, 0x00, 0x21, 0x22, 0x11, 0x90,
+	0xca, 0xcc, 0xba, 0x9b, 0x30, 0x65, 0x45, 0x34, 0x35, 0x43, 0x43, 0x22, 0x22, 0x02, 0x81, 0xa9,
+	0xcb, 0xcc, 0xbc, 0xbc, 0xbc, 0xab, 0xbb, 0x9b, 0x8a, 0x08, 0x20, 0x21, 0x12, 0x80, 0xb9, 0xcc,
+	0xac, 0x9b, 0x19, 0x64, 0x54, 0x34, 0x35, 0x34, 0x24, 0x33, 0x32, 0x21, 0x81, 0x98, 0xdb, 0xdb,
+	0xbc, 0xdb, 0xca, 0xaa, 0xab, 0xaa, 0x8a, 0x88, 0x10, 0x21, 0x11, 0x81, 0xa8, 0xcb, 0xbc, 0xba,
+	0x09, 0x63, 0x55, 0x44, 0x34, 0x25, 0x24, 0x32, 0x32, 0x12, 0x01, 0x90, 0xba, 0xcd, 0xbc, 0xbc,
+	0xbc, 0xcb, 0xba, 0xaa, 0x9a, 0x88, 0x00, 0x11, 0x12, 0x01, 0x98, 0xca, 0xcb, 0xbb, 0x8a, 0x51,
+	0x55, 0x35, 0x45, 0x43, 0x33, 0x43, 0x23, 0x22, 0x02, 0x80, 0xba, 0xcc, 0xcc, 0xcb, 0xcb, 0xbb,
+	0xcb, 0xaa, 0x9a, 0x89, 0x00, 0x10, 0x12, 0x11, 0x88, 0xba, 0xdb, 0xbb, 0x9b, 0x30, 0x57, 0x54,
+	0x53, 0x43, 0x43, 0x33, 0x33, 0x32, 0x12, 0x00, 0xaa, 0xcc, 0xcc, 0xdb, 0xbb, 0xcb, 0xbb, 0xbb,
+	0xab, 0x99, 0x08, 0x11, 0x21, 0x12, 0x80, 0xb9, 0xcc, 0xac, 0x9b, 0x18, 0x64, 0x54, 0x44, 0x43,
+	0x34, 0x33, 0x24, 0x23, 0x12, 0x00, 0x98, 0xcb, 0xcc, 0xbc, 0xbc, 0xcb, 0xcb, 0xaa, 0xaa, 0x89,
+	0x09, 0x10, 0x20, 0x11, 0x00, 0x99, 0xbb, 0xbd, 0xab, 0x09, 0x73, 0x45, 0x44, 0x44, 0x33, 0x34,
+	0x43, 0x22, 0x12, 0x01, 0x90, 0xba, 0xdc, 0xcb, 0xbc, 0xcb, 0xbb, 0xac, 0xaa, 0x9a, 0x88, 0x00,
+	0x11, 0x11, 0x01, 0x88, 0xbb, 0xcc, 0xba, 0x89, 0x41, 0x47, 0x44, 0x44, 0x43, 0x33, 0x34, 0x32,
+	0x22, 0x11, 0x80, 0xba, 0xcc, 0xcc, 0xbc, 0xcb, 0xbb, 0xcb, 0xaa, 0xaa, 0x98, 0x00, 0x11, 0x11,
+	0x11, 0x88, 0xaa, 0xcc, 0xab, 0x9a, 0x30, 0x47, 0x45, 0x44, 0x43, 0x24, 0x43, 0x22, 0x22, 0x11,
+	0x80, 0xa8, 0xcb, 0xbd, 0xbc, 0xcc, 0xba, 0xac, 0xaa, 0x9a, 0x99, 0x08, 0x10, 0x11, 0x11, 0x80,
+	0x99, 0xbc, 0xbb, 0x9c, 0x18, 0x55, 0x45, 0x44, 0x53, 0x33, 0x43, 0x33, 0x23, 0x22, 0x81, 0x98,
+	0xdb, 0xbc, 0xbd, 0xbc, 0xbc, 0xbb, 0xac, 0xaa, 0x99, 0x88, 0x10, 0x11, 0x11, 0x81, 0xa8, 0xca,
+	0xcb, 0xaa, 0x09, 0x73, 0x54, 0x44, 0x34, 0x34, 0x43, 0x33, 0x33, 0x22, 0x11, 0x98, 0xca, 0xcc,
+	0xbc, 0xcc, 0xbb, 0xcb, 0xbb, 0xaa, 0x9a, 0x89, 0x00, 0x11, 0x12, 0x01, 0x98, 0xbb, 0xbd, 0xbb,
+	0x8a, 0x62, 0x55, 0x54, 0x43, 0x34, 0x24, 0x43, 0x22, 0x12, 0x11, 0x90, 0xa9, 0xbc, 0xcd, 0xbb,
+	0xbd, 0xbb, 0xac, 0xab, 0x9a, 0x89, 0x08, 0x11, 0x11, 0x11, 0x88, 0xba, 0xdb, 0xbb, 0x9a, 0x40,
+	0x46, 0x55, 0x43, 0x34, 0x34, 0x24, 0x23, 0x23, 0x11, 0x00, 0xa9, 0xdb, 0xcc, 0xcb, 0xcb, 0xcb,
+	0xba, 0xba, 0xaa, 0x89, 0x88, 0x01, 0x12, 0x01, 0x81, 0xb9, 0xdb, 0xbb, 0xaa, 0x38, 0x75, 0x44,
+	0x44, 0x34, 0x53, 0x32, 0x33, 0x33, 0x12, 0x01, 0xa8, 0xdb, 0xbc, 0xbd, 0xad, 0xcb, 0xba, 0xab,
+	0xab, 0x99, 0x88, 0x00, 0x21, 0x11, 0x00, 0x99, 0xcb, 0xbc, 0xaa, 0x19, 0x73, 0x55, 0x53, 0x34,
+	0x34, 0x34, 0x33, 0x33, 0x22, 0x11, 0x98, 0xca, 0xcc, 0xcc, 0xbb, 0xcc, 0xba, 0xab, 0xab, 0xaa,
+	0x88, 0x18, 0x20, 0x11, 0x01, 0x98, 0xbb, 0xbd, 0xbb, 0x0a, 0x72, 0x54, 0x35, 0x35, 0x35, 0x33,
+	0x34, 0x23, 0x23, 0x11, 0x80, 0xba, 0xdc, 0xdb, 0xcb, 0xcb, 0xbb, 0xbb, 0xbb, 0xaa, 0x8a, 0x08,
+	0x11, 0x21, 0x11, 0x88, 0xca, 0xcb, 0xcb, 0x99, 0x31, 0x47, 0x45, 0x34, 0x35, 0x43, 0x33, 0x24,
+	0x22, 0x11, 0x00, 0xa9, 0xcb, 0xcc, 0xbc, 0xbc, 0xbc, 0xba, 0xbb, 0x9b, 0x9a, 0x08, 0x10, 0x11,
+	0x11, 0x00, 0xaa, 0xbc, 0xbc, 0x9b, 0x20, 0x56, 0x45, 0x35, 0x44, 0x33, 0x34, 0x33, 0x32, 0x22,
+	0x81, 0x98, 0xbc, 0xcd, 0xdb, 0xbb, 0xbc, 0xbb, 0xac, 0xaa, 0x9a, 0x88, 0x10, 0x20, 0x10, 0x81,
+	0xa8, 0xca, 0xbb, 0xbb, 0x29, 0x74, 0x45, 0x44, 0x34, 0x44, 0x32, 0x33, 0x33, 0x23, 0x01, 0x90,
+	0xcb, 0xcc, 0xcc, 0xbb, 0xad, 0xbb, 0xac, 0xaa, 0x99, 0x89, 0x00, 0x10, 0x11, 0x00, 0x98, 0xb9,
+	0xbc, 0xbb, 0x09, 0x72, 0x45, 0x35, 0x45, 0x33, 0x34, 0x34, 0x22, 0x13, 0x02, 0x80, 0xb9, 0xcc,
+	0xcc, 0xcb, 0xcb, 0xbb, 0xbb, 0xbb, 0xab, 0x99, 0x80, 0x11, 0x21, 0x01, 0x90, 0xc9, 0xcb, 0xbb,
+	0x9a, 0x51, 0x46, 0x45, 0x34, 0x35, 0x24, 0x24, 0x32, 0x22, 0x11, 0x80, 0xa8, 0xdb, 0xdb, 0xbc,
+	0xcb, 0xcb, 0xba, 0xab, 0xaa, 0x99, 0x88, 0x10, 0x11, 0x01, 0x00, 0xb9, 0xcb, 0xac, 0x9a, 0x20,
+	0x56, 0x54, 0x44, 0x43, 0x43, 0x43, 0x22, 0x23, 0x12, 0x00, 0x98, 0xcb, 0xbc, 0xcd, 0xbb, 0xbc,
+	0xcb, 0xba, 0xaa, 0x99, 0x88, 0x18, 0x10, 0x11, 0x81, 0xa8, 0xca, 0xbb, 0xab, 0x29, 0x65, 0x45,
+	0x44, 0x34, 0x44, 0x32, 0x24, 0x22, 0x12, 0x01, 0x90, 0xba, 0xcc, 0xcc, 0xcb, 0xbb, 0xbc, 0xba,
+	0xab, 0xaa, 0x98, 0x00, 0x01, 0x12, 0x00, 0x98, 0xba, 0xbd, 0xba, 0x09, 0x73, 0x45, 0x45, 0x43,
+	0x34, 0x34, 0x33, 0x43, 0x12, 0x11, 0x80, 0xaa, 0xbc, 0xcd, 0xcb, 0xcb, 0xbb, 0xcb, 0xaa, 0x9a,
+	0x99, 0x80, 0x01, 0x11, 0x10, 0x88, 0xb9, 0xcb, 0xbb, 0x8a, 0x52, 0x46, 0x45, 0x44, 0x43, 0x33,
+	0x34, 0x33, 0x23, 0x12, 0x81, 0xa9, 0xcc, 0xcc, 0xcb, 0xbc, 0xbb, 0xbc, 0xba, 0xaa, 0x99, 0x09,
+	0x00, 0x11, 0x11, 0x80, 0xa9, 0xdb, 0xba, 0x9a, 0x30, 0x47, 0x36, 0x45, 0x43, 0x24, 0x43, 0x32,
+	0x22, 0x12, 0x01, 0x99, 0xbb, 0xbe, 0xbd, 0xbc, 0xcb, 0xbb, 0xbb, 0xbb, 0xa9, 0x88, 0x18, 0x20,
+	0x11, 0x00, 0xa9, 0xcb, 0xcb, 0x9b, 0x29, 0x65, 0x54, 0x34, 0x45, 0x33, 0x34, 0x33, 0x33, 0x22,
+	0x11, 0x98, 0xca, 0xbd, 0xbd, 0xbc, 0xbc, 0xcb, 0xba, 0xaa, 0xaa, 0x98, 0x00, 0x10, 0x11, 0x00,
+	0x98, 0xba, 0xdb, 0xaa, 0x09, 0x63, 0x46, 0x44, 0x34, 0x35, 0x43, 0x32, 0x33, 0x23, 0x11, 0x90,
+	0xb9, 0xcd, 0xdb, 0xcb, 0xcb, 0xbb, 0xcb, 0xaa, 0x9a, 0x99, 0x08, 0x10, 0x01, 0x01, 0x90, 0xa9,
+	0xcb, 0xab, 0x8a, 0x52, 0x56, 0x44, 0x34, 0x35, 0x24, 0x24, 0x32, 0x22, 0x11, 0x00, 0xa9, 0xdb,
+	0xdb, 0xdb, 0xbb, 0xcb, 0xbb, 0xbb, 0xba, 0x99, 0x09, 0x00, 0x11, 0x11, 0x80, 0xa9, 0xdb, 0xbb,
+	0x9a, 0x31, 0x67, 0x44, 0x34, 0x35, 0x34, 0x24, 0x33, 0x32, 0x12, 0x81, 0x98, 0xcb, 0xbd, 0xbd,
+	0xbc, 0xcb, 0xbb, 0xbb, 0xab, 0xaa, 0x88, 0x18, 0x10, 0x11, 0x81, 0xa8, 0xcb, 0xcb, 0xaa, 0x10,
+	0x46, 0x46, 0x34, 0x35, 0x25, 0x43, 0x32, 0x22, 0x22, 0x01, 0x90, 0xba, 0xcd, 0xbc, 0xbc, 0xbc,
+	0xcb, 0xba, 0xaa, 0x9a, 0x89, 0x08, 0x10, 0x10, 0x01, 0x98, 0xba, 0xdb, 0xaa, 0x08, 0x73, 0x54,
+	0x44, 0x44, 0x33, 0x34, 0x34, 0x22, 0x23, 0x11, 0x88, 0xb9, 0xcc, 0xcc, 0xcb, 0xcb, 0xbb, 0xbb,
+	0xac, 0xa9, 0x89, 0x88, 0x10, 0x10, 0x10, 0x88, 0xb9, 0xca, 0xab, 0x89, 0x52, 0x56, 0x44, 0x34,
+	0x35, 0x43, 0x43, 0x22, 0x13, 0x12, 0x80, 0xa8, 0xdb, 0xbc, 0xcc, 0xbb, 0xbc, 0xac, 0xba, 0x9a,
+	0x8a, 0x09, 0x18, 0x10, 0x10, 0x80, 0xa9, 0xba, 0xbc, 0x8a, 0x40, 0x56, 0x44, 0x35, 0x44, 0x33,
+	0x34, 0x33, 0x32, 0x22, 0x01, 0x99, 0xdb, 0xcc, 0xdb, 0xbb, 0xbc, 0xcb, 0xaa, 0xab, 0x99, 0x89,
+	0x00, 0x10, 0x01, 0x00, 0xa8, 0xba, 0xcb, 0xaa, 0x20, 0x56, 0x45, 0x35, 0x44, 0x43, 0x33, 0x43,
+	0x22, 0x22, 0x01, 0x90, 0xba, 0xcd, 0xdb, 0xcb, 0xbb, 0xcb, 0xbb, 0xba, 0x9a, 0x99, 0x80, 0x01,
+	0x11, 0x00, 0x98, 0xaa, 0xbc, 0xbb, 0x18, 0x74, 0x45, 0x44, 0x34, 0x44, 0x33, 0x43, 0x32, 0x22,
+	0x11, 0x88, 0xb9, 0xcc, 0xcc, 0xcb, 0xbb, 0xbc, 0xac, 0xaa, 0x9a, 0x99, 0x08, 0x18, 0x10, 0x00,
+	0x80, 0xa9, 0xbb, 0xac, 0x89, 0x53, 0x56, 0x44, 0x34, 0x35, 0x43, 0x33, 0x43, 0x22, 0x11, 0x80,
+	0xa8, 0xcb, 0xbd, 0xcc, 0xbb, 0xbc, 0xcb, 0xaa, 0xaa, 0x99, 0x88, 0x00, 0x10, 0x10, 0x80, 0xa9,
+	0xba, 0xcb, 0x8a, 0x41, 0x56, 0x44, 0x35, 0x34, 0x44, 0x32, 0x33, 0x23, 0x13, 0x01, 0xa8, 0xdb,
+	0xbc, 0xbd, 0xad, 0xcb, 0xba, 0xab, 0xab, 0xa9, 0x88, 0x08, 0x01, 0x01, 0x81, 0xa8, 0xba, 0xbc,
+	0x9a, 0x38, 0x57, 0x54, 0x34, 0x35, 0x34, 0x34, 0x42, 0x22, 0x21, 0x10, 0x98, 0xb9, 0xcc, 0xbc,
+	0xbd, 0xbb, 0xbc, 0xbb, 0xbb, 0xaa, 0x99, 0x80, 0x01, 0x11, 0x81, 0x98, 0xba, 0xbc, 0xab, 0x19,
+	0x75, 0x44, 0x35, 0x35, 0x44, 0x33, 0x33, 0x24, 0x22, 0x11, 0x90, 0xa9, 0xcc, 0xcc, 0xbb, 0xbd,
+	0xbb, 0xcb, 0xba, 0xa9, 0x99, 0x88, 0x10, 0x10, 0x00, 0x90, 0xa9, 0xbb, 0xac, 0x09, 0x63, 0x46,
+	0x54, 0x43, 0x34, 0x34, 0x33, 0x24, 0x23, 0x11, 0x81, 0xa9, 0xdb, 0xbc, 0xbd, 0xbc, 0xcb, 0xba,
+	0xbb, 0xaa, 0x9a, 0x09, 0x18, 0x10, 0x10, 0x80, 0xa9, 0xcb, 0xab, 0x9a, 0x52, 0x46, 0x55, 0x43,
+	0x34, 0x34, 0x34, 0x23, 0x23, 0x13, 0x01, 0x99, 0xdb, 0xdb, 0xbc, 0xbc, 0xbc, 0xbb, 0xbb, 0xbb,
+	0x9a, 0x99, 0x00, 0x10, 0x01, 0x81, 0x99, 0xcb, 0xbb, 0x9b, 0x40, 0x56, 0x45, 0x44, 0x53, 0x33,
+	0x34, 0x33, 0x24, 0x12, 0x01, 0x88, 0xba, 0xbd, 0xbd, 0xbc, 0xbc, 0xac, 0xbb, 0xaa, 0xaa, 0x89,
+	0x08, 0x00, 0x01, 0x01, 0x89, 0xba, 0xcb, 0xaa, 0x28, 0x74, 0x54, 0x44, 0x53, 0x43, 0x33, 0x43,
+	0x23, 0x22, 0x02, 0x80, 0xaa, 0xdc, 0xcb, 0xbc, 0xbc, 0xcb, 0xba, 0xba, 0xaa, 0x99, 0x88, 0x10,
+	0x10, 0x00, 0x90, 0xa9, 0xbb, 0xac, 0x09, 0x73, 0x45, 0x45, 0x53, 0x43, 0x43, 0x32, 0x33, 0x23,
+	0x22, 0x80, 0xa9, 0xcc, 0xcc, 0xcb, 0xbc, 0xbb, 0xbc, 0xba, 0xaa, 0x9a, 0x88, 0x00, 0x10, 0x00,
+	0x00, 0xa9, 0xbb, 0xac, 0x0a, 0x51, 0x56, 0x44, 0x34, 0x35, 0x34, 0x43, 0x32, 0x23, 0x12, 0x01,
+	0xa8, 0xda, 0xdb, 0xbc, 0xdb, 0xba, 0xac, 0xab, 0xaa, 0x9a, 0x98, 0x00, 0x00, 0x01, 0x00, 0x99,
+	0xaa, 0xcb, 0x8a, 0x30, 0x47, 0x55, 0x53, 0x43, 0x34, 0x33, 0x34, 0x32, 0x22, 0x01, 0x98, 0xba,
+	0xdd, 0xcb, 0xcb, 0xcb, 0xbb, 0xbb, 0xab, 0x9b, 0x8a, 0x09, 0x10, 0x10, 0x81, 0x98, 0xba, 0xcb,
+	0x9b, 0x20, 0x56, 0x55, 0x34, 0x35, 0x44, 0x32, 0x24, 0x23, 0x22, 0x11, 0x88, 0xa9, 0xcc, 0xcc,
+	0xbb, 0xbd, 0xbb, 0xcb, 0xba, 0xa9, 0x99, 0x88, 0x00, 0x00, 0x01, 0x88, 0xa9, 0xbb, 0xbb, 0x19,
+	0x55, 0x46, 0x54, 0x43, 0x34, 0x34, 0x33, 0x24, 0x22, 0x12, 0x00, 0xa9, 0xdb, 0xcc, 0xcb, 0xcb,
+	0xbb, 0xcb, 0xba, 0x9a, 0x9a, 0x98, 0x00, 0x10, 0x00, 0x80, 0x99, 0xbb, 0xba, 0x0a, 0x72, 0x55,
+	0x44, 0x44, 0x43, 0x34, 0x33, 0x43, 0x22, 0x12, 0x01, 0xa8, 0xca, 0xcc, 0xbc, 0xbc, 0xcb, 0xbb,
+	0xbb, 0xbb, 0xaa, 0x89, 0x08, 0x00, 0x11, 0x80, 0x99, 0xba, 0xbc, 0x99, 0x50, 0x55, 0x45, 0x44,
+	0x43, 0x34, 0x43, 0x32, 0x23, 0x13, 0x02, 0x98, 0xba, 0xbe, 0xbd, 0xbc, 0xbc, 0xcb, 0xba, 0xaa,
+	0xaa, 0x89, 0x88, 0x00, 0x01, 0x81, 0x98, 0xa9, 0xbb, 0x9b, 0x38, 0x57, 0x45, 0x44, 0x34, 0x25,
+	0x24, 0x23, 0x33, 0x22, 0x12, 0x90, 0xb9, 0xcd, 0xdb, 0xcb, 0xbb, 0xbc, 0xbb, 0xbb, 0xab, 0x9a,
+	0x09, 0x18, 0x10, 0x00, 0x90, 0xa9, 0xcb, 0xab, 0x18, 0x55, 0x46, 0x44, 0x34, 0x44, 0x33, 0x24,
+	0x33, 0x32, 0x21, 0x80, 0xa9, 0xeb, 0xdb, 0xcb, 0xcb, 0xbb, 0xcb, 0xba, 0xaa, 0x99, 0x89, 0x08,
+	0x10, 0x00, 0x80, 0x99, 0xba, 0xab, 0x0a, 0x73, 0x55, 0x54, 0x43, 0x34, 0x34, 0x24, 0x33, 0x32,
+	0x12, 0x01, 0xa8, 0xcb, 0xbd, 0xbd, 0xbc, 0xcb, 0xbb, 0xbb, 0xbb, 0xaa, 0x89, 0x88, 0x10, 0x10,
+	0x80, 0x98, 0xbb, 0xcb, 0x99, 0x51, 0x65, 0x44, 0x34, 0x35, 0x44, 0x32, 0x33, 0x33, 0x32, 0x01,
+	0x90, 0xcb, 0xcc, 0xcc, 0xbb, 0xad, 0xbb, 0xbb, 0xbb, 0xab, 0x99, 0x88, 0x00, 0x01, 0x01, 0x98,
+	0xab, 0xcb, 0x9a, 0x30, 0x47, 0x46, 0x63, 0x43, 0x43, 0x33, 0x24, 0x33, 0x22, 0x11, 0x80, 0xba,
+	0xcc, 0xbd, 0xbc, 0xbc, 0xcb, 0xbb, 0xba, 0xaa, 0x99, 0x89, 0x00, 0x10, 0x10, 0x98, 0xa9, 0xba,
+	0xab, 0x39, 0x47, 0x45, 0x54, 0x43, 0x34, 0x43, 0x43, 0x22, 0x13, 0x12, 0x00, 0xa9, 0xdb, 0xbc,
+	0xcc, 0xcb, 0xbb, 0xbb, 0xac, 0xaa, 0x9a, 0x88, 0x08, 0x00, 0x00, 0x00, 0x99, 0xab, 0xab, 0x19,
+	0x73, 0x45, 0x45, 0x53, 0x43, 0x43, 0x33, 0x43, 0x22, 0x12, 0x00, 0x98, 0xca, 0xcc, 0xdb, 0xbb,
+	0xbc, 0xbb, 0xcb, 0xaa, 0x9a, 0x89, 0x08, 0x00, 0x10, 0x80, 0x98, 0xaa, 0xab, 0x0a, 0x61, 0x54,
+	0x45, 0x34, 0x35, 0x34, 0x43, 0x33, 0x32, 0x13, 0x02, 0x98, 0xca, 0xcc, 0xbc, 0xbc, 0xbc, 0xac,
+	0xbb, 0xaa, 0xaa, 0x99, 0x88, 0x00, 0x10, 0x80, 0x90, 0xb9, 0xba, 0x9a, 0x31, 0x47, 0x45, 0x44,
+	0x53, 0x33, 0x34, 0x24, 0x23, 0x22, 0x11, 0x80, 0xaa, 0xbd, 0xbd, 0xbc, 0xbc, 0xbc, 0xba, 0xbb,
+	0xaa, 0x9a, 0x89, 0x00, 0x10, 0x00, 0x90, 0xa9, 0xab, 0xbb, 0x20, 0x55, 0x54, 0x44, 0x34, 0x44,
+	0x33, 0x43, 0x33, 0x22, 0x12, 0x81, 0xa9, 0xcc, 0xbc, 0xbd, 0xdb, 0xba, 0xbb, 0xbb, 0xbb, 0x9a,
+	0x89, 0x08, 0x00, 0x10, 0x90, 0x99, 0xbb, 0xbb, 0x1a, 0x73, 0x34, 0x37, 0x44, 0x43, 0x43, 0x33,
+	0x33, 0x33, 0x23, 0x01, 0xa9, 0xeb, 0xdb, 0xbc, 0xcb, 0xcb, 0xbb, 0xbb, 0xab, 0xaa, 0x99, 0x08,
+	0x00, 0x10, 0x80, 0x99, 0xb9, 0xbb, 0x9b, 0x42, 0x55, 0x44, 0x44, 0x34, 0x43, 0x24, 0x33, 0x23,
+	0x22, 0x11, 0x98, 0xca, 0xcc, 0xdb, 0xcb, 0xbb, 0xac, 0xbb, 0xbb, 0x9a, 0x9a, 0x88, 0x00, 0x00,
+	0x10, 0x89, 0xb9, 0xbb, 0x9b, 0x31, 0x55, 0x44, 0x44, 0x34, 0x34, 0x34, 0x43, 0x22, 0x22, 0x11,
+	0x80, 0xb9, 0xcc, 0xbc, 0xbd, 0xcb, 0xbb, 0xcb, 0xaa, 0xaa, 0x99, 0x09, 0x08, 0x00, 0x00, 0x90,
+	0xa8, 0xaa, 0x9b, 0x10, 0x44, 0x45, 0x44, 0x44, 0x33, 0x44, 0x32, 0x23, 0x23, 0x12, 0x81, 0xb9,
+	0xeb, 0xdb, 0xcb, 0xcb, 0xbb, 0xac, 0xab, 0xaa, 0x9a, 0x89, 0x08, 0x00, 0x01, 0x08, 0x99, 0xbb,
+	0x9a, 0x09, 0x43, 0x45, 0x44, 0x34, 0x35, 0x34, 0x33, 0x24, 0x23, 0x12, 0x01, 0xa8, 0xda, 0xdb,
+	0xdb, 0xca, 0xba, 0xbb, 0xac, 0xaa, 0x9a, 0x89, 0x88, 0x00, 0x01, 0x80, 0x98, 0xaa, 0x9a, 0x99,
+	0x31, 0x36, 0x35, 0x45, 0x43, 0x43, 0x43, 0x32, 0x23, 0x22, 0x11, 0x98, 0xca, 0xdb, 0xcc, 0xbb,
+	0xbc, 0xcb, 0xba, 0xba, 0xaa, 0x99, 0x88, 0x00, 0x10, 0x90, 0x90, 0xb9, 0xa9, 0x99, 0x21, 0x63,
+	0x43, 0x35, 0x35, 0x43, 0x43, 0x33, 0x23, 0x23, 0x02, 0x80, 0xba, 0xcd, 0xbc, 0xcc, 0xca, 0xba,
+	0xbb, 0xbb, 0xaa, 0x9a, 0x98, 0x00, 0x00, 0x11, 0x90, 0x99, 0x9a, 0x99, 0x10, 0x33, 0x36, 0x44,
+	0x34, 0x34, 0x34, 0x43, 0x32, 0x32, 0x11, 0x00, 0xb9, 0xdb, 0xbc, 0xbd, 0xbc, 0xcb, 0xba, 0xbb,
+	0xaa, 0x9a, 0x99, 0x80, 0x11, 0x11, 0x00, 0x99, 0x99, 0x99, 0x19, 0x31, 0x34, 0x35, 0x35, 0x44,
+	0x33, 0x24, 0x33, 0x23, 0x13, 0x01, 0x99, 0xfb, 0xba, 0xbc, 0xbc, 0xcb, 0xbb, 0xbb, 0xbb, 0xaa,
+	0x99, 0x99, 0x11, 0x10, 0x01, 0x90, 0x99, 0x99, 0x00, 0x21, 0x33, 0x35, 0x53, 0x43, 0x53, 0x32,
+	0x32, 0x23, 0x23, 0x01, 0xa9, 0xbb, 0xbd, 0xbc, 0xdb, 0xbb, 0xac, 0xbb, 0xaa, 0xaa, 0x99, 0x99,
+	0x10, 0x10, 0x10, 0x00, 0x99, 0x90, 0x00, 0x11, 0x22, 0x33, 0x35, 0x42, 0x33, 0x34, 0x33, 0x24,
+	0x12, 0x11, 0x91, 0xaa, 0xbb, 0xad, 0xbb, 0xcb, 0xbb, 0xcb, 0xaa, 0xaa, 0x99, 0x99, 0x10, 0x10,
+	0x10, 0x00, 0x00, 0x09, 0x00, 0x01, 0x11, 0x23, 0x32, 0x33, 0x33, 0x24, 0x32, 0x32, 0x21, 0x11,
+	0x00, 0x99, 0xaa, 0xaa, 0xba, 0xab, 0xba, 0x9a, 0x9b, 0x99, 0x99, 0x09, 0x01, 0x10, 0x00, 0x01,
+	0x00, 0x01, 0x00, 0x01, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x01, 0x10, 0x90, 0x00, 0x09, 0x09
+};
+
+static const adpcm_clip_t pluck =
+{
+	pluck_codes, 16000, 16000, 6000, 7968,
+	{ 0, 80 }, { -3432, 43 }
+};
+
+//drum.wav: 5600 samples at 16000 Hz, one shot
+static const uint8_t drum_codes[2800] =
+{
+	0x67, 0x2e, 0x34, 0xd5, 0x10, 0x92, 0x12, 0x69, 0x98, 0xa3, 0x90, 0x05, 0x19, 0x2c, 0x98, 0xa2,
+	0xa2, 0x1e, 0xa8, 0x82, 0xbc, 0x98, 0x29, 0xac, 0xf3, 0xb0, 0x89, 0xa1, 0xf8, 0x09, 0xa0, 0x0a,
+	0x2b, 0xd9, 0x08, 0x09, 0x9c, 0x29, 0xb0, 0x39, 0x8c, 0x39, 0x39, 0xa6, 0x21, 0x29, 0x96, 0x33,
+	0x83, 0x72, 0x21, 0x40, 0x28, 0x13, 0x23, 0x07, 0x13, 0x30, 0x32, 0x41, 0x23, 0x58, 0x31, 0x02,
+	0x31, 0x18, 0x06, 0x88, 0x30, 0x08, 0x99, 0x0d, 0xcb, 0x1a, 0x8f, 0xba, 0xab, 0xc8, 0x8e, 0x8c,
+	0xaa, 0x9c, 0xba, 0xca, 0xaa, 0x9d, 0xaa, 0xab, 0xab, 0x8e, 0xab, 0xa9, 0x9b, 0xb9, 0xc9, 0xb8,
+	0x80, 0x0b, 0x91, 0x22, 0x53, 0x41, 0x15, 0x25, 0x32, 0x34, 0x35, 0x33, 0x25, 0x24, 0x24, 0x42,
+	0x32, 0x43, 0x33, 0x43, 0x33, 0x43, 0x43, 0x22, 0x33, 0x33, 0x43, 0x22, 0x14, 0x11, 0x11, 0x11,
+	0x09, 0x9a, 0x9c, 0xcc, 0xdb, 0xcb, 0xdb, 0xbb, 0xbc, 0xcc, 0xba, 0xbc, 0xdb, 0xba, 0xcb, 0xbb,
+	0xbc, 0xbb, 0xbc, 0xac, 0xbb, 0xcb, 0xbb, 0xbb, 0xcb, 0xba, 0xab, 0xab, 0xba, 0xaa, 0x88, 0x08,
+	0x31, 0x35, 0x35, 0x35, 0x35, 0x34, 0x34, 0x44, 0x33, 0x34, 0x34, 0x43, 0x43, 0x33, 0x34, 0x43,
+	0x33, 0x34, 0x43, 0x32, 0x43, 0x33, 0x33, 0x43, 0x32, 0x33, 0x33, 0x33, 0x23, 0x22, 0x11, 0x88,
+	0xb9, 0xcd, 0xdb, 0xcc, 0xbb, 0xbd, 0xcc, 0xbb, 0xbc, 0xbc, 0xbc, 0xcb, 0xac, 0xcb, 0xbb, 0xcb,
+	0xcb, 0xba, 0xac, 0xcb, 0xba, 0xbb, 0xcb, 0xba, 0xcb, 0xba, 0xba, 0xab, 0xbb, 0xaa, 0xaa, 0x99,
+	0x00, 0x21, 0x44, 0x44, 0x34, 0x44, 0x43, 0x34, 0x43, 0x34, 0x43, 0x43, 0x43, 0x33, 0x34, 0x34,
+	0x33, 0x34, 0x34, 0x33, 0x34, 0x43, 0x33, 0x43, 0x32, 0x43, 0x32, 0x33, 0x33, 0x33, 0x33, 0x23,
+	0x23, 0x11, 0x80, 0xa9, 0xcc, 0xcc, 0xbc, 0xbd, 0xcc, 0xbb, 0xcc, 0xcb, 0xbb, 0xcc, 0xbb, 0xdb,
+	0xca, 0xba, 0xcb, 0xbb, 0xbc, 0xcb, 0xca, 0xba, 0xbb, 0xbc, 0xca, 0xba, 0xbb, 0xbb, 0xbc, 0xab,
+	0xbb, 0xbb, 0xbb, 0xaa, 0x9a, 0x89, 0x11, 0x52, 0x53, 0x44, 0x43, 0x34, 0x34, 0x44, 0x33, 0x44,
+	0x33, 0x34, 0x34, 0x43, 0x43, 0x33, 0x53, 0x32, 0x34, 0x42, 0x32, 0x43, 0x33, 0x33, 0x34, 0x24,
+	0x33, 0x33, 0x43, 0x32, 0x33, 0x33, 0x23, 0x23, 0x13, 0x02, 0x80, 0xb9, 0xcc, 0xbd, 0xcc, 0xbc,
+	0xcc, 0xbb, 0xcc, 0xcb, 0xbb, 0xcc, 0xbb, 0xbc, 0xcb, 0xcb, 0xbb, 0xbc, 0xcb, 0xcb, 0xca, 0xba,
+	0xca, 0xba, 0xbb, 0xbc, 0xbb, 0xac, 0xbb, 0xac, 0xbb, 0xba, 0xbb, 0xbb, 0xac, 0xa9, 0x9a, 0x88,
+	0x08, 0x22, 0x34, 0x36, 0x44, 0x43, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x43, 0x43, 0x33,
+	0x34, 0x43, 0x33, 0x34, 0x34, 0x33, 0x34, 0x43, 0x33, 0x43, 0x33, 0x43, 0x32, 0x24, 0x33, 0x32,
+	0x24, 0x32, 0x32, 0x22, 0x22, 0x12, 0x11, 0x88, 0xb9, 0xcc, 0xbc, 0xcd, 0xcb, 0xbc, 0xdb, 0xbb,
+	0xbd, 0xcb, 0xcb, 0xcb, 0xbb, 0xbc, 0xbc, 0xcb, 0xbb, 0xbc, 0xbc, 0xbb, 0xbc, 0xbc, 0xbb, 0xbc,
+	0xbb, 0xbc, 0xcb, 0xbb, 0xbb, 0xbc, 0xbb, 0xcb, 0xba, 0xbb, 0xbb, 0xba, 0xbb, 0xaa, 0x9a, 0x88,
+	0x21, 0x43, 0x45, 0x34, 0x35, 0x34, 0x35, 0x43, 0x34, 0x43, 0x34, 0x43, 0x43, 0x33, 0x34, 0x34,
+	0x24, 0x43, 0x33, 0x24, 0x24, 0x33, 0x34, 0x33, 0x34, 0x43, 0x33, 0x43, 0x33, 0x43, 0x32, 0x24,
+	0x33, 0x32, 0x24, 0x32, 0x32, 0x32, 0x22, 0x22, 0x01, 0x81, 0x99, 0xdb, 0xbc, 0xbd, 0xbd, 0xbc,
+	0xbd, 0xcb, 0xbc, 0xcb, 0xbc, 0xcb, 0xcb, 0xbb, 0xbc, 0xbc, 0xcb, 0xcb, 0xbb, 0xcb, 0xac, 0xbb,
+	0xbc, 0xbb, 0xbc, 0xac, 0xcb, 0xba, 0xbb, 0xbc, 0xbb, 0xcb, 0xbb, 0xcb, 0xab, 0xbb, 0xcb, 0xaa,
+	0xab, 0xaa, 0xaa, 0x99, 0x09, 0x18, 0x32, 0x45, 0x34, 0x44, 0x34, 0x34, 0x44, 0x33, 0x44, 0x33,
+	0x34, 0x34, 0x34, 0x43, 0x43, 0x33, 0x34, 0x34, 0x33, 0x44, 0x32, 0x43, 0x33, 0x34, 0x33, 0x34,
+	0x43, 0x33, 0x24, 0x43, 0x32, 0x33, 0x43, 0x33, 0x33, 0x24, 0x33, 0x33, 0x33, 0x33, 0x33, 0x32,
+	0x21, 0x00, 0x99, 0xdb, 0xcc, 0xdb, 0xbc, 0xbc, 0xbd, 0xdb, 0xbb, 0xcc, 0xca, 0xbb, 0xbc, 0xcb,
+	0xbc, 0xbb, 0xcc, 0xba, 0xbc, 0xcb, 0xbb, 0xcb, 0xac, 0xcb, 0xba, 0xcb, 0xbb, 0xcb, 0xbb, 0xbc,
+	0xbb, 0xbc, 0xbb, 0xbc, 0xbb, 0xac, 0xbb, 0xac, 0xab, 0xbb, 0xbb, 0xbb, 0xba, 0xab, 0xaa, 0x89,
+	0x08, 0x32, 0x45, 0x53, 0x34, 0x35, 0x34, 0x44, 0x33, 0x44, 0x33, 0x44, 0x33, 0x34, 0x53, 0x42,
+	0x32, 0x43, 0x43, 0x42, 0x32, 0x43, 0x33, 0x34, 0x43, 0x33, 0x34, 0x33, 0x34, 0x24, 0x43, 0x32,
+	0x33, 0x34, 0x33, 0x34, 0x42, 0x32, 0x33, 0x33, 0x43, 0x23, 0x33, 0x33, 0x33, 0x32, 0x12, 0x02,
+	0x80, 0xb9, 0xdc, 0xdb, 0xbc, 0xcc, 0xcb, 0xcb, 0xbc, 0xbc, 0xcb, 0xbc, 0xcb, 0xcb, 0xcb, 0xbb,
+	0xbc, 0xbc, 0xcb, 0xbb, 0xbc, 0xbc, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xcb, 0xac, 0xbb, 0xcb, 0xbb,
+	0xbc, 0xbb, 0xbc, 0xbb, 0xbc, 0xbb, 0xac, 0xbb, 0xac, 0xbb, 0xbb, 0xbb, 0xbb, 0xac, 0xba, 0x9a,
+	0x9a, 0x89, 0x00, 0x22, 0x54, 0x43, 0x44, 0x43, 0x34, 0x34, 0x44, 0x42, 0x33, 0x34, 0x34, 0x34,
+	0x43, 0x43, 0x33, 0x44, 0x32, 0x34, 0x33, 0x34, 0x34, 0x43, 0x33, 0x53, 0x32, 0x43, 0x33, 0x34,
+	0x33, 0x34, 0x43, 0x33, 0x43, 0x33, 0x43, 0x33, 0x24, 0x33, 0x24, 0x33, 0x33, 0x33, 0x34, 0x23,
+	0x33, 0x33, 0x32, 0x22, 0x11, 0x00, 0xa9, 0xdb, 0xcc, 0xbc, 0xbd, 0xbc, 0xbd, 0xdb, 0xbb, 0xbc,
+	0xcc, 0xbb, 0xdb, 0xbb, 0xbc, 0xbc, 0xcb, 0xcb, 0xbb, 0xbc, 0xcb, 0xcb, 0xbb, 0xcb, 0xac, 0xbb,
+	0xbc, 0xcb, 0xbb, 0xcb, 0xcb, 0xbb, 0xcb, 0xbb, 0xcb, 0xbb, 0xbc, 0xbb, 0xcb, 0xcb, 0xba, 0xbb,
+	0xcb, 0xba, 0xbb, 0xcb, 0xba, 0xba, 0xab, 0xba, 0xaa, 0x99, 0x89, 0x20, 0x32, 0x36, 0x45, 0x43,
+	0x53, 0x43, 0x43, 0x43, 0x34, 0x43, 0x43, 0x43, 0x33, 0x25, 0x43, 0x33, 0x34, 0x34, 0x33, 0x25,
+	0x24, 0x33, 0x24, 0x24, 0x33, 0x34, 0x43, 0x33, 0x53, 0x32, 0x43, 0x32, 0x24, 0x43, 0x32, 0x33,
+	0x34, 0x33, 0x34, 0x33, 0x34, 0x33, 0x43, 0x33, 0x33, 0x24, 0x33, 0x33, 0x43, 0x22, 0x22, 0x12,
+	0x12, 0x00, 0x98, 0xba, 0xdc, 0xdb, 0xdb, 0xcb, 0xcb, 0xdb, 0xbb, 0xbc, 0xcc, 0xbb, 0xbc, 0xdb,
+	0xbb, 0xdb, 0xbb, 0xdb, 0xca, 0xba, 0xcb, 0xbb, 0xbc, 0xac, 0xac, 0xbb, 0xbc, 0xcb, 0xca, 0xba,
+	0xcb, 0xbb, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xcb, 0xbb, 0xcb, 0xbb, 0xac, 0xcb, 0xba, 0xbb, 0xbb,
+	0xbc, 0xbb, 0xcb, 0xba, 0xbb, 0xab, 0xbb, 0xbb, 0xaa, 0xa9, 0x88, 0x11, 0x53, 0x63, 0x43, 0x34,
+	0x44, 0x43, 0x34, 0x43, 0x34, 0x43, 0x43, 0x24, 0x24, 0x43, 0x33, 0x34, 0x53, 0x32, 0x34, 0x33,
+	0x44, 0x32, 0x34, 0x33, 0x34, 0x43, 0x43, 0x33, 0x24, 0x24, 0x33, 0x24, 0x43, 0x23, 0x24, 0x33,
+	0x34, 0x33, 0x43, 0x43, 0x32, 0x43, 0x32, 0x43, 0x32, 0x33, 0x24, 0x33, 0x33, 0x24, 0x33, 0x32,
+	0x33, 0x33, 0x32, 0x12, 0x02, 0x00, 0xaa, 0xcc, 0xcc, 0xbc, 0xcc, 0xbc, 0xdb, 0xbb, 0xbd, 0xcb,
+	0xbc, 0xcb, 0xcb, 0xbb, 0xad, 0xac, 0xcb, 0xca, 0xba, 0xcb, 0xcb, 0xbb, 0xdb, 0xba, 0xbc, 0xbb,
+	0xbc, 0xcb, 0xcb, 0xbb, 0xcb, 0xbb, 0xbc, 0xac, 0xcb, 0xba, 0xcb, 0xbb, 0xcb, 0xbb, 0xcb, 0xcb,
+	0xba, 0xcb, 0xba, 0xbb, 0xbc, 0xbb, 0xcb, 0xba, 0xcb, 0xba, 0xab, 0xbb, 0xbb, 0xbb, 0xbb, 0xab,
+	0x9a, 0x89, 0x10, 0x43, 0x44, 0x44, 0x34, 0x44, 0x43, 0x43, 0x34, 0x43, 0x34, 0x43, 0x43, 0x43,
+	0x43, 0x33, 0x34, 0x53, 0x42, 0x32, 0x43, 0x33, 0x34, 0x34, 0x43, 0x33, 0x34, 0x43, 0x33, 0x34,
+	0x43, 0x43, 0x32, 0x34, 0x33, 0x53, 0x32, 0x43, 0x33, 0x43, 0x33, 0x43, 0x43, 0x32, 0x43, 0x32,
+	0x24, 0x33, 0x33, 0x43, 0x33, 0x24, 0x33, 0x33, 0x24, 0x23, 0x33, 0x23, 0x33, 0x22, 0x22, 0x01,
+	0x80, 0xaa, 0xbd, 0xbe, 0xbc, 0xbd, 0xcc, 0xbb, 0xbd, 0xdb, 0xbb, 0xbc, 0xbc, 0xbc, 0xbc, 0xcb,
+	0xcb, 0xbb, 0xcc, 0xba, 0xbc, 0xbb, 0xad, 0xcb, 0xbb, 0xcb, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xbc,
+	0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xcb, 0xcb, 0xbb, 0xcb, 0xbb, 0xcb, 0xbb, 0xbc, 0xcb, 0xba, 0xcb,
+	0xbb, 0xbb, 0xbc, 0xbb, 0xac, 0xbb, 0xac, 0xab, 0xbb, 0xcb, 0xaa, 0xab, 0xab, 0xaa, 0x9a, 0x99,
+	0x08, 0x21, 0x34, 0x45, 0x34, 0x44, 0x43, 0x34, 0x53, 0x33, 0x35, 0x43, 0x43, 0x33, 0x35, 0x33,
+	0x35, 0x33, 0x35, 0x33, 0x44, 0x42, 0x32, 0x43, 0x33, 0x34, 0x24, 0x24, 0x33, 0x34, 0x33, 0x25,
+	0x33, 0x34, 0x43, 0x33, 0x24, 0x24, 0x33, 0x43, 0x43, 0x32, 0x43, 0x33, 0x43, 0x33, 0x43, 0x33,
+	0x24, 0x43, 0x32, 0x33, 0x34, 0x42, 0x32, 0x32, 0x33, 0x24, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+	0x32, 0x01, 0x90, 0xb9, 0xdd, 0xcb, 0xcc, 0xcb, 0xbc, 0xbc, 0xbc, 0xcc, 0xbb, 0xbc, 0xbc, 0xbc,
+	0xbc, 0xcb, 0xcb, 0xcb, 0xbb, 0xbc, 0xcb, 0xac, 0xcb, 0xbb, 0xcb, 0xcb, 0xbb, 0xbc, 0xac, 0xac,
+	0xbb, 0xac, 0xac, 0xbb, 0xbc, 0xbb, 0xbc, 0xac, 0xac, 0xbb, 0xcb, 0xbb, 0xcb, 0xcb, 0xba, 0xac,
+	0xbb, 0xac, 0xbb, 0xbc, 0xbb, 0xcb, 0xbb, 0xcb, 0xbb, 0xcb, 0xab, 0xac, 0xba, 0xbb, 0xbb, 0xbb,
+	0xac, 0xba, 0xaa, 0x9b, 0x9a, 0x09, 0x10, 0x32, 0x36, 0x44, 0x34, 0x35, 0x53, 0x43, 0x33, 0x35,
+	0x53, 0x33, 0x34, 0x53, 0x33, 0x53, 0x33, 0x53, 0x33, 0x53, 0x42, 0x32, 0x43, 0x33, 0x34, 0x34,
+	0x33, 0x44, 0x32, 0x24, 0x43, 0x33, 0x43, 0x33, 0x34, 0x24, 0x43, 0x23, 0x24, 0x43, 0x32, 0x43,
+	0x33, 0x43, 0x33, 0x34, 0x33, 0x34, 0x43, 0x33, 0x43, 0x42, 0x32, 0x32, 0x24, 0x33, 0x43, 0x32,
+	0x33, 0x24, 0x33, 0x33, 0x43, 0x32, 0x32, 0x22, 0x22, 0x22, 0x10, 0x88, 0xba, 0xcc, 0xcc, 0xdb,
+	0xdb, 0xbb, 0xbd, 0xdb, 0xbb, 0xbc, 0xcc, 0xbb, 0xdb, 0xbb, 0xbc, 0xbc, 0xcb, 0xac, 0xcb, 0xbb,
+	0xbc, 0xcb, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xbc, 0xbc, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xbc, 0xbb,
+	0xad, 0xbb, 0xbc, 0xcb, 0xbb, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xcb, 0xbb, 0xcb, 0xcb, 0xba, 0xcb,
+	0xba, 0xcb, 0xab, 0xcb, 0xba, 0xbb, 0xbc, 0xba, 0xac, 0xab, 0xbb, 0xbb, 0xbb, 0xcb, 0xaa, 0xaa,
+	0x99, 0x99, 0x10, 0x22, 0x44, 0x44, 0x53, 0x43, 0x34, 0x53, 0x43, 0x33, 0x35, 0x43, 0x43, 0x43,
+	0x43, 0x33, 0x34, 0x34, 0x43, 0x43, 0x43, 0x42, 0x32, 0x24, 0x24, 0x33, 0x34, 0x43, 0x33, 0x34,
+	0x43, 0x43, 0x33, 0x43, 0x43, 0x33, 0x43, 0x43, 0x33, 0x43, 0x43, 0x32, 0x34, 0x42, 0x32, 0x43,
+	0x33, 0x43, 0x33, 0x43, 0x43, 0x32, 0x43, 0x32, 0x24, 0x33, 0x33, 0x34, 0x43, 0x32, 0x43, 0x32,
+	0x32, 0x24, 0x23, 0x33, 0x32, 0x43, 0x22, 0x22, 0x11, 0x11, 0x00, 0xa9, 0xca, 0xcc, 0xdb, 0xdb,
+	0xcb, 0xcb, 0xcb, 0xdb, 0xbb, 0xbc, 0xbc, 0xdb, 0xbb, 0xbc, 0xdb, 0xca, 0xba, 0xcb, 0xcb, 0xbb,
+	0xbc, 0xac, 0xac, 0xcb, 0xba, 0xbc, 0xbb, 0xbc, 0xbc, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xbc, 0xcb,
+	0xbb, 0xbc, 0xcb, 0xbb, 0xbc, 0xcb, 0xca, 0xba, 0xbb, 0xbc, 0xcb, 0xbb, 0xcb, 0xbb, 0xbc, 0xbb,
+	0xdb, 0xba, 0xbb, 0xbc, 0xbb, 0xcb, 0xbb, 0xac, 0xbb, 0xcb, 0xab, 0xbb, 0xac, 0xba, 0xab, 0xbb,
+	0xab, 0xbb, 0x9a, 0x8a, 0x08, 0x22, 0x53, 0x43, 0x53, 0x43, 0x53, 0x43, 0x43, 0x43, 0x43, 0x43,
+	0x43, 0x43, 0x33, 0x34, 0x34, 0x34, 0x43, 0x43, 0x33, 0x34, 0x53, 0x32, 0x34, 0x33, 0x34, 0x34,
+	0x43, 0x43, 0x32, 0x34, 0x33, 0x34, 0x34, 0x43, 0x33, 0x43, 0x24, 0x33, 0x34, 0x33, 0x34, 0x34,
+	0x33, 0x34, 0x43, 0x33, 0x43, 0x43, 0x32, 0x24, 0x33, 0x24, 0x33, 0x34, 0x33, 0x24, 0x43, 0x32,
+	0x43, 0x32, 0x33, 0x43, 0x33, 0x33, 0x24, 0x33, 0x33, 0x24, 0x23, 0x23, 0x32, 0x12, 0x12, 0x00,
+	0x99, 0xbb, 0xbd, 0xcb, 0xbc, 0xbd, 0xbc, 0xbc, 0xbd, 0xcb, 0xcb, 0xcb, 0xcb, 0xbb, 0xbc, 0xbc,
+	0xbc, 0xbc, 0xbb, 0xbd, 0xbb, 0xad, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xbc, 0xbc, 0xbb, 0xad, 0xcb,
+	0xba, 0xbc, 0xbb, 0xbc, 0xcb, 0xcb, 0xba, 0xbc, 0xbb, 0xbc, 0xcb, 0xbb, 0xcb, 0xac, 0xbb, 0xcb,
+	0xcb, 0xba, 0xcb, 0xbb, 0xcb, 0xbb, 0xcb, 0xcb, 0xba, 0xbb, 0xbc, 0xcb, 0xba, 0xcb, 0xba, 0xbb,
+	0xcb, 0xbb, 0xbb, 0xbc, 0xbb, 0xbb, 0xbb, 0xac, 0xaa, 0xba, 0xa9, 0x99, 0x19, 0x31, 0x32, 0x34,
+	0x34, 0x35, 0x44, 0x33, 0x35, 0x53, 0x33, 0x44, 0x33, 0x53, 0x33, 0x34, 0x34, 0x24, 0x34, 0x33,
+	0x34, 0x34, 0x34, 0x33, 0x25, 0x43, 0x33, 0x34, 0x43, 0x33, 0x34, 0x43, 0x43, 0x33, 0x43, 0x43,
+	0x33, 0x34, 0x43, 0x42, 0x32, 0x43, 0x33, 0x43, 0x43, 0x33, 0x43, 0x33, 0x34, 0x33, 0x34, 0x24,
+	0x43, 0x32, 0x43, 0x32, 0x24, 0x33, 0x43, 0x33, 0x43, 0x33, 0x43, 0x33, 0x43, 0x32, 0x43, 0x32,
+	0x33, 0x43, 0x32, 0x33, 0x33, 0x32, 0x33, 0x33, 0x23, 0x11, 0x91, 0xb9, 0xba, 0xdb, 0xbb, 0xbc,
+	0xbd, 0xdb, 0xbb, 0xbd, 0xcb, 0xdb, 0xba, 0xbc, 0xcb, 0xcb, 0xcb, 0xbb, 0xbc, 0xbc, 0xcb, 0xcb,
+	0xbb, 0xbc, 0xcb, 0xcb, 0xbb, 0xbc, 0xcb, 0xcb, 0xbb, 0xdb, 0xba, 0xac, 0xcb, 0xba, 0xbc, 0xbb,
+	0xbc, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xac, 0xac, 0xbb, 0xbc, 0xbb, 0xbc, 0xcb, 0xbb, 0xac, 0xac,
+	0xab, 0xac, 0xbb, 0xcb, 0xbb, 0xcb, 0xbb, 0xbc, 0xbb, 0xcb, 0xbb, 0xcb, 0xbb, 0xcb, 0xba, 0xbb,
+	0xac, 0xab, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x9b, 0x9a, 0x10, 0x21, 0x32, 0x33, 0x35, 0x33, 0x35,
+	0x53, 0x43, 0x33, 0x35, 0x34, 0x43, 0x43, 0x43, 0x33, 0x35, 0x42, 0x33, 0x34, 0x43, 0x43, 0x43,
+	0x42, 0x32, 0x43, 0x43, 0x42, 0x32, 0x43, 0x33, 0x34, 0x43, 0x33, 0x34, 0x34, 0x33, 0x34, 0x34,
+	0x33, 0x34, 0x34, 0x33, 0x34, 0x43, 0x33, 0x34, 0x43, 0x33, 0x24, 0x24, 0x33, 0x43, 0x33, 0x43,
+	0x43, 0x32, 0x43, 0x33, 0x43, 0x32, 0x24, 0x33, 0x24, 0x33, 0x24, 0x33, 0x43, 0x33, 0x33, 0x33,
+	0x34, 0x33, 0x43, 0x32, 0x22, 0x32, 0x23, 0x12, 0x11, 0x91, 0xa9, 0xb9, 0xbb, 0xdb, 0xab, 0xcb,
+	0xcb, 0xdb, 0xbb, 0xbd, 0xca, 0xcb, 0xbb, 0xbc, 0xbc, 0xbc, 0xbc, 0xcb, 0xbb, 0xad, 0xcb, 0xca,
+	0xba, 0xcb, 0xbb, 0xbc, 0xbc, 0xcb, 0xbb, 0xbc, 0xcb, 0xcb, 0xbb, 0xcb, 0xcb, 0xbb, 0xcb, 0xac,
+	0xbb, 0xbc, 0xbb, 0xad, 0xbb, 0xbc, 0xbb, 0xbc, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xcb, 0xcb, 0xba,
+	0xcb, 0xbb, 0xcb, 0xca, 0xba, 0xbb, 0xbc, 0xbb, 0xbc, 0xbb, 0xac, 0xcb, 0xba, 0xbb, 0xbb, 0xbc,
+	0xcb, 0xba, 0xba, 0xbb, 0xbb, 0xbb, 0x9c, 0xa9, 0x99, 0x99, 0x10, 0x11, 0x22, 0x32, 0x33, 0x34,
+	0x42, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x33, 0x34, 0x34, 0x34, 0x34, 0x43, 0x33, 0x25, 0x43,
+	0x33, 0x34, 0x43, 0x33, 0x25, 0x33, 0x34, 0x43, 0x43, 0x42, 0x32, 0x43, 0x33, 0x43, 0x43, 0x33,
+	0x34, 0x43, 0x33, 0x53, 0x32, 0x24, 0x33, 0x34, 0x33, 0x34, 0x43, 0x43, 0x32, 0x43, 0x33, 0x43,
+	0x43, 0x32, 0x43, 0x33, 0x43, 0x33, 0x34, 0x33, 0x43, 0x33, 0x34, 0x33, 0x43, 0x33, 0x43, 0x33,
+	0x33, 0x24, 0x33, 0x24, 0x23, 0x33, 0x33, 0x33, 0x23, 0x21, 0x11, 0x01, 0x99, 0x99, 0x9a, 0xbb,
+	0xba, 0xbb, 0xad, 0xba, 0xcb, 0xdb, 0xba, 0xbc, 0xdb, 0xbb, 0xbc, 0xdb, 0xab, 0xbc, 0xcb, 0xbb,
+	0xcc, 0xba, 0xbc, 0xcb, 0xbb, 0xbc, 0xbc, 0xcb, 0xbb, 0xbc, 0xac, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb,
+	0xbc, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xbc, 0xbb, 0xad, 0xbb, 0xbc, 0xbb, 0xad, 0xbb, 0xcb, 0xbb,
+	0xbc, 0xbb, 0xbc, 0xcb, 0xbb, 0xbc, 0xbb, 0xcb, 0xcb, 0xba, 0xbb, 0xbc, 0xcb, 0xba, 0xcb, 0xbb,
+	0xbb, 0xac, 0xbb, 0xac, 0xbb, 0xbb, 0xdb, 0x9a, 0xaa, 0xb9, 0xaa, 0xa9, 0x99, 0x09, 0x00, 0x11,
+	0x11, 0x12, 0x23, 0x32, 0x33, 0x43, 0x32, 0x43, 0x33, 0x34, 0x34, 0x53, 0x32, 0x25, 0x33, 0x34,
+	0x34, 0x43, 0x43, 0x42, 0x23, 0x34, 0x33, 0x35, 0x33, 0x34, 0x43, 0x43, 0x33, 0x34, 0x43, 0x43,
+	0x42, 0x32, 0x43, 0x33, 0x34, 0x33, 0x34, 0x34, 0x43, 0x33, 0x43, 0x43, 0x33, 0x43, 0x33, 0x34,
+	0x43, 0x33, 0x43, 0x33, 0x34, 0x43, 0x33, 0x43, 0x33, 0x43, 0x43, 0x23, 0x43, 0x33, 0x43, 0x23,
+	0x24, 0x33, 0x43, 0x32, 0x33, 0x34, 0x33, 0x53, 0x12, 0x22, 0x32, 0x23, 0x12, 0x13, 0x21, 0x11,
+	0x01, 0x00, 0x90, 0x99, 0xa9, 0xa9, 0xaa, 0xaa, 0xbb, 0xbb, 0xbb, 0xbc, 0xba, 0xbc, 0xbb, 0xbd,
+	0xbb, 0xbc, 0xcb, 0xcb, 0xcb, 0xca, 0xbb, 0xcb, 0xcb, 0xbb, 0xbc, 0xbc, 0xcb, 0xbb, 0xbc, 0xbc,
+	0xbb, 0xbc, 0xbc, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xdb, 0xab,
+	0xcb, 0xbb, 0xcb, 0xcb, 0xbb, 0xcb, 0xbb, 0xbc, 0xbb, 0xbc, 0xcb, 0xbb, 0xcb, 0xbb, 0xac, 0xcb,
+	0xba, 0xac, 0xbb, 0xbb, 0xbc, 0xbb, 0xad, 0xba, 0xba, 0xbb, 0xac, 0xb9, 0xbb, 0xaa, 0xaa, 0xb9,
+	0xa9, 0x99, 0x99, 0x99, 0x09, 0x10, 0x10, 0x11, 0x11, 0x21, 0x31, 0x31, 0x22, 0x32, 0x32, 0x33,
+	0x33, 0x43, 0x32, 0x33, 0x34, 0x42, 0x33, 0x53, 0x23, 0x43, 0x32, 0x34, 0x43, 0x33, 0x34, 0x34,
+	0x43, 0x33, 0x34, 0x34, 0x43, 0x42, 0x32, 0x53, 0x32, 0x33, 0x25, 0x33, 0x43, 0x33, 0x25, 0x33,
+	0x43, 0x33, 0x34, 0x43, 0x33, 0x24, 0x43, 0x33, 0x43, 0x33, 0x34, 0x43, 0x33, 0x43, 0x33, 0x53,
+	0x23, 0x33, 0x34, 0x33, 0x25, 0x32, 0x32, 0x34, 0x32, 0x33, 0x43, 0x12, 0x33, 0x33, 0x22, 0x23,
+	0x31, 0x31, 0x21, 0x21, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x09, 0x99, 0x90, 0x99, 0x9a, 0xa9,
+	0xb9, 0xa9, 0xaa, 0xaa, 0xaa, 0xab, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xac, 0xba, 0xac, 0xba, 0xbc,
+	0xba, 0xbc, 0xba, 0xbd, 0xaa, 0xbb, 0xbd, 0xba, 0xbb, 0xbd, 0xba, 0xcb, 0xbb, 0xdb, 0xbb, 0xbb,
+	0xdb, 0xbb, 0xbb, 0xdb, 0xbb, 0xab, 0xbc, 0xbb, 0xbd, 0xba, 0xbb, 0xbd, 0xaa, 0xbb, 0xbc, 0xba,
+	0xad, 0xaa, 0xba, 0xac, 0xba, 0xac, 0xba, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xba, 0xaa,
+	0x9a, 0x9b, 0x9b, 0x9a, 0x9a, 0x9a, 0xa9, 0x99, 0x99, 0x99, 0x09, 0x09, 0x00, 0x00, 0x00, 0x01,
+	0x01, 0x11, 0x11, 0x11, 0x21, 0x11, 0x12, 0x21, 0x31, 0x21, 0x12, 0x23, 0x31, 0x22, 0x22, 0x32,
+	0x22, 0x23, 0x33, 0x32, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x24, 0x22, 0x33, 0x33,
+	0x43, 0x22, 0x32, 0x33, 0x24, 0x22, 0x33, 0x33, 0x43, 0x22, 0x32, 0x33, 0x33, 0x33, 0x33, 0x33,
+	0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x32, 0x22, 0x22, 0x22, 0x22, 0x12, 0x23, 0x31, 0x21,
+	0x12, 0x12, 0x12, 0x12, 0x21, 0x11, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x01, 0x10, 0x00,
+	0x00, 0x00, 0x00, 0x09, 0x90, 0x90, 0x09, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xa9, 0x99, 0xa9,
+	0x99, 0x9a, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0xb9, 0xa9, 0xb9, 0xa9, 0xb9, 0xb9, 0xa9, 0x9a,
+	0x9b, 0xaa, 0xb9, 0xb9, 0xa9, 0x9a, 0x9b, 0x9b, 0xaa, 0xb9, 0xa9, 0x9a, 0xaa, 0xa9, 0xb9, 0xa9,
+	0xa9, 0xa9, 0x9a, 0x9a, 0x9a, 0xa9, 0xa9, 0x99, 0x9a, 0x9a, 0x99, 0x9a, 0x99, 0x9a, 0x99, 0x99,
+	0x99, 0x9a, 0x99, 0x99, 0x90, 0x99, 0x09, 0x99, 0x90, 0x90, 0x90, 0x90, 0x00, 0x90, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x10, 0x10, 0x00, 0x11, 0x10, 0x10, 0x10, 0x01, 0x11,
+	0x01, 0x11, 0x11, 0x10, 0x11, 0x11, 0x10, 0x11, 0x11, 0x11, 0x01, 0x11, 0x11, 0x11, 0x11, 0x01,
+	0x11, 0x11, 0x11, 0x01, 0x11, 0x11, 0x10, 0x11, 0x10, 0x11, 0x10, 0x01, 0x01, 0x11, 0x10, 0x10,
+	0x10, 0x10, 0x00, 0x01, 0x10, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00
+};
+
+static const adpcm_clip_t drum =
+{
+	drum_codes, 5600, 16000, 0, 0,
+	{ 0, 47 }, { 0, 47 }
+};
+
+//10800 bytes of codes
+const adpcm_clip_t *const adpcm_clips[] = { &pluck, &drum };
+const char *const adpcm_clip_names[] = { "pluck", "drum" };
+const uint32_t adpcm_clip_count = 2;
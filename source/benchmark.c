@@ -0,0 +1,543 @@
+/*
+ * @file        benchmark.c
+ * @brief       On-target cycle benchmarks of the audio path function implementations
+ *
+ * Measures CPU cycles of the audio hot paths with cycle_count() and prints them
+ * against the per-sample budget at the output sample rate.
+ * Interrupts are masked while a measurement runs so the DMA refill does not skew it.
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       MCUXpresso IDE
+ */
+
+#include <stdio.h>
+#include <musical_tones.h>
+#include "benchmark.h"
+#include "mixer.h"
+#include "sequencer.h"
+#include "effects.h"
+#include "adpcm.h"
+#include "health.h"
+#include "i2c.h"
+#include "accelerometer.h"
+#include "tilt.h"
+#include "systick.h"
+#include <math.h>
+
+#define BENCH_REPEATS  (16) //Blocks per measurement
+#define RATE_TICKS     (16) //SysTick ticks each sample rate is measured for, 1 second
+#define SETTLE_TICKS   (2)  //Ticks to let a rate switch settle before measuring
+#define DMA_BUS_CYCLES (4)  //Estimated bus clocks per 16-bit SRAM to DAC0 transfer, read plus bridge write
+#define BUS_CLOCK_DIV  (2)  //Bus clock is half the core clock
+#define FX_ECHO_MS     (40) //Fits the delay line at 48 kHz
+#define FX_LEVEL       (EFFECTS_LEVEL_MAX / 2)
+#define FX_INPUT_STEP  (1024) //Saw wave fed to the effects, Q15 per sample
+#define HEALTH_REFILLS (128)  //Refills timed, under one SysTick tick in all
+#define FIT_HEADROOM   (4)    //Fits sample voices in 3/4 of the budget, the rest is the stream and the main loop
+#define I2C_BATCHES    (16)   //Accelerometer FIFO batches timed for each receive path, 320 ms
+#define TILT_READINGS  (64)   //Readings timed for each angle path, well under a SysTick tick in soft-float
+#define TILT_STEP      (521)  //Counts between the axes of successive readings, all octants covered
+#define COUNTS_PER_G   (4096)
+#define DEGREES_PER_RADIAN (57.2957795)
+
+static const uint32_t bench_rates[] = { 16000, 24000, 32000, 48000 };
+
+/*
+ * @name   benchmark_mixer
+ * @brief  Measures mixer cost for 0..MIXER_NUM_VOICES active voices
+ *
+ * Prints cycles per sample and the cost of each additional voice
+ *
+ * @param  void
+ * @return void
+ */
+void benchmark_mixer()
+{
+	static uint16_t out[MIXER_BLOCK_SIZE];
+	tone_t tone = { WAVEFORM1_FREQ, ZERO };
+	uint32_t budget = SystemCoreClock / output_sample_rate;
+	uint32_t samples = BENCH_REPEATS * MIXER_BLOCK_SIZE;
+	uint32_t base = ZERO;
+
+	tone_init(&tone);
+	sequencer_stop();
+	audio_stream_stop(); //The benchmark uses the mixer voices
+	mixer_reset();
+
+	printf("\r\nMixer budget: %lu cycles/sample at %lu Hz\r", (unsigned long)budget,
+			(unsigned long)output_sample_rate);
+	for(int v = ZERO; v <= MIXER_NUM_VOICES; v++)
+	{
+		uint32_t start, cycles;
+
+		if(v > ZERO)
+			mixer_note_on(v, &tone, MIXER_VELOCITY_MAX);
+
+		__disable_irq();
+		start = cycle_count();
+		for(int r = ZERO; r < BENCH_REPEATS; r++)
+			mixer_fill(out, MIXER_BLOCK_SIZE);
+		cycles = cycle_count() - start;
+		__enable_irq();
+
+		if(v == ZERO)
+		{
+			base = cycles;
+			printf("\r\n0 voices: %lu cycles/sample\r", (unsigned long)(cycles / samples));
+		}
+		else
+		{
+			printf("\r\n%d voices: %lu cycles/sample, %lu cycles/voice/sample\r", v,
+					(unsigned long)(cycles / samples), (unsigned long)((cycles - base) / (samples * v)));
+		}
+	}
+	printf("\r\n");
+	mixer_reset();
+}
+
+/*
+ * @name   time_fill
+ * @brief  Cycles per sample of mixer_fill() with the voices as they are
+ *
+ * @param  void
+ * @return uint32_t cycles
+ */
+static uint32_t time_fill()
+{
+	static uint16_t out[MIXER_BLOCK_SIZE];
+	uint32_t start, cycles;
+
+	__disable_irq();
+	start = cycle_count();
+	for(int r = ZERO; r < BENCH_REPEATS; r++)
+		mixer_fill(out, MIXER_BLOCK_SIZE);
+	cycles = cycle_count() - start;
+	__enable_irq();
+	return cycles / (BENCH_REPEATS * MIXER_BLOCK_SIZE);
+}
+
+/*
+ * @name   benchmark_gain
+ * @brief  Measures the per-sample cost of the mixer output stage
+ *
+ * With no voices, mixer_fill() is the clear, the knee test and the DAC conversion, with and
+ * without dither. All voices in phase at full level drive every peak into the soft clip; the
+ * same voices at a quarter of the master volume stay under the knee.
+ *
+ * @param  void
+ * @return void
+ */
+void benchmark_gain()
+{
+	tone_t tone = { WAVEFORM1_FREQ, ZERO };
+	int32_t volume = mixer_master();
+	int dithered = mixer_dither();
+	uint32_t plain, dither, clipped, linear;
+
+	tone_init(&tone);
+	sequencer_stop();
+	audio_stream_stop(); //The benchmark uses the mixer voices
+	mixer_reset();
+
+	mixer_set_dither(ZERO);
+	plain = time_fill();
+	mixer_set_dither(ONE);
+	dither = time_fill();
+	mixer_set_dither(ZERO);
+	for(int v = ZERO; v < MIXER_NUM_VOICES; v++)
+		mixer_note_on(v, &tone, MIXER_VELOCITY_MAX);
+	mixer_set_master(MIXER_VOLUME_MAX / MIXER_NUM_VOICES);
+	linear = time_fill();
+	mixer_set_master(MIXER_VOLUME_MAX);
+	clipped = time_fill();
+
+	printf("\r\nOutput stage: %lu cycles/sample, dither +%lu, soft clip +%lu, budget %lu\r\n",
+			(unsigned long)plain, (unsigned long)(dither - plain), (unsigned long)(clipped - linear),
+			(unsigned long)(SystemCoreClock / output_sample_rate));
+	mixer_reset();
+	mixer_set_master(volume);
+	mixer_set_dither(dithered);
+}
+
+/*
+ * @name   benchmark_envelope
+ * @brief  Measures the cost of advancing one ADSR envelope by one block
+ *
+ * Times envelope_block() in the attack and sustain stages and through a whole note, where
+ * the stage transitions add one division each
+ *
+ * @param  void
+ * @return void
+ */
+void benchmark_envelope()
+{
+	static const adsr_params_t slow = { 60000, 0, ENV_Q15(0.5), 60000 }; //Never leaves attack
+	static const adsr_params_t note = { 5, 50, ENV_Q15(0.5), 50 };
+	adsr_rates_t rates;
+	envelope_t env = { ZERO };
+	int32_t step;
+	uint32_t start, attack, sustain, whole, blocks = ZERO;
+
+	envelope_rates(&rates, &slow, output_sample_rate);
+	envelope_trigger(&env, &rates);
+	__disable_irq();
+	start = cycle_count();
+	for(int r = ZERO; r < BENCH_REPEATS; r++)
+		envelope_block(&env, MIXER_BLOCK_SIZE, &step);
+	attack = cycle_count() - start;
+
+	env.stage = ENV_SUSTAIN;
+	start = cycle_count();
+	for(int r = ZERO; r < BENCH_REPEATS; r++)
+		envelope_block(&env, MIXER_BLOCK_SIZE, &step);
+	sustain = cycle_count() - start;
+
+	env.stage = ENV_IDLE;
+	envelope_rates(&rates, &note, output_sample_rate);
+	envelope_trigger(&env, &rates);
+	start = cycle_count();
+	while(env.stage != ENV_IDLE)
+	{
+		if(env.stage == ENV_SUSTAIN)
+			envelope_release(&env);
+		envelope_block(&env, MIXER_BLOCK_SIZE, &step);
+		blocks++;
+	}
+	whole = cycle_count() - start;
+	__enable_irq();
+
+	printf("\r\nEnvelope per %d-sample block: attack %lu, sustain %lu, whole note avg %lu cycles\r\n",
+			MIXER_BLOCK_SIZE, (unsigned long)(attack / BENCH_REPEATS), (unsigned long)(sustain / BENCH_REPEATS),
+			(unsigned long)(whole / blocks));
+}
+
+/*
+ * @name   benchmark_rates
+ * @brief  Measures CPU and bus occupancy of the audio stream at each output sample rate
+ *
+ * Plays the current tune, or tune 1, for a second at each rate and reads the cycles spent in
+ * DMA0_IRQHandler over that second. DMA0 moves one 16-bit sample per TPM0 overflow; its bus
+ * share is estimated from DMA_BUS_CYCLES per transfer. The original rate is restored after.
+ *
+ * @param  void
+ * @return void
+ */
+void benchmark_rates()
+{
+	uint32_t original = output_sample_rate;
+	int started = (sequencer_current() == NULL);
+	uint32_t bus_clock = SystemCoreClock / BUS_CLOCK_DIV;
+
+	if(started)
+		play_tune(ONE);
+
+	printf("\r\nRate   CPU%%  cycles/refill  DMA/s  bus%% (est.)\r");
+	for(uint32_t i = ZERO; i < sizeof(bench_rates) / sizeof(bench_rates[ZERO]); i++)
+	{
+		uint32_t busy, refills, samples, elapsed, transfers;
+
+		audio_set_sample_rate(bench_rates[i]);
+		reset_timer();
+		while(get_timer() < SETTLE_TICKS);
+
+		busy = audio_stream_stats.busy_cycles;
+		refills = audio_stream_stats.completions;
+		samples = audio_sample_clock;
+		elapsed = cycle_count();
+		reset_timer();
+		while(get_timer() < RATE_TICKS);
+		busy = audio_stream_stats.busy_cycles - busy;
+		refills = audio_stream_stats.completions - refills;
+		samples = audio_sample_clock - samples;
+		elapsed = cycle_count() - elapsed;
+
+		transfers = (uint32_t)(((uint64_t)samples * SystemCoreClock) / elapsed); //Per second
+		printf("\r\n%5lu  %2lu.%lu  %13lu  %5lu  %2lu.%02lu\r", (unsigned long)bench_rates[i],
+				(unsigned long)(((uint64_t)busy * 1000 / elapsed) / 10), (unsigned long)(((uint64_t)busy * 1000 / elapsed) % 10),
+				(unsigned long)(refills ? busy / refills : ZERO), (unsigned long)transfers,
+				(unsigned long)(((uint64_t)transfers * DMA_BUS_CYCLES * 10000 / bus_clock) / 100),
+				(unsigned long)(((uint64_t)transfers * DMA_BUS_CYCLES * 10000 / bus_clock) % 100));
+	}
+	printf("\r\n");
+
+	audio_set_sample_rate(original);
+	if(started)
+		sequencer_stop();
+}
+
+/*
+ * @name   benchmark_effects
+ * @brief  Measures the cycles per block of the filter, the echo and both
+ *
+ * Runs a saw wave block through each setting and prints the cycles per MIXER_BLOCK_SIZE block
+ * against the cycles the block lasts at OUTPUT_SAMPLE_RATE. The settings in use are restored.
+ *
+ * @param  void
+ * @return void
+ */
+void benchmark_effects()
+{
+	static const effects_settings_t cases[] = {
+		{ FILTER_LOWPASS, EFFECTS_CUTOFF_DEFAULT, EFFECTS_Q_DEFAULT, ZERO, ZERO, ZERO },
+		{ FILTER_OFF, EFFECTS_CUTOFF_DEFAULT, EFFECTS_Q_DEFAULT, FX_ECHO_MS, FX_LEVEL, FX_LEVEL },
+		{ FILTER_LOWPASS, EFFECTS_CUTOFF_DEFAULT, EFFECTS_Q_DEFAULT, FX_ECHO_MS, FX_LEVEL, FX_LEVEL }
+	};
+	static const char *const names[] = { "Filter", "Echo", "Filter + echo" };
+	static int32_t block[MIXER_BLOCK_SIZE];
+	effects_settings_t keep = *effects_current();
+	uint32_t budget = SystemCoreClock / OUTPUT_SAMPLE_RATE * MIXER_BLOCK_SIZE;
+
+	sequencer_stop();
+	audio_stream_stop(); //The benchmark replaces the effects in use
+	printf("\r\nEffects per %d-sample block, %lu cycles at %d Hz\r", MIXER_BLOCK_SIZE, (unsigned long)budget,
+			OUTPUT_SAMPLE_RATE);
+	for(uint32_t c = ZERO; c < sizeof(cases) / sizeof(cases[ZERO]); c++)
+	{
+		uint32_t start, cycles;
+
+		for(int i = ZERO; i < MIXER_BLOCK_SIZE; i++)
+			block[i] = (int16_t)(i * FX_INPUT_STEP);
+		effects_configure(&cases[c]);
+		__disable_irq();
+		start = cycle_count();
+		for(int r = ZERO; r < BENCH_REPEATS; r++)
+			effects_process(block, MIXER_BLOCK_SIZE);
+		cycles = (cycle_count() - start) / BENCH_REPEATS;
+		__enable_irq();
+		printf("\r\n%-14s %5lu cycles/block, %2lu%% of the block\r", names[c], (unsigned long)cycles,
+				(unsigned long)(cycles * 100 / budget));
+	}
+	printf("\r\n");
+	effects_configure(&keep);
+}
+
+/*
+ * @name   time_fill_total
+ * @brief  Cycles of BENCH_REPEATS blocks of mixer_fill() with the voices as they are
+ *
+ * @param  void
+ * @return uint32_t cycles
+ */
+static uint32_t time_fill_total()
+{
+	static uint16_t out[MIXER_BLOCK_SIZE];
+	uint32_t start, cycles;
+
+	__disable_irq();
+	start = cycle_count();
+	for(int r = ZERO; r < BENCH_REPEATS; r++)
+		mixer_fill(out, MIXER_BLOCK_SIZE);
+	cycles = cycle_count() - start;
+	__enable_irq();
+	return cycles;
+}
+
+/*
+ * @name   benchmark_adpcm
+ * @brief  Measures the cycles per sample of an ADPCM sample voice against an oscillator voice
+ *
+ * Times mixer_fill() with no voice, one oscillator voice and one looping sample voice, whose
+ * clip is decoded from flash and resampled to the output rate. Prints the cost of each voice in
+ * hundredths of a cycle per sample and how many sample voices fit, next to MIXER_NUM_VOICES
+ * oscillators, in 3/4 of the budget at the output sample rate.
+ *
+ * @param  void
+ * @return void
+ */
+void benchmark_adpcm()
+{
+	tone_t tone = { WAVEFORM1_FREQ, ZERO };
+	uint32_t samples = BENCH_REPEATS * MIXER_BLOCK_SIZE;
+	uint32_t budget = SystemCoreClock / output_sample_rate * samples;
+	uint32_t base, osc, adpcm, spare;
+	const adpcm_clip_t *clip = adpcm_clips[ZERO];
+
+	tone_init(&tone);
+	sequencer_stop();
+	audio_stream_stop(); //The benchmark uses the mixer voices
+	mixer_reset();
+	for(uint32_t c = ZERO; c < adpcm_clip_count; c++)
+	{
+		if(adpcm_clips[c]->loop_end != ADPCM_NO_LOOP)
+			clip = adpcm_clips[c]; //A looping clip never runs out during the measurement
+	}
+
+	base = time_fill_total();
+	mixer_note_on(ZERO, &tone, MIXER_VELOCITY_MAX);
+	osc = time_fill_total() - base;
+	mixer_reset();
+	mixer_sample_on(clip, MIXER_VELOCITY_MAX, 1);
+	adpcm = time_fill_total() - base;
+	mixer_reset();
+
+	printf("\r\nSample voice, %lu Hz clip at %lu Hz: %lu.%02lu cycles/sample\r", (unsigned long)clip->rate,
+			(unsigned long)output_sample_rate, (unsigned long)(adpcm / samples), (unsigned long)(adpcm * 100 / samples % 100));
+	printf("\r\nOscillator voice: %lu.%02lu cycles/sample, mixer with no voice: %lu.%02lu\r",
+			(unsigned long)(osc / samples), (unsigned long)(osc * 100 / samples % 100), (unsigned long)(base / samples),
+			(unsigned long)(base * 100 / samples % 100));
+	spare = budget - budget / FIT_HEADROOM;
+	spare = (spare > base + MIXER_NUM_VOICES * osc) ? spare - base - MIXER_NUM_VOICES * osc : ZERO;
+	printf("\r\nSample voices that fit next to %d oscillators: %lu\r\n", MIXER_NUM_VOICES,
+			(unsigned long)(adpcm ? spare / adpcm : ZERO));
+}
+
+/*
+ * @name   benchmark_health
+ * @brief  Measures the cycles the health counters add to each refill
+ *
+ * Times health_refill() on a scratch copy of the counters, fed refills a 64-sample half at
+ * 48 kHz apart, so the load window closes a couple of times; the worst call is one that
+ * closes it. The cost of reading the cycle count is measured first and taken off.
+ *
+ * @param  void
+ * @return void
+ */
+void benchmark_health()
+{
+	static audio_stream_stats_t scratch;
+	uint32_t half = SystemCoreClock / OUTPUT_SAMPLE_RATE * AUDIO_HALF_SIZE;
+	uint32_t empty, start, total = ZERO, worst = ZERO, mean;
+
+	health_reset(&scratch, ZERO);
+	__disable_irq();
+	start = cycle_count();
+	empty = cycle_count() - start;
+	for(uint32_t i = ZERO; i < HEALTH_REFILLS; i++)
+	{
+		uint32_t stamp = (i + ONE) * half, cycles;
+
+		start = cycle_count();
+		health_refill(&scratch, stamp, stamp + half / HEALTH_LATE_DEN);
+		cycles = cycle_count() - start - empty;
+		total += cycles;
+		if(cycles > worst)
+			worst = cycles;
+	}
+	__enable_irq();
+
+	mean = total / HEALTH_REFILLS;
+	printf("\r\nHealth counters: %lu cycles/refill mean, %lu worst closing the load window\r", (unsigned long)mean,
+			(unsigned long)worst);
+	printf("\r\n%lu.%03lu%% of a %d-sample half at %d Hz, %s the %d cycle budget\r\n",
+			(unsigned long)(mean * 100 / half), (unsigned long)(mean * 100000 / half % 1000), AUDIO_HALF_SIZE,
+			OUTPUT_SAMPLE_RATE, (mean <= HEALTH_COST_MAX) ? "within" : "OVER", HEALTH_COST_MAX);
+}
+
+/*
+ * @name   time_batches
+ * @brief  Times I2C_BATCHES drains of the accelerometer FIFO on one receive path
+ *
+ * The first batch may have been drained on the other path and is not timed. The cost of reading
+ * the cycle count, which each handler does twice, is taken off per handler entry.
+ *
+ * @param  int dma, uint32_t *isr (per sample), uint32_t *entries (per batch)
+ * @return void
+ */
+static void time_batches(int dma, uint32_t *isr, uint32_t *entries)
+{
+	uint32_t empty, start, cycles, handled, batches;
+
+	i2c_use_dma(dma);
+	read_full_xyz();
+	start = cycle_count();
+	empty = cycle_count() - start;
+	__disable_irq();
+	handled = i2c_stats.interrupts + i2c_stats.dma_reads + mma_fifo_stats.watermarks;
+	cycles = i2c_isr_cycles;
+	batches = mma_fifo_stats.batches;
+	__enable_irq();
+	for(uint32_t i = ZERO; i < I2C_BATCHES; i++)
+		read_full_xyz();
+	__disable_irq();
+	handled = i2c_stats.interrupts + i2c_stats.dma_reads + mma_fifo_stats.watermarks - handled;
+	cycles = i2c_isr_cycles - cycles - handled * empty;
+	batches = mma_fifo_stats.batches - batches;
+	__enable_irq();
+	if(batches == ZERO)
+		batches = ONE;
+	*isr = cycles / (batches * MMA_FIFO_WATERMARK);
+	*entries = handled / batches;
+}
+
+/*
+ * @name   benchmark_i2c
+ * @brief  Measures the CPU cycles per accelerometer sample with and without the receive DMA
+ *
+ * Each batch of the FIFO is one I2C transaction; prints the cycles spent in the watermark and
+ * I2C interrupts per sample and the interrupts per batch on each path, at 800 Hz. The receive DMA
+ * is left on.
+ *
+ * @param  void
+ * @return void
+ */
+void benchmark_i2c()
+{
+	uint32_t isr, entries;
+
+	mma_hold_fast(ONE);
+
+	time_batches(ZERO, &isr, &entries);
+	printf("\r\nFIFO drained by interrupt: %lu cycles/sample, %lu interrupts a %d-sample batch\r", (unsigned long)isr,
+			(unsigned long)entries, MMA_FIFO_WATERMARK);
+	time_batches(ONE, &isr, &entries);
+	printf("\r\nFIFO drained by DMA:       %lu cycles/sample, %lu interrupts a %d-sample batch\r\n", (unsigned long)isr,
+			(unsigned long)entries, MMA_FIFO_WATERMARK);
+	mma_hold_fast(ZERO);
+}
+
+/*
+ * @name   tilt_reading
+ * @brief  Axes of reading i of the tilt benchmark, spread over the 14-bit range
+ *
+ * @param  uint32_t i, int16_t *x, int16_t *y, int16_t *z
+ * @return void
+ */
+static void tilt_reading(uint32_t i, int16_t *x, int16_t *y, int16_t *z)
+{
+	*x = (int16_t)((i * TILT_STEP) % (2 * COUNTS_PER_G)) - COUNTS_PER_G;
+	*y = (int16_t)((i * TILT_STEP * 3) % (2 * COUNTS_PER_G)) - COUNTS_PER_G;
+	*z = (int16_t)((i * TILT_STEP * 7) % (2 * COUNTS_PER_G)) - COUNTS_PER_G;
+}
+
+/*
+ * @name   benchmark_tilt
+ * @brief  Measures the cycles of a roll and pitch reading, integer against soft-float
+ *
+ * Times tilt_roll() and tilt_pitch() on TILT_READINGS readings, then the same angles computed
+ * as convert_xyz_to_roll() did before, in g with atan2() and sqrt(). The readings are made up
+ * before each timing, so only the angles are timed.
+ *
+ * @param  void
+ * @return void
+ */
+void benchmark_tilt()
+{
+	static int16_t x[TILT_READINGS], y[TILT_READINGS], z[TILT_READINGS];
+	volatile int32_t fixed_sink = ZERO;
+	volatile float soft_sink = ZERO;
+	uint32_t empty, start, fixed, soft;
+
+	for(uint32_t i = ZERO; i < TILT_READINGS; i++)
+		tilt_reading(i, &x[i], &y[i], &z[i]);
+	__disable_irq();
+	start = cycle_count();
+	empty = cycle_count() - start;
+	start = cycle_count();
+	for(uint32_t i = ZERO; i < TILT_READINGS; i++)
+		fixed_sink += tilt_roll(y[i], z[i]) + tilt_pitch(x[i], y[i], z[i]);
+	fixed = cycle_count() - start - empty;
+	start = cycle_count();
+	for(uint32_t i = ZERO; i < TILT_READINGS; i++)
+	{
+		float ax = x[i] / (float)COUNTS_PER_G, ay = y[i] / (float)COUNTS_PER_G, az = z[i] / (float)COUNTS_PER_G;
+
+		soft_sink += atan2(ay, az) * DEGREES_PER_RADIAN + atan2(ax, sqrt(ay * ay + az * az)) * DEGREES_PER_RADIAN;
+	}
+	soft = cycle_count() - start - empty;
+	__enable_irq();
+
+	printf("\r\nRoll and pitch, integer:    %lu cycles/reading\r", (unsigned long)(fixed / TILT_READINGS));
+	printf("\r\nRoll and pitch, soft-float: %lu cycles/reading, %lu.%lux the integer\r\n",
+			(unsigned long)(soft / TILT_READINGS), (unsigned long)(soft / (fixed ? fixed : ONE)),
+			(unsigned long)(soft * 10 / (fixed ? fixed : ONE) % 10));
+}
@@ -0,0 +1,114 @@
+/*
+ * @file        benchmark.h
+ * @brief       On-target cycle benchmarks of the audio path function declarations
+ *
+ * Measures CPU cycles of the audio hot paths with cycle_count() and prints them
+ * against the per-sample budget at the output sample rate
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       MCUXpresso IDE
+ */
+
+#ifndef BENCHMARK_H_
+#define BENCHMARK_H_
+
+/*
+ * @name   benchmark_mixer
+ * @brief  Measures mixer cost for 0..MIXER_NUM_VOICES active voices
+ *
+ * Prints cycles per sample and the cost of each additional voice
+ *
+ * @param  void
+ * @return void
+ */
+void benchmark_mixer();
+
+/*
+ * @name   benchmark_gain
+ * @brief  Measures the per-sample cost of the mixer output stage
+ *
+ * Prints cycles per sample of the stage alone, and what dither and soft clipping add
+ *
+ * @param  void
+ * @return void
+ */
+void benchmark_gain();
+
+/*
+ * @name   benchmark_envelope
+ * @brief  Measures the cost of advancing one ADSR envelope by one block
+ *
+ * @param  void
+ * @return void
+ */
+void benchmark_envelope();
+
+/*
+ * @name   benchmark_rates
+ * @brief  Measures CPU and bus occupancy of the audio stream at each output sample rate
+ *
+ * Prints the share of CPU cycles spent refilling the ring and the DMA0 transfers per second
+ * with their estimated share of the bus, at 16, 24, 32 and 48 kHz
+ *
+ * @param  void
+ * @return void
+ */
+void benchmark_rates();
+
+/*
+ * @name   benchmark_effects
+ * @brief  Measures the cycles per block of the filter, the echo and both
+ *
+ * Prints them against the cycles a block lasts at 48 kHz, the headroom left for synthesis
+ *
+ * @param  void
+ * @return void
+ */
+void benchmark_effects();
+
+/*
+ * @name   benchmark_adpcm
+ * @brief  Measures the cycles per sample of an ADPCM sample voice against an oscillator voice
+ *
+ * Prints how many sample voices fit next to all the oscillator voices at the output sample rate
+ *
+ * @param  void
+ * @return void
+ */
+void benchmark_adpcm();
+
+/*
+ * @name   benchmark_health
+ * @brief  Measures the cycles the health counters add to each refill
+ *
+ * Prints the mean and the worst against HEALTH_COST_MAX
+ *
+ * @param  void
+ * @return void
+ */
+void benchmark_health();
+
+/*
+ * @name   benchmark_i2c
+ * @brief  Measures the CPU cycles per accelerometer sample with and without the receive DMA
+ *
+ * Prints the cycles spent in the interrupts draining the FIFO per sample, and the interrupts
+ * per batch, on each path
+ *
+ * @param  void
+ * @return void
+ */
+void benchmark_i2c();
+
+/*
+ * @name   benchmark_tilt
+ * @brief  Measures the cycles of a roll and pitch reading, integer against soft-float
+ *
+ * Prints the mean cycles of each and their ratio
+ *
+ * @param  void
+ * @return void
+ */
+void benchmark_tilt();
+
+#endif /* BENCHMARK_H_ */
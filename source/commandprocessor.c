@@ -23,6 +23,21 @@
 #include "musical_tones.h"
 #include "test_queue.h"
 #include "test_sine.h"
+#include "benchmark.h"
+#include "tone_cache.h"
+#include "mixer.h"
+#include "pcm_uart.h"
+#include "midi_uart.h"
+#include "theremin.h"
+#include "effects.h"
+#include "adpcm.h"
+#include "sequencer.h"
+#include "power.h"
+#include "health.h"
+#include "systick.h"
+
+#define PERCENT  (100)
+#define US_PER_SECOND (1000000)
 
 int commandprocessor_stop = 0;
 
@@ -101,7 +116,8 @@ void sinewave_test()
  * @name   display
  * @brief  Prints roll angle
  *
- *Prints roll angle
+ *Prints roll angle from the next batch of the accelerometer FIFO, the FIFO counters, the output
+ *data rate and the event driven reading counters
  *
  * @param  none
  * @return none
@@ -109,12 +125,23 @@ void sinewave_test()
 void display()
 {
 	read_full_xyz();
-	int roll = (int)convert_xyz_to_roll();
+	int roll = (int)(convert_xyz_to_roll() / TILT_CENTIDEGREES);
 	if (roll < 0)
 	{
 		roll = -roll;
 	}
 	printf("\r\nThe roll angle in degrees is: %d\n\r", roll);
+	printf("\r\nFIFO: %lu watermarks, %lu batches of %d samples, %lu overflows, %lu ring full\r\n",
+			(unsigned long)mma_fifo_stats.watermarks, (unsigned long)mma_fifo_stats.batches, MMA_FIFO_WATERMARK,
+			(unsigned long)mma_fifo_stats.overflows, (unsigned long)mma_fifo_stats.ring_full);
+	printf("\rRate: %s, %lu changes; %lu readings, %lu reads avoided\r\n",
+			mma_rate() == MMA_RATE_MOVING ? "800 Hz batches" : "12.5 Hz data-ready", (unsigned long)mma_read_stats.rate_changes,
+			(unsigned long)mma_read_stats.readings, (unsigned long)mma_read_stats.reads_avoided);
+	if (mma_read_stats.readings)
+		printf("\rInterrupt to reading: last %lu us, mean %lu us, worst %lu us\r\n",
+				(unsigned long)mma_read_stats.latency_last_us,
+				(unsigned long)(mma_read_stats.latency_total_us / mma_read_stats.readings),
+				(unsigned long)mma_read_stats.latency_worst_us);
 	if (fabs(roll) >= 0 && fabs(roll) <= 5)
 	{
 		Control_RGB_LEDs(0, 1, 0);
@@ -137,6 +164,431 @@ void display()
     }
 }
 
+/*
+ * @name   stream_stats
+ * @brief  Prints audio stream health counters
+ *
+ * Prints halves played, underruns and missed refill deadlines of the DMA ring
+ *
+ * @param  none
+ * @return none
+ */
+void stream_stats()
+{
+	printf("\r\nHalves played: %lu (%lu samples)\r", (unsigned long)audio_stream_stats.completions,
+			(unsigned long)audio_sample_clock);
+	printf("\r\nUnderruns: %lu\r", (unsigned long)audio_stream_stats.underruns);
+	printf("\r\nMissed refills: %lu\r\n", (unsigned long)audio_stream_stats.deadline_misses);
+}
+
+/*
+ * @name   health
+ * @brief  Prints or clears the audio engine health counters
+ *
+ * health       - prints halves played, underruns, missed and late refills, the shortest, mean
+ *                and longest refill against the half period, and the refill CPU load
+ * health reset - clears them
+ * A single HEALTH_QUERY byte at the command line returns them as a binary frame instead.
+ *
+ * @param  int argc, char *argv[]
+ * @return none
+ */
+void health(int argc, char *argv[])
+{
+	audio_stream_stats_t now;
+	uint32_t half = SystemCoreClock / output_sample_rate * audio_half_size;
+	uint32_t cycles_per_us = SystemCoreClock / US_PER_SECOND;
+
+	if(argc > 1 && strcasecmp(argv[1], "reset") == 0)
+	{
+		__disable_irq(); //The refill ISR updates the counters
+		health_reset(&audio_stream_stats, cycle_count());
+		__enable_irq();
+	}
+	__disable_irq(); //One refill's worth of counters, not parts of two
+	now = audio_stream_stats;
+	__enable_irq();
+
+	printf("\r\nHalves played: %lu, underruns: %lu, missed refills: %lu, late refills: %lu\r",
+			(unsigned long)now.completions, (unsigned long)now.underruns, (unsigned long)now.deadline_misses,
+			(unsigned long)now.late_refills);
+	printf("\r\nRefill cycles: min %lu, mean %lu, max %lu of %lu per half (%lu us)\r", (unsigned long)now.refill_min,
+			(unsigned long)health_mean(&now), (unsigned long)now.refill_max, (unsigned long)half,
+			(unsigned long)(half / cycles_per_us));
+	printf("\r\nRefill CPU load: %lu.%lu%%, peak %lu.%lu%%\r\n", (unsigned long)(now.load / 10),
+			(unsigned long)(now.load % 10), (unsigned long)(now.load_peak / 10), (unsigned long)(now.load_peak % 10));
+}
+
+/*
+ * @name   cache_stats
+ * @brief  Prints tone cache counters
+ *
+ * Prints hits, misses and evictions of the tone cache and how many entries are in use
+ *
+ * @param  none
+ * @return none
+ */
+void cache_stats()
+{
+	printf("\r\nTone cache hits: %lu\r", (unsigned long)tone_cache_stats.hits);
+	printf("\r\nTone cache misses: %lu\r", (unsigned long)tone_cache_stats.misses);
+	printf("\r\nTone cache evictions: %lu\r", (unsigned long)tone_cache_stats.evictions);
+	printf("\r\nEntries used: %lu of %d\r\n", (unsigned long)tone_cache_used(), TONE_CACHE_SIZE);
+}
+
+/*
+ * @name   rate
+ * @brief  Prints or switches the DAC output sample rate
+ *
+ * rate        - prints the current rate
+ * rate <hz>   - switches to hz, also while a tune plays; pitch and tempo are kept
+ *
+ * @param  int argc, char *argv[]
+ * @return none
+ */
+void rate(int argc, char *argv[])
+{
+	if(argc > 1 && !audio_set_sample_rate((uint32_t)strtoul(argv[1], NULL, 10)))
+	{
+		printf("\r\nUnsupported rate %s: %d..%d Hz dividing %d Hz\r\n", argv[1], OUTPUT_RATE_MIN, OUTPUT_RATE_MAX, CLOCK);
+		return;
+	}
+	printf("\r\nOutput sample rate: %lu Hz\r\n", (unsigned long)output_sample_rate);
+}
+
+/*
+ * @name   xfade
+ * @brief  Prints or sets the crossfade between notes
+ *
+ * xfade           - prints the crossfade and the worst gain step since the last print
+ * xfade <samples> - sets the shortest attack and release of the notes started from now on
+ *
+ * @param  int argc, char *argv[]
+ * @return none
+ */
+void xfade(int argc, char *argv[])
+{
+	uint32_t worst;
+
+	if(argc > 1)
+	{
+		__disable_irq(); //The refill ISR starts notes from the rates being replaced
+		mixer_set_crossfade((uint32_t)strtoul(argv[1], NULL, 10));
+		__enable_irq();
+	}
+	worst = mixer_worst_step;
+	mixer_worst_step = 0;
+	printf("\r\nCrossfade: %lu samples, %lu..%d\r", (unsigned long)mixer_crossfade(), (unsigned long)ENV_MIN_SAMPLES,
+			MIXER_XFADE_MAX);
+	printf("\r\nWorst gain step: %lu/32768 per sample\r\n", (unsigned long)worst);
+}
+
+/*
+ * @name   volume
+ * @brief  Prints or sets the master and voice volumes
+ *
+ * volume               - prints the master volume and each voice's volume
+ * volume <pct>         - sets the master volume, also while a tune plays
+ * volume <pct> <voice> - sets the volume of voice 0..MIXER_NUM_VOICES-1
+ *
+ * @param  int argc, char *argv[]
+ * @return none
+ */
+void volume(int argc, char *argv[])
+{
+	if(argc > 1)
+	{
+		uint32_t pct = (uint32_t)strtoul(argv[1], NULL, 10);
+		int32_t gain = (int32_t)(((pct > PERCENT) ? PERCENT : pct) * MIXER_VOLUME_MAX / PERCENT);
+
+		if(argc > 2)
+			mixer_set_volume(atoi(argv[2]), gain);
+		else
+			mixer_set_master(gain);
+	}
+	printf("\r\nMaster volume: %lu%%\r", (unsigned long)(mixer_master() * PERCENT / MIXER_VOLUME_MAX));
+	for(int v = 0; v < MIXER_NUM_VOICES; v++)
+		printf("\r\nVoice %d volume: %lu%%\r", v, (unsigned long)(mixer_volume(v) * PERCENT / MIXER_VOLUME_MAX));
+	printf("\r\n");
+}
+
+/*
+ * @name   dither
+ * @brief  Prints or switches TPDF dither on the DAC output
+ *
+ * dither          - prints whether dither is on
+ * dither on|off   - switches it, also while a tune plays
+ *
+ * @param  int argc, char *argv[]
+ * @return none
+ */
+void dither(int argc, char *argv[])
+{
+	if(argc > 1 && strcasecmp(argv[1], "on") == 0)
+		mixer_set_dither(1);
+	else if(argc > 1 && strcasecmp(argv[1], "off") == 0)
+		mixer_set_dither(0);
+	else if(argc > 1)
+		printf("\r\nUsage: dither [on|off]\r");
+	printf("\r\nDither: %s\r\n", mixer_dither() ? "on" : "off");
+}
+
+/*
+ * @name   bench
+ * @brief  Runs audio path cycle benchmarks
+ *
+ * bench mixer - cycles per sample of the voice mixer
+ * bench env   - cycles per block of one ADSR envelope
+ * bench rates - CPU and bus occupancy of the stream at each output sample rate
+ * bench gain  - cycles per sample of the output stage, dither and soft clip
+ * bench fx    - cycles per block of the filter and the echo against the block at 48 kHz
+ * bench adpcm - cycles per sample of an ADPCM sample voice and how many fit next to the oscillators
+ * bench health - cycles the health counters add to each refill, against their budget
+ * bench i2c   - CPU cycles per accelerometer sample drained from the FIFO by interrupt and by DMA
+ * bench tilt  - cycles per roll and pitch reading, integer against soft-float
+ *
+ * @param  int argc, char *argv[]
+ * @return none
+ */
+void bench(int argc, char *argv[])
+{
+	if(argc > 1 && strcasecmp(argv[1], "mixer") == 0)
+		benchmark_mixer();
+	else if(argc > 1 && strcasecmp(argv[1], "env") == 0)
+		benchmark_envelope();
+	else if(argc > 1 && strcasecmp(argv[1], "rates") == 0)
+		benchmark_rates();
+	else if(argc > 1 && strcasecmp(argv[1], "gain") == 0)
+		benchmark_gain();
+	else if(argc > 1 && strcasecmp(argv[1], "fx") == 0)
+		benchmark_effects();
+	else if(argc > 1 && strcasecmp(argv[1], "adpcm") == 0)
+		benchmark_adpcm();
+	else if(argc > 1 && strcasecmp(argv[1], "health") == 0)
+		benchmark_health();
+	else if(argc > 1 && strcasecmp(argv[1], "i2c") == 0)
+		benchmark_i2c();
+	else if(argc > 1 && strcasecmp(argv[1], "tilt") == 0)
+		benchmark_tilt();
+	else
+		printf("\r\nUsage: bench mixer|env|rates|gain|fx|adpcm|health|i2c|tilt\r\n");
+}
+
+/*
+ * @name   u16_arg
+ * @brief  Parses a decimal argument, saturating at 65535 instead of wrapping
+ *
+ * @param  const char *arg
+ * @return uint16_t value
+ */
+static uint16_t u16_arg(const char *arg)
+{
+	unsigned long value = strtoul(arg, NULL, 10);
+
+	return (uint16_t)((value > UINT16_MAX) ? UINT16_MAX : value);
+}
+
+/*
+ * @name   level_arg
+ * @brief  Parses an optional percentage argument as a Q15 effect level
+ *
+ * @param  int argc, char *argv[], int i (argument index, 50% when absent; clamped to 0..100%)
+ * @return int16_t level, Q15
+ */
+static int16_t level_arg(int argc, char *argv[], int i)
+{
+	unsigned long pct = (argc > i) ? strtoul(argv[i], NULL, 10) : PERCENT / 2;
+
+	return (int16_t)(((pct > PERCENT) ? PERCENT : pct) * EFFECTS_LEVEL_MAX / PERCENT);
+}
+
+/*
+ * @name   fx
+ * @brief  Prints or sets the effects chain
+ *
+ * fx                       - prints the effects and their counters
+ * fx off                   - turns the filter and the echo off
+ * fx lp|hp <hz> [q]        - low-pass or high-pass filter, q in hundredths (71)
+ * fx nofilter              - turns the filter off
+ * fx echo <ms> [fb%] [mix%] - echo with feedback and mix levels (50%), 0 ms turns it off
+ * Percentages are clamped to 0..100 and numbers to 0..65535; effects_configure() then clamps
+ * them to what the sample rate allows.
+ *
+ * @param  int argc, char *argv[]
+ * @return none
+ */
+void fx(int argc, char *argv[])
+{
+	effects_settings_t next = *effects_current();
+	const effects_settings_t *now;
+	uint8_t type;
+
+	for(type = FILTER_LOWPASS; argc > 1 && type < FILTER_COUNT && strcasecmp(argv[1], effects_filter_names[type]) != 0; type++);
+	if(argc > 1 && strcasecmp(argv[1], "off") == 0)
+	{
+		next.filter = FILTER_OFF;
+		next.echo_ms = 0;
+	}
+	else if(argc > 1 && strcasecmp(argv[1], "nofilter") == 0)
+		next.filter = FILTER_OFF;
+	else if(argc > 2 && type < FILTER_COUNT)
+	{
+		next.filter = type;
+		next.cutoff_hz = u16_arg(argv[2]);
+		next.q = (argc > 3) ? u16_arg(argv[3]) : EFFECTS_Q_DEFAULT;
+	}
+	else if(argc > 2 && strcasecmp(argv[1], "echo") == 0)
+	{
+		next.echo_ms = u16_arg(argv[2]);
+		next.feedback = level_arg(argc, argv, 3);
+		next.wet = level_arg(argc, argv, 4);
+	}
+	else if(argc > 1)
+		printf("\r\nUsage: fx [off|nofilter|lp <hz> [q]|hp <hz> [q]|echo <ms> [fb%%] [mix%%]]\r");
+	if(argc > 1)
+	{
+		__disable_irq(); //The refill ISR runs the effects being replaced
+		effects_configure(&next);
+		__enable_irq();
+	}
+
+	now = effects_current();
+	if(now->filter == FILTER_OFF)
+		printf("\r\nFilter: off\r");
+	else
+		printf("\r\nFilter: %s %u Hz, Q %u.%02u\r", effects_filter_names[now->filter], now->cutoff_hz, now->q / PERCENT,
+				now->q % PERCENT);
+	if(now->echo_ms == 0)
+		printf("\r\nEcho: off, up to %lu ms\r", (unsigned long)effects_delay_max_ms());
+	else
+		printf("\r\nEcho: %u ms of %lu, feedback %lu%%, mix %lu%%\r", now->echo_ms, (unsigned long)effects_delay_max_ms(),
+				(unsigned long)(now->feedback * PERCENT / EFFECTS_LEVEL_MAX), (unsigned long)(now->wet * PERCENT / EFFECTS_LEVEL_MAX));
+	printf("\r\nBlocks: %lu, filter clips: %lu, echo clips: %lu\r\n", (unsigned long)effects_stats.blocks,
+			(unsigned long)effects_stats.filter_clips, (unsigned long)effects_stats.echo_clips);
+}
+
+/*
+ * @name   sample
+ * @brief  Plays the ADPCM clips from flash on the sample voices
+ *
+ * sample                 - lists the clips and the sample voices playing
+ * sample <name|n> [loop] - starts a clip behind the tunes; loop holds its loop section
+ * sample stop            - lets looping clips play out to their end
+ *
+ * @param  int argc, char *argv[]
+ * @return none
+ */
+void sample(int argc, char *argv[])
+{
+	uint32_t clip = adpcm_clip_count;
+
+	if(argc > 1 && strcasecmp(argv[1], "stop") == 0)
+	{
+		mixer_sample_release(MIXER_NO_VOICE);
+		return;
+	}
+	if(argc > 1)
+	{
+		for(clip = 0; clip < adpcm_clip_count && strcasecmp(argv[1], adpcm_clip_names[clip]) != 0; clip++);
+		if(clip == adpcm_clip_count && argv[1][0] >= '0' && argv[1][0] <= '9')
+			clip = (uint32_t)strtoul(argv[1], NULL, 10);
+		if(clip >= adpcm_clip_count)
+		{
+			printf("\r\nUsage: sample [name|n [loop]|stop]\r");
+			argc = 1;
+		}
+	}
+	if(argc > 1)
+	{
+		int loop = (argc > 2 && strcasecmp(argv[2], "loop") == 0);
+		int v;
+
+		__disable_irq(); //The refill ISR mixes the sample voices
+		v = mixer_sample_on(adpcm_clips[clip], MIXER_VELOCITY_MAX, loop);
+		__enable_irq();
+		power_play(sequencer_fill); //Plays over the tune, if one is playing
+		printf("\r\nSample voice %d: %s%s\r\n", v, adpcm_clip_names[clip],
+				(loop && adpcm_clips[clip]->loop_end != ADPCM_NO_LOOP) ? ", looping until sample stop" : "");
+		return;
+	}
+
+	for(clip = 0; clip < adpcm_clip_count; clip++)
+	{
+		const adpcm_clip_t *c = adpcm_clips[clip];
+
+		printf("\r\n%lu %-8s %lu samples at %lu Hz, %lu bytes%s\r", (unsigned long)clip, adpcm_clip_names[clip],
+				(unsigned long)c->samples, (unsigned long)c->rate, (unsigned long)((c->samples + 1) / 2),
+				(c->loop_end != ADPCM_NO_LOOP) ? ", loops" : "");
+	}
+	for(int i = 0; i < MIXER_SAMPLE_VOICES; i++)
+	{
+		if(mixer_samples[i].active)
+			printf("\r\nVoice %d: sample %lu of %lu%s\r", i, (unsigned long)mixer_samples[i].position,
+					(unsigned long)mixer_samples[i].clip->samples, mixer_samples[i].looping ? ", looping" : "");
+	}
+	printf("\r\n");
+}
+
+/*
+ * @name   pcm
+ * @brief  Plays PCM streamed from the host over UART0
+ *
+ * pcm <hz> - switches UART0 to PCM_BAUD_RATE and plays frames at hz until the host ends the
+ *            stream, then prints the stream counters
+ *
+ * @param  int argc, char *argv[]
+ * @return none
+ */
+void pcm(int argc, char *argv[])
+{
+	if(argc < 2 || !pcm_uart_stream((uint32_t)strtoul(argv[1], NULL, 10)))
+		printf("\r\nUsage: pcm <hz>, %d..%d Hz dividing %d Hz\r\n", OUTPUT_RATE_MIN, OUTPUT_RATE_MAX, CLOCK);
+}
+
+/*
+ * @name   midi
+ * @brief  Plays MIDI received on UART0 on the synth voices
+ *
+ * midi - switches UART0 to MIDI_BAUD_RATE and plays MIDI until a system reset byte (0xFF) or
+ *        30 s of silence, then prints the parser counters and the note on latency
+ *
+ * @param  int argc, char *argv[]
+ * @return none
+ */
+void midi(int argc, char *argv[])
+{
+	midi_uart_play();
+}
+
+/*
+ * @name   theremin
+ * @brief  Plays the accelerometer theremin
+ *
+ * theremin [scale] [ms] - plays roll as pitch and pitch angle as volume until a key is pressed;
+ *                         scale off|chromatic|major|pentatonic (chromatic), glide ms (60)
+ *
+ * @param  int argc, char *argv[]
+ * @return none
+ */
+void theremin(int argc, char *argv[])
+{
+	uint8_t scale = SCALE_CHROMATIC;
+	uint32_t glide = THEREMIN_GLIDE_MS;
+
+	if(argc > 1)
+	{
+		for(scale = SCALE_OFF; scale < SCALE_COUNT && strcasecmp(argv[1], theremin_scale_names[scale]) != 0; scale++);
+		if(scale == SCALE_COUNT)
+		{
+			printf("\r\nUsage: theremin [off|chromatic|major|pentatonic] [glide ms, 0..%d]\r\n", THEREMIN_GLIDE_MAX_MS);
+			return;
+		}
+	}
+	if(argc > 2)
+		glide = (uint32_t)strtoul(argv[2], NULL, 10);
+	play_theremin(scale, glide);
+}
+
 /*
  * @name   terminate
  * @brief  Terminates command processor
@@ -169,9 +621,22 @@ void help()
 	printf("\r\nMusical Tones Player Based on Acceleration Angle Command Processor   \r");
 	printf("\r\n---------------------------------------------------------------------\r");
 	printf("\r\nAUTHOR       Prints author name.                                     \r");
-	printf("\r\nDISPLAY      Prints current roll angle                               \r");
+	printf("\r\nDISPLAY      Prints roll angle, sensor rate, FIFO and read counters  \r");
 	printf("\r\nCBFIFO_TEST  Runs cbfifo tests                                       \r");
 	printf("\r\nSYSTICK_TEST Runs systick timer test                                 \r");
+	printf("\r\nSTREAM       Prints audio stream underruns and missed refills        \r");
+	printf("\r\nHEALTH [reset] Prints or clears refill times, late refills, CPU load \r");
+	printf("\r\nCACHE        Prints tone cache hits, misses and evictions            \r");
+	printf("\r\nRATE [hz]    Prints or switches the DAC output sample rate           \r");
+	printf("\r\nXFADE [n]    Prints or sets the note crossfade in samples, worst step\r");
+	printf("\r\nVOLUME [%%] [v] Prints or sets the master or a voice's volume         \r");
+	printf("\r\nDITHER [on|off] Prints or switches TPDF dither on the DAC output     \r");
+	printf("\r\nFX [...]     Prints or sets the lp/hp filter and the echo effects    \r");
+	printf("\r\nSAMPLE [name|n [loop]|stop] Plays an ADPCM clip over the tunes       \r");
+	printf("\r\nBENCH <name> mixer, env, rates, gain, fx, adpcm, health, i2c, tilt   \r");
+	printf("\r\nPCM <hz>     Plays PCM streamed from the host over UART0             \r");
+	printf("\r\nMIDI         Plays MIDI from UART0 until a System Reset byte (0xFF)  \r");
+	printf("\r\nTHEREMIN [scale] [ms] Roll plays pitch, pitch angle volume; key stops\r");
 	printf("\r\nTERMINATE    Terminates command processor                            \r");
 	printf("\r\nHELP     Prints information about all of the supported commands.     \r");
 	printf("\r\n                                                                     \r");
@@ -79,6 +79,174 @@ void sinewave_test();
  */
 void display();
 
+/*
+ * @name   stream_stats
+ * @brief  Prints audio stream health counters
+ *
+ * Prints halves played, underruns and missed refill deadlines of the DMA ring
+ *
+ * @param  none
+ * @return none
+ */
+void stream_stats();
+
+/*
+ * @name   health
+ * @brief  Prints or clears the audio engine health counters
+ *
+ * health       - prints halves played, underruns, missed and late refills, the shortest, mean
+ *                and longest refill against the half period, and the refill CPU load
+ * health reset - clears them
+ * A single HEALTH_QUERY byte at the command line returns them as a binary frame instead.
+ *
+ * @param  int argc, char *argv[]
+ * @return none
+ */
+void health(int argc, char *argv[]);
+
+/*
+ * @name   cache_stats
+ * @brief  Prints tone cache counters
+ *
+ * Prints hits, misses and evictions of the tone cache and how many entries are in use
+ *
+ * @param  none
+ * @return none
+ */
+void cache_stats();
+
+/*
+ * @name   rate
+ * @brief  Prints or switches the DAC output sample rate
+ *
+ * rate        - prints the current rate
+ * rate <hz>   - switches to hz, also while a tune plays; pitch and tempo are kept
+ *
+ * @param  int argc, char *argv[]
+ * @return none
+ */
+void rate(int argc, char *argv[]);
+
+/*
+ * @name   xfade
+ * @brief  Prints or sets the crossfade between notes
+ *
+ * xfade           - prints the crossfade and the worst gain step since the last print
+ * xfade <samples> - sets the shortest attack and release of the notes started from now on
+ *
+ * @param  int argc, char *argv[]
+ * @return none
+ */
+void xfade(int argc, char *argv[]);
+
+/*
+ * @name   volume
+ * @brief  Prints or sets the master and voice volumes
+ *
+ * volume               - prints the master volume and each voice's volume
+ * volume <pct>         - sets the master volume, also while a tune plays
+ * volume <pct> <voice> - sets the volume of voice 0..MIXER_NUM_VOICES-1
+ *
+ * @param  int argc, char *argv[]
+ * @return none
+ */
+void volume(int argc, char *argv[]);
+
+/*
+ * @name   dither
+ * @brief  Prints or switches TPDF dither on the DAC output
+ *
+ * dither          - prints whether dither is on
+ * dither on|off   - switches it, also while a tune plays
+ *
+ * @param  int argc, char *argv[]
+ * @return none
+ */
+void dither(int argc, char *argv[]);
+
+/*
+ * @name   bench
+ * @brief  Runs audio path cycle benchmarks
+ *
+ * bench mixer - cycles per sample of the voice mixer
+ * bench env   - cycles per block of one ADSR envelope
+ * bench rates - CPU and bus occupancy of the stream at each output sample rate
+ * bench gain  - cycles per sample of the output stage, dither and soft clip
+ * bench fx    - cycles per block of the filter and the echo against the block at 48 kHz
+ * bench adpcm - cycles per sample of an ADPCM sample voice and how many fit next to the oscillators
+ * bench health - cycles the health counters add to each refill, against their budget
+ * bench i2c   - CPU cycles per accelerometer sample drained from the FIFO by interrupt and by DMA
+ * bench tilt  - cycles per roll and pitch reading, integer against soft-float
+ *
+ * @param  int argc, char *argv[]
+ * @return none
+ */
+void bench(int argc, char *argv[]);
+
+/*
+ * @name   fx
+ * @brief  Prints or sets the effects chain
+ *
+ * fx                       - prints the effects and their counters
+ * fx off                   - turns the filter and the echo off
+ * fx lp|hp <hz> [q]        - low-pass or high-pass filter, q in hundredths (71)
+ * fx nofilter              - turns the filter off
+ * fx echo <ms> [fb%] [mix%] - echo with feedback and mix levels (50%), 0 ms turns it off
+ *
+ * @param  int argc, char *argv[]
+ * @return none
+ */
+void fx(int argc, char *argv[]);
+
+/*
+ * @name   sample
+ * @brief  Plays the ADPCM clips from flash on the sample voices
+ *
+ * sample                 - lists the clips and the sample voices playing
+ * sample <name|n> [loop] - starts a clip behind the tunes; loop holds its loop section
+ * sample stop            - lets looping clips play out to their end
+ *
+ * @param  int argc, char *argv[]
+ * @return none
+ */
+void sample(int argc, char *argv[]);
+
+/*
+ * @name   pcm
+ * @brief  Plays PCM streamed from the host over UART0
+ *
+ * pcm <hz> - switches UART0 to PCM_BAUD_RATE and plays frames at hz until the host ends the
+ *            stream, then prints the stream counters
+ *
+ * @param  int argc, char *argv[]
+ * @return none
+ */
+void pcm(int argc, char *argv[]);
+
+/*
+ * @name   midi
+ * @brief  Plays MIDI received on UART0 on the synth voices
+ *
+ * midi - switches UART0 to MIDI_BAUD_RATE and plays MIDI until a system reset byte (0xFF) or
+ *        30 s of silence, then prints the parser counters and the note on latency
+ *
+ * @param  int argc, char *argv[]
+ * @return none
+ */
+void midi(int argc, char *argv[]);
+
+/*
+ * @name   theremin
+ * @brief  Plays the accelerometer theremin
+ *
+ * theremin [scale] [ms] - plays roll as pitch and pitch angle as volume until a key is pressed;
+ *                         scale off|chromatic|major|pentatonic (chromatic), glide ms (60)
+ *
+ * @param  int argc, char *argv[]
+ * @return none
+ */
+void theremin(int argc, char *argv[]);
+
 /*
  * @name   help
  * @brief  Prints a help message with info about all of the supported commands.
@@ -108,7 +276,20 @@ static const command_table_t commands[] = {
 		{"Cbfifo_test", cbfifo_test, "cbfifo_test - Runs cbfifo tests"},
 		{"Systick_test", systick_test, "systick_test - Runs systick timer test"},
 		{"Sinewave_test", sinewave_test, "sinewave_test - Tests the sine wave generated"},
-		{"Display", display, "display - Prints current roll angle"},
+		{"Display", display, "display - Prints current roll angle and accelerometer FIFO counters"},
+		{"Stream", stream_stats, "stream - Prints audio stream underruns and missed refills"},
+		{"Health", health, "health [reset] - Prints or clears refill times, late refills and CPU load"},
+		{"Cache", cache_stats, "cache - Prints tone cache hits, misses and evictions"},
+		{"Rate", rate, "rate [hz] - Prints or switches the DAC output sample rate"},
+		{"Xfade", xfade, "xfade [samples] - Prints or sets the note crossfade and the worst gain step"},
+		{"Volume", volume, "volume [pct] [voice] - Prints or sets the master or a voice's volume"},
+		{"Dither", dither, "dither [on|off] - Prints or switches TPDF dither on the DAC output"},
+		{"Fx", fx, "fx [off|nofilter|lp <hz> [q]|hp <hz> [q]|echo <ms> [fb%] [mix%]] - Prints or sets the effects"},
+		{"Sample", sample, "sample [name|n [loop]|stop] - Plays an ADPCM clip from flash, or lists the clips"},
+		{"Bench", bench, "bench <name> - Runs an audio path cycle benchmark"},
+		{"Pcm", pcm, "pcm <hz> - Plays PCM streamed from the host over UART0"},
+		{"Midi", midi, "midi - Plays MIDI received on UART0 until a System Reset byte (0xFF)"},
+		{"Theremin", theremin, "theremin [scale] [ms] - Plays roll as pitch through a scale with glide until a key"},
 		{"Terminate", terminate, "terminate - Terminates command processor and gets fully into action"},
 		{"Help", help, "help - Print this help message"}
 };
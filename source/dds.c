@@ -0,0 +1,159 @@
+/*
+ * @file        dds.c
+ * @brief       Direct digital synthesis (DDS) oscillator function implementations
+ *
+ * A 32-bit phase accumulator and tuning word read a one-cycle table from the flash wavetable bank.
+ * Any pitch can be played with sub-cent accuracy without per-note sample buffers.
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       MCUXpresso IDE, gcc
+ * @references  Analog Devices MT-085 "Fundamentals of Direct Digital Synthesis"
+ */
+
+#include "dds.h"
+
+/*
+ * @name   dds_tuning_word
+ * @brief  Computes the phase increment for a frequency
+ *
+ * tuning_word = freq * 2^32 / sample_rate, rounded to nearest
+ *
+ * @param  uint32_t freq_q16 (frequency in Hz, Q16.16), uint32_t sample_rate (Hz)
+ * @return uint32_t tuning word
+ */
+uint32_t dds_tuning_word(uint32_t freq_q16, uint32_t sample_rate)
+{
+	//freq_q16 already carries 2^16, the other 2^16 is shifted in here
+	return (uint32_t)((((uint64_t)freq_q16 << 16) + (sample_rate >> 1)) / sample_rate);
+}
+
+/*
+ * @name   dds_frequency
+ * @brief  Computes the frequency actually produced by a tuning word
+ *
+ * freq = tuning_word * sample_rate / 2^32
+ *
+ * @param  uint32_t tuning_word, uint32_t sample_rate (Hz)
+ * @return uint32_t achieved frequency in Hz, Q16.16
+ */
+uint32_t dds_frequency(uint32_t tuning_word, uint32_t sample_rate)
+{
+	return (uint32_t)(((uint64_t)tuning_word * sample_rate) >> 16);
+}
+
+/*
+ * @name   dds_set_frequency
+ * @brief  Retunes an oscillator
+ *
+ * Only the tuning word changes, the phase carries on so the waveform stays continuous
+ *
+ * @param  dds_osc_t *osc, uint32_t freq_q16 (Hz, Q16.16), uint32_t sample_rate (Hz)
+ * @return void
+ */
+void dds_set_frequency(dds_osc_t *osc, uint32_t freq_q16, uint32_t sample_rate)
+{
+	osc->tuning_word = dds_tuning_word(freq_q16, sample_rate); //Single word write, safe against the refill ISR
+}
+
+/*
+ * @name   dds_sample
+ * @brief  Produces the next sample of an oscillator
+ *
+ * Linear interpolation between two table entries, then advances the phase
+ *
+ * @param  dds_osc_t *osc
+ * @return int16_t sample, Q15
+ */
+int16_t dds_sample(dds_osc_t *osc)
+{
+	uint32_t phase = osc->phase;
+	uint32_t index = phase >> DDS_INDEX_SHIFT;
+	int32_t frac = (phase >> DDS_FRAC_SHIFT) & DDS_FRAC_MASK;
+	int32_t a = osc->table[index];
+	int32_t b = osc->table[(index + 1) & DDS_TABLE_MASK];
+
+	osc->phase = phase + osc->tuning_word; //Wraps modulo 2^32, i.e. one cycle
+	return (int16_t)(a + (((b - a) * frac) >> 15));
+}
+
+/*
+ * @name   dds_render
+ * @brief  Fills a block of DAC samples from an oscillator
+ *
+ * Converts each Q15 sample to a 12-bit unsigned DAC code
+ *
+ * @param  dds_osc_t *osc, uint16_t *dac_buffer, uint32_t count (samples)
+ * @return void
+ */
+void dds_render(dds_osc_t *osc, uint16_t *dac_buffer, uint32_t count)
+{
+	while(count--)
+	{
+		*dac_buffer++ = (uint16_t)((dds_sample(osc) >> DDS_DAC_SHIFT) + DDS_DAC_MIDSCALE);
+	}
+}
+
+/*
+ * @name   dds_mix
+ * @brief  Adds a block of oscillator samples into a mix accumulator with a gain ramp
+ *
+ * Same interpolation as dds_sample(), with the phase, table and gain kept in registers for the whole block.
+ * The gain starts at level and moves by step every sample (both Q30, at most 1.0).
+ *
+ * @param  dds_osc_t *osc, int32_t *mix, uint32_t count (samples), int32_t level, int32_t step
+ * @return void
+ */
+void dds_mix(dds_osc_t *osc, int32_t *mix, uint32_t count, int32_t level, int32_t step)
+{
+	uint32_t phase = osc->phase;
+	uint32_t tuning_word = osc->tuning_word;
+	const int16_t *table = osc->table;
+
+	while(count--)
+	{
+		uint32_t index = phase >> DDS_INDEX_SHIFT;
+		int32_t frac = (phase >> DDS_FRAC_SHIFT) & DDS_FRAC_MASK;
+		int32_t a = table[index];
+		int32_t b = table[(index + 1) & DDS_TABLE_MASK];
+		int32_t s = a + (((b - a) * frac) >> 15);
+
+		*mix++ += (s * (level >> 15)) >> 15;
+		level += step;
+		phase += tuning_word;
+	}
+	osc->phase = phase;
+}
+
+/*
+ * @name   dds_mix_glide
+ * @brief  Adds a block of oscillator samples into a mix accumulator with a gain and a pitch ramp
+ *
+ * dds_mix() with one more add per sample: the tuning word moves by word_step after every sample
+ * and is left at its final value, so the next block carries on from it.
+ *
+ * @param  dds_osc_t *osc, int32_t *mix, uint32_t count (samples), int32_t level, int32_t step (Q30),
+ *         int32_t word_step
+ * @return void
+ */
+void dds_mix_glide(dds_osc_t *osc, int32_t *mix, uint32_t count, int32_t level, int32_t step, int32_t word_step)
+{
+	uint32_t phase = osc->phase;
+	uint32_t tuning_word = osc->tuning_word;
+	const int16_t *table = osc->table;
+
+	while(count--)
+	{
+		uint32_t index = phase >> DDS_INDEX_SHIFT;
+		int32_t frac = (phase >> DDS_FRAC_SHIFT) & DDS_FRAC_MASK;
+		int32_t a = table[index];
+		int32_t b = table[(index + 1) & DDS_TABLE_MASK];
+		int32_t s = a + (((b - a) * frac) >> 15);
+
+		*mix++ += (s * (level >> 15)) >> 15;
+		level += step;
+		phase += tuning_word;
+		tuning_word += word_step;
+	}
+	osc->phase = phase;
+	osc->tuning_word = tuning_word;
+}
@@ -0,0 +1,123 @@
+/*
+ * @file        dds.h
+ * @brief       Direct digital synthesis (DDS) oscillator function declarations
+ *
+ * A 32-bit phase accumulator and tuning word read a one-cycle table from the flash wavetable bank.
+ * Any pitch can be played with sub-cent accuracy without per-note sample buffers.
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       MCUXpresso IDE, gcc
+ * @references  Analog Devices MT-085 "Fundamentals of Direct Digital Synthesis"
+ */
+
+#ifndef DDS_H_
+#define DDS_H_
+
+#include <stdint.h>
+
+#ifndef DDS_TABLE_BITS
+#define DDS_TABLE_BITS    (8)                        //256 entry tables, must match wavetable_data.c
+#endif
+#define DDS_TABLE_SIZE    (1 << DDS_TABLE_BITS)
+#define DDS_TABLE_MASK    (DDS_TABLE_SIZE - 1)
+#define DDS_INDEX_SHIFT   (32 - DDS_TABLE_BITS)      //Table index is the top bits of the phase
+#define DDS_FRAC_SHIFT    (DDS_INDEX_SHIFT - 15)     //Next 15 bits interpolate between entries
+#define DDS_FRAC_MASK     (0x7FFF)
+
+#define DDS_DAC_SHIFT     (4)                        //Q15 sample to 12-bit DAC
+#define DDS_DAC_MIDSCALE  (2048)                     //DAC code for 0 V AC
+
+#define DDS_HZ(f)         ((uint32_t)(f) << 16)      //Integer Hz to Q16.16 Hz
+
+//Oscillator state: one full cycle of the waveform is 2^32 phase units
+typedef struct dds_osc
+{
+	uint32_t phase;        //Phase accumulator
+	uint32_t tuning_word;  //Phase increment per output sample
+	const int16_t *table;  //One cycle of the waveform, DDS_TABLE_SIZE samples in flash
+} dds_osc_t;
+
+//One-cycle sine table in flash, Q15, generated into wavetable_data.c
+extern const int16_t dds_sine_table[DDS_TABLE_SIZE];
+
+/*
+ * @name   dds_tuning_word
+ * @brief  Computes the phase increment for a frequency
+ *
+ * tuning_word = freq * 2^32 / sample_rate, rounded to nearest
+ *
+ * @param  uint32_t freq_q16 (frequency in Hz, Q16.16), uint32_t sample_rate (Hz)
+ * @return uint32_t tuning word
+ */
+uint32_t dds_tuning_word(uint32_t freq_q16, uint32_t sample_rate);
+
+/*
+ * @name   dds_frequency
+ * @brief  Computes the frequency actually produced by a tuning word
+ *
+ * freq = tuning_word * sample_rate / 2^32
+ *
+ * @param  uint32_t tuning_word, uint32_t sample_rate (Hz)
+ * @return uint32_t achieved frequency in Hz, Q16.16
+ */
+uint32_t dds_frequency(uint32_t tuning_word, uint32_t sample_rate);
+
+/*
+ * @name   dds_set_frequency
+ * @brief  Retunes an oscillator
+ *
+ * Only the tuning word changes, the phase carries on so the waveform stays continuous
+ *
+ * @param  dds_osc_t *osc, uint32_t freq_q16 (Hz, Q16.16), uint32_t sample_rate (Hz)
+ * @return void
+ */
+void dds_set_frequency(dds_osc_t *osc, uint32_t freq_q16, uint32_t sample_rate);
+
+/*
+ * @name   dds_sample
+ * @brief  Produces the next sample of an oscillator
+ *
+ * Linear interpolation between two table entries, then advances the phase
+ *
+ * @param  dds_osc_t *osc
+ * @return int16_t sample, Q15
+ */
+int16_t dds_sample(dds_osc_t *osc);
+
+/*
+ * @name   dds_render
+ * @brief  Fills a block of DAC samples from an oscillator
+ *
+ * Converts each Q15 sample to a 12-bit unsigned DAC code
+ *
+ * @param  dds_osc_t *osc, uint16_t *dac_buffer, uint32_t count (samples)
+ * @return void
+ */
+void dds_render(dds_osc_t *osc, uint16_t *dac_buffer, uint32_t count);
+
+/*
+ * @name   dds_mix
+ * @brief  Adds a block of oscillator samples into a mix accumulator with a gain ramp
+ *
+ * Used by the mixer: each voice adds its Q15 samples, scaled by a linear envelope ramp,
+ * into a 32-bit accumulator
+ *
+ * @param  dds_osc_t *osc, int32_t *mix, uint32_t count (samples), int32_t level, int32_t step (Q30)
+ * @return void
+ */
+void dds_mix(dds_osc_t *osc, int32_t *mix, uint32_t count, int32_t level, int32_t step);
+
+/*
+ * @name   dds_mix_glide
+ * @brief  Adds a block of oscillator samples into a mix accumulator with a gain and a pitch ramp
+ *
+ * As dds_mix(), with the tuning word moving by word_step every sample, for portamento that
+ * changes pitch at the sample rate rather than once per block
+ *
+ * @param  dds_osc_t *osc, int32_t *mix, uint32_t count (samples), int32_t level, int32_t step (Q30),
+ *         int32_t word_step (tuning word change per sample)
+ * @return void
+ */
+void dds_mix_glide(dds_osc_t *osc, int32_t *mix, uint32_t count, int32_t level, int32_t step, int32_t word_step);
+
+#endif /* DDS_H_ */
@@ -2,7 +2,9 @@
  * @file        dma.c
  * @brief       Function Implementation of audio output module
  *
- * Contains DMA initialization, Copy DMA to DAC BUffer, Start DMA Transfer and IRQ Handler functions
+ * Contains DMA initialization, audio stream start/stop and IRQ Handler functions
+ * DMA0 plays a small circular ring of samples split into two halves (ping-pong). The IRQ handler
+ * refills the half just played from the stream producer while DMA plays the other half.
  *
  * @author      Swathi Venkatachalam
  * @tools       MCUXpresso IDE
@@ -12,7 +14,8 @@
 
 #include <musical_tones.h>
 #include "dma.h"
-#include "systick.h"
+#include "dds.h"
+#include "sequencer.h"
 #include "MKL25Z4.h"
 
 #include <stdint.h>
@@ -22,10 +25,19 @@
 #define PRIORITY               (2)
 #define TPM0_OVERFLOW_TRIGG    (54) //Selecting TPM0 overflow as trigger for DMA
 #define BCR_COUNT              (2)  //To increase number of bytes stored in DMA0 BCR register
+#define AUDIO_RING_BYTES       (AUDIO_RING_SIZE * BCR_COUNT)
+#define AUDIO_RING_SMOD        (5)  //Source address modulo 256 bytes, DMA wraps SAR around the ring
+#define SMOD_BYTES_SHIFT       (3)  //SMOD n wraps the source address modulo 2^(n+3) bytes
 
-int tone_transition_req = ZERO; //Set after 1 second is elapsed
-uint16_t *Reload_DMA_Source; //Stores buffer's source address
-uint32_t Reload_DMA_Byte_Count = ZERO; //Stores total number of samples in buffer
+//Ring must be aligned to its size for the DMA source modulo to wrap correctly
+static uint16_t audio_ring[AUDIO_RING_SIZE] __attribute__((aligned(AUDIO_RING_BYTES)));
+static int audio_half = ZERO; //Half of the ring currently being played by DMA
+static int audio_running = ZERO;
+static audio_fill_t audio_fill; //Producer that renders samples into the ring
+audio_stream_stats_t audio_stream_stats; //Output health counters
+volatile uint32_t audio_sample_clock = ZERO; //Samples played, the note timing timebase
+uint32_t audio_half_size = AUDIO_HALF_SIZE; //Samples per refill; the ring is the first two halves
+uint32_t audio_start_cycles; //When TPM0 last started from zero
 
 /*
  * @name   init_DMA0
@@ -52,6 +64,7 @@ void init_DMA0()
 			DMA_DCR_SINC_MASK                    | // Source address increments after each transfer
 			DMA_DCR_SSIZE(DMA_SOURCE_SIZE)       | // Source data size (2 bytes)
 			DMA_DCR_DSIZE(DMA_DESTINATION_SIZE)  | // Destination data size (2 bytes)
+			DMA_DCR_SMOD(AUDIO_RING_SMOD)        | // Source wraps around the audio ring
 			DMA_DCR_ERQ_MASK                     | // Enable request for DMA
 			DMA_DCR_CS_MASK; // Circular transfer mode enabled
 
@@ -66,71 +79,192 @@ void init_DMA0()
 
 
 /*
- * @name   copy_dma_dacbuffer
- * @brief  Function copies from DMA Source to DAC Buffer
+ * @name   fill_half
+ * @brief  Function renders one half of the ring from the producer
  *
- * Copying from DMA Source to DAC Buffer
+ * A short fill is padded by holding the last sample, so an underrun is a flat line instead of a click
  *
- * @param  buffer *waveform_buffer
+ * @param  uint16_t *half
  * @return void
  */
-
-void copy_dma_dacbuffer(buffer *waveform_buffer)
+static void fill_half(uint16_t *half)
 {
-	uint32_t sample_count = waveform_buffer->sample_count; // Get the number of samples from the buffer
+	uint32_t produced = audio_fill(half, audio_half_size);
 
-	TPM0->SC &= ~TPM_SC_CMOD_MASK; //Stop TPM0 to prepare for DMA transfer
-	// Store the start address of the DAC buffer in the DMA source pointer
-	Reload_DMA_Source = &waveform_buffer->dac_buffer[ZERO]; //Store start address
-	Reload_DMA_Byte_Count = sample_count; //Store total number of samples
-	TPM0->SC |= TPM_SC_CMOD(ONE); //Start TPM0
+	if(produced < audio_half_size)
+	{
+		uint16_t hold = produced ? half[produced - ONE] : DDS_DAC_MIDSCALE;
+		while(produced < audio_half_size)
+			half[produced++] = hold;
+		audio_stream_stats.underruns++;
+	}
 }
 
 
 /*
- * @name   start_dma_transfer
- * @brief  Function initiates DAC0
+ * @name   audio_stream_start
+ * @brief  Function starts streaming the audio ring to DAC0
  *
- * Function for starting DMA0 to define source, destination address and byte counts
- * @param  void
- * @return void
+ * Renders both halves of the ring from the producer, then sets DMA0 source, destination address
+ * and byte count for the first half and starts TPM0. TPM0 starts from zero, since
+ * audio_stream_stop() leaves its count wherever it stopped, so the first sample reaches DAC0 a
+ * whole period after audio_start_cycles. If the ring is already streaming only the producer is
+ * swapped, which takes effect from the next refilled half.
  *
+ * @param  audio_fill_t fill
+ * @return void
  */
-void start_dma_transfer()
+void audio_stream_start(audio_fill_t fill)
 {
-	// Set the DMA source address register with the buffer's source address
-	DMA0->DMA[ZERO].SAR = DMA_SAR_SAR((uint32_t) Reload_DMA_Source);
+	audio_fill = fill; //Single word write, safe against the refill ISR
+	if(audio_running)
+		return;
+
+	fill_half(&audio_ring[ZERO]);
+	fill_half(&audio_ring[audio_half_size]);
+	audio_half = ZERO;
+
+	// Set the DMA source address register with the ring's start address
+	DMA0->DMA[ZERO].SAR = DMA_SAR_SAR((uint32_t) audio_ring);
 	// Set the DMA destination address register with the DAC data register address
 	DMA0->DMA[ZERO].DAR = DMA_DAR_DAR((uint32_t) (&(DAC0->DAT[ZERO])));
 
-	// Set the byte count for the DMA transfer; multiplying by BCR_COUNT for total bytes to transfer
-	DMA0->DMA[ZERO].DSR_BCR = DMA_DSR_BCR_BCR(Reload_DMA_Byte_Count * BCR_COUNT);
-
 	// Clear the DMA done flag to reset the status before starting a new transfer
-	DMA0->DMA[ZERO].DSR_BCR &= ~DMA_DSR_BCR_DONE_MASK;
+	DMA0->DMA[ZERO].DSR_BCR = DMA_DSR_BCR_DONE_MASK;
+	// One interrupt per half of the ring
+	DMA0->DMA[ZERO].DSR_BCR = DMA_DSR_BCR_BCR(audio_half_size * BCR_COUNT);
 
 	// Enable the DMA MUX channel to allow the transfer to start
 	DMAMUX0->CHCFG[ZERO] |= DMAMUX_CHCFG_ENBL_MASK;
+	audio_running = ONE;
+
+	TPM0->SC |= TPM_SC_TOF_MASK;  //Clear any stale overflow so it is not counted as an underrun
+	TPM0->CNT = ZERO;             //Any write clears the counter
+	audio_start_cycles = cycle_count();
+	TPM0->SC |= TPM_SC_CMOD(ONE); //Start TPM0
+}
+
+
+/*
+ * @name   audio_stream_stop
+ * @brief  Function stops streaming the audio ring to DAC0
+ *
+ * Stops TPM0 and disables the DMA0 request. DAC0 holds the last sample written.
+ *
+ * @param  void
+ * @return void
+ */
+void audio_stream_stop()
+{
+	TPM0->SC &= ~TPM_SC_CMOD_MASK; //Stop TPM0
+	DMAMUX0->CHCFG[ZERO] &= ~DMAMUX_CHCFG_ENBL_MASK;
+	DMA0->DMA[ZERO].DSR_BCR = DMA_DSR_BCR_DONE_MASK;
+	audio_running = ZERO;
+}
+
+
+/*
+ * @name   audio_stream_running
+ * @brief  Function checks whether the ring is streaming to DAC0
+ *
+ * @param  void
+ * @return int 1 while streaming, 0 when stopped
+ */
+int audio_stream_running()
+{
+	return audio_running;
+}
+
+
+/*
+ * @name   audio_set_sample_rate
+ * @brief  Function switches the DAC output sample rate, also while playing
+ *
+ * Retunes the synthesis and note timing with sequencer_set_sample_rate() and reprograms TPM0
+ * together, with interrupts masked so no refill sees one without the other. The ring still
+ * holds up to AUDIO_LATENCY samples rendered at the old rate; they play at the new one.
+ *
+ * @param  uint32_t rate (Hz, OUTPUT_RATE_MIN..OUTPUT_RATE_MAX and a divisor of CLOCK)
+ * @return int 1 when the rate was set, 0 when it is not supported
+ */
+int audio_set_sample_rate(uint32_t rate)
+{
+	if(rate < OUTPUT_RATE_MIN || rate > OUTPUT_RATE_MAX || (CLOCK % rate) != ZERO)
+		return ZERO;
+
+	__disable_irq();
+	sequencer_set_sample_rate(rate);
+	tpm0_set_sample_rate(rate);
+	__enable_irq();
+	return ONE;
+}
+
+
+/*
+ * @name   audio_set_half_size
+ * @brief  Function sets the samples refilled per DMA0 interrupt
+ *
+ * The ring is the first two halves of audio_ring, which is aligned for the largest, so a smaller
+ * source address modulo wraps it. A running stream is stopped and restarted on the same producer,
+ * which renders the new ring afresh.
+ *
+ * @param  uint32_t samples (rounded down to a power of two, AUDIO_HALF_MIN..AUDIO_HALF_SIZE)
+ * @return uint32_t samples in use
+ */
+uint32_t audio_set_half_size(uint32_t samples)
+{
+	uint32_t half = AUDIO_HALF_MIN, smod = ZERO;
+	int running = audio_running;
+
+	while(half < AUDIO_HALF_SIZE && half * 2 <= samples)
+		half *= 2;
+	if(half == audio_half_size)
+		return half;
+	while(((uint32_t)ONE << (smod + SMOD_BYTES_SHIFT)) < half * 2 * BCR_COUNT)
+		smod++;
+
+	if(running)
+		audio_stream_stop();
+	audio_half_size = half;
+	DMA0->DMA[ZERO].DCR = (DMA0->DMA[ZERO].DCR & ~DMA_DCR_SMOD_MASK) | DMA_DCR_SMOD(smod);
+	if(running)
+		audio_stream_start(audio_fill);
+	return half;
 }
 
 
 /*
  * @name   DMA0_IRQHandler
- * @brief  DMA0 interrupt handler and checks is 1 second has elapsed for waveform transition
+ * @brief  DMA0 interrupt handler, refills the half of the ring that was just played
  *
- * DMA0 interrupt handler called every time entire buffer is copied from source
+ * DMA0 interrupt handler called every time half of the ring is copied to DAC0.
+ * The source address has already moved on to the other half, so only the byte count is reloaded.
+ * Underruns, missed refill deadlines and the cycles spent here are counted in audio_stream_stats;
+ * health_refill() adds the refill times, late refills and the CPU load.
  *
  * @param  void
  * @return void
  */
 void DMA0_IRQHandler()
 {
-	// Clear the DMA done flag to acknowledge that the transfer is complete
-	DMA0->DMA[ZERO].DSR_BCR |= DMA_DSR_BCR_DONE_MASK;
-//
-//	//Check if 1 second has elapsed
-//	if(get_timer() >= ONE_SEC_ELAPSE)
-//		tone_transition_req = ONE;
-//	else
-		start_dma_transfer(); // Start the next DMA transfer to continue sending data to the DAC
+	uint32_t start = cycle_count();
+	uint16_t *played = &audio_ring[audio_half * audio_half_size];
+
+	// A TPM0 overflow still pending means a sample slot passed while DMA0 was idle
+	if(TPM0->SC & TPM_SC_TOF_MASK)
+		audio_stream_stats.underruns++;
+
+	// Clear the DMA done flag and restart on the other half straight away
+	DMA0->DMA[ZERO].DSR_BCR = DMA_DSR_BCR_DONE_MASK;
+	DMA0->DMA[ZERO].DSR_BCR = DMA_DSR_BCR_BCR(audio_half_size * BCR_COUNT);
+	audio_half ^= ONE;
+	audio_stream_stats.completions++;
+	audio_sample_clock += audio_half_size;
+
+	fill_half(played); // Refill while DMA plays the other half
+
+	// The other half already finished, so this refill was too late to be seamless
+	if(DMA0->DMA[ZERO].DSR_BCR & DMA_DSR_BCR_DONE_MASK)
+		audio_stream_stats.deadline_misses++;
+	health_refill(&audio_stream_stats, start, cycle_count());
 }
@@ -2,7 +2,7 @@
  * @file        dma.h
  * @brief       Function declaration of audio output module
  *
- * Contains DMA initialization, Copy DMA to DAC BUffer, Start DMA Transfer and IRQ Handler function declarations
+ * Contains DMA initialization, audio stream start/stop and IRQ Handler function declarations
  *
  * @author      Swathi Venkatachalam
  * @tools       MCUXpresso IDE
@@ -12,7 +12,33 @@
 #ifndef DMA_H_
 #define DMA_H_
 
-#include "tone_to_sample.h"
+#include <stdint.h>
+#include "health.h"
+
+#define AUDIO_HALF_SIZE  (64)                    //Samples refilled per DMA0 interrupt, the default and largest
+#define AUDIO_HALF_MIN   (4)                     //Smallest half, for low latency input
+#define AUDIO_RING_SIZE  (2 * AUDIO_HALF_SIZE)   //Samples in the DMA ring
+#define AUDIO_LATENCY    (2 * audio_half_size)   //Samples from rendering to the DAC
+
+/*
+ * Stream producer: renders up to count 12-bit DAC samples into dst, returns the number rendered.
+ * Called from DMA0_IRQHandler, so it must finish well within one half of the ring.
+ */
+typedef uint32_t (*audio_fill_t)(uint16_t *dst, uint32_t count);
+
+//Output health counters, audio_stream_stats_t in health.h, updated by DMA0_IRQHandler
+extern audio_stream_stats_t audio_stream_stats;
+
+//Samples played to DAC0 since the stream first started, counted from DMA0 completions.
+//The audio timebase: after each refill the producer has rendered exactly AUDIO_LATENCY samples more.
+extern volatile uint32_t audio_sample_clock;
+
+//Samples refilled per DMA0 interrupt, AUDIO_HALF_SIZE unless audio_set_half_size() changed it
+extern uint32_t audio_half_size;
+
+//cycle_count() as audio_stream_start() last started TPM0 from zero; the first sample reaches DAC0
+//exactly one TPM0 period later
+extern uint32_t audio_start_cycles;
 
 /*
  * @name   init_DMA0
@@ -27,33 +53,66 @@
 void init_DMA0();
 
 /*
- * @name   copy_dma_dacbuffer
- * @brief  Function copies from DMA Source to DAC Buffer
+ * @name   audio_stream_start
+ * @brief  Function starts streaming the audio ring to DAC0
  *
- * Copying from DMA Source to DAC Buffer
+ * Renders the ring from the producer and starts DMA0 and TPM0 from a cleared count, stamping
+ * audio_start_cycles. If the ring is already streaming only the producer is swapped, at the next half boundary.
  *
- * @param  buffer *waveform_buffer
+ * @param  audio_fill_t fill
  * @return void
  */
-
-void copy_dma_dacbuffer(buffer *out_buff);
+void audio_stream_start(audio_fill_t fill);
 
 /*
- * @name   start_dma_transfer
- * @brief  Function initiates DAC0
+ * @name   audio_stream_stop
+ * @brief  Function stops streaming the audio ring to DAC0
+ *
+ * Stops TPM0 and disables the DMA0 request
  *
- * Function for starting DMA0 to define source, destination address and byte counts
  * @param  void
  * @return void
+ */
+void audio_stream_stop();
+
+/*
+ * @name   audio_stream_running
+ * @brief  Function checks whether the ring is streaming to DAC0
+ *
+ * @param  void
+ * @return int 1 while streaming, 0 when stopped
+ */
+int audio_stream_running();
+
+/*
+ * @name   audio_set_sample_rate
+ * @brief  Function switches the DAC output sample rate, also while playing
+ *
+ * Retunes the synthesis and note timing with sequencer_set_sample_rate() and reprograms TPM0
+ * together, with interrupts masked so no refill sees one without the other
+ *
+ * @param  uint32_t rate (Hz, OUTPUT_RATE_MIN..OUTPUT_RATE_MAX and a divisor of CLOCK)
+ * @return int 1 when the rate was set, 0 when it is not supported
+ */
+int audio_set_sample_rate(uint32_t rate);
+
+/*
+ * @name   audio_set_half_size
+ * @brief  Function sets the samples refilled per DMA0 interrupt
+ *
+ * The ring shrinks with it, so a note reaches the DAC at most two halves after it starts.
+ * A running stream is stopped and restarted on the same producer.
  *
+ * @param  uint32_t samples (rounded down to a power of two, AUDIO_HALF_MIN..AUDIO_HALF_SIZE)
+ * @return uint32_t samples in use
  */
-void start_dma_transfer();
+uint32_t audio_set_half_size(uint32_t samples);
 
 /*
  * @name   DMA0_IRQHandler
- * @brief  DMA0 interrupt handler and checks is 1 second has elapsed for waveform transition
+ * @brief  DMA0 interrupt handler, refills the half of the ring that was just played
  *
- * DMA0 interrupt handler called every time entire buffer is copied from source
+ * DMA0 interrupt handler called every time half of the ring is copied to DAC0
  *
  * @param  void
  * @return void
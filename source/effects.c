@@ -0,0 +1,293 @@
+/*
+ * @file        effects.c
+ * @brief       Fixed-point effects chain function implementations
+ *
+ * The biquad is direct form I on 16-bit samples with Q14 coefficients: every product is one
+ * 16 by 16 bit multiply and only the sum is carried in 64 bits. It runs at half scale, which
+ * leaves a bit of headroom for a mix louder than full scale before the output stage clips it.
+ * The fraction the output drops is fed into the next sample, so truncation noise is pushed up
+ * out of the low notes and the filter decays to silence instead of sticking on a DC offset.
+ * Coefficients are computed in floating point when the settings change, never per sample.
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       MCUXpresso IDE, gcc
+ */
+
+#include <string.h>
+#include <math.h>
+#include "effects.h"
+#include "tpm.h"
+#include "tone_to_sample.h"
+
+#define COEFF_ONE     (1L << EFFECTS_COEFF_SHIFT)
+#define FRAC_MASK     (COEFF_ONE - 1)
+#define HEADROOM      (1)           //Bits the filter runs below Q15
+#define Q15_MAX       (32767)
+#define Q15_MIN       (-32768)
+#define QUIET         (16)          //One DAC step, Q15
+#define PERCENT       (100)
+#define MS_PER_SECOND (1000)
+#define TWO_PI        (6.2831853f)
+
+const char *const effects_filter_names[FILTER_COUNT] = { "off", "lp", "hp" };
+effects_stats_t effects_stats;
+
+static effects_settings_t settings = { FILTER_OFF, EFFECTS_CUTOFF_DEFAULT, EFFECTS_Q_DEFAULT, 0, 0, 0 };
+static uint32_t rate = OUTPUT_SAMPLE_RATE;  //Output sample rate the coefficients are for
+
+//Biquad, Q14: a1 and a2 negated so every term adds
+static int32_t b0, b1, b2, a1, a2;
+static int32_t in1, in2, out1, out2, error; //Half scale samples and the fraction carried
+
+//Echo
+static int16_t line[EFFECTS_DELAY_SIZE];
+static uint32_t length;                     //Delay, samples; 0 when the echo is off
+static uint32_t position;
+static uint32_t quiet;                      //Delay line writes in a row under a DAC step
+
+/*
+ * @name   saturate
+ * @brief  Clamps a sample to 16 bits
+ *
+ * @param  int32_t s, uint32_t *clips (counted when it clamps)
+ * @return int32_t
+ */
+static inline int32_t saturate(int32_t s, uint32_t *clips)
+{
+	if(s > Q15_MAX)
+	{
+		(*clips)++;
+		return Q15_MAX;
+	}
+	if(s < Q15_MIN)
+	{
+		(*clips)++;
+		return Q15_MIN;
+	}
+	return s;
+}
+
+/*
+ * @name   design_filter
+ * @brief  Computes the biquad coefficients for the settings and the sample rate
+ *
+ * Audio EQ Cookbook low-pass and high-pass, rounded to Q14. b0 is then taken from the rounded
+ * poles so the passband gain, at DC or at Nyquist, is exactly unity however low the cutoff.
+ *
+ * @param  void
+ * @return void
+ */
+static void design_filter()
+{
+	float w = TWO_PI * settings.cutoff_hz / rate;
+	float c = cosf(w);
+	float alpha = sinf(w) * PERCENT / (2.0f * settings.q);
+	float a0 = 1.0f + alpha;
+
+	a1 = (int32_t)lroundf(2.0f * c / a0 * COEFF_ONE);
+	a2 = (int32_t)lroundf(-(1.0f - alpha) / a0 * COEFF_ONE);
+	if(settings.filter == FILTER_HIGHPASS)
+	{
+		b0 = (COEFF_ONE + a1 - a2 + 2) >> 2;  //1 - a1 + a2 = 4 b0 with the cookbook signs
+		b1 = -2 * b0;
+	}
+	else
+	{
+		b0 = (COEFF_ONE - a1 - a2 + 2) >> 2;  //1 + a1 + a2 = 4 b0
+		b1 = 2 * b0;
+	}
+	b2 = b0;
+	in1 = in2 = out1 = out2 = error = 0;
+}
+
+/*
+ * @name   apply
+ * @brief  Clamps the settings to the sample rate and sets up the filter and the delay line
+ *
+ * @param  const effects_settings_t *next
+ * @return void
+ */
+static void apply(const effects_settings_t *next)
+{
+	uint32_t lowest = rate / EFFECTS_CUTOFF_DIV, highest = rate * EFFECTS_CUTOFF_MAX / PERCENT;
+	uint32_t delay, longest = effects_delay_max_ms();
+
+	settings.filter = (next->filter < FILTER_COUNT) ? next->filter : FILTER_OFF;
+	settings.cutoff_hz = (next->cutoff_hz < lowest) ? lowest : (next->cutoff_hz > highest) ? highest : next->cutoff_hz;
+	settings.q = (next->q < EFFECTS_Q_MIN) ? EFFECTS_Q_MIN : (next->q > EFFECTS_Q_MAX) ? EFFECTS_Q_MAX : next->q;
+	settings.echo_ms = (next->echo_ms > longest) ? longest : next->echo_ms;
+	settings.feedback = (next->feedback < 0) ? 0 : (next->feedback > EFFECTS_FEEDBACK_MAX) ? EFFECTS_FEEDBACK_MAX : next->feedback;
+	settings.wet = (next->wet < 0) ? 0 : (next->wet > EFFECTS_LEVEL_MAX) ? EFFECTS_LEVEL_MAX : next->wet;
+	if(settings.filter != FILTER_OFF)
+		design_filter();
+
+	delay = settings.echo_ms * rate / MS_PER_SECOND;
+	if(delay > EFFECTS_DELAY_SIZE)
+		delay = EFFECTS_DELAY_SIZE;
+	if(delay != length)
+	{
+		memset(line, 0, sizeof(line));
+		position = 0;
+		quiet = delay;
+		length = delay;
+	}
+}
+
+/*
+ * @name   effects_configure
+ * @brief  Sets the effects for the output sample rate
+ *
+ * Must not run concurrently with effects_process(). Clears the filter state, and the delay line
+ * when the echo delay changes.
+ *
+ * @param  const effects_settings_t *settings
+ * @return void
+ */
+void effects_configure(const effects_settings_t *next)
+{
+	rate = output_sample_rate;
+	apply(next);
+}
+
+/*
+ * @name   effects_current
+ * @brief  Settings in use, clamped to the output sample rate
+ *
+ * @param  void
+ * @return const effects_settings_t *
+ */
+const effects_settings_t *effects_current()
+{
+	return &settings;
+}
+
+/*
+ * @name   effects_set_sample_rate
+ * @brief  Recomputes the effects for a new output sample rate, keeping cutoff and delay time
+ *
+ * The delay shortens if the delay line cannot hold it at the new rate
+ *
+ * @param  uint32_t new_rate (Hz)
+ * @return void
+ */
+void effects_set_sample_rate(uint32_t new_rate)
+{
+	effects_settings_t keep = settings;
+
+	if(new_rate == 0 || new_rate == rate)
+		return;
+	rate = new_rate;
+	apply(&keep);
+}
+
+/*
+ * @name   effects_delay_max_ms
+ * @brief  Longest echo delay the delay line holds at the output sample rate
+ *
+ * @param  void
+ * @return uint32_t ms
+ */
+uint32_t effects_delay_max_ms()
+{
+	return (uint32_t)EFFECTS_DELAY_SIZE * MS_PER_SECOND / rate;
+}
+
+/*
+ * @name   effects_ringing
+ * @brief  Whether the echo is still sounding
+ *
+ * Nonzero until the delay line has held nothing above a DAC step for a whole delay
+ *
+ * @param  void
+ * @return int
+ */
+int effects_ringing()
+{
+	return length && quiet < length;
+}
+
+/*
+ * @name   filter_block
+ * @brief  Runs a block through the biquad
+ *
+ * @param  int32_t *mix, uint32_t count
+ * @return void
+ */
+static void filter_block(int32_t *mix, uint32_t count)
+{
+	int32_t s1 = in1, s2 = in2, t1 = out1, t2 = out2, carry = error;
+
+	while(count--)
+	{
+		int32_t x = saturate(*mix >> HEADROOM, &effects_stats.filter_clips);
+		int64_t acc = (int64_t)carry + b0 * x + b1 * s1 + b2 * s2 + a1 * t1 + a2 * t2;
+		int32_t y = (int32_t)(acc >> EFFECTS_COEFF_SHIFT);
+
+		carry = (int32_t)acc & FRAC_MASK;
+		y = saturate(y, &effects_stats.filter_clips);
+		*mix++ = y << HEADROOM;
+		s2 = s1;
+		s1 = x;
+		t2 = t1;
+		t1 = y;
+	}
+	in1 = s1;
+	in2 = s2;
+	out1 = t1;
+	out2 = t2;
+	error = carry;
+}
+
+/*
+ * @name   echo_block
+ * @brief  Runs a block through the feedback delay line
+ *
+ * Each sample adds the delay line's output at the wet level, and writes the input plus the
+ * feedback share of the delay line's output back in its place
+ *
+ * @param  int32_t *mix, uint32_t count
+ * @return void
+ */
+static void echo_block(int32_t *mix, uint32_t count)
+{
+	uint32_t at = position, still = quiet;
+	int32_t feedback = settings.feedback, wet = settings.wet;
+
+	while(count--)
+	{
+		int32_t d = line[at];
+		int32_t x = *mix;
+		int32_t v = saturate(x + ((d * feedback) >> 15), &effects_stats.echo_clips);
+
+		line[at] = (int16_t)v;
+		if(++at == length)
+			at = 0;
+		if(v > QUIET || v < -QUIET)
+			still = 0;
+		else if(still < length)
+			still++;
+		*mix++ = x + ((d * wet) >> 15);
+	}
+	position = at;
+	quiet = still;
+}
+
+/*
+ * @name   effects_process
+ * @brief  Runs a block of the mix through the filter and the echo, in place
+ *
+ * Returns straight away when both are off, so the mix is unchanged
+ *
+ * @param  int32_t *mix (Q15 scale, may exceed full scale), uint32_t count (samples)
+ * @return void
+ */
+void effects_process(int32_t *mix, uint32_t count)
+{
+	if(settings.filter == FILTER_OFF && length == 0)
+		return;
+	if(settings.filter != FILTER_OFF)
+		filter_block(mix, count);
+	if(length)
+		echo_block(mix, count);
+	effects_stats.blocks++;
+}
@@ -0,0 +1,125 @@
+/*
+ * @file        effects.h
+ * @brief       Fixed-point effects chain function declarations
+ *
+ * A biquad low-pass or high-pass filter followed by a feedback echo, applied in place to a block
+ * of the mix between synthesis and the output stage. Both run in integer math a block at a time,
+ * with their state held in locals across the block; the echo's delay line is a fixed circular
+ * buffer of EFFECTS_DELAY_SIZE samples, so the delay it reaches shrinks as the rate rises.
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       MCUXpresso IDE, gcc
+ */
+
+#ifndef EFFECTS_H_
+#define EFFECTS_H_
+
+#include <stdint.h>
+
+#ifndef EFFECTS_DELAY_SIZE
+#define EFFECTS_DELAY_SIZE   (2048)   //Delay line samples, 2 bytes each; override with -DEFFECTS_DELAY_SIZE=n
+#endif
+#define EFFECTS_COEFF_SHIFT  (14)     //Biquad coefficients are Q14, so |a1| up to 2 fits
+#define EFFECTS_CUTOFF_DEFAULT (1000)
+#define EFFECTS_CUTOFF_DIV   (100)    //Lowest cutoff is the output sample rate over this, where Q14 poles stay within 0.5 dB
+#define EFFECTS_CUTOFF_MAX   (45)     //Highest cutoff, percent of the output sample rate
+#define EFFECTS_Q_MIN        (50)     //Filter Q, hundredths
+#define EFFECTS_Q_DEFAULT    (71)     //Butterworth
+#define EFFECTS_Q_MAX        (400)
+#define EFFECTS_FEEDBACK_MAX (29491)  //0.9, Q15: every repeat quieter than the last
+#define EFFECTS_LEVEL_MAX    (32767)  //Unity, Q15
+
+typedef enum
+{
+	FILTER_OFF = 0,
+	FILTER_LOWPASS,
+	FILTER_HIGHPASS,
+	FILTER_COUNT
+} filter_t;
+
+//Effect parameters; effects_configure() clamps them to what the output sample rate allows
+typedef struct effects_settings
+{
+	uint8_t filter;      //filter_t
+	uint16_t cutoff_hz;  //-3 dB frequency at Q 0.71
+	uint16_t q;          //Resonance, hundredths
+	uint16_t echo_ms;    //Delay, 0 turns the echo off
+	int16_t feedback;    //Q15 of each repeat fed back into the delay line
+	int16_t wet;         //Q15 of the delay line added to the output, up to EFFECTS_LEVEL_MAX
+} effects_settings_t;
+
+//Counters, printed by the FX command
+typedef struct effects_stats
+{
+	uint32_t blocks;       //Blocks through an enabled effect
+	uint32_t filter_clips; //Filter outputs saturated, Q overshoot beyond twice full scale
+	uint32_t echo_clips;   //Delay line writes saturated, feedback piling up
+} effects_stats_t;
+
+extern effects_stats_t effects_stats;
+extern const char *const effects_filter_names[FILTER_COUNT];
+
+/*
+ * @name   effects_configure
+ * @brief  Sets the effects for the output sample rate
+ *
+ * Must not run concurrently with effects_process(). Clears the filter state, and the delay line
+ * when the echo delay changes.
+ *
+ * @param  const effects_settings_t *settings
+ * @return void
+ */
+void effects_configure(const effects_settings_t *settings);
+
+/*
+ * @name   effects_current
+ * @brief  Settings in use, clamped to the output sample rate
+ *
+ * @param  void
+ * @return const effects_settings_t *
+ */
+const effects_settings_t *effects_current();
+
+/*
+ * @name   effects_set_sample_rate
+ * @brief  Recomputes the effects for a new output sample rate, keeping cutoff and delay time
+ *
+ * Must not run concurrently with effects_process()
+ *
+ * @param  uint32_t rate (Hz)
+ * @return void
+ */
+void effects_set_sample_rate(uint32_t rate);
+
+/*
+ * @name   effects_delay_max_ms
+ * @brief  Longest echo delay the delay line holds at the output sample rate
+ *
+ * @param  void
+ * @return uint32_t ms
+ */
+uint32_t effects_delay_max_ms();
+
+/*
+ * @name   effects_ringing
+ * @brief  Whether the echo is still sounding
+ *
+ * Nonzero until the delay line has held nothing above a DAC step for a whole delay
+ *
+ * @param  void
+ * @return int
+ */
+int effects_ringing();
+
+/*
+ * @name   effects_process
+ * @brief  Runs a block of the mix through the filter and the echo, in place
+ *
+ * Returns straight away when both are off, so the mix is unchanged
+ *
+ * @param  int32_t *mix (Q15 scale, may exceed full scale), uint32_t count (samples)
+ * @return void
+ */
+void effects_process(int32_t *mix, uint32_t count);
+
+#endif /* EFFECTS_H_ */
@@ -0,0 +1,137 @@
+/*
+ * @file        envelope.c
+ * @brief       Fixed-point ADSR envelope generator function implementations
+ *
+ * Attack/decay/sustain/release amplitude envelope, advanced once per sample block in integer math.
+ * Each block returns a start level and a per-sample step, so the mixer applies a linear gain
+ * ramp with one multiply per sample and no soft-float.
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       MCUXpresso IDE, gcc
+ */
+
+#include "envelope.h"
+
+#define MS_PER_SECOND  (1000)
+
+/*
+ * @name   stage_step
+ * @brief  Per-sample step that sweeps full scale in a number of milliseconds
+ *
+ * @param  uint16_t ms, uint32_t sample_rate
+ * @return int32_t step, Q30 per sample
+ */
+static int32_t stage_step(uint16_t ms, uint32_t sample_rate)
+{
+	uint32_t samples = ((uint32_t)ms * sample_rate) / MS_PER_SECOND;
+
+	if(samples < ENV_MIN_SAMPLES)
+		samples = ENV_MIN_SAMPLES; //Keeps step * block within full scale and the edge click free
+	return ENV_ONE / (int32_t)samples;
+}
+
+/*
+ * @name   envelope_rates
+ * @brief  Converts envelope times to per-sample steps
+ *
+ * Stages shorter than ENV_MIN_SAMPLES are stretched to ENV_MIN_SAMPLES
+ *
+ * @param  adsr_rates_t *rates, const adsr_params_t *params, uint32_t sample_rate
+ * @return void
+ */
+void envelope_rates(adsr_rates_t *rates, const adsr_params_t *params, uint32_t sample_rate)
+{
+	rates->attack_step = stage_step(params->attack_ms, sample_rate);
+	rates->decay_step = stage_step(params->decay_ms, sample_rate);
+	rates->release_step = stage_step(params->release_ms, sample_rate);
+	rates->sustain_level = (params->sustain < 0) ? 0 : ((int32_t)params->sustain << ENV_LEVEL_SHIFT);
+}
+
+/*
+ * @name   envelope_trigger
+ * @brief  Starts the attack stage
+ *
+ * The attack starts from the current level, so a stolen voice does not jump to zero
+ *
+ * @param  envelope_t *env, const adsr_rates_t *rates
+ * @return void
+ */
+void envelope_trigger(envelope_t *env, const adsr_rates_t *rates)
+{
+	env->rates = *rates;
+	if(env->stage == ENV_IDLE)
+		env->level = 0;
+	env->stage = ENV_ATTACK;
+}
+
+/*
+ * @name   envelope_release
+ * @brief  Starts the release stage
+ *
+ * @param  envelope_t *env
+ * @return void
+ */
+void envelope_release(envelope_t *env)
+{
+	if(env->stage != ENV_IDLE)
+		env->stage = ENV_RELEASE;
+}
+
+/*
+ * @name   envelope_block
+ * @brief  Advances the envelope by one block of samples
+ *
+ * The level moves linearly towards the stage target. If the target is reached inside the block
+ * the step is shortened so the block ends exactly on it, and the next stage starts with the next
+ * block; that division is the only one and happens once per stage. The level stays within
+ * 0..ENV_ONE from any level a trigger or release starts at.
+ *
+ * @param  envelope_t *env, uint32_t count (at most ENV_MIN_SAMPLES), int32_t *step (Q30 per sample)
+ * @return int32_t level at the start of the block, Q30
+ */
+int32_t envelope_block(envelope_t *env, uint32_t count, int32_t *step)
+{
+	int32_t start = env->level;
+	int32_t target, rate, sweep;
+	uint8_t next;
+
+	switch(env->stage)
+	{
+	case ENV_ATTACK:
+		target = ENV_ONE;
+		rate = env->rates.attack_step;
+		next = ENV_DECAY;
+		break;
+	case ENV_DECAY:
+		target = env->rates.sustain_level;
+		rate = -env->rates.decay_step;
+		next = ENV_SUSTAIN;
+		break;
+	case ENV_RELEASE:
+		target = 0;
+		rate = -env->rates.release_step;
+		next = ENV_IDLE;
+		break;
+	case ENV_SUSTAIN:
+		*step = 0;
+		return start;
+	default:
+		*step = 0;
+		return 0;
+	}
+
+	//Compared against the distance left, since start + sweep can pass 2^31 from a retriggered full level
+	sweep = rate * (int32_t)count;
+	if((rate > 0) ? (sweep >= target - start) : (sweep <= target - start))
+	{
+		*step = (target - start) / (int32_t)count;
+		env->level = target;
+		env->stage = next;
+	}
+	else
+	{
+		*step = rate;
+		env->level = start + sweep;
+	}
+	return start;
+}
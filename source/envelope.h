@@ -0,0 +1,101 @@
+/*
+ * @file        envelope.h
+ * @brief       Fixed-point ADSR envelope generator function declarations
+ *
+ * Attack/decay/sustain/release amplitude envelope, advanced once per sample block in integer math.
+ * Each block returns a start level and a per-sample step, so the mixer applies a linear gain
+ * ramp with one multiply per sample and no soft-float.
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       MCUXpresso IDE, gcc
+ */
+
+#ifndef ENVELOPE_H_
+#define ENVELOPE_H_
+
+#include <stdint.h>
+
+#define ENV_ONE           ((int32_t)1 << 30)  //Full scale level, Q30
+#define ENV_LEVEL_SHIFT   (15)                //Q30 level to Q15 gain
+#define ENV_MIN_SAMPLES   (64)                //Shortest stage; also the longest block envelope_block() accepts
+#define ENV_Q15(x)        ((int16_t)((x) * 32767))
+
+typedef enum
+{
+	ENV_IDLE = 0,
+	ENV_ATTACK,
+	ENV_DECAY,
+	ENV_SUSTAIN,
+	ENV_RELEASE
+} env_stage_t;
+
+//Envelope shape, set per tune
+typedef struct adsr_params
+{
+	uint16_t attack_ms;   //0 to full scale
+	uint16_t decay_ms;    //Full scale to 0, the decay stops at the sustain level
+	int16_t sustain;      //Sustain level, Q15
+	uint16_t release_ms;  //Full scale to 0
+} adsr_params_t;
+
+//Per-sample steps precomputed from adsr_params_t for one sample rate
+typedef struct adsr_rates
+{
+	int32_t attack_step;
+	int32_t decay_step;
+	int32_t sustain_level;
+	int32_t release_step;
+} adsr_rates_t;
+
+//State of one voice's envelope
+typedef struct envelope
+{
+	int32_t level;       //Current level, Q30
+	adsr_rates_t rates;  //Copied at trigger so retuning a tune does not bend sounding notes
+	uint8_t stage;       //env_stage_t
+} envelope_t;
+
+/*
+ * @name   envelope_rates
+ * @brief  Converts envelope times to per-sample steps
+ *
+ * Stages shorter than ENV_MIN_SAMPLES are stretched to ENV_MIN_SAMPLES
+ *
+ * @param  adsr_rates_t *rates, const adsr_params_t *params, uint32_t sample_rate
+ * @return void
+ */
+void envelope_rates(adsr_rates_t *rates, const adsr_params_t *params, uint32_t sample_rate);
+
+/*
+ * @name   envelope_trigger
+ * @brief  Starts the attack stage
+ *
+ * The attack starts from the current level, so a stolen voice does not jump to zero
+ *
+ * @param  envelope_t *env, const adsr_rates_t *rates
+ * @return void
+ */
+void envelope_trigger(envelope_t *env, const adsr_rates_t *rates);
+
+/*
+ * @name   envelope_release
+ * @brief  Starts the release stage
+ *
+ * @param  envelope_t *env
+ * @return void
+ */
+void envelope_release(envelope_t *env);
+
+/*
+ * @name   envelope_block
+ * @brief  Advances the envelope by one block of samples
+ *
+ * Returns the level at the start of the block and the per-sample step to ramp by.
+ * At the end of the release the stage becomes ENV_IDLE.
+ *
+ * @param  envelope_t *env, uint32_t count (at most ENV_MIN_SAMPLES), int32_t *step (Q30 per sample)
+ * @return int32_t level at the start of the block, Q30
+ */
+int32_t envelope_block(envelope_t *env, uint32_t count, int32_t *step);
+
+#endif /* ENVELOPE_H_ */
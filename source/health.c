@@ -0,0 +1,199 @@
+/*
+ * @file        health.c
+ * @brief       Audio engine health counter implementations
+ *
+ * health_refill() runs at the end of every DMA0 refill, so it keeps to compares, adds and
+ * shifts. The load window is closed with two 32-bit divides once per
+ * HEALTH_WINDOW_CYCLES, about once every 60 refills at 48 kHz.
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       MCUXpresso IDE, gcc
+ */
+
+#include <string.h>
+#include "health.h"
+
+#define BYTE_BITS  (8)
+#define BYTE_MASK  (0xFF)
+
+/*
+ * @name   health_refill
+ * @brief  Records one refill, called at the end of the refill interrupt
+ *
+ * A refill is late when it takes over HEALTH_LATE_NUM / HEALTH_LATE_DEN of the time since the
+ * previous one started, the time the other half lasts; it still made its deadline, but with
+ * little to spare. The load is the refill cycles over the cycles the window lasted, so the
+ * first window after the stream was stopped reads low.
+ *
+ * @param  audio_stream_stats_t *stats, uint32_t start, uint32_t end (cycle counts, wrap safe)
+ * @return void
+ */
+void health_refill(audio_stream_stats_t *stats, uint32_t start, uint32_t end)
+{
+	uint32_t cycles = end - start;
+	uint32_t interval = start - stats->last_start;
+	uint32_t elapsed = end - stats->window_start;
+
+	stats->busy_cycles += cycles;
+	if(stats->refills == 0 || cycles < stats->refill_min)
+		stats->refill_min = cycles;
+	if(cycles > stats->refill_max)
+		stats->refill_max = cycles;
+	stats->refill_total += cycles;
+	stats->refills++;
+	if(cycles * HEALTH_LATE_DEN > interval * HEALTH_LATE_NUM)
+		stats->late_refills++;
+	stats->last_start = start;
+
+	stats->window_busy += cycles;
+	if(elapsed >= HEALTH_WINDOW_CYCLES)
+	{
+		uint32_t load = stats->window_busy / (elapsed / HEALTH_PERMILLE);
+
+		stats->load = (uint16_t)((load > HEALTH_PERMILLE) ? HEALTH_PERMILLE : load);
+		if(stats->load > stats->load_peak)
+			stats->load_peak = stats->load;
+		stats->window_start = end;
+		stats->window_busy = 0;
+	}
+}
+
+/*
+ * @name   health_reset
+ * @brief  Clears the counters
+ *
+ * @param  audio_stream_stats_t *stats, uint32_t now (cycle count, opens the load window)
+ * @return void
+ */
+void health_reset(audio_stream_stats_t *stats, uint32_t now)
+{
+	memset(stats, 0, sizeof(*stats));
+	stats->window_start = now;
+	stats->last_start = now;
+}
+
+/*
+ * @name   health_mean
+ * @brief  Mean refill, cycles
+ *
+ * @param  const audio_stream_stats_t *stats
+ * @return uint32_t cycles, 0 before the first refill
+ */
+uint32_t health_mean(const audio_stream_stats_t *stats)
+{
+	return stats->refills ? (uint32_t)(stats->refill_total / stats->refills) : 0;
+}
+
+/*
+ * @name   put
+ * @brief  Writes a little-endian field into the payload
+ *
+ * @param  uint8_t **p, uint32_t value, uint32_t bytes
+ * @return void
+ */
+static void put(uint8_t **p, uint32_t value, uint32_t bytes)
+{
+	while(bytes--)
+	{
+		*(*p)++ = (uint8_t)(value & BYTE_MASK);
+		value >>= BYTE_BITS;
+	}
+}
+
+/*
+ * @name   get
+ * @brief  Reads a little-endian field from the payload
+ *
+ * @param  const uint8_t **p, uint32_t bytes
+ * @return uint32_t value
+ */
+static uint32_t get(const uint8_t **p, uint32_t bytes)
+{
+	uint32_t value = 0;
+
+	for(uint32_t i = 0; i < bytes; i++)
+		value |= (uint32_t)*(*p)++ << (i * BYTE_BITS);
+	return value;
+}
+
+/*
+ * @name   saturate
+ * @brief  Limits refill cycles to the 16-bit frame field
+ *
+ * @param  uint32_t cycles
+ * @return uint32_t
+ */
+static uint32_t saturate(uint32_t cycles)
+{
+	return (cycles > HEALTH_CYCLES_MAX) ? HEALTH_CYCLES_MAX : cycles;
+}
+
+/*
+ * @name   checksum
+ * @brief  8-bit sum of the payload
+ *
+ * @param  const uint8_t *payload
+ * @return uint8_t
+ */
+static uint8_t checksum(const uint8_t *payload)
+{
+	uint8_t sum = 0;
+
+	for(int i = 0; i < HEALTH_PAYLOAD_BYTES; i++)
+		sum += payload[i];
+	return sum;
+}
+
+/*
+ * @name   health_pack
+ * @brief  Writes the counters as a binary frame
+ *
+ * @param  const audio_stream_stats_t *stats, uint8_t *frame (HEALTH_FRAME_BYTES)
+ * @return void
+ */
+void health_pack(const audio_stream_stats_t *stats, uint8_t *frame)
+{
+	uint8_t *p = frame + 2;
+
+	frame[0] = HEALTH_SYNC0;
+	frame[1] = HEALTH_SYNC1;
+	put(&p, stats->completions, 4);
+	put(&p, stats->underruns, 4);
+	put(&p, stats->deadline_misses, 4);
+	put(&p, stats->late_refills, 4);
+	put(&p, saturate(stats->refill_min), 2);
+	put(&p, saturate(health_mean(stats)), 2);
+	put(&p, saturate(stats->refill_max), 2);
+	put(&p, stats->load, 2);
+	put(&p, stats->load_peak, 2);
+	*p = checksum(frame + 2);
+}
+
+/*
+ * @name   health_unpack
+ * @brief  Reads the counters from a binary frame
+ *
+ * Fills the frame's counters; the mean goes into refill_total with refills set to 1
+ *
+ * @param  const uint8_t *frame (HEALTH_FRAME_BYTES), audio_stream_stats_t *stats (out)
+ * @return int 1 when the sync bytes and the checksum match
+ */
+int health_unpack(const uint8_t *frame, audio_stream_stats_t *stats)
+{
+	const uint8_t *p = frame + 2;
+
+	if(frame[0] != HEALTH_SYNC0 || frame[1] != HEALTH_SYNC1 || frame[HEALTH_FRAME_BYTES - 1] != checksum(p))
+		return 0;
+	memset(stats, 0, sizeof(*stats));
+	stats->completions = get(&p, 4);
+	stats->underruns = get(&p, 4);
+	stats->deadline_misses = get(&p, 4);
+	stats->late_refills = get(&p, 4);
+	stats->refill_min = get(&p, 2);
+	stats->refill_total = get(&p, 2);
+	stats->refills = 1;
+	stats->refill_max = get(&p, 2);
+	stats->load = (uint16_t)get(&p, 2);
+	stats->load_peak = (uint16_t)get(&p, 2);
+	return 1;
+}
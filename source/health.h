@@ -0,0 +1,105 @@
+/*
+ * @file        health.h
+ * @brief       Audio engine health counter declarations
+ *
+ * Counters of the DMA refill path: halves played, underruns, refills that missed or nearly
+ * missed their deadline, the shortest, mean and longest refill and the share of the CPU the
+ * refill interrupt takes. health_refill() is the only per-refill cost, a few compares and adds;
+ * the load is divided out once per HEALTH_WINDOW_CYCLES.
+ * The counters can also be read as a compact binary frame, answered to a single query byte:
+ *
+ * Frame: HEALTH_SYNC0 HEALTH_SYNC1 payload checksum
+ *  - payload  little-endian: completions, underruns, deadline_misses, late_refills (32 bits),
+ *             refill_min, mean, refill_max (cycles, 16 bits, saturated), load, load_peak (permille, 16 bits)
+ *  - checksum 8-bit sum of the payload
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       MCUXpresso IDE, gcc
+ */
+
+#ifndef HEALTH_H_
+#define HEALTH_H_
+
+#include <stdint.h>
+
+#define HEALTH_QUERY         (0x05)       //ENQ: received at the command line, answered with a frame
+#define HEALTH_SYNC0         (0xA5)
+#define HEALTH_SYNC1         (0x48)       //'H'
+#define HEALTH_PAYLOAD_BYTES (26)
+#define HEALTH_FRAME_BYTES   (HEALTH_PAYLOAD_BYTES + 3)
+#define HEALTH_WINDOW_CYCLES (1UL << 22)  //Load window, 87 ms at 48 MHz
+#define HEALTH_LATE_NUM      (3)          //A refill is late past 3/4 of the time between refills
+#define HEALTH_LATE_DEN      (4)
+#define HEALTH_PERMILLE      (1000)
+#define HEALTH_CYCLES_MAX    (0xFFFF)     //Refill cycles saturate here in the frame
+#define HEALTH_COST_MAX      (64)         //Budget of health_refill(), mean cycles: 1/1000 of a 64-sample half at 48 kHz
+
+//Output health counters, updated by DMA0_IRQHandler
+typedef struct audio_stream_stats
+{
+	uint32_t completions;      //Halves of the ring played
+	uint32_t underruns;        //DMA0 found idle at a sample request, or producer came up short
+	uint32_t deadline_misses;  //Refills that finished after the other half had already played
+	uint32_t busy_cycles;      //CPU cycles spent in DMA0_IRQHandler, for occupancy measurements
+	uint32_t late_refills;     //Refills that took over 3/4 of the time since the last, near misses
+	uint32_t refills;          //Refills timed since the last reset
+	uint32_t refill_min;       //Shortest refill, cycles
+	uint32_t refill_max;       //Longest refill, cycles
+	uint64_t refill_total;     //Cycles of the refills timed, for the mean
+	uint16_t load;             //Refill share of the CPU over the last window, permille
+	uint16_t load_peak;        //Highest window load since the last reset, permille
+	uint32_t window_start;     //Cycle count the load window opened at
+	uint32_t window_busy;      //Refill cycles in the window
+	uint32_t last_start;       //Cycle count the last refill started at
+} audio_stream_stats_t;
+
+/*
+ * @name   health_refill
+ * @brief  Records one refill, called at the end of the refill interrupt
+ *
+ * Closes the load window once HEALTH_WINDOW_CYCLES have passed since it opened
+ *
+ * @param  audio_stream_stats_t *stats, uint32_t start, uint32_t end (cycle counts, wrap safe)
+ * @return void
+ */
+void health_refill(audio_stream_stats_t *stats, uint32_t start, uint32_t end);
+
+/*
+ * @name   health_reset
+ * @brief  Clears the counters
+ *
+ * @param  audio_stream_stats_t *stats, uint32_t now (cycle count, opens the load window)
+ * @return void
+ */
+void health_reset(audio_stream_stats_t *stats, uint32_t now);
+
+/*
+ * @name   health_mean
+ * @brief  Mean refill, cycles
+ *
+ * @param  const audio_stream_stats_t *stats
+ * @return uint32_t cycles, 0 before the first refill
+ */
+uint32_t health_mean(const audio_stream_stats_t *stats);
+
+/*
+ * @name   health_pack
+ * @brief  Writes the counters as a binary frame
+ *
+ * @param  const audio_stream_stats_t *stats, uint8_t *frame (HEALTH_FRAME_BYTES)
+ * @return void
+ */
+void health_pack(const audio_stream_stats_t *stats, uint8_t *frame);
+
+/*
+ * @name   health_unpack
+ * @brief  Reads the counters from a binary frame
+ *
+ * Fills the frame's counters; the mean goes into refill_total with refills set to 1
+ *
+ * @param  const uint8_t *frame (HEALTH_FRAME_BYTES), audio_stream_stats_t *stats (out)
+ * @return int 1 when the sync bytes and the checksum match
+ */
+int health_unpack(const uint8_t *frame, audio_stream_stats_t *stats);
+
+#endif /* HEALTH_H_ */
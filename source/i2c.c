@@ -2,7 +2,12 @@
  * @file        i2c.c
  * @brief       Initialization of I2C functions for MMA accelerometer
  *
- * Initialization of LED function declarations
+ * Runs the I2C transaction engine on I2C0. Each address and data byte raises the I2C0 interrupt,
+ * which steps the engine; PIT channel 0 is armed one-shot for each transaction and ends it with
+ * a timeout, resetting the module, if the bus hangs. DMA channel 1, on the I2C0 request, moves
+ * the bytes of longer reads and its interrupt hands the last two back to the engine. The three
+ * interrupts share a priority below DMA0 and UART0, so they never preempt each other and never
+ * delay an audio refill. The cycles spent in them are counted for the I2C benchmark.
  *
  * @author      Swathi Venkatachalam
  * @tools       MCUXpresso IDE
@@ -11,218 +16,205 @@
  */
 
 #include <MKL25Z4.H>
+#include <musical_tones.h>
 #include "i2c.h"
+#include "systick.h"
+
+#define SCL_PIN        (24)     //PTE24, I2C0_SCL
+#define SDA_PIN        (25)     //PTE25, I2C0_SDA
+#define PORT_MUX_I2C   (5)
+#define I2C_ICR        (0x10)   //SCL divider 48
+#define PRIORITY       (3)
+#define PIT_CHANNEL    (0)
+#define BUS_CLOCK_DIV  (2)      //Bus clock, which clocks the PIT, is half the core clock
+#define US_PER_SECOND  (1000000)
+#define DMA_CHANNEL    (1)      //DMA0 channel 0 streams the audio
+#define DMAMUX_I2C0    (22)     //DMAMUX source, I2C0 transfer complete
+#define DMA_BYTE       (1)      //DCR SSIZE/DSIZE: 8-bit
+
+volatile uint32_t i2c_isr_cycles;
 
-#define I2C_M_START 	I2C0->C1 |= I2C_C1_MST_MASK
-#define I2C_M_STOP  	I2C0->C1 &= ~I2C_C1_MST_MASK
-#define I2C_M_RSTART 	I2C0->C1 |= I2C_C1_RSTA_MASK
-
-#define I2C_TRAN		I2C0->C1 |= I2C_C1_TX_MASK
-#define I2C_REC			I2C0->C1 &= ~I2C_C1_TX_MASK
-
-#define BUSY_ACK 	    while(I2C0->S & 0x01)
-#define TRANS_COMP		while(!(I2C0->S & 0x80))
-#define I2C_WAIT 		i2c_wait();
-
-#define NACK 	        I2C0->C1 |= I2C_C1_TXAK_MASK
-#define ACK             I2C0->C1 &= ~I2C_C1_TXAK_MASK
-
+/*
+ * @name   pit_timeout
+ * @brief  Arms PIT channel 0 to expire once after us microseconds, or stops it for 0
+ *
+ * @param  uint32_t us
+ * @return void
+ */
+static void pit_timeout(uint32_t us)
+{
+	PIT->CHANNEL[PIT_CHANNEL].TCTRL = ZERO;
+	PIT->CHANNEL[PIT_CHANNEL].TFLG = PIT_TFLG_TIF_MASK; //Write 1 to clear
+	if(us == ZERO)
+		return;
+	PIT->CHANNEL[PIT_CHANNEL].LDVAL = us * (SystemCoreClock / BUS_CLOCK_DIV / US_PER_SECOND) - ONE;
+	PIT->CHANNEL[PIT_CHANNEL].TCTRL = PIT_TCTRL_TIE_MASK | PIT_TCTRL_TEN_MASK;
+}
 
-int lock_detect=0;
-int i2c_lock=0;
+/*
+ * @name   dma_receive
+ * @brief  Arms DMA channel 1 to move count bytes from I2C0_D to dst, or stops it for 0
+ *
+ * Each I2C0 byte received requests one transfer; the request is disabled once the count is done
+ *
+ * @param  uint8_t *dst, uint32_t count
+ * @return void
+ */
+static void dma_receive(uint8_t *dst, uint32_t count)
+{
+	DMA0->DMA[DMA_CHANNEL].DCR = ZERO;
+	DMA0->DMA[DMA_CHANNEL].DSR_BCR = DMA_DSR_BCR_DONE_MASK; //Clears the channel
+	if(count == ZERO)
+		return;
+	DMA0->DMA[DMA_CHANNEL].SAR = DMA_SAR_SAR((uint32_t)&I2C0->D);
+	DMA0->DMA[DMA_CHANNEL].DAR = DMA_DAR_DAR((uint32_t)dst);
+	DMA0->DMA[DMA_CHANNEL].DSR_BCR = DMA_DSR_BCR_BCR(count);
+	DMA0->DMA[DMA_CHANNEL].DCR = DMA_DCR_EINT_MASK | // Interrupt when the count is done
+			DMA_DCR_ERQ_MASK                   | // I2C0 requests the transfers
+			DMA_DCR_CS_MASK                    | // One byte per request
+			DMA_DCR_DINC_MASK                  | // Destination increments, source stays at D
+			DMA_DCR_SSIZE(DMA_BYTE)            |
+			DMA_DCR_DSIZE(DMA_BYTE)            |
+			DMA_DCR_D_REQ_MASK;                  // Request disabled when the count is done
+}
 
 /*
  * @name   init_i2c0
  * @brief  Initializes I2C0
  *
- * Initializes RGB
+ * Initializes I2C0 on PTE24/PTE25, its interrupt, the PIT channel timing transactions out and
+ * the DMA channel receiving longer reads
  *
  * @param  none
  * @return void
  */
 void init_i2c()
 {
-	//clock i2c peripheral and port E
+	//clock i2c peripheral, port E, the PIT and the DMA
 	SIM->SCGC4 |= SIM_SCGC4_I2C0_MASK;
 	SIM->SCGC5 |= (SIM_SCGC5_PORTE_MASK);
+	SIM->SCGC6 |= SIM_SCGC6_PIT_MASK | SIM_SCGC6_DMAMUX_MASK;
+	SIM->SCGC7 |= SIM_SCGC7_DMA_MASK;
 
 	//set pins to I2C function
-	PORTE->PCR[24] |= PORT_PCR_MUX(5);
-	PORTE->PCR[25] |= PORT_PCR_MUX(5);
-
- 	I2C0->F = (I2C_F_ICR(0x10) | I2C_F_MULT(0));
+	PORTE->PCR[SCL_PIN] |= PORT_PCR_MUX(PORT_MUX_I2C);
+	PORTE->PCR[SDA_PIN] |= PORT_PCR_MUX(PORT_MUX_I2C);
 
-	//enable i2c and set to master mode
-	I2C0->C1 |= (I2C_C1_IICEN_MASK);
+	I2C0->F = (I2C_F_ICR(I2C_ICR) | I2C_F_MULT(ZERO));
 
 	// Select high drive mode
 	I2C0->C2 |= (I2C_C2_HDRS_MASK);
-}
-
 
-void i2c_busy()
-{
-	// Start Signal
-	lock_detect=0;
-	I2C0->C1 &= ~I2C_C1_IICEN_MASK;
-	I2C_TRAN;
-	I2C_M_START;
-	I2C0->C1 |=  I2C_C1_IICEN_MASK;
-	// Write to clear line
-	I2C0->C1 |= I2C_C1_MST_MASK; //set MASTER mode
-	I2C0->C1 |= I2C_C1_TX_MASK; //Set transmit (TX) mode
-	I2C0->D = 0xFF;
-	while ((I2C0->S & I2C_S_IICIF_MASK) == 0U) {
-	} //wait interrupt
-	I2C0->S |= I2C_S_IICIF_MASK; //clear interrupt bit
-
-	//Clear arbitration error flag
-	I2C0->S |= I2C_S_ARBL_MASK;
-
-	//Send start
-	I2C0->C1 &= ~I2C_C1_IICEN_MASK;
-	I2C0->C1 |= I2C_C1_TX_MASK; //Set transmit (TX) mode
-	I2C0->C1 |= I2C_C1_MST_MASK; //START signal generated
-
-	I2C0->C1 |= I2C_C1_IICEN_MASK;
-	//Wait until start is send
-
-	//Send stop
-	I2C0->C1 &= ~I2C_C1_IICEN_MASK;
-	I2C0->C1 |= I2C_C1_MST_MASK;
-	I2C0->C1 &= ~I2C_C1_MST_MASK; //set SLAVE mode
-	I2C0->C1 &= ~I2C_C1_TX_MASK; //Set Rx
-	I2C0->C1 |= I2C_C1_IICEN_MASK;
-
-	// wait
-	//Clear arbitration error & interrupt flag
-	I2C0->S |= I2C_S_IICIF_MASK;
-	I2C0->S |= I2C_S_ARBL_MASK;
-	lock_detect=0;
-	i2c_lock=1;
+	//PIT enabled, frozen while the debugger halts the core
+	PIT->MCR = PIT_MCR_FRZ_MASK;
+	pit_timeout(ZERO);
+
+	//DMA channel 1 on the I2C0 request, armed per read
+	dma_receive(NULL, ZERO);
+	DMAMUX0->CHCFG[DMA_CHANNEL] = DMAMUX_CHCFG_ENBL_MASK | DMAMUX_CHCFG_SOURCE(DMAMUX_I2C0);
+
+	//enable i2c with its interrupt, idle until the first transaction
+	i2c_engine_init((i2c_regs_t *)I2C0, pit_timeout);
+	i2c_engine_set_dma(dma_receive);
+
+	NVIC_SetPriority(I2C0_IRQn, PRIORITY);
+	NVIC_ClearPendingIRQ(I2C0_IRQn);
+	NVIC_EnableIRQ(I2C0_IRQn);
+	NVIC_SetPriority(PIT_IRQn, PRIORITY);
+	NVIC_ClearPendingIRQ(PIT_IRQn);
+	NVIC_EnableIRQ(PIT_IRQn);
+	NVIC_SetPriority(DMA1_IRQn, PRIORITY);
+	NVIC_ClearPendingIRQ(DMA1_IRQn);
+	NVIC_EnableIRQ(DMA1_IRQn);
 }
 
-void i2c_wait()
+/*
+ * @name   i2c_use_dma
+ * @brief  Selects DMA or the interrupt for the bytes of longer reads
+ *
+ * Waits for the bus to be idle first
+ *
+ * @param  int on
+ * @return void
+ */
+void i2c_use_dma(int on)
 {
-	lock_detect = 0;
-	while(((I2C0->S & I2C_S_IICIF_MASK)==0) & (lock_detect < 200))
+	for(;;)
 	{
-		lock_detect++;
+		__disable_irq(); //An interrupt may queue a transaction between the check and the switch
+		if(i2c_idle())
+			break;
+		__enable_irq();
 	}
-	if (lock_detect >= 200)
-		i2c_busy();
-	I2C0->S |= I2C_S_IICIF_MASK;
+	i2c_engine_set_dma(on ? dma_receive : NULL);
+	__enable_irq();
 }
 
 /*
- * @name   i2c_start
- * @brief  Send start sequence
+ * @name   i2c_queue
+ * @brief  Queues a transaction without waiting for it
  *
- * Send start sequence
+ * Interrupts are masked around the queue, which the I2C0 and PIT handlers also change
  *
- * @param  none
- * @return void
+ * @param  i2c_xfer_t *xfer
+ * @return int 1 when queued, 0 when it is still queued from before or moves no bytes
  */
-void i2c_start()
+int i2c_queue(i2c_xfer_t *xfer)
 {
-	I2C_TRAN;	 //set to transmit mode
-	I2C_M_START; //send start
+	int queued;
+
+	__disable_irq();
+	queued = i2c_engine_submit(xfer);
+	__enable_irq();
+	return queued;
 }
 
 /*
- * @name   i2c_read_setup
- * @brief  Send device and register address
+ * @name   i2c_transfer
+ * @brief  Queues a transaction and waits for it
  *
- * Send device and register address
+ * The PIT timeout bounds the wait
  *
- * @param  uint8_t dev, uint8_t address
- * @return void
+ * @param  i2c_xfer_t *xfer
+ * @return i2c_status_t
  */
-void i2c_read_setup(uint8_t dev, uint8_t address)
+i2c_status_t i2c_transfer(i2c_xfer_t *xfer)
 {
-	I2C0->D = dev;	    //send dev address
-	I2C_WAIT		    //wait for completion
-
-	I2C0->D =  address;	//send read address
-	I2C_WAIT			//wait for completion
-
-	I2C_M_RSTART;	    //repeated start
-	I2C0->D = (dev|0x1);//send dev address (read)
-	I2C_WAIT            //wait for completion
-
-	I2C_REC;		    //set to receive mode
+	while(xfer->status == I2C_PENDING);
+	if(!i2c_queue(xfer))
+		return (i2c_status_t)xfer->status;
+	while(xfer->status == I2C_PENDING);
+	return (i2c_status_t)xfer->status;
 }
 
 /*
- * @name   i2c_repeated_read
- * @brief  Read a byte and ack/ nack as appropriate
- *
- * Initializes RGB
+ * @name   i2c_idle
+ * @brief  Checks that no transaction is on the bus or queued
  *
- * @param  uint8_t isLastRead
- * @return void
+ * @param  void
+ * @return int 1 when idle
  */
-uint8_t i2c_repeated_read(uint8_t isLastRead)
+int i2c_idle()
 {
-	uint8_t data;
-
-	lock_detect = 0;
-
-	if(isLastRead)
-	{
-		NACK;	         //set NACK after read
-	}
-	else
-	{
-		ACK;	        //ACK after read
-	}
-
-	data = I2C0->D;	    //dummy read
-	I2C_WAIT		    //wait for completion
-
-	if(isLastRead)
-	{
-		I2C_M_STOP;		//send stop
-	}
-	data = I2C0->D;		//read data
-
-	return  data;
+	return !i2c_engine_busy();
 }
 
 /*
  * @name   i2c_read_byte
  * @brief  Reads a byte data to dev address
  *
- * Reads a byte data to dev address using 7 but addressing
+ * Reads a register of the device with a write-then-read transaction, and waits for it
  *
  * @param  uint8_t dev, uint8_t address
- * @return void
+ * @return uint8_t data, 0 when the transaction failed
  */
 uint8_t i2c_read_byte(uint8_t dev, uint8_t address)
 {
-	uint8_t data;
-
-	I2C_TRAN;				//set to transmit mode
-	I2C_M_START;			//send start
-	I2C0->D = dev;			//send dev address
-	I2C_WAIT				//wait for completion
-
-	I2C0->D =  address;		//send read address
-	I2C_WAIT				//wait for completion
-
-	I2C_M_RSTART;			//repeated start
-	I2C0->D = (dev|0x1);	//send dev address (read)
-	I2C_WAIT				//wait for completion
-
-	I2C_REC;				//set to recieve mode
-	NACK;					//set NACK after read
-
-	data = I2C0->D;			//dummy read
-	I2C_WAIT				//wait for completio
-
-	I2C_M_STOP;				//send stop
-	data = I2C0->D;			//read data
+	uint8_t data = ZERO;
+	i2c_xfer_t xfer = { .dev = dev, .tx = &address, .tx_len = ONE, .rx = &data, .rx_len = ONE };
 
+	if(i2c_transfer(&xfer) != I2C_DONE)
+		return ZERO;
 	return data;
 }
 
@@ -230,23 +222,71 @@ uint8_t i2c_read_byte(uint8_t dev, uint8_t address)
  * @name   i2c_write_byte
  * @brief  Writes a byte data to dev address
  *
- * Writes a byte data to dev address using 7 but addressing
+ * Writes a register of the device, and waits for the transaction
  *
  * @param  uint8_t dev, uint8_t address, uint8_t data
  * @return void
  */
 void i2c_write_byte(uint8_t dev, uint8_t address, uint8_t data)
 {
+	uint8_t bytes[] = { address, data };
+	i2c_xfer_t xfer = { .dev = dev, .tx = bytes, .tx_len = sizeof(bytes) };
+
+	(void)i2c_transfer(&xfer);
+}
+
+/*
+ * @name   I2C0_IRQHandler
+ * @brief  I2C0 interrupt handler, an address or data byte has been sent or received
+ *
+ * @param  void
+ * @return void
+ */
+void I2C0_IRQHandler()
+{
+	uint32_t start = cycle_count();
+
+	i2c_engine_irq();
+	i2c_isr_cycles += cycle_count() - start;
+}
+
+/*
+ * @name   PIT_IRQHandler
+ * @brief  PIT interrupt handler, the transaction on the bus timed out
+ *
+ * A timeout stopped by the transaction ending while this interrupt was pending is ignored
+ *
+ * @param  void
+ * @return void
+ */
+void PIT_IRQHandler()
+{
+	uint32_t start = cycle_count();
 
-	I2C_TRAN;			//set to transmit mode
-	I2C_M_START;		//send start
-	I2C0->D = dev;		//send dev address
-	I2C_WAIT			//wait for ack
+	if(PIT->CHANNEL[PIT_CHANNEL].TFLG & PIT_TFLG_TIF_MASK)
+	{
+		pit_timeout(ZERO);
+		i2c_engine_timeout();
+	}
+	i2c_isr_cycles += cycle_count() - start;
+}
 
-	I2C0->D =  address;	//send write address
-	I2C_WAIT
+/*
+ * @name   DMA1_IRQHandler
+ * @brief  DMA channel 1 interrupt handler, the bytes of a read have been moved
+ *
+ * Hands the read back to the engine. The second to last byte may already be in with its IICIF
+ * flag cleared by the engine, so the I2C0 interrupt is then raised here.
+ *
+ * @param  void
+ * @return void
+ */
+void DMA1_IRQHandler()
+{
+	uint32_t start = cycle_count();
 
-	I2C0->D = data;		//send data
-	I2C_WAIT
-	I2C_M_STOP;
+	DMA0->DMA[DMA_CHANNEL].DSR_BCR = DMA_DSR_BCR_DONE_MASK; //Write 1 to clear
+	if(i2c_engine_dma_done())
+		NVIC_SetPendingIRQ(I2C0_IRQn);
+	i2c_isr_cycles += cycle_count() - start;
 }
@@ -2,7 +2,10 @@
  * @file        i2c.h
  * @brief       Initialization of I2C functions for MMA accelerometer
  *
- * Initialization of LED function declarations
+ * I2C0 runs the transaction engine of i2c_engine.h from its interrupt; the PIT times each
+ * transaction out and DMA channel 1 receives the bytes of longer reads. i2c_queue() returns at
+ * once and the transaction's callback runs when it ends; i2c_transfer(), i2c_read_byte() and
+ * i2c_write_byte() wait for it.
  *
  * @author      Swathi Venkatachalam
  * @tools       MCUXpresso IDE
@@ -14,12 +17,16 @@
 #define I2C_H_
 
 #include <stdint.h>
+#include "i2c_engine.h"
+
+extern volatile uint32_t i2c_isr_cycles; //Core cycles spent in the I2C0, PIT and DMA1 interrupts
 
 /*
  * @name   init_i2c
  * @brief  Initializes I2C
  *
- * Initializes RGB
+ * Initializes I2C0 on PTE24/PTE25, its interrupt, the PIT channel timing transactions out and
+ * the DMA channel receiving longer reads, which is in use from the start
  *
  * @param  none
  * @return void
@@ -27,46 +34,56 @@
 void init_i2c();
 
 /*
- * @name   i2c_start
- * @brief  Send start sequence
+ * @name   i2c_use_dma
+ * @brief  Selects DMA or the interrupt for the bytes of longer reads
  *
- * Send start sequence
+ * Waits for the bus to be idle first
  *
- * @param  none
+ * @param  int on
  * @return void
  */
-void i2c_start();
+void i2c_use_dma(int on);
 
 /*
- * @name   i2c_read_setup
- * @brief  Send device and register address
+ * @name   i2c_queue
+ * @brief  Queues a transaction without waiting for it
  *
- * Send device and register address
+ * The callback runs in the I2C0 or PIT interrupt once the status is final. The transaction and
+ * its buffers must stay valid until then.
  *
- * @param  uint8_t dev, uint8_t address
- * @return void
+ * @param  i2c_xfer_t *xfer
+ * @return int 1 when queued, 0 when it is still queued from before or moves no bytes
  */
-void i2c_read_setup(uint8_t dev, uint8_t address);
+int i2c_queue(i2c_xfer_t *xfer);
 
 /*
- * @name   i2c_repeated_read
- * @brief  Read a byte and ack/ nack as appropriate
+ * @name   i2c_transfer
+ * @brief  Queues a transaction and waits for it
  *
- * Initializes RGB
+ * Not for use in interrupts at or above the I2C0 priority, which would never let it finish
  *
- * @param  uint8_t isLastRead
- * @return void
+ * @param  i2c_xfer_t *xfer
+ * @return i2c_status_t
  */
-uint8_t i2c_repeated_read(uint8_t);
+i2c_status_t i2c_transfer(i2c_xfer_t *xfer);
+
+/*
+ * @name   i2c_idle
+ * @brief  Checks that no transaction is on the bus or queued
+ *
+ * @param  void
+ * @return int 1 when idle
+ */
+int i2c_idle();
 
 /*
  * @name   i2c_read_byte
  * @brief  Reads a byte data to dev address
  *
- * Reads a byte data to dev address using 7 but addressing
+ * Reads a register of the device with a write-then-read transaction, and waits for it
  *
  * @param  uint8_t dev, uint8_t address
- * @return void
+ * @return uint8_t data, 0 when the transaction failed
  */
 uint8_t i2c_read_byte(uint8_t dev, uint8_t address);
 
@@ -74,7 +91,7 @@ uint8_t i2c_read_byte(uint8_t dev, uint8_t address);
  * @name   i2c_write_byte
  * @brief  Writes a byte data to dev address
  *
- * Writes a byte data to dev address using 7 but addressing
+ * Writes a register of the device, and waits for the transaction
  *
  * @param  uint8_t dev, uint8_t address, uint8_t data
  * @return void
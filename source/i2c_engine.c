@@ -0,0 +1,363 @@
+/*
+ * @file        i2c_engine.c
+ * @brief       Interrupt driven I2C master transaction engine implementations
+ *
+ * The module interrupts once each address or data byte has been clocked out or in. The handler
+ * writes the next byte, issues the repeated START or reads the byte received; reading D in
+ * receive mode clocks in the next byte, so the acknowledge of the last byte is set to NACK one
+ * byte ahead and STOP is issued before the last byte is read. The module also interrupts when it
+ * detects a STOP on the bus, and the next queued transaction starts from there: a START set while
+ * the STOP is still going out would lose arbitration. The queue is a linked list through the
+ * transactions themselves, so the engine allocates nothing.
+ * A DMA read turns the interrupt off and the module's DMA request on after the read address, so
+ * every byte received is moved by DMA and its read of D clocks in the next one. It stops two bytes
+ * short: the interrupt reads the second to last byte with TXAK set, as a read without DMA does,
+ * so the NACK of the last byte does not race the DMA.
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       MCUXpresso IDE, gcc
+ * @references  KL25 Sub-Family Reference Manual, chapter 38 (I2C)
+ *              https://github.com/alexander-g-dean/ESF/blob/master/NXP/Code/Chapter_8/I2C-Demo/src/i2c.c
+ */
+
+#include <stddef.h>
+#include "i2c_engine.h"
+
+//I2C register bits
+#define C1_IICEN   (0x80)
+#define C1_IICIE   (0x40)
+#define C1_MST     (0x20)  //Setting it sends START, clearing it STOP
+#define C1_TX      (0x10)
+#define C1_TXAK    (0x08)  //NACK the next byte received
+#define C1_RSTA    (0x04)  //Repeated START
+#define C1_DMAEN   (0x01)  //DMA request on each byte instead of the interrupt
+#define S_TCF      (0x80)  //A byte is complete and D not read yet
+#define S_ARBL     (0x10)  //Write 1 to clear
+#define S_IICIF    (0x02)  //Write 1 to clear
+#define S_RXAK     (0x01)  //The last byte sent was not acknowledged
+#define FLT_STOPF  (0x40)  //STOP detected, write 1 to clear
+#define FLT_STOPIE (0x20)  //Interrupt on STOP detected
+
+typedef enum
+{
+	STATE_IDLE = 0, //Bus free, queue empty
+	STATE_TX,       //The address for a write or a tx byte went out
+	STATE_ADDR_R,   //The address for a read went out
+	STATE_RX,       //A byte came in
+	STATE_DMA,      //Bytes coming in by DMA
+	STATE_STOP      //Waiting for the STOP on the bus to start the next transaction
+} state_t;
+
+i2c_stats_t i2c_stats;
+static i2c_regs_t *i2c;
+static i2c_timer_t timer;
+static i2c_dma_t dma;
+static i2c_xfer_t *head;   //On the bus
+static i2c_xfer_t *tail;
+static uint8_t state;
+static uint8_t position;   //Next byte of tx or rx
+
+/*
+ * @name   i2c_engine_init
+ * @brief  Enables the module in master-ready state with its interrupt, with an empty queue
+ *
+ * @param  i2c_regs_t *regs, i2c_timer_t timeout_timer
+ * @return void
+ */
+void i2c_engine_init(i2c_regs_t *regs, i2c_timer_t timeout_timer)
+{
+	i2c = regs;
+	timer = timeout_timer;
+	head = NULL;
+	tail = NULL;
+	state = STATE_IDLE;
+	i2c->C1 = C1_IICEN | C1_IICIE;
+	i2c->FLT = FLT_STOPIE | FLT_STOPF;
+	i2c->S = S_IICIF | S_ARBL;
+}
+
+/*
+ * @name   i2c_engine_set_dma
+ * @brief  Sets the receive DMA, or NULL to read every byte in the interrupt
+ *
+ * @param  i2c_dma_t receive_dma
+ * @return void
+ */
+void i2c_engine_set_dma(i2c_dma_t receive_dma)
+{
+	dma = receive_dma;
+}
+
+/*
+ * @name   i2c_engine_timeout_us
+ * @brief  Timeout armed for a transaction
+ *
+ * @param  const i2c_xfer_t *xfer
+ * @return uint32_t microseconds
+ */
+uint32_t i2c_engine_timeout_us(const i2c_xfer_t *xfer)
+{
+	uint32_t bytes = 1 + xfer->tx_len + xfer->rx_len + ((xfer->tx_len && xfer->rx_len) ? 1 : 0);
+
+	return I2C_TIMEOUT_US + bytes * I2C_BYTE_TIMEOUT_US;
+}
+
+/*
+ * @name   start
+ * @brief  Puts a transaction on the bus: START and the device address
+ *
+ * @param  i2c_xfer_t *xfer
+ * @return void
+ */
+static void start(i2c_xfer_t *xfer)
+{
+	timer(i2c_engine_timeout_us(xfer));
+	position = 0;
+	state = xfer->tx_len ? STATE_TX : STATE_ADDR_R;
+	i2c->C1 = (i2c->C1 & ~C1_TXAK) | C1_TX;
+	i2c->C1 |= C1_MST;
+	i2c->D = xfer->tx_len ? xfer->dev : (xfer->dev | I2C_READ_BIT);
+}
+
+/*
+ * @name   stop
+ * @brief  Sends STOP and leaves the module in slave receive mode
+ *
+ * @param  void
+ * @return void
+ */
+static void stop()
+{
+	i2c->C1 &= ~(C1_MST | C1_TX | C1_TXAK);
+}
+
+/*
+ * @name   finish
+ * @brief  Ends the transaction on the bus and calls the callback
+ *
+ * The next transaction, also one queued by the callback, waits for the STOP interrupt; its
+ * timeout already runs, so it cannot wait for a STOP that never comes
+ *
+ * @param  i2c_status_t status
+ * @return void
+ */
+static void finish(i2c_status_t status)
+{
+	i2c_xfer_t *xfer = head;
+
+	head = xfer->next;
+	if(head == NULL)
+		tail = NULL;
+	xfer->next = NULL;
+	xfer->status = status;
+	switch(status)
+	{
+	case I2C_DONE:     i2c_stats.transfers++; break;
+	case I2C_NACK:     i2c_stats.nacks++; break;
+	case I2C_ARB_LOST: i2c_stats.arbitration_lost++; break;
+	default:           i2c_stats.timeouts++; break;
+	}
+
+	state = STATE_STOP;
+	timer(head ? i2c_engine_timeout_us(head) : 0);
+	if(xfer->done)
+		xfer->done(xfer);
+}
+
+/*
+ * @name   i2c_engine_submit
+ * @brief  Queues a transaction, starting it if the bus is idle
+ *
+ * Call with the I2C and timer interrupts masked, or from their handlers (a callback may queue
+ * the next transaction).
+ *
+ * @param  i2c_xfer_t *xfer
+ * @return int 1 when queued, 0 when it is already queued or moves no bytes
+ */
+int i2c_engine_submit(i2c_xfer_t *xfer)
+{
+	if(xfer->status == I2C_PENDING || (xfer->tx_len == 0 && xfer->rx_len == 0))
+		return 0;
+
+	xfer->status = I2C_PENDING;
+	xfer->next = NULL;
+	if(tail)
+	{
+		tail->next = xfer;
+		tail = xfer;
+		return 1;
+	}
+	head = xfer;
+	tail = xfer;
+	if(state == STATE_IDLE)
+		start(xfer);
+	else
+		timer(i2c_engine_timeout_us(xfer)); //Starts at the STOP of the last transaction
+	return 1;
+}
+
+/*
+ * @name   i2c_engine_irq
+ * @brief  Steps the transaction on the bus, called from the I2C interrupt
+ *
+ * Lost arbitration has already released the bus, a NACK is followed by STOP. A STOP on the bus
+ * starts the next transaction queued.
+ *
+ * @param  void
+ * @return void
+ */
+void i2c_engine_irq()
+{
+	uint8_t status = i2c->S;
+	i2c_xfer_t *xfer = head;
+
+	i2c->S = S_IICIF;
+	i2c_stats.interrupts++;
+	if(i2c->FLT & FLT_STOPF)
+	{
+		i2c->FLT = FLT_STOPIE | FLT_STOPF;
+		if(state == STATE_STOP)
+		{
+			if(xfer)
+				start(xfer);
+			else
+				state = STATE_IDLE;
+		}
+		return;
+	}
+	if(xfer == NULL || state == STATE_STOP)
+		return;
+	if(status & S_ARBL)
+	{
+		i2c->S = S_ARBL;
+		stop();
+		finish(I2C_ARB_LOST);
+		return;
+	}
+
+	switch(state)
+	{
+	case STATE_TX:
+		if(status & S_RXAK)
+		{
+			stop();
+			finish(I2C_NACK);
+		}
+		else if(position < xfer->tx_len)
+			i2c->D = xfer->tx[position++];
+		else if(xfer->rx_len)
+		{
+			i2c->C1 |= C1_RSTA;
+			i2c->D = xfer->dev | I2C_READ_BIT;
+			state = STATE_ADDR_R;
+		}
+		else
+		{
+			stop();
+			finish(I2C_DONE);
+		}
+		break;
+
+	case STATE_ADDR_R:
+		if(status & S_RXAK)
+		{
+			stop();
+			finish(I2C_NACK);
+			break;
+		}
+		position = 0;
+		state = STATE_RX;
+		i2c->C1 &= ~C1_TX;
+		if(xfer->rx_len == 1)
+			i2c->C1 |= C1_TXAK;
+		else
+			i2c->C1 &= ~C1_TXAK;
+		if(dma && xfer->rx_len >= I2C_DMA_MIN)
+		{
+			position = xfer->rx_len - 2;
+			state = STATE_DMA;
+			dma(xfer->rx, position);
+			i2c->C1 = (i2c->C1 & ~C1_IICIE) | C1_DMAEN;
+			i2c_stats.dma_reads++;
+			i2c_stats.dma_bytes += position;
+		}
+		(void)i2c->D; //Dummy read clocks in the first byte
+		break;
+
+	case STATE_RX:
+		if(position == xfer->rx_len - 1)
+		{
+			stop(); //Before the read, so no further byte is clocked in
+			xfer->rx[position++] = i2c->D;
+			finish(I2C_DONE);
+			break;
+		}
+		if(position == xfer->rx_len - 2)
+			i2c->C1 |= C1_TXAK;
+		xfer->rx[position++] = i2c->D;
+		break;
+
+	default:
+		break;
+	}
+}
+
+/*
+ * @name   i2c_engine_dma_done
+ * @brief  Hands the read back to the interrupt, called when the receive DMA has moved its bytes
+ *
+ * IICIF was set by every byte the DMA moved, so it is cleared before the interrupt is turned
+ * back on. The second to last byte may have come in before that; TCF shows it.
+ *
+ * @param  void
+ * @return int 1 when the next byte is already in; the caller raises the I2C interrupt
+ */
+int i2c_engine_dma_done()
+{
+	if(state != STATE_DMA)
+		return 0;
+	state = STATE_RX;
+	i2c->C1 &= ~C1_DMAEN;
+	i2c->S = S_IICIF;
+	i2c->C1 |= C1_IICIE;
+	return (i2c->S & S_TCF) != 0;
+}
+
+/*
+ * @name   i2c_engine_timeout
+ * @brief  Ends the transaction on the bus with I2C_TIMEOUT, called when the timer expires
+ *
+ * Releases the bus and disables and re-enables the module, which resets its state machine,
+ * then starts the next transaction straight away, as no STOP may follow
+ *
+ * @param  void
+ * @return void
+ */
+void i2c_engine_timeout()
+{
+	if(head == NULL)
+		return;
+	if(state == STATE_DMA)
+		dma(NULL, 0);
+	i2c->C1 = (i2c->C1 & ~(C1_MST | C1_TX | C1_TXAK | C1_RSTA | C1_DMAEN)) | C1_IICIE;
+	i2c->C1 &= ~C1_IICEN;
+	i2c->C1 |= C1_IICEN;
+	i2c->FLT = FLT_STOPIE | FLT_STOPF;
+	i2c->S = S_IICIF | S_ARBL;
+	finish(I2C_TIMEOUT);
+	state = STATE_IDLE;
+	if(head)
+		start(head);
+}
+
+/*
+ * @name   i2c_engine_busy
+ * @brief  Checks for a transaction on the bus or queued
+ *
+ * @param  void
+ * @return int 1 while busy
+ */
+int i2c_engine_busy()
+{
+	return head != NULL;
+}
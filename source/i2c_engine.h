@@ -0,0 +1,178 @@
+/*
+ * @file        i2c_engine.h
+ * @brief       Interrupt driven I2C master transaction engine declarations
+ *
+ * Transactions are queued and run one after another by a state machine stepped from the I2C
+ * interrupt, one step per address or data byte, so the CPU is free while the bus is busy.
+ * A transaction's kind follows from its lengths:
+ *  - write             tx_len > 0, rx_len 0: START, address, tx bytes, STOP
+ *  - write-then-read   tx_len > 0, rx_len > 0: START, address, tx bytes, repeated START, address, rx bytes, STOP
+ *  - burst read        tx_len 0, rx_len > 0: START, address, rx bytes, STOP
+ * Every transaction arms a timeout; a timer calls i2c_engine_timeout() when it expires, which
+ * resets the module and moves on to the next transaction.
+ * With a receive DMA set by i2c_engine_set_dma(), reads of I2C_DMA_MIN bytes or more move all but
+ * the last two bytes by DMA: the CPU handles the addresses, then the NACK and STOP at the end.
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       MCUXpresso IDE, gcc
+ * @references  KL25 Sub-Family Reference Manual, chapter 38 (I2C)
+ */
+
+#ifndef I2C_ENGINE_H_
+#define I2C_ENGINE_H_
+
+#include <stdint.h>
+
+#define I2C_READ_BIT          (0x01)  //Set in the address byte for a read
+#define I2C_TIMEOUT_US        (500)   //Timeout of a transaction, plus I2C_BYTE_TIMEOUT_US a byte
+#define I2C_BYTE_TIMEOUT_US   (100)   //A byte and its acknowledge take 90 us at 100 kHz
+#define I2C_DMA_MIN           (4)     //Shortest read worth setting up the receive DMA for
+
+//I2C register block, laid out as the KL25's I2C0
+typedef struct i2c_regs
+{
+	volatile uint8_t A1;
+	volatile uint8_t F;
+	volatile uint8_t C1;
+	volatile uint8_t S;
+	volatile uint8_t D;
+	volatile uint8_t C2;
+	volatile uint8_t FLT;
+	volatile uint8_t RA;
+	volatile uint8_t SMB;
+	volatile uint8_t A2;
+	volatile uint8_t SLTH;
+	volatile uint8_t SLTL;
+} i2c_regs_t;
+
+typedef enum
+{
+	I2C_IDLE = 0,       //Never queued
+	I2C_PENDING,        //Queued or on the bus
+	I2C_DONE,           //Every byte acknowledged
+	I2C_NACK,           //The device did not acknowledge its address or a byte
+	I2C_ARB_LOST,       //Another master took the bus
+	I2C_TIMEOUT         //No interrupt within the timeout; the bus was reset
+} i2c_status_t;
+
+typedef struct i2c_xfer i2c_xfer_t;
+
+//Completion callback, called from the I2C or timer interrupt once the status is final
+typedef void (*i2c_done_t)(i2c_xfer_t *xfer);
+
+//Timeout timer: armed for us microseconds, stopped by 0
+typedef void (*i2c_timer_t)(uint32_t us);
+
+//Receive DMA: armed to move count bytes from D to dst, one per byte received, stopped by count 0
+typedef void (*i2c_dma_t)(uint8_t *dst, uint32_t count);
+
+//One transaction, owned by the engine from i2c_engine_submit() until its callback
+struct i2c_xfer
+{
+	uint8_t dev;                    //8-bit write address; the read address is dev | I2C_READ_BIT
+	uint8_t tx_len;
+	uint8_t rx_len;
+	const uint8_t *tx;              //Bytes written, usually the register address first
+	uint8_t *rx;                    //Bytes read
+	i2c_done_t done;                //Called on completion, may be NULL
+	void *arg;                      //For the callback
+	volatile uint8_t status;        //i2c_status_t
+	i2c_xfer_t *next;               //Queue link
+};
+
+//Engine counters
+typedef struct i2c_stats
+{
+	uint32_t transfers;             //Transactions completed
+	uint32_t nacks;
+	uint32_t arbitration_lost;
+	uint32_t timeouts;
+	uint32_t interrupts;            //One per address and data byte the CPU handles, and per STOP
+	uint32_t dma_reads;             //Reads that moved bytes by DMA
+	uint32_t dma_bytes;
+} i2c_stats_t;
+
+extern i2c_stats_t i2c_stats;
+
+/*
+ * @name   i2c_engine_init
+ * @brief  Enables the module in master-ready state with its interrupt, with an empty queue
+ *
+ * @param  i2c_regs_t *regs, i2c_timer_t timeout_timer
+ * @return void
+ */
+void i2c_engine_init(i2c_regs_t *regs, i2c_timer_t timeout_timer);
+
+/*
+ * @name   i2c_engine_set_dma
+ * @brief  Sets the receive DMA, or NULL to read every byte in the interrupt
+ *
+ * Call with the bus idle
+ *
+ * @param  i2c_dma_t dma
+ * @return void
+ */
+void i2c_engine_set_dma(i2c_dma_t dma);
+
+/*
+ * @name   i2c_engine_submit
+ * @brief  Queues a transaction, starting it if the bus is idle
+ *
+ * Call with the I2C and timer interrupts masked, or from their handlers (a callback may queue
+ * the next transaction).
+ *
+ * @param  i2c_xfer_t *xfer
+ * @return int 1 when queued, 0 when it is already queued or moves no bytes
+ */
+int i2c_engine_submit(i2c_xfer_t *xfer);
+
+/*
+ * @name   i2c_engine_irq
+ * @brief  Steps the transaction on the bus, called from the I2C interrupt
+ *
+ * @param  void
+ * @return void
+ */
+void i2c_engine_irq();
+
+/*
+ * @name   i2c_engine_dma_done
+ * @brief  Hands the read back to the interrupt, called when the receive DMA has moved its bytes
+ *
+ * Call at the I2C interrupt's priority
+ *
+ * @param  void
+ * @return int 1 when the next byte is already in; the caller raises the I2C interrupt
+ */
+int i2c_engine_dma_done();
+
+/*
+ * @name   i2c_engine_timeout
+ * @brief  Ends the transaction on the bus with I2C_TIMEOUT, called when the timer expires
+ *
+ * Releases the bus, resets the module and starts the next transaction
+ *
+ * @param  void
+ * @return void
+ */
+void i2c_engine_timeout();
+
+/*
+ * @name   i2c_engine_busy
+ * @brief  Checks for a transaction on the bus or queued
+ *
+ * @param  void
+ * @return int 1 while busy
+ */
+int i2c_engine_busy();
+
+/*
+ * @name   i2c_engine_timeout_us
+ * @brief  Timeout armed for a transaction
+ *
+ * @param  const i2c_xfer_t *xfer
+ * @return uint32_t microseconds
+ */
+uint32_t i2c_engine_timeout_us(const i2c_xfer_t *xfer);
+
+#endif /* I2C_ENGINE_H_ */
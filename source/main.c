@@ -22,6 +22,7 @@
 #include "accelerometer.h"
 #include "musical_tones.h"
 #include "led.h"
+#include "power.h"
 
 //Main subroutine
 int main()
@@ -50,13 +51,16 @@ int main()
 
 	sysclock_init();                 //initialize clock
 	uart_init(BAUD_RATE);            //initialize uart0
+	init_power();                    //sleep while silent, wake on tilt or uart0
 	PRINTF("\n\rWelcome to the Command Processor of Musical Tones Player Based on Acceleration Angle!!\n\r");
 	while(1)
 	{
 		commandprocessor();             //command processor begins
-		read_full_xyz();                //read accelerometer
-		roll = (int)convert_xyz_to_roll();
-		play_tunes(roll);               //play tones
+		if(read_xyz_batch())            //a batch or data-ready sample drained, its mean stored
+		{
+			roll = (int)(convert_xyz_to_roll() / TILT_CENTIDEGREES);
+			play_tunes(roll);           //play tones
+		}
 	}
 	return ZERO;
 }
@@ -0,0 +1,354 @@
+/*
+ * @file        midi.c
+ * @brief       MIDI byte stream parser and synth voice control function implementations
+ *
+ * Parses a MIDI byte stream one byte at a time, as it arrives from the UART receive interrupt,
+ * and plays it on the mixer voices directly. A note on costs a table lookup, a shift and a
+ * multiply for its tuning word: the top octave's tuning words are computed once per sample rate
+ * in midi_reset(), and the pitch bend ratio comes from a table of eighth semitones.
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       MCUXpresso IDE, gcc
+ * @references  MIDI 1.0 Detailed Specification, MIDI Manufacturers Association
+ */
+
+#include <string.h>
+#include "midi.h"
+#include "mixer.h"
+#include "wavetable.h"
+#include "dma.h"
+
+#define STATUS_BIT        (0x80)
+#define TYPE_MASK         (0xF0)
+#define DATA_BITS         (7)
+#define SEMITONES         (12)
+#define REF_OCTAVE        (8)       //Notes 96..107, C7..B7, in ref_hz_q16
+#define NYQUIST_WORD      (1UL << 31)
+#define BEND_STEPS        (8)       //Bend table entries per semitone
+#define BEND_SHIFT        (13)      //Bend offset -8192..8191 is 13 bits and a sign
+#define BEND_CENTRE_INDEX (MIDI_BEND_SEMITONES * BEND_STEPS)
+#define RATIO_ONE         (1UL << 16)
+#define SUSTAIN_ON        (64)      //Pedal values from here are down
+#define WORD_BITS         (32)
+#define US_PER_SECOND     (1000000)
+
+//Frequencies of C7..B7, Hz Q16.16, equal temperament from A4 = 440 Hz
+static const uint32_t ref_hz_q16[SEMITONES] =
+{
+	137167144, 145323527, 153964914, 163120144, 172819773, 183096171,
+	193983636, 205518503, 217739269, 230686720, 244404066, 258937088
+};
+
+//2^(k / 96) for k = -16..16, Q16: pitch ratios in eighth semitones across the bend range
+static const uint32_t bend_ratio_q16[2 * BEND_CENTRE_INDEX + 1] =
+{
+	58386, 58809, 59235, 59664, 60097, 60532, 60971, 61413, 61858, 62306, 62757,
+	63212, 63670, 64132, 64596, 65065, 65536, 66011, 66489, 66971, 67456, 67945,
+	68438, 68933, 69433, 69936, 70443, 70953, 71468, 71985, 72507, 73032, 73562
+};
+
+//Envelope of MIDI notes: attack ms, decay ms, sustain level, release ms
+static const adsr_params_t midi_envelope = { 5, 200, ENV_Q15(0.7), 150 };
+
+midi_stats_t midi_stats;
+static uint32_t ref_words[SEMITONES];       //Tuning words of ref_hz_q16 at the output sample rate
+static uint32_t bend_q16 = RATIO_ONE;       //Pitch bend ratio
+static uint8_t status;                      //Running status, 0 for none
+static uint8_t data[2];
+static uint8_t have;                        //Data bytes of the message received so far
+static uint8_t with_status;                 //The message's status byte was sent, not running
+static uint8_t system;                      //In a system message, its data bytes are skipped
+static uint8_t wave = WAVE_SINE;
+static uint8_t sustain;                     //Pedal down
+static uint32_t sustained[MIDI_NOTES / WORD_BITS];  //Notes released while the pedal was down
+
+/*
+ * @name   midi_reset
+ * @brief  Clears the parser, controllers and counters and tunes the notes to the output rate
+ *
+ * Notes sounding are released rather than cut, so a reset does not click
+ *
+ * @param  void
+ * @return void
+ */
+void midi_reset()
+{
+	for(int i = 0; i < SEMITONES; i++)
+		ref_words[i] = dds_tuning_word(ref_hz_q16[i], output_sample_rate);
+	memset(&midi_stats, 0, sizeof(midi_stats));
+	memset(sustained, 0, sizeof(sustained));
+	bend_q16 = RATIO_ONE;
+	status = 0;
+	system = 0;
+	have = 0;
+	wave = WAVE_SINE;
+	sustain = 0;
+	mixer_set_envelope(&midi_envelope);
+	mixer_all_notes_off();
+}
+
+/*
+ * @name   midi_tuning_word
+ * @brief  DDS tuning word of a note at the current pitch bend
+ *
+ * The reference octave's word is shifted to the note's octave, rounding on the way down
+ *
+ * @param  uint8_t note (0..127)
+ * @return uint32_t tuning word, 0 for a note at or above the Nyquist frequency
+ */
+uint32_t midi_tuning_word(uint8_t note)
+{
+	int octave = (int)(note / SEMITONES) - REF_OCTAVE;
+	uint64_t word = ref_words[note % SEMITONES];
+
+	if(octave < 0)
+		word = (word + (1UL << (-octave - 1))) >> -octave;
+	else
+		word <<= octave;
+	word = (word * bend_q16) >> 16;
+	return (word >= NYQUIST_WORD) ? 0 : (uint32_t)word;
+}
+
+/*
+ * @name   midi_ring_half
+ * @brief  Largest DMA ring half that keeps two halves within MIDI_RING_US at a sample rate
+ *
+ * @param  uint32_t rate (Hz)
+ * @return uint32_t samples, a power of two from AUDIO_HALF_MIN to AUDIO_HALF_SIZE
+ */
+uint32_t midi_ring_half(uint32_t rate)
+{
+	uint32_t half = AUDIO_HALF_MIN;
+
+	while(half < AUDIO_HALF_SIZE && (uint64_t)4 * half * US_PER_SECOND <= (uint64_t)MIDI_RING_US * rate)
+		half *= 2;
+	return half;
+}
+
+/*
+ * @name   midi_wave
+ * @brief  Waveform new notes play with, set by program change
+ *
+ * @param  void
+ * @return uint8_t wave_t
+ */
+uint8_t midi_wave()
+{
+	return wave;
+}
+
+/*
+ * @name   set_bend
+ * @brief  Sets the pitch bend and retunes every sounding voice
+ *
+ * Linear between the eighth semitone ratios, within 0.05 cent of the exponential with the Q16 ratio
+ *
+ * @param  uint32_t value (0..16383, MIDI_BEND_CENTRE for none)
+ * @return void
+ */
+static void set_bend(uint32_t value)
+{
+	int32_t scaled = ((int32_t)value - MIDI_BEND_CENTRE) * BEND_CENTRE_INDEX;
+	int32_t index = (scaled >> BEND_SHIFT) + BEND_CENTRE_INDEX;   //Arithmetic shift floors
+	uint32_t frac = (uint32_t)scaled & ((1UL << BEND_SHIFT) - 1);
+
+	bend_q16 = bend_ratio_q16[index] +
+			(((bend_ratio_q16[index + 1] - bend_ratio_q16[index]) * frac) >> BEND_SHIFT);
+	for(int v = 0; v < MIXER_NUM_VOICES; v++)
+	{
+		tone_t tone;
+
+		if(!mixer_voices[v].active)
+			continue;
+		tone.tuning_word = midi_tuning_word(mixer_voices[v].note);
+		if(tone.tuning_word == 0)
+			continue;
+		tone.wave = mixer_voices[v].wave;
+		tone.table = wavetable_select(tone.wave, tone.tuning_word);
+		mixer_retune(v, &tone);
+	}
+}
+
+/*
+ * @name   note_on
+ * @brief  Starts a note on a voice, releasing the note if it is already sounding
+ *
+ * @param  uint8_t note, uint8_t velocity (1..127)
+ * @return void
+ */
+static void note_on(uint8_t note, uint8_t velocity)
+{
+	tone_t tone;
+
+	tone.tuning_word = midi_tuning_word(note);
+	if(tone.tuning_word == 0)
+	{
+		midi_stats.dropped++;
+		return;
+	}
+	tone.frequency = (int)(dds_frequency(tone.tuning_word, output_sample_rate) >> 16);
+	tone.wave = wave;
+	tone.table = wavetable_select(wave, tone.tuning_word);
+	sustained[note / WORD_BITS] &= ~(1UL << (note % WORD_BITS));
+	mixer_note_off(note);
+	mixer_note_on(note, &tone, velocity);
+	midi_stats.note_ons++;
+}
+
+/*
+ * @name   note_off
+ * @brief  Releases a note, or holds it until the sustain pedal comes up
+ *
+ * @param  uint8_t note
+ * @return void
+ */
+static void note_off(uint8_t note)
+{
+	midi_stats.note_offs++;
+	if(sustain)
+		sustained[note / WORD_BITS] |= 1UL << (note % WORD_BITS);
+	else
+		mixer_note_off(note);
+}
+
+/*
+ * @name   release_sustained
+ * @brief  Releases the notes held by the sustain pedal
+ *
+ * @param  void
+ * @return void
+ */
+static void release_sustained()
+{
+	for(uint32_t note = 0; note < MIDI_NOTES; note++)
+	{
+		if(sustained[note / WORD_BITS] & (1UL << (note % WORD_BITS)))
+			mixer_note_off((uint8_t)note);
+	}
+	memset(sustained, 0, sizeof(sustained));
+}
+
+/*
+ * @name   control
+ * @brief  Acts on a control change
+ *
+ * @param  uint8_t controller, uint8_t value
+ * @return void
+ */
+static void control(uint8_t controller, uint8_t value)
+{
+	midi_stats.controls++;
+	switch(controller)
+	{
+	case MIDI_CC_VOLUME:
+		mixer_set_master((int32_t)value * MIXER_VOLUME_MAX / MIXER_VELOCITY_MAX);
+		break;
+	case MIDI_CC_SUSTAIN:
+		if(value < SUSTAIN_ON && sustain)
+			release_sustained();
+		sustain = (value >= SUSTAIN_ON);
+		break;
+	case MIDI_CC_SOUND_OFF:
+		memset(sustained, 0, sizeof(sustained));
+		mixer_reset();
+		break;
+	case MIDI_CC_RESET:
+		set_bend(MIDI_BEND_CENTRE);
+		release_sustained();
+		sustain = 0;
+		break;
+	case MIDI_CC_NOTES_OFF:
+		memset(sustained, 0, sizeof(sustained));
+		mixer_all_notes_off();
+		break;
+	default:
+		break;
+	}
+}
+
+/*
+ * @name   dispatch
+ * @brief  Acts on a complete channel message
+ *
+ * @param  void
+ * @return void
+ */
+static void dispatch()
+{
+	midi_stats.messages++;
+	if(!with_status)
+		midi_stats.running++;
+	switch(status & TYPE_MASK)
+	{
+	case MIDI_NOTE_ON:
+		if(data[1])
+		{
+			note_on(data[0], data[1]);
+			break;
+		}
+		note_off(data[0]); //Velocity 0 is a note off, which running status makes common
+		break;
+	case MIDI_NOTE_OFF:
+		note_off(data[0]);
+		break;
+	case MIDI_PITCH_BEND:
+		midi_stats.bends++;
+		set_bend(data[0] | (uint32_t)data[1] << DATA_BITS);
+		break;
+	case MIDI_CONTROL:
+		control(data[0], data[1]);
+		break;
+	case MIDI_PROGRAM:
+		midi_stats.programs++;
+		wave = data[0] % WAVE_COUNT;
+		break;
+	default:
+		midi_stats.ignored++;
+		break;
+	}
+}
+
+/*
+ * @name   midi_rx
+ * @brief  Parses one received byte, acting on a message when it completes
+ *
+ * A status byte starts a message and becomes the running status; data bytes fill the message
+ * and, once it is complete, start the next one with the same status. System messages cancel
+ * running status, and the data bytes after them until the next status byte are skipped.
+ *
+ * @param  uint8_t byte
+ * @return void
+ */
+void midi_rx(uint8_t byte)
+{
+	uint8_t type;
+
+	midi_stats.bytes++;
+	if(byte >= MIDI_REAL_TIME)
+		return;
+	if(byte & STATUS_BIT)
+	{
+		system = (byte >= MIDI_SYSEX);
+		status = system ? 0 : byte;
+		have = 0;
+		with_status = 1;
+		if(system)
+			midi_stats.ignored++;
+		return;
+	}
+	if(!status)
+	{
+		if(system)
+			midi_stats.ignored++;
+		else
+			midi_stats.stray++;
+		return;
+	}
+	data[have++] = byte;
+	type = status & TYPE_MASK;
+	if(have < ((type == MIDI_PROGRAM || type == MIDI_CHANNEL_PRESSURE) ? 1 : 2))
+		return;
+	dispatch();
+	have = 0;
+	with_status = 0;
+}
@@ -0,0 +1,116 @@
+/*
+ * @file        midi.h
+ * @brief       MIDI byte stream parser and synth voice control declarations
+ *
+ * Parses a MIDI byte stream one byte at a time, as it arrives from the UART receive interrupt,
+ * and plays it on the mixer voices directly: note on and off, pitch bend, control change and
+ * program change, with running status. Real time bytes may arrive anywhere, even inside a
+ * message, and leave running status alone; system exclusive and system common messages are
+ * skipped. Every channel plays the same voices (omni on).
+ * midi_rx() must not run concurrently with mixer_fill(); UART0 and DMA0 share one interrupt
+ * priority for that.
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       MCUXpresso IDE, gcc
+ */
+
+#ifndef MIDI_H_
+#define MIDI_H_
+
+#include <stdint.h>
+
+#define MIDI_NOTE_OFF        (0x80)
+#define MIDI_NOTE_ON         (0x90)
+#define MIDI_POLY_PRESSURE   (0xA0)
+#define MIDI_CONTROL         (0xB0)
+#define MIDI_PROGRAM         (0xC0)
+#define MIDI_CHANNEL_PRESSURE (0xD0)
+#define MIDI_PITCH_BEND      (0xE0)
+#define MIDI_SYSEX           (0xF0)
+#define MIDI_SYSEX_END       (0xF7)
+#define MIDI_REAL_TIME       (0xF8)   //0xF8..0xFF are single byte real time messages
+#define MIDI_SYSTEM_RESET    (0xFF)
+
+#define MIDI_CC_VOLUME       (7)
+#define MIDI_CC_SUSTAIN      (64)
+#define MIDI_CC_SOUND_OFF    (120)
+#define MIDI_CC_RESET        (121)
+#define MIDI_CC_NOTES_OFF    (123)
+
+#define MIDI_BAUD_RATE       (115200) //UART0 rate while playing MIDI, a note on is on the wire for 0.29 ms
+#define MIDI_UART_BITS       (11)     //Line bits per byte: start, 8 data, even parity, stop
+#define MIDI_RING_US         (1500)   //Longest two ring halves may hold a note: the rest of a 2 ms note on budget is the wire
+#define MIDI_NOTES           (128)
+#define MIDI_BEND_CENTRE     (8192)
+#define MIDI_BEND_SEMITONES  (2)      //Pitch bend range either way
+
+//Parser counters, printed when the midi command ends
+typedef struct midi_stats
+{
+	uint32_t bytes;          //Bytes received, real time bytes included
+	uint32_t messages;       //Channel messages completed
+	uint32_t running;        //Of those, sent with running status
+	uint32_t note_ons;       //Note ons that started a voice
+	uint32_t note_offs;      //Note offs, including note ons with velocity 0
+	uint32_t bends;
+	uint32_t controls;
+	uint32_t programs;
+	uint32_t ignored;        //Pressure messages, system exclusive and system common bytes
+	uint32_t stray;          //Data bytes with no status to apply to
+	uint32_t dropped;        //Note ons above the Nyquist frequency
+} midi_stats_t;
+
+extern midi_stats_t midi_stats;
+
+/*
+ * @name   midi_reset
+ * @brief  Clears the parser, controllers and counters and tunes the notes to the output rate
+ *
+ * Sets the mixer envelope for MIDI notes and silences every voice. Call again after a change
+ * of the output sample rate.
+ *
+ * @param  void
+ * @return void
+ */
+void midi_reset();
+
+/*
+ * @name   midi_rx
+ * @brief  Parses one received byte, acting on a message when it completes
+ *
+ * @param  uint8_t byte
+ * @return void
+ */
+void midi_rx(uint8_t byte);
+
+/*
+ * @name   midi_tuning_word
+ * @brief  DDS tuning word of a note at the current pitch bend
+ *
+ * @param  uint8_t note (0..127)
+ * @return uint32_t tuning word, 0 for a note at or above the Nyquist frequency
+ */
+uint32_t midi_tuning_word(uint8_t note);
+
+/*
+ * @name   midi_ring_half
+ * @brief  Largest DMA ring half that keeps two halves within MIDI_RING_US at a sample rate
+ *
+ * A note on waits up to one half for the refill that starts it, then one half for the half
+ * being played ahead of it
+ *
+ * @param  uint32_t rate (Hz)
+ * @return uint32_t samples, a power of two from AUDIO_HALF_MIN to AUDIO_HALF_SIZE
+ */
+uint32_t midi_ring_half(uint32_t rate);
+
+/*
+ * @name   midi_wave
+ * @brief  Waveform new notes play with, set by program change
+ *
+ * @param  void
+ * @return uint8_t wave_t
+ */
+uint8_t midi_wave();
+
+#endif /* MIDI_H_ */
@@ -0,0 +1,151 @@
+/*
+ * @file        midi_uart.c
+ * @brief       MIDI input over UART0 function implementations
+ *
+ * Hands every byte received on UART0 to the MIDI parser in the receive interrupt, so notes start
+ * at the next DMA0 refill without going through the command line. UART0 and DMA0 share an
+ * interrupt priority, so the parser never runs in the middle of a refill.
+ * A note on is timed from the receive interrupt of its last byte: the refill after it renders
+ * the note from the start of a ring half, and the refill after that runs as DMA0 moves on to
+ * that half, one sample period before its first sample reaches the DAC.
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       MCUXpresso IDE
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <musical_tones.h>
+#include "midi_uart.h"
+#include "mixer.h"
+#include "uart.h"
+#include "dma.h"
+#include "power.h"
+#include "sequencer.h"
+#include "systick.h"
+#include "MKL25Z4.h"
+
+#define US_PER_SECOND  (1000000)
+
+typedef enum
+{
+	NOTE_IDLE = 0,
+	NOTE_RECEIVED,   //Note on parsed, not rendered yet
+	NOTE_RENDERED    //Rendered into the half DMA0 plays next
+} note_timing_t;
+
+midi_latency_stats_t midi_latency_stats;
+static volatile uint32_t note_cycles;            //cycle_count() at the note on being timed
+static volatile uint8_t note_timing = NOTE_IDLE;
+static volatile uint8_t reset_received;          //MIDI system reset ends the input
+
+/*
+ * @name   midi_uart_rx
+ * @brief  UART0 receive handler: parses the byte and stamps a note on
+ *
+ * @param  uint8_t byte
+ * @return void
+ */
+static void midi_uart_rx(uint8_t byte)
+{
+	uint32_t note_ons = midi_stats.note_ons;
+
+	if(byte == MIDI_SYSTEM_RESET)
+		reset_received = ONE;
+	midi_rx(byte);
+	if(midi_stats.note_ons != note_ons && note_timing == NOTE_IDLE)
+	{
+		note_cycles = cycle_count();
+		note_timing = NOTE_RECEIVED;
+	}
+}
+
+/*
+ * @name   midi_uart_fill
+ * @brief  Audio stream producer: the mixer, timing the note on in flight
+ *
+ * @param  uint16_t *dst, uint32_t count
+ * @return uint32_t samples rendered
+ */
+static uint32_t midi_uart_fill(uint16_t *dst, uint32_t count)
+{
+	if(note_timing == NOTE_RENDERED)
+	{
+		uint32_t cycles = cycle_count() - note_cycles + SystemCoreClock / output_sample_rate;
+		uint32_t us = cycles / (SystemCoreClock / US_PER_SECOND);
+
+		midi_latency_stats.measured++;
+		midi_latency_stats.last_us = us;
+		midi_latency_stats.total_us += us;
+		if(us > midi_latency_stats.worst_us)
+			midi_latency_stats.worst_us = us;
+		note_timing = NOTE_IDLE;
+	}
+	else if(note_timing == NOTE_RECEIVED)
+		note_timing = NOTE_RENDERED;
+	return mixer_fill(dst, count);
+}
+
+/*
+ * @name   midi_uart_play
+ * @brief  Function plays MIDI received on UART0 until a system reset byte or MIDI_IDLE_TICKS of silence
+ *
+ * The console message goes out at the old baud rate before UART0 switches to MIDI_BAUD_RATE, with
+ * the console's frame format. Tunes resume from the roll angle once the
+ * command processor is left.
+ *
+ * @param  void
+ * @return void
+ */
+void midi_uart_play()
+{
+	uint32_t half = midi_ring_half(output_sample_rate), bytes = ZERO;
+	int32_t master = mixer_master();
+	ticktime_t last_byte;
+
+	printf("\r\nMIDI input at %lu baud, %lu Hz, ring of 2 x %lu samples: send 0xFF to stop\r\n",
+			(unsigned long)MIDI_BAUD_RATE, (unsigned long)output_sample_rate, (unsigned long)half);
+	while(!uart_tx_idle());
+
+	sequencer_stop();
+	midi_reset();
+	memset(&midi_latency_stats, ZERO, sizeof(midi_latency_stats));
+	note_timing = NOTE_IDLE;
+	reset_received = ZERO;
+	audio_set_half_size(half);
+	uart_set_rx_handler(midi_uart_rx);
+	uart_set_baud(MIDI_BAUD_RATE);
+	power_play(midi_uart_fill);
+
+	reset_timer();
+	last_byte = get_timer();
+	while(!reset_received && get_timer() - last_byte < MIDI_IDLE_TICKS)
+	{
+		if(midi_stats.bytes != bytes)
+		{
+			bytes = midi_stats.bytes;
+			last_byte = get_timer();
+		}
+	}
+
+	uart_set_baud(BAUD_RATE);
+	uart_set_rx_handler(NULL);
+	__disable_irq(); //The refill ISR mixes the voices being released
+	mixer_all_notes_off();
+	mixer_set_master(master);
+	__enable_irq();
+	audio_set_half_size(AUDIO_HALF_SIZE);
+	power_play(sequencer_fill); //Releases finish, then power_silence() can sleep
+
+	printf("\r\nMIDI messages: %lu, running status: %lu, note ons: %lu, offs: %lu\r", (unsigned long)midi_stats.messages,
+			(unsigned long)midi_stats.running, (unsigned long)midi_stats.note_ons, (unsigned long)midi_stats.note_offs);
+	printf("\r\nBends: %lu, controls: %lu, ignored: %lu, stray: %lu, dropped: %lu\r", (unsigned long)midi_stats.bends,
+			(unsigned long)midi_stats.controls, (unsigned long)midi_stats.ignored, (unsigned long)midi_stats.stray,
+			(unsigned long)midi_stats.dropped);
+	if(midi_latency_stats.measured)
+		printf("\r\nNote on latency: last %lu us, mean %lu us, worst %lu us over %lu notes\r",
+				(unsigned long)midi_latency_stats.last_us,
+				(unsigned long)(midi_latency_stats.total_us / midi_latency_stats.measured),
+				(unsigned long)midi_latency_stats.worst_us, (unsigned long)midi_latency_stats.measured);
+	printf("\r\n");
+}
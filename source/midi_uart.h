@@ -0,0 +1,44 @@
+/*
+ * @file        midi_uart.h
+ * @brief       MIDI input over UART0 function declarations
+ *
+ * Hands every byte received on UART0 to the MIDI parser in the receive interrupt, so notes start
+ * without going through the command line, and measures the time from each note on to its first
+ * sample at the DAC
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       MCUXpresso IDE
+ */
+
+#ifndef MIDI_UART_H_
+#define MIDI_UART_H_
+
+#include <stdint.h>
+#include "midi.h"
+
+#define MIDI_IDLE_TICKS   (480)   //Silence on the line that ends MIDI input, 30 s of 62.5 ms ticks
+
+//Note on latency, measured for one note on at a time
+typedef struct midi_latency_stats
+{
+	uint32_t measured;   //Note ons timed
+	uint32_t last_us;    //Last byte of the note on received to its first sample at the DAC
+	uint32_t worst_us;
+	uint32_t total_us;   //For the mean
+} midi_latency_stats_t;
+
+extern midi_latency_stats_t midi_latency_stats;
+
+/*
+ * @name   midi_uart_play
+ * @brief  Function plays MIDI received on UART0 until a system reset byte or MIDI_IDLE_TICKS of silence
+ *
+ * Shrinks the DMA ring for the output sample rate with midi_ring_half() while playing, then
+ * restores the ring, master volume and tunes and prints the counters
+ *
+ * @param  void
+ * @return void
+ */
+void midi_uart_play();
+
+#endif /* MIDI_UART_H_ */
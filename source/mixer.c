@@ -0,0 +1,617 @@
+/*
+ * @file        mixer.c
+ * @brief       Polyphonic voice mixer function implementations
+ *
+ * Sums MIXER_NUM_VOICES DDS voices and MIXER_SAMPLE_VOICES ADPCM clip voices in saturating
+ * fixed point into the DAC stream.
+ * Voices are allocated on note on; when all are busy the oldest note is stolen.
+ * Volumes are Q15 gains folded into each voice's envelope ramp once per block, so the only per-sample
+ * output work is the soft clip, the optional dither and the conversion to 12-bit DAC codes.
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       MCUXpresso IDE, gcc
+ */
+
+#include <string.h>
+#include "mixer.h"
+#include "wavetable.h"
+#include "effects.h"
+
+#define Q15_MAX   (32767)
+#define LCG_MUL   (1664525UL)     //Numerical Recipes 32-bit LCG
+#define LCG_ADD   (1013904223UL)
+#define DITHER_BITS  (DDS_DAC_SHIFT)                    //Q15 bits dropped by the DAC conversion
+#define DITHER_MASK  ((1 << DITHER_BITS) - 1)
+
+voice_t mixer_voices[MIXER_NUM_VOICES];
+adpcm_voice_t mixer_samples[MIXER_SAMPLE_VOICES];
+uint32_t mixer_worst_step = 0;
+static uint32_t note_counter = 0;  //Stamps voices with their note on order
+static int32_t mix[MIXER_BLOCK_SIZE];
+static adsr_rates_t envelope_steps = { ENV_ONE / ENV_MIN_SAMPLES, ENV_ONE / ENV_MIN_SAMPLES, ENV_ONE, ENV_ONE / ENV_MIN_SAMPLES };
+static adsr_rates_t note_rates = { ENV_ONE / MIXER_XFADE_SAMPLES, ENV_ONE / ENV_MIN_SAMPLES, ENV_ONE, ENV_ONE / MIXER_XFADE_SAMPLES };
+static uint32_t crossfade = MIXER_XFADE_SAMPLES;  //Shortest attack and release, samples
+static int32_t master = MIXER_VOLUME_MAX;
+static int32_t output_gain = MIXER_HEADROOM;      //Master volume with the headroom, Q15
+static uint8_t dither = 0;
+static uint32_t noise = 1;                        //Dither generator state
+
+/*
+ * @name   apply_crossfade
+ * @brief  Rates for new notes: the envelope set, with attack and release no shorter than the crossfade
+ *
+ * @param  void
+ * @return void
+ */
+static void apply_crossfade()
+{
+	int32_t longest = ENV_ONE / (int32_t)crossfade;
+
+	note_rates = envelope_steps;
+	if(note_rates.attack_step > longest)
+		note_rates.attack_step = longest;
+	if(note_rates.release_step > longest)
+		note_rates.release_step = longest;
+}
+
+/*
+ * @name   mixer_set_envelope
+ * @brief  Sets the envelope used by notes started from now on
+ *
+ * @param  const adsr_params_t *params
+ * @return void
+ */
+void mixer_set_envelope(const adsr_params_t *params)
+{
+	envelope_rates(&envelope_steps, params, output_sample_rate);
+	apply_crossfade();
+}
+
+/*
+ * @name   mixer_set_crossfade
+ * @brief  Sets the shortest attack and release of notes started from now on
+ *
+ * A note following another fades in while the outgoing note's release fades out, so the two
+ * overlap for at least this many samples. Costs nothing per sample: only the envelope steps change.
+ *
+ * @param  uint32_t samples (clamped to ENV_MIN_SAMPLES..MIXER_XFADE_MAX)
+ * @return uint32_t samples in use
+ */
+uint32_t mixer_set_crossfade(uint32_t samples)
+{
+	if(samples < ENV_MIN_SAMPLES)
+		samples = ENV_MIN_SAMPLES;
+	else if(samples > MIXER_XFADE_MAX)
+		samples = MIXER_XFADE_MAX;
+	crossfade = samples;
+	apply_crossfade();
+	return crossfade;
+}
+
+/*
+ * @name   mixer_crossfade
+ * @brief  Shortest attack and release of new notes
+ *
+ * @param  void
+ * @return uint32_t samples
+ */
+uint32_t mixer_crossfade()
+{
+	return crossfade;
+}
+
+/*
+ * @name   allocate_voice
+ * @brief  Picks the voice for a new note
+ *
+ * First free voice, otherwise the active voice with the oldest note on
+ *
+ * @param  void
+ * @return int voice index
+ */
+static int allocate_voice()
+{
+	int oldest = 0;
+
+	for(int i = 0; i < MIXER_NUM_VOICES; i++)
+	{
+		if(!mixer_voices[i].active)
+			return i;
+		if((int32_t)(mixer_voices[i].age - mixer_voices[oldest].age) < 0) //Wrap safe comparison
+			oldest = i;
+	}
+	return oldest;
+}
+
+/*
+ * @name   mixer_note_on
+ * @brief  Starts a note on a free voice
+ *
+ * Takes a free voice, or steals the voice playing the oldest note.
+ * The voice is marked active last so the refill ISR never mixes a half set up voice.
+ *
+ * @param  uint8_t note, const tone_t *tone, uint8_t velocity (0..MIXER_VELOCITY_MAX)
+ * @return int voice index
+ */
+int mixer_note_on(uint8_t note, const tone_t *tone, uint8_t velocity)
+{
+	int v = allocate_voice();
+	voice_t *voice = &mixer_voices[v];
+
+	voice->active = 0;
+	if(voice->env.stage == ENV_IDLE)
+		voice->osc.phase = 0;  //A stolen voice keeps its phase and level, so it does not click
+	voice->osc.tuning_word = tone->tuning_word;
+	voice->osc.table = tone->table;
+	voice->wave = tone->wave;
+	envelope_trigger(&voice->env, &note_rates);
+	voice->note = note;
+	if(velocity > MIXER_VELOCITY_MAX)
+		velocity = MIXER_VELOCITY_MAX;
+	voice->velocity = ((int32_t)velocity * Q15_MAX) / MIXER_VELOCITY_MAX;
+	voice->age = ++note_counter;
+	voice->active = 1;
+	return v;
+}
+
+/*
+ * @name   mixer_sample_on
+ * @brief  Starts a clip on a free sample voice
+ *
+ * Takes a free sample voice, or steals the oldest. A looping clip holds its loop section
+ * until mixer_sample_release().
+ *
+ * @param  const adpcm_clip_t *clip, uint8_t velocity (0..MIXER_VELOCITY_MAX), int loop
+ * @return int sample voice index
+ */
+int mixer_sample_on(const adpcm_clip_t *clip, uint8_t velocity, int loop)
+{
+	int v = 0;
+
+	for(int i = 0; i < MIXER_SAMPLE_VOICES; i++)
+	{
+		if(!mixer_samples[i].active)
+		{
+			v = i;
+			break;
+		}
+		if((int32_t)(mixer_samples[i].age - mixer_samples[v].age) < 0) //Wrap safe comparison
+			v = i;
+	}
+	if(velocity > MIXER_VELOCITY_MAX)
+		velocity = MIXER_VELOCITY_MAX;
+	mixer_samples[v].age = ++note_counter;
+	adpcm_voice_start(&mixer_samples[v], clip, ((int32_t)velocity * Q15_MAX) / MIXER_VELOCITY_MAX, loop);
+	return v;
+}
+
+/*
+ * @name   mixer_sample_release
+ * @brief  Lets a sample voice play out from its loop to the end of its clip
+ *
+ * @param  int voice (MIXER_NO_VOICE for every sample voice)
+ * @return void
+ */
+void mixer_sample_release(int voice)
+{
+	for(int i = 0; i < MIXER_SAMPLE_VOICES; i++)
+	{
+		if(voice == MIXER_NO_VOICE || voice == i)
+			mixer_samples[i].looping = 0;
+	}
+}
+
+/*
+ * @name   mixer_retune
+ * @brief  Changes the pitch of a sounding voice
+ *
+ * Phase continuous, for legato note changes on one voice.
+ * The tuning word and table are single word writes; a refill between them plays one block
+ * from the neighbouring band, which is inaudible.
+ *
+ * @param  int voice, const tone_t *tone
+ * @return void
+ */
+void mixer_retune(int voice, const tone_t *tone)
+{
+	if(voice < 0 || voice >= MIXER_NUM_VOICES)
+		return;
+	mixer_voices[voice].osc.tuning_word = tone->tuning_word;
+	mixer_voices[voice].osc.table = tone->table;
+	mixer_voices[voice].wave = tone->wave;
+}
+
+/*
+ * @name   mixer_set_wave
+ * @brief  Changes the waveform of a voice
+ *
+ * Phase continuous; the band-limited table is picked for the pitch the voice is playing
+ *
+ * @param  int voice, uint8_t wave (wave_t)
+ * @return void
+ */
+void mixer_set_wave(int voice, uint8_t wave)
+{
+	if(voice < 0 || voice >= MIXER_NUM_VOICES)
+		return;
+	mixer_voices[voice].wave = wave;
+	mixer_voices[voice].osc.table = wavetable_select(wave, mixer_voices[voice].osc.tuning_word);
+}
+
+/*
+ * @name   rescale
+ * @brief  Scales a per-sample increment by old_rate / new_rate, rounded to nearest
+ *
+ * @param  uint32_t value, uint32_t old_rate, uint32_t new_rate
+ * @return uint32_t
+ */
+static uint32_t rescale(uint32_t value, uint32_t old_rate, uint32_t new_rate)
+{
+	return (uint32_t)(((uint64_t)value * old_rate + (new_rate >> 1)) / new_rate);
+}
+
+/*
+ * @name   rescale_rates
+ * @brief  Scales the steps of an envelope by old_rate / new_rate
+ *
+ * Steps are capped at full scale in ENV_MIN_SAMPLES, as envelope_rates() does
+ *
+ * @param  adsr_rates_t *rates, uint32_t old_rate, uint32_t new_rate
+ * @return void
+ */
+static void rescale_rates(adsr_rates_t *rates, uint32_t old_rate, uint32_t new_rate)
+{
+	int32_t *steps[] = { &rates->attack_step, &rates->decay_step, &rates->release_step };
+
+	for(int i = 0; i < 3; i++)
+	{
+		uint32_t step = rescale((uint32_t)*steps[i], old_rate, new_rate);
+		*steps[i] = (step > ENV_ONE / ENV_MIN_SAMPLES) ? ENV_ONE / ENV_MIN_SAMPLES : (int32_t)step;
+	}
+}
+
+/*
+ * @name   mixer_rescale
+ * @brief  Keeps pitch and envelope times when the output sample rate changes
+ *
+ * Scales the tuning word and envelope steps of every voice, and of notes started from now on,
+ * by old_rate / new_rate. The phase and level carry on, so sounding notes do not click, and the
+ * band-limited table is picked again since a lower rate puts the same pitch closer to Nyquist.
+ * Sample voices keep their clip's pitch the same way, through their clip step.
+ * Must not run concurrently with mixer_fill().
+ *
+ * @param  uint32_t old_rate, uint32_t new_rate (Hz)
+ * @return void
+ */
+void mixer_rescale(uint32_t old_rate, uint32_t new_rate)
+{
+	if(old_rate == new_rate || new_rate == 0)
+		return;
+	rescale_rates(&envelope_steps, old_rate, new_rate);
+	apply_crossfade();
+	for(int i = 0; i < MIXER_NUM_VOICES; i++)
+	{
+		voice_t *voice = &mixer_voices[i];
+
+		voice->osc.tuning_word = rescale(voice->osc.tuning_word, old_rate, new_rate);
+		voice->osc.table = wavetable_select(voice->wave, voice->osc.tuning_word);
+		rescale_rates(&voice->env.rates, old_rate, new_rate);
+	}
+	for(int i = 0; i < MIXER_SAMPLE_VOICES; i++)
+		mixer_samples[i].step = rescale(mixer_samples[i].step, old_rate, new_rate);
+}
+
+/*
+ * @name   clamp_volume
+ * @brief  Limits a volume to 0..MIXER_VOLUME_MAX
+ *
+ * @param  int32_t volume
+ * @return int32_t
+ */
+static int32_t clamp_volume(int32_t volume)
+{
+	return (volume < 0) ? 0 : (volume > MIXER_VOLUME_MAX) ? MIXER_VOLUME_MAX : volume;
+}
+
+/*
+ * @name   mixer_set_volume
+ * @brief  Sets the volume of a voice
+ *
+ * Applies to the note sounding on the voice and the notes it plays later, from the next block
+ *
+ * @param  int voice, int32_t volume (Q15, 0..MIXER_VOLUME_MAX)
+ * @return void
+ */
+void mixer_set_volume(int voice, int32_t volume)
+{
+	if(voice < 0 || voice >= MIXER_NUM_VOICES)
+		return;
+	mixer_voices[voice].attenuation = MIXER_VOLUME_MAX - clamp_volume(volume);
+}
+
+/*
+ * @name   mixer_volume
+ * @brief  Volume of a voice
+ *
+ * @param  int voice
+ * @return int32_t volume (Q15), 0 for a voice that does not exist
+ */
+int32_t mixer_volume(int voice)
+{
+	if(voice < 0 || voice >= MIXER_NUM_VOICES)
+		return 0;
+	return MIXER_VOLUME_MAX - mixer_voices[voice].attenuation;
+}
+
+/*
+ * @name   mixer_set_master
+ * @brief  Sets the master volume, from the next block
+ *
+ * @param  int32_t volume (Q15, 0..MIXER_VOLUME_MAX)
+ * @return void
+ */
+void mixer_set_master(int32_t volume)
+{
+	master = clamp_volume(volume);
+	output_gain = (master * MIXER_HEADROOM) >> 15;
+}
+
+/*
+ * @name   mixer_master
+ * @brief  Master volume
+ *
+ * @param  void
+ * @return int32_t volume (Q15)
+ */
+int32_t mixer_master()
+{
+	return master;
+}
+
+/*
+ * @name   mixer_output_gain
+ * @brief  Master volume with the mix headroom: the gain a voice at full level plays at
+ *
+ * @param  void
+ * @return int32_t gain (Q15, at most MIXER_HEADROOM)
+ */
+int32_t mixer_output_gain()
+{
+	return output_gain;
+}
+
+/*
+ * @name   mixer_set_dither
+ * @brief  Turns TPDF dither on the 12-bit output on or off
+ *
+ * @param  int on
+ * @return void
+ */
+void mixer_set_dither(int on)
+{
+	dither = on ? 1 : 0;
+}
+
+/*
+ * @name   mixer_dither
+ * @brief  Whether the output is dithered
+ *
+ * @param  void
+ * @return int 1 when on
+ */
+int mixer_dither()
+{
+	return dither;
+}
+
+/*
+ * @name   mixer_soft_clip
+ * @brief  Soft clips a mix sample to Q15
+ *
+ * Above the knee K the sample x becomes x - (x - K)^2 / (4 << MIXER_CLIP_SHIFT), which meets the
+ * straight line with the same slope at K and flattens onto full scale at K + (2 << MIXER_CLIP_SHIFT).
+ * Every voice is scaled by MIXER_HEADROOM, so a single voice at full level peaks at the knee and
+ * stays on the straight line. Louder sums and effect overshoot are bent over the top quarter of
+ * the range, 512 DAC codes, and only flatten onto full scale at a quarter beyond it.
+ *
+ * @param  int32_t s (sum of voices, Q15 scale)
+ * @return int32_t sample, Q15
+ */
+int32_t mixer_soft_clip(int32_t s)
+{
+	int32_t over = ((s < 0) ? -s : s) - MIXER_CLIP_KNEE;
+	int32_t y;
+
+	if(over <= 0)
+		return s;
+	if(over >= (2 << MIXER_CLIP_SHIFT))
+		y = Q15_MAX;
+	else
+		y = MIXER_CLIP_KNEE + over - ((over * over) >> (MIXER_CLIP_SHIFT + 2));
+	return (s < 0) ? -y : y;
+}
+
+/*
+ * @name   mixer_output
+ * @brief  Output stage: converts a block of Q15 samples to 12-bit DAC codes
+ *
+ * TPDF dither is added if enabled, then samples past the knee are soft clipped, so a block the
+ * effects pushed over full scale still lands within 0 to 4095; samples below the knee cost one
+ * comparison
+ *
+ * @param  const int32_t *block (Q15 scale), uint16_t *dst, uint32_t n
+ * @return void
+ */
+void mixer_output(const int32_t *block, uint16_t *dst, uint32_t n)
+{
+	if(dither)
+	{
+		uint32_t r = noise;
+
+		for(uint32_t j = 0; j < n; j++)
+		{
+			int32_t s;
+
+			r = r * LCG_MUL + LCG_ADD;  //Two uniform draws from the top bits sum to a triangular one
+			s = block[j] - DITHER_MASK + (int32_t)(r >> (32 - DITHER_BITS)) +
+					(int32_t)((r >> (32 - 2 * DITHER_BITS)) & DITHER_MASK);
+			if(s > MIXER_CLIP_KNEE || s < -MIXER_CLIP_KNEE)
+				s = mixer_soft_clip(s);
+			*dst++ = (uint16_t)((s >> DDS_DAC_SHIFT) + DDS_DAC_MIDSCALE);
+		}
+		noise = r;
+	}
+	else
+	{
+		for(uint32_t j = 0; j < n; j++)
+		{
+			int32_t s = block[j];
+			if(s > MIXER_CLIP_KNEE || s < -MIXER_CLIP_KNEE)
+				s = mixer_soft_clip(s);
+			*dst++ = (uint16_t)((s >> DDS_DAC_SHIFT) + DDS_DAC_MIDSCALE);
+		}
+	}
+}
+
+/*
+ * @name   mixer_note_off
+ * @brief  Releases every voice playing a note
+ *
+ * The voice stays active until its release stage has faded out
+ *
+ * @param  uint8_t note
+ * @return void
+ */
+void mixer_note_off(uint8_t note)
+{
+	for(int i = 0; i < MIXER_NUM_VOICES; i++)
+	{
+		if(mixer_voices[i].active && mixer_voices[i].note == note)
+			envelope_release(&mixer_voices[i].env);
+	}
+}
+
+/*
+ * @name   mixer_all_notes_off
+ * @brief  Releases every voice, sample voices included
+ *
+ * @param  void
+ * @return void
+ */
+void mixer_all_notes_off()
+{
+	for(int i = 0; i < MIXER_NUM_VOICES; i++)
+		envelope_release(&mixer_voices[i].env);
+	mixer_sample_release(MIXER_NO_VOICE);
+}
+
+/*
+ * @name   mixer_reset
+ * @brief  Silences every voice immediately, without a release
+ *
+ * @param  void
+ * @return void
+ */
+void mixer_reset()
+{
+	for(int i = 0; i < MIXER_NUM_VOICES; i++)
+	{
+		mixer_voices[i].active = 0;
+		mixer_voices[i].env.stage = ENV_IDLE;
+		mixer_voices[i].env.level = 0;
+	}
+	for(int i = 0; i < MIXER_SAMPLE_VOICES; i++)
+		mixer_samples[i].active = 0;
+}
+
+/*
+ * @name   mixer_active_voices
+ * @brief  Number of voices sounding, including releases and sample voices
+ *
+ * Zero once the last release has faded out, so the output is silent
+ *
+ * @param  void
+ * @return uint32_t voices
+ */
+uint32_t mixer_active_voices()
+{
+	uint32_t active = 0;
+
+	for(int i = 0; i < MIXER_NUM_VOICES; i++)
+	{
+		if(mixer_voices[i].active)
+			active++;
+	}
+	for(int i = 0; i < MIXER_SAMPLE_VOICES; i++)
+	{
+		if(mixer_samples[i].active)
+			active++;
+	}
+	return active;
+}
+
+/*
+ * @name   mixer_fill
+ * @brief  Audio stream producer: mixes all active voices into DAC samples
+ *
+ * Works through the request in MIXER_BLOCK_SIZE pieces. Each voice advances its envelope once
+ * per block, scales it by the note velocity, voice volume and output gain and adds the whole
+ * block with a linear gain ramp, so its oscillator state stays in registers. Sample voices decode
+ * their clips into the same block, scaled by velocity and output gain. The block then runs
+ * through the effects chain and mixer_output().
+ * Voices whose release has finished are freed. The steepest gain ramp is kept in mixer_worst_step.
+ *
+ * @param  uint16_t *dst, uint32_t count
+ * @return uint32_t samples rendered (always count)
+ */
+uint32_t mixer_fill(uint16_t *dst, uint32_t count)
+{
+	uint32_t remaining = count;
+
+	while(remaining)
+	{
+		uint32_t n = (remaining < MIXER_BLOCK_SIZE) ? remaining : MIXER_BLOCK_SIZE;
+
+		memset(mix, 0, n * sizeof(mix[0]));
+		for(int i = 0; i < MIXER_NUM_VOICES; i++)
+		{
+			voice_t *voice = &mixer_voices[i];
+			int32_t level, step, gain;
+			uint32_t gain_step;
+
+			if(!voice->active)
+				continue;
+			level = envelope_block(&voice->env, n, &step);
+			gain = voice->velocity;
+			if(voice->attenuation)
+				gain = (gain * (MIXER_VOLUME_MAX - voice->attenuation)) >> 15;
+			gain = (gain * output_gain) >> 15;
+			if(gain < Q15_MAX) //Scales the ramp once per block, not per sample
+			{
+				level = (int32_t)(((int64_t)level * gain) >> 15);
+				step = (int32_t)(((int64_t)step * gain) >> 15);
+			}
+			gain_step = (uint32_t)((step < 0) ? -step : step) >> ENV_LEVEL_SHIFT;
+			if(gain_step > mixer_worst_step)
+				mixer_worst_step = gain_step;
+			dds_mix(&voice->osc, mix, n, level, step);
+			if(voice->env.stage == ENV_IDLE)
+				voice->active = 0;
+		}
+		for(int i = 0; i < MIXER_SAMPLE_VOICES; i++)
+		{
+			adpcm_voice_t *sample = &mixer_samples[i];
+			int32_t gain = sample->gain;
+
+			if(!sample->active)
+				continue;
+			gain = (gain * output_gain) >> 15;
+			adpcm_voice_mix(sample, mix, n, gain);
+		}
+		effects_process(mix, n);
+		mixer_output(mix, dst, n);
+		dst += n;
+		remaining -= n;
+	}
+	return count;
+}
@@ -0,0 +1,295 @@
+/*
+ * @file        mixer.h
+ * @brief       Polyphonic voice mixer function declarations
+ *
+ * Sums MIXER_NUM_VOICES DDS voices and MIXER_SAMPLE_VOICES ADPCM clip voices in saturating
+ * fixed point into the DAC stream.
+ * Voices are allocated on note on; when all are busy the oldest note is stolen.
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       MCUXpresso IDE, gcc
+ */
+
+#ifndef MIXER_H_
+#define MIXER_H_
+
+#include <stdint.h>
+#include "dds.h"
+#include "envelope.h"
+#include "tone_to_sample.h"
+#include "adpcm.h"
+
+#ifndef MIXER_NUM_VOICES
+#define MIXER_NUM_VOICES   (4)    //Build time voice count, override with -DMIXER_NUM_VOICES=n
+#endif
+#ifndef MIXER_SAMPLE_VOICES
+#define MIXER_SAMPLE_VOICES (2)   //ADPCM clip voices, override with -DMIXER_SAMPLE_VOICES=n
+#endif
+#define MIXER_BLOCK_SIZE   (64)   //Samples mixed per pass through the voices
+#define MIXER_NO_VOICE     (-1)
+#define MIXER_VELOCITY_MAX (127)  //Full level, as MIDI
+#ifndef MIXER_XFADE_SAMPLES
+#define MIXER_XFADE_SAMPLES (256) //Default shortest attack and release, the overlap of consecutive notes
+#endif
+#define MIXER_XFADE_MAX    (4096)
+#define MIXER_VOLUME_MAX   (32767)                //Unity gain, Q15
+#define MIXER_CLIP_SHIFT   (13)                   //The bend spans 2 << 13 in Q15, 1024 DAC codes
+#define MIXER_CLIP_KNEE    (32767 - (1 << MIXER_CLIP_SHIFT))  //Soft clipping starts here, Q15, 75% of full scale
+#define MIXER_HEADROOM     (MIXER_CLIP_KNEE)      //Q15 gain on every voice, so one at full level peaks at the knee
+
+#if MIXER_BLOCK_SIZE > ENV_MIN_SAMPLES
+#error "A block of envelope steps only stays within full scale for blocks up to ENV_MIN_SAMPLES"
+#endif
+
+//One voice of the mixer
+typedef struct voice
+{
+	dds_osc_t osc;       //Oscillator
+	envelope_t env;      //Amplitude envelope
+	int32_t velocity;    //Note velocity as a Q15 gain on the envelope
+	int32_t attenuation; //MIXER_VOLUME_MAX less the voice volume, so a cleared voice plays at full volume
+	uint32_t age;        //Note on order, smallest active age is the oldest note
+	uint8_t note;        //Note number the voice was started with, for note off
+	uint8_t wave;        //wave_t, to pick the band again when the voice is retuned
+	uint8_t active;      //Voice is sounding, including its release
+} voice_t;
+
+extern voice_t mixer_voices[MIXER_NUM_VOICES];
+extern adpcm_voice_t mixer_samples[MIXER_SAMPLE_VOICES];
+extern uint32_t mixer_worst_step;  //Largest per-sample gain change of any voice, Q15 of full scale; clear to restart
+
+/*
+ * @name   mixer_set_envelope
+ * @brief  Sets the envelope used by notes started from now on
+ *
+ * @param  const adsr_params_t *params
+ * @return void
+ */
+void mixer_set_envelope(const adsr_params_t *params);
+
+/*
+ * @name   mixer_set_crossfade
+ * @brief  Sets the shortest attack and release of notes started from now on
+ *
+ * A note following another fades in while the outgoing note's release fades out, so the two
+ * overlap for at least this many samples. Counted in samples, so it does not follow rate changes.
+ *
+ * @param  uint32_t samples (clamped to ENV_MIN_SAMPLES..MIXER_XFADE_MAX)
+ * @return uint32_t samples in use
+ */
+uint32_t mixer_set_crossfade(uint32_t samples);
+
+/*
+ * @name   mixer_crossfade
+ * @brief  Shortest attack and release of new notes
+ *
+ * @param  void
+ * @return uint32_t samples
+ */
+uint32_t mixer_crossfade();
+
+/*
+ * @name   mixer_note_on
+ * @brief  Starts a note on a free voice
+ *
+ * Takes a free voice, or steals the voice playing the oldest note
+ *
+ * @param  uint8_t note, const tone_t *tone, uint8_t velocity (0..MIXER_VELOCITY_MAX)
+ * @return int voice index
+ */
+int mixer_note_on(uint8_t note, const tone_t *tone, uint8_t velocity);
+
+/*
+ * @name   mixer_sample_on
+ * @brief  Starts a clip on a free sample voice
+ *
+ * Takes a free sample voice, or steals the oldest. A looping clip holds its loop section
+ * until mixer_sample_release().
+ *
+ * @param  const adpcm_clip_t *clip, uint8_t velocity (0..MIXER_VELOCITY_MAX), int loop
+ * @return int sample voice index
+ */
+int mixer_sample_on(const adpcm_clip_t *clip, uint8_t velocity, int loop);
+
+/*
+ * @name   mixer_sample_release
+ * @brief  Lets a sample voice play out from its loop to the end of its clip
+ *
+ * @param  int voice (MIXER_NO_VOICE for every sample voice)
+ * @return void
+ */
+void mixer_sample_release(int voice);
+
+/*
+ * @name   mixer_retune
+ * @brief  Changes the pitch of a sounding voice
+ *
+ * Phase continuous, for legato note changes on one voice
+ *
+ * @param  int voice, const tone_t *tone
+ * @return void
+ */
+void mixer_retune(int voice, const tone_t *tone);
+
+/*
+ * @name   mixer_set_wave
+ * @brief  Changes the waveform of a voice
+ *
+ * Phase continuous; the band-limited table is picked for the pitch the voice is playing
+ *
+ * @param  int voice, uint8_t wave (wave_t)
+ * @return void
+ */
+void mixer_set_wave(int voice, uint8_t wave);
+
+/*
+ * @name   mixer_rescale
+ * @brief  Keeps pitch and envelope times when the output sample rate changes
+ *
+ * Scales the tuning word and envelope steps of every voice, and of notes started from now on,
+ * and the clip step of every sample voice by old_rate / new_rate. Must not run concurrently with mixer_fill().
+ *
+ * @param  uint32_t old_rate, uint32_t new_rate (Hz)
+ * @return void
+ */
+void mixer_rescale(uint32_t old_rate, uint32_t new_rate);
+
+/*
+ * @name   mixer_set_volume
+ * @brief  Sets the volume of a voice
+ *
+ * Applies to the note sounding on the voice and the notes it plays later, from the next block
+ *
+ * @param  int voice, int32_t volume (Q15, 0..MIXER_VOLUME_MAX)
+ * @return void
+ */
+void mixer_set_volume(int voice, int32_t volume);
+
+/*
+ * @name   mixer_volume
+ * @brief  Volume of a voice
+ *
+ * @param  int voice
+ * @return int32_t volume (Q15), 0 for a voice that does not exist
+ */
+int32_t mixer_volume(int voice);
+
+/*
+ * @name   mixer_set_master
+ * @brief  Sets the master volume, from the next block
+ *
+ * @param  int32_t volume (Q15, 0..MIXER_VOLUME_MAX)
+ * @return void
+ */
+void mixer_set_master(int32_t volume);
+
+/*
+ * @name   mixer_master
+ * @brief  Master volume
+ *
+ * @param  void
+ * @return int32_t volume (Q15)
+ */
+int32_t mixer_master();
+
+/*
+ * @name   mixer_output_gain
+ * @brief  Master volume with the mix headroom: the gain a voice at full level plays at
+ *
+ * @param  void
+ * @return int32_t gain (Q15, at most MIXER_HEADROOM)
+ */
+int32_t mixer_output_gain();
+
+/*
+ * @name   mixer_set_dither
+ * @brief  Turns TPDF dither on the 12-bit output on or off
+ *
+ * @param  int on
+ * @return void
+ */
+void mixer_set_dither(int on);
+
+/*
+ * @name   mixer_dither
+ * @brief  Whether the output is dithered
+ *
+ * @param  void
+ * @return int 1 when on
+ */
+int mixer_dither();
+
+/*
+ * @name   mixer_soft_clip
+ * @brief  Soft clips a mix sample to Q15
+ *
+ * Samples within MIXER_CLIP_KNEE pass unchanged. Above the knee a quadratic curve bends the
+ * sample smoothly onto full scale, which it reaches 2 << MIXER_CLIP_SHIFT above the knee.
+ *
+ * @param  int32_t s (sum of voices, Q15 scale)
+ * @return int32_t sample, Q15
+ */
+int32_t mixer_soft_clip(int32_t s);
+
+/*
+ * @name   mixer_output
+ * @brief  Output stage: converts a block of Q15 samples to 12-bit DAC codes
+ *
+ * Dithered if enabled and soft clipped, so any sum, however far over full scale, lands within 0 to 4095
+ *
+ * @param  const int32_t *block (Q15 scale), uint16_t *dst, uint32_t n
+ * @return void
+ */
+void mixer_output(const int32_t *block, uint16_t *dst, uint32_t n);
+
+/*
+ * @name   mixer_note_off
+ * @brief  Releases every voice playing a note
+ *
+ * The voice stays active until its release stage has faded out
+ *
+ * @param  uint8_t note
+ * @return void
+ */
+void mixer_note_off(uint8_t note);
+
+/*
+ * @name   mixer_all_notes_off
+ * @brief  Releases every voice, sample voices included
+ *
+ * @param  void
+ * @return void
+ */
+void mixer_all_notes_off();
+
+/*
+ * @name   mixer_reset
+ * @brief  Silences every voice immediately, without a release
+ *
+ * @param  void
+ * @return void
+ */
+void mixer_reset();
+
+/*
+ * @name   mixer_active_voices
+ * @brief  Number of voices sounding, including releases and sample voices
+ *
+ * @param  void
+ * @return uint32_t voices
+ */
+uint32_t mixer_active_voices();
+
+/*
+ * @name   mixer_fill
+ * @brief  Audio stream producer: mixes all active voices into DAC samples
+ *
+ * Each voice is scaled by its envelope, velocity, volume and mixer_output_gain(), sample voices
+ * by their velocity and mixer_output_gain(); voices are summed in 32 bits, dithered if enabled, soft clipped to Q15 and converted to 12-bit DAC codes
+ *
+ * @param  uint16_t *dst, uint32_t count
+ * @return uint32_t samples rendered (always count)
+ */
+uint32_t mixer_fill(uint16_t *dst, uint32_t count);
+
+#endif /* MIXER_H_ */
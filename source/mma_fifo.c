@@ -0,0 +1,203 @@
+/*
+ * @file        mma_fifo.c
+ * @brief       MMA8451 FIFO batch ring and output data rate selection implementations
+ *
+ * A single producer, the I2C interrupt, and a single consumer, the main loop: each only moves its
+ * own counter, so the ring needs no locking. A slot stays with the producer from mma_ring_slot()
+ * until mma_ring_drained(), the DMA writing it in between.
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       MCUXpresso IDE, gcc
+ * @references  MMA8451Q data sheet, section 6.1 (FIFO); NXP AN4073
+ */
+
+#include <stddef.h>
+#include "mma_fifo.h"
+
+#define AXIS_SHIFT_DIV (4)  //14-bit samples are left-justified in 16 bits
+
+mma_fifo_stats_t mma_fifo_stats;
+
+/*
+ * @name   mma_ring_reset
+ * @brief  Empties the ring
+ *
+ * @param  mma_ring_t *ring
+ * @return void
+ */
+void mma_ring_reset(mma_ring_t *ring)
+{
+	ring->drained = 0;
+	ring->processed = 0;
+}
+
+/*
+ * @name   mma_ring_slot
+ * @brief  Batch the next drain writes, NULL while the ring is full
+ *
+ * @param  mma_ring_t *ring
+ * @return mma_batch_t *
+ */
+mma_batch_t *mma_ring_slot(mma_ring_t *ring)
+{
+	uint32_t drained = ring->drained;
+
+	if(drained - ring->processed >= MMA_RING_BATCHES)
+	{
+		mma_fifo_stats.ring_full++;
+		return NULL;
+	}
+	return &ring->batch[drained & (MMA_RING_BATCHES - 1)];
+}
+
+/*
+ * @name   mma_ring_drained
+ * @brief  Hands the batch from mma_ring_slot() to the consumer once its drain is complete
+ *
+ * F_STATUS was read before the batch, so the FIFO held at least its count less this batch after.
+ * A single sample came after the status register instead, which has no count.
+ *
+ * @param  mma_ring_t *ring, uint8_t samples (in the batch)
+ * @return int 1 when the FIFO still held another batch after this one
+ */
+int mma_ring_drained(mma_ring_t *ring, uint8_t samples)
+{
+	uint32_t drained = ring->drained;
+	uint8_t status = ring->batch[drained & (MMA_RING_BATCHES - 1)].f_status;
+
+	mma_fifo_stats.batches++;
+	if(status & MMA_F_OVF)
+		mma_fifo_stats.overflows++;
+	ring->samples[drained & (MMA_RING_BATCHES - 1)] = samples;
+	ring->drained = drained + 1;
+	return samples == MMA_FIFO_WATERMARK && (status & MMA_F_CNT_MASK) >= 2 * MMA_FIFO_WATERMARK;
+}
+
+/*
+ * @name   mma_ring_oldest
+ * @brief  Oldest batch not processed yet, NULL when there is none
+ *
+ * @param  mma_ring_t *ring, uint8_t *samples (in the batch, set when there is one)
+ * @return const mma_batch_t *
+ */
+const mma_batch_t *mma_ring_oldest(mma_ring_t *ring, uint8_t *samples)
+{
+	uint32_t processed = ring->processed;
+
+	if(processed == ring->drained)
+		return NULL;
+	*samples = ring->samples[processed & (MMA_RING_BATCHES - 1)];
+	return &ring->batch[processed & (MMA_RING_BATCHES - 1)];
+}
+
+/*
+ * @name   mma_ring_processed
+ * @brief  Releases the batch from mma_ring_oldest() for another drain
+ *
+ * @param  mma_ring_t *ring
+ * @return void
+ */
+void mma_ring_processed(mma_ring_t *ring)
+{
+	if(ring->processed != ring->drained)
+		ring->processed++;
+}
+
+/*
+ * @name   mma_axis
+ * @brief  14-bit count of an axis from its data registers
+ *
+ * Divided rather than shifted, as the single readings always were, so negative counts round
+ * towards zero
+ *
+ * @param  uint8_t msb, uint8_t lsb
+ * @return int16_t -8192 to 8191, 4096 a g
+ */
+int16_t mma_axis(uint8_t msb, uint8_t lsb)
+{
+	return (int16_t)((int16_t)((msb << 8) | lsb) / AXIS_SHIFT_DIV);
+}
+
+/*
+ * @name   mma_batch_mean
+ * @brief  Mean of the samples of a batch on each axis, a boxcar low-pass at the full rate
+ *
+ * Rounds towards zero
+ *
+ * @param  const mma_batch_t *batch, uint8_t samples (1 to MMA_FIFO_WATERMARK), int16_t *x, int16_t *y, int16_t *z
+ * @return void
+ */
+void mma_batch_mean(const mma_batch_t *batch, uint8_t samples, int16_t *x, int16_t *y, int16_t *z)
+{
+	int32_t sx = 0, sy = 0, sz = 0;
+
+	if(samples == 0)
+		samples = 1;
+	for(int i = 0; i < samples; i++)
+	{
+		const mma_sample_t *s = &batch->sample[i];
+
+		sx += mma_axis(s->x_msb, s->x_lsb);
+		sy += mma_axis(s->y_msb, s->y_lsb);
+		sz += mma_axis(s->z_msb, s->z_lsb);
+	}
+	*x = (int16_t)(sx / samples);
+	*y = (int16_t)(sy / samples);
+	*z = (int16_t)(sz / samples);
+}
+
+/*
+ * @name   mma_motion_reset
+ * @brief  Starts rate selection at a rate, from a reading
+ *
+ * @param  mma_motion_t *motion, mma_rate_t rate, int16_t x, int16_t y, int16_t z
+ * @return void
+ */
+void mma_motion_reset(mma_motion_t *motion, mma_rate_t rate, int16_t x, int16_t y, int16_t z)
+{
+	motion->reference[0] = x;
+	motion->reference[1] = y;
+	motion->reference[2] = z;
+	motion->still_ms = 0;
+	motion->rate = (uint8_t)rate;
+}
+
+/*
+ * @name   moved
+ * @brief  Checks one axis for motion since the reference
+ *
+ * @param  int16_t now, int16_t reference
+ * @return int 1 when it moved
+ */
+static int moved(int16_t now, int16_t reference)
+{
+	int32_t change = (int32_t)now - reference;
+
+	return change > MMA_MOTION_COUNTS || change < -MMA_MOTION_COUNTS;
+}
+
+/*
+ * @name   mma_motion_update
+ * @brief  Selects the rate from a reading
+ *
+ * Motion is a change of more than MMA_MOTION_COUNTS on any axis since the last motion, so slow
+ * drifts are caught too. Motion selects the fast rate at once; MMA_STILL_MS without it the slow.
+ *
+ * @param  mma_motion_t *motion, int16_t x, int16_t y, int16_t z, uint32_t period_ms (since the last reading)
+ * @return mma_rate_t
+ */
+mma_rate_t mma_motion_update(mma_motion_t *motion, int16_t x, int16_t y, int16_t z, uint32_t period_ms)
+{
+	if(moved(x, motion->reference[0]) || moved(y, motion->reference[1]) || moved(z, motion->reference[2]))
+	{
+		mma_motion_reset(motion, MMA_RATE_MOVING, x, y, z);
+		return MMA_RATE_MOVING;
+	}
+	if(motion->rate == MMA_RATE_MOVING)
+	{
+		motion->still_ms += period_ms;
+		if(motion->still_ms >= MMA_STILL_MS)
+			motion->rate = MMA_RATE_STILL;
+	}
+	return (mma_rate_t)motion->rate;
+}
@@ -0,0 +1,173 @@
+/*
+ * @file        mma_fifo.h
+ * @brief       MMA8451 FIFO batch ring and output data rate selection declarations
+ *
+ * In watermark mode the MMA8451 keeps its last 32 samples and interrupts once it holds
+ * MMA_FIFO_WATERMARK of them. One write-then-read from F_STATUS drains a batch: with the FIFO on,
+ * the register pointer wraps from OUT_Z_LSB back to OUT_X_MSB, so the status and the samples
+ * come in one burst, laid out as mma_batch_t. With the FIFO off the data-ready interrupt reads
+ * one sample the same way, after the status register. The I2C interrupt drains batches into a
+ * ring and the main loop processes them whole, oldest first.
+ * The rate follows the readings: 800 Hz batches while the board moves, single samples at
+ * 12.5 Hz once it has been still for MMA_STILL_MS.
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       MCUXpresso IDE, gcc
+ * @references  MMA8451Q data sheet, section 6.1 (FIFO); NXP AN4073
+ */
+
+#ifndef MMA_FIFO_H_
+#define MMA_FIFO_H_
+
+#include <stdint.h>
+
+#define MMA_REG_F_STATUS   (0x00)  //Drains start here
+#define MMA_FIFO_SAMPLES   (32)    //FIFO depth
+#define MMA_FIFO_WATERMARK (16)    //Samples a batch: 20 ms at 800 Hz
+#define MMA_RING_BATCHES   (4)     //Power of two
+#define MMA_F_OVF          (0x80)  //F_STATUS: the FIFO was full and dropped its oldest sample; STATUS: a sample was overwritten
+#define MMA_F_CNT_MASK     (0x3F)  //F_STATUS: samples in the FIFO
+#define MMA_MOTION_COUNTS  (205)   //Change of a reading on any axis that is motion: 0.05 g, 3 degrees of tilt
+#define MMA_STILL_MS       (2000)  //Time without motion before the slow rate
+#define MMA_MOVING_MS      (20)    //Time between readings: a batch at 800 Hz
+#define MMA_STILL_READ_MS  (80)    //A sample at 12.5 Hz
+
+typedef enum
+{
+	MMA_RATE_STILL = 0,            //12.5 Hz, data-ready interrupt, one sample a read
+	MMA_RATE_MOVING                //800 Hz, FIFO watermark interrupt, a batch a read
+} mma_rate_t;
+
+//Data registers OUT_X_MSB to OUT_Z_LSB as a burst read leaves them, left-justified 14-bit samples
+typedef struct mma_sample
+{
+	uint8_t x_msb;
+	uint8_t x_lsb;
+	uint8_t y_msb;
+	uint8_t y_lsb;
+	uint8_t z_msb;
+	uint8_t z_lsb;
+} mma_sample_t;
+
+//One drain: F_STATUS as it was when the drain started, then the oldest samples of the FIFO
+typedef struct mma_batch
+{
+	uint8_t f_status;
+	mma_sample_t sample[MMA_FIFO_WATERMARK];
+} mma_batch_t;
+
+//Batches drained by the I2C interrupt, processed by the main loop
+typedef struct mma_ring
+{
+	mma_batch_t batch[MMA_RING_BATCHES];
+	uint8_t samples[MMA_RING_BATCHES];  //Samples in each batch: MMA_FIFO_WATERMARK, or 1 read on data-ready
+	volatile uint32_t drained;      //Batches written, only changed by the producer
+	volatile uint32_t processed;    //Batches released, only changed by the consumer
+} mma_ring_t;
+
+//FIFO counters
+typedef struct mma_fifo_stats
+{
+	uint32_t watermarks;            //Watermark interrupts
+	uint32_t batches;               //Batches drained
+	uint32_t overflows;             //Drains that found the FIFO had dropped samples
+	uint32_t ring_full;             //Watermarks left waiting for the main loop
+} mma_fifo_stats_t;
+
+//Output data rate selection from the readings
+typedef struct mma_motion
+{
+	int16_t reference[3];           //Reading motion is measured from
+	uint32_t still_ms;              //Time since the last motion
+	uint8_t rate;                   //mma_rate_t
+} mma_motion_t;
+
+extern mma_fifo_stats_t mma_fifo_stats;
+
+/*
+ * @name   mma_ring_reset
+ * @brief  Empties the ring
+ *
+ * @param  mma_ring_t *ring
+ * @return void
+ */
+void mma_ring_reset(mma_ring_t *ring);
+
+/*
+ * @name   mma_ring_slot
+ * @brief  Batch the next drain writes, NULL while the ring is full
+ *
+ * A full ring counts in mma_fifo_stats.ring_full
+ *
+ * @param  mma_ring_t *ring
+ * @return mma_batch_t *
+ */
+mma_batch_t *mma_ring_slot(mma_ring_t *ring);
+
+/*
+ * @name   mma_ring_drained
+ * @brief  Hands the batch from mma_ring_slot() to the consumer once its drain is complete
+ *
+ * @param  mma_ring_t *ring, uint8_t samples (in the batch)
+ * @return int 1 when the FIFO still held another batch after this one
+ */
+int mma_ring_drained(mma_ring_t *ring, uint8_t samples);
+
+/*
+ * @name   mma_ring_oldest
+ * @brief  Oldest batch not processed yet, NULL when there is none
+ *
+ * @param  mma_ring_t *ring, uint8_t *samples (in the batch, set when there is one)
+ * @return const mma_batch_t *
+ */
+const mma_batch_t *mma_ring_oldest(mma_ring_t *ring, uint8_t *samples);
+
+/*
+ * @name   mma_ring_processed
+ * @brief  Releases the batch from mma_ring_oldest() for another drain
+ *
+ * @param  mma_ring_t *ring
+ * @return void
+ */
+void mma_ring_processed(mma_ring_t *ring);
+
+/*
+ * @name   mma_axis
+ * @brief  14-bit count of an axis from its data registers
+ *
+ * @param  uint8_t msb, uint8_t lsb
+ * @return int16_t -8192 to 8191, 4096 a g
+ */
+int16_t mma_axis(uint8_t msb, uint8_t lsb);
+
+/*
+ * @name   mma_batch_mean
+ * @brief  Mean of the samples of a batch on each axis, a boxcar low-pass at the full rate
+ *
+ * @param  const mma_batch_t *batch, uint8_t samples (1 to MMA_FIFO_WATERMARK), int16_t *x, int16_t *y, int16_t *z
+ * @return void
+ */
+void mma_batch_mean(const mma_batch_t *batch, uint8_t samples, int16_t *x, int16_t *y, int16_t *z);
+
+/*
+ * @name   mma_motion_reset
+ * @brief  Starts rate selection at a rate, from a reading
+ *
+ * @param  mma_motion_t *motion, mma_rate_t rate, int16_t x, int16_t y, int16_t z
+ * @return void
+ */
+void mma_motion_reset(mma_motion_t *motion, mma_rate_t rate, int16_t x, int16_t y, int16_t z);
+
+/*
+ * @name   mma_motion_update
+ * @brief  Selects the rate from a reading
+ *
+ * Motion is a change of more than MMA_MOTION_COUNTS on any axis since the last motion, so slow
+ * drifts are caught too. Motion selects the fast rate at once; MMA_STILL_MS without it the slow.
+ *
+ * @param  mma_motion_t *motion, int16_t x, int16_t y, int16_t z, uint32_t period_ms (since the last reading)
+ * @return mma_rate_t
+ */
+mma_rate_t mma_motion_update(mma_motion_t *motion, int16_t x, int16_t y, int16_t z, uint32_t period_ms);
+
+#endif /* MMA_FIFO_H_ */
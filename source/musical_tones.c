@@ -2,7 +2,8 @@
  * @file        musical_tones.c
  * @brief       Initialization of all musical waveforms functions
  *
- * Initialization musical waveform function and contains general macros and musical tunes
+ * Initialization musical waveform function and contains general macros, the roll angle player of the tunes in tunes.c
+ * and the theremin player
  *
  * @author      Swathi Venkatachalam
  * @tools       MCUXpresso IDE
@@ -10,16 +11,34 @@
  *
  */
 #include <stdio.h>
-#include <math.h>
+#include <string.h>
 #include "musical_tones.h"
+#include "sequencer.h"
+#include "tunes.h"
 #include "led.h"
+#include "power.h"
+#include "theremin.h"
+#include "accelerometer.h"
+#include "uart.h"
 
-#define DURATION         (100) //to run tune
 #define RESET            (-1)
-#define ONE_SEC_ELAPSE   (16)
+#define FADE_TICKS       (2)             //Theremin fade out before the output is handed back, 125 ms
+#define US_PER_SECOND    (1000000)
+#define MS_PER_SECOND    (1000)
+#define TICKS_PER_SECOND (16)            //SysTick timer ticks
 
-//Array of structures to store contents of each tone
-buffer waveforms[BUFFER_ARRAY_SIZE];
+typedef enum
+{
+	SENSOR_IDLE = 0,
+	SENSOR_SET,          //Pitch set from a reading, not rendered yet
+	SENSOR_RENDERED      //Rendered into the half DMA0 plays next
+} sensor_timing_t;
+
+static int tune_zone = RESET;            //Roll zone of the last pass
+theremin_latency_stats_t theremin_latency_stats;
+static volatile uint32_t sensor_cycles;  //cycle_count() at the watermark of the reading being timed
+static volatile uint8_t sensor_timing = SENSOR_IDLE;
+static volatile uint8_t key_pressed;
 
 /*
  * @name   init_all
@@ -45,220 +64,193 @@ void init_all()
 }
 
 /*
- * @name   play_tune1
- * @brief  Function playes tune 1 notes: A4, D5, D6
+ * @name   play_tune
+ * @brief  Function starts one of the tunes
  *
- * Plays A4, D5, D6 in loop
+ * Hands the tune's pattern to the sequencer and streams it to the DAC, powering the output up
+ * if it was asleep. The sequencer times the notes in output samples from the DMA0 refills.
+ * Returns straight away.
  *
- * @param  void
+ * @param  int tune (1..NUM_TUNES)
  * @return void
  */
-void play_tune1()
+void play_tune(int tune)
 {
-	int waveform_no = ZERO; //To keep track of current tone
-
-	//Pre-calculate the 3 buffers
-	waveforms[WAVEFORM1].frequency = WAVEFORM1_FREQ;
-	waveforms[WAVEFORM2].frequency = WAVEFORM2_FREQ;
-	waveforms[WAVEFORM3].frequency = WAVEFORM3_FREQ;
-
-	for(int i = WAVEFORM1; i < BUFFER_ARRAY_SIZE; i++)
+	if(tune_pattern(tune) == NULL)
+		return;
+	sequencer_play(tune_pattern(tune));
+	if(power_play(sequencer_fill)) //Start DMA0 and TPM0 if not already streaming
 	{
-		tone_to_samples(&waveforms[i]);
-	}
-
-	copy_dma_dacbuffer(&waveforms[WAVEFORM1]); //Copy contents of tone 0
-	TPM0->SC |= TPM_SC_CMOD(ONE); //Start TPM0
-	start_dma_transfer(); //Start DMA0
-	for(int k = ONE; k < DURATION; k++)
-	{
-		if(get_timer() >= ONE) //If 1 second has elapsed
-		{
-			waveform_no++; //Change to next tone
-			copy_dma_dacbuffer(&waveforms[waveform_no]); //Copy next tone contents
-			reset_timer(); //Reset timer
-			start_dma_transfer(); //Start DMA again
-		}
-		if( waveform_no == WAVEFORM3) //If last waveform is reached, reset the waveform
-		{
-			 waveform_no = RESET;
-		}
+		printf("\r\nWoke after %lu ms asleep, first sample %lu us after the wake interrupt\n\r",
+				(unsigned long)power_stats.last_asleep_ms, (unsigned long)power_stats.wake_latency_us);
+		printf("\r\nAsleep %lu ms in total, woken %lu times by the accelerometer, %lu by UART\n\r",
+				(unsigned long)power_stats.asleep_ms, (unsigned long)power_stats.accel_wakes,
+				(unsigned long)power_stats.uart_wakes);
 	}
-	reset_timer();
 }
 
 /*
- * @name   play_tune2
- * @brief  Function playes tune 2 notes: D4, E5, F5
+ * @name   play_tunes
+ * @brief  Function playes tunes based on accelerometer angle
  *
- * Plays D4, E5, F5 in loop
+ * Function playes tunes based on accelerometer angle.
+ * The angle, tune name and LED colour are only updated when the zone changes. The tune is only
+ * (re)started when the sequencer is not already playing it; the roll zone 0 stops it, and once
+ * the note has faded out the core sleeps until the board is tilted or UART0 receives.
  *
- * @param  void
+ * @param  int roll
  * @return void
  */
-void play_tune2()
+void play_tunes(int roll)
 {
-	int waveform_no = ZERO; //To keep track of current tone
+	int zone;
 
-	//Pre-calculate the 3 buffers
-	waveforms[WAVEFORM1].frequency = WAVEFORM4_FREQ;
-	waveforms[WAVEFORM2].frequency = WAVEFORM5_FREQ;
-	waveforms[WAVEFORM3].frequency = WAVEFORM6_FREQ;
-
-	for(int i = WAVEFORM1; i < BUFFER_ARRAY_SIZE; i++)
+	if (roll < 0)
 	{
-		tone_to_samples(&waveforms[i]);
+		roll = -roll;
 	}
-
-	copy_dma_dacbuffer(&waveforms[WAVEFORM1]); //Copy contents of tone 0
-	TPM0->SC |= TPM_SC_CMOD(ONE); //Start TPM0
-	start_dma_transfer(); //Start DMA0
-	for(int k = ONE; k < DURATION; k++)
+	zone = roll_zone(roll);
+	if (zone != tune_zone)
 	{
-		if(get_timer() >= ONE) //If 1 second has elapsed
+		printf("\r\nThe roll angle in degrees is: %d\n\r", roll);
+		switch (zone)
 		{
-			waveform_no++; //Change to next tone
-			copy_dma_dacbuffer(&waveforms[waveform_no]); //Copy next tone contents
-			reset_timer(); //Reset timer
-			start_dma_transfer(); //Start DMA again
-		}
-		if( waveform_no == WAVEFORM3) //If last waveform is reached, reset the waveform
-		{
-			 waveform_no = RESET;
+		case 1:
+			Control_RGB_LEDs(1, 1, 1);
+			break;
+		case 2:
+			Control_RGB_LEDs(1, 1, 0);
+			break;
+		case 3:
+			Control_RGB_LEDs(1, 0, 1);
+			break;
+		case 4:
+			Control_RGB_LEDs(0, 1, 1);
+			break;
+		case ZERO:
+			Control_RGB_LEDs(0, 1, 0);
+			break;
+		default:
+			break;
 		}
+		if (zone > ZERO)
+			printf("\r\nPlaying tune%d\n\r", zone);
+		tune_zone = zone;
+	}
+
+	if (zone == ZERO)
+	{
+		sequencer_stop(); //stops music player
+		power_silence();  //sleeps once the output has faded out
+	}
+	else if (zone > ZERO && sequencer_current() != tune_pattern(zone))
+	{
+		play_tune(zone);
 	}
-	reset_timer();
 }
 
 /*
- * @name   play_tune3
- * @brief  Function playes tune 3 notes: E6, F6, G6
+ * @name   theremin_key
+ * @brief  UART0 receive handler while the theremin plays: any key stops it
  *
- * Plays A4, D5, D6 in loop
- *
- * @param  void
+ * @param  uint8_t byte
  * @return void
  */
-void play_tune3()
+static void theremin_key(uint8_t byte)
 {
-	int waveform_no = ZERO; //To keep track of current tone
-
-	//Pre-calculate the 3 buffers
-	waveforms[WAVEFORM1].frequency = WAVEFORM7_FREQ;
-	waveforms[WAVEFORM2].frequency = WAVEFORM8_FREQ;
-	waveforms[WAVEFORM3].frequency = WAVEFORM9_FREQ;
-
-	for(int i = WAVEFORM1; i < BUFFER_ARRAY_SIZE; i++)
-	{
-		tone_to_samples(&waveforms[i]);
-	}
-
-	copy_dma_dacbuffer(&waveforms[WAVEFORM1]); //Copy contents of tone 0
-	TPM0->SC |= TPM_SC_CMOD(ONE); //Start TPM0
-	start_dma_transfer(); //Start DMA0
-	for(int k = ONE; k < DURATION; k++)
-	{
-		if(get_timer() >= ONE) //If 1 second has elapsed
-		{
-			waveform_no++; //Change to next tone
-			copy_dma_dacbuffer(&waveforms[waveform_no]); //Copy next tone contents
-			reset_timer(); //Reset timer
-			start_dma_transfer(); //Start DMA again
-		}
-		if( waveform_no == WAVEFORM3) //If last waveform is reached, reset the waveform
-		{
-			 waveform_no = RESET;
-		}
-	}
-	reset_timer();
-
+	key_pressed = ONE;
 }
 
 /*
- * @name   play_tune4
- * @brief  Function playes tune 4 notes: D4, D5, D6
+ * @name   theremin_timed_fill
+ * @brief  Audio stream producer: the theremin, timing the reading in flight
  *
- * Plays D4, D5, D6 in loop
+ * A reading set before this refill is rendered by it, into the half DMA0 moves on to at the
+ * next refill, one sample period before its first sample reaches the DAC
  *
- * @param  void
- * @return void
+ * @param  uint16_t *dst, uint32_t count
+ * @return uint32_t samples rendered
  */
-void play_tune4()
+static uint32_t theremin_timed_fill(uint16_t *dst, uint32_t count)
 {
-	int waveform_no = ZERO; //To keep track of current tone
-
-	//Pre-calculate the 3 buffers
-	waveforms[WAVEFORM1].frequency = WAVEFORM10_FREQ;
-	waveforms[WAVEFORM2].frequency = WAVEFORM11_FREQ;
-	waveforms[WAVEFORM3].frequency = WAVEFORM12_FREQ;
-
-	for(int i = WAVEFORM1; i < BUFFER_ARRAY_SIZE; i++)
+	if(sensor_timing == SENSOR_RENDERED)
 	{
-		tone_to_samples(&waveforms[i]);
-	}
+		uint32_t cycles = cycle_count() - sensor_cycles + SystemCoreClock / output_sample_rate;
+		uint32_t us = cycles / (SystemCoreClock / US_PER_SECOND);
 
-	copy_dma_dacbuffer(&waveforms[WAVEFORM1]); //Copy contents of tone 0
-	TPM0->SC |= TPM_SC_CMOD(ONE); //Start TPM0
-	start_dma_transfer(); //Start DMA0
-	for(int k = ONE; k < DURATION; k++)
-	{
-		if(get_timer() >= ONE) //If 1 second has elapsed
-		{
-			waveform_no++; //Change to next tone
-			copy_dma_dacbuffer(&waveforms[waveform_no]); //Copy next tone contents
-			reset_timer(); //Reset timer
-			start_dma_transfer(); //Start DMA again
-		}
-		if( waveform_no == WAVEFORM3) //If last waveform is reached, reset the waveform
-		{
-			 waveform_no = RESET;
-		}
+		theremin_latency_stats.measured++;
+		theremin_latency_stats.last_us = us;
+		theremin_latency_stats.total_us += us;
+		if(us > theremin_latency_stats.worst_us)
+			theremin_latency_stats.worst_us = us;
+		sensor_timing = SENSOR_IDLE;
 	}
+	else if(sensor_timing == SENSOR_SET)
+		sensor_timing = SENSOR_RENDERED;
+	return theremin_fill(dst, count);
 }
 
 /*
- * @name   play_tunes
- * @brief  Function playes tunes based on accelerometer angle
+ * @name   play_theremin
+ * @brief  Function plays the theremin from the accelerometer until a key is pressed
  *
- * Function playes tunes based on accelerometer angle
+ * Sets the theremin's pitch and volume from every batch of the accelerometer FIFO, 50 a second,
+ * holding the accelerometer at 800 Hz while it plays.
+ * One reading at a time is timed from its batch's watermark interrupt, when its newest sample
+ * was taken; the batch mean lags that by half a batch, 10 ms. The voice fades out before the output
+ * goes back to the tunes, which resume from the roll angle once the command processor is left.
  *
- * @param  int roll
+ * @param  uint8_t scale (scale_t), uint32_t glide_ms
  * @return void
  */
-void play_tunes(int roll)
+void play_theremin(uint8_t scale, uint32_t glide_ms)
 {
-	if (roll < 0)
-	{
-		roll = -roll;
-	}
-	printf("\r\nThe roll angle in degrees is: %d\n\r", roll);
-	if (fabs(roll) >= 0 && fabs(roll) <= 5)
-	{
-		Control_RGB_LEDs(0, 1, 0);
-		//stops music player
-	}
-	else if (fabs(roll) > 5 && fabs(roll) <= 45)
-	{
-		Control_RGB_LEDs(1, 1, 1);
-		printf("\r\nPlaying tune1\r");
-		play_tune1();
-	}
-	else if (fabs(roll) > 45 && fabs(roll) <= 90)
-	{
-		Control_RGB_LEDs(1, 1, 0);
-		printf("\r\nPlaying tune2\n\r");
-		play_tune2();
-	}
-	else if (fabs(roll) > 90 && fabs(roll) <= 135)
+	ticktime_t started, fade;
+
+	printf("\r\nTheremin, %s scale, %lu ms glide: roll for pitch, tilt forward or back for volume, any key stops\r\n",
+			theremin_scale_names[scale < SCALE_COUNT ? scale : SCALE_CHROMATIC], (unsigned long)glide_ms);
+	while(!uart_tx_idle());
+
+	sequencer_stop();
+	theremin_start(scale, glide_ms);
+	mma_hold_fast(ONE);
+	memset(&theremin_latency_stats, ZERO, sizeof(theremin_latency_stats));
+	sensor_timing = SENSOR_IDLE;
+	key_pressed = ZERO;
+	uart_set_rx_handler(theremin_key);
+	power_play(theremin_timed_fill);
+
+	reset_timer();
+	started = get_timer();
+	while(!key_pressed)
 	{
-		Control_RGB_LEDs(1, 0, 1);
-		printf("\r\nPlaying tune3\n\r");
-		play_tune3();
+		int32_t roll;
+
+		read_full_xyz();
+		roll = convert_xyz_to_roll();
+		__disable_irq(); //A refill between the two would be timed one half late
+		theremin_set(roll, get_pitch());
+		if(sensor_timing == SENSOR_IDLE)
+		{
+			sensor_cycles = mma_reading_cycles();
+			sensor_timing = SENSOR_SET;
+		}
+		__enable_irq();
 	}
-	else if (fabs(roll) > 135 && fabs(roll) <= 800)
-	{
-		Control_RGB_LEDs(0, 1, 1);
-		printf("\r\nPlaying tune4\n\r");
-		play_tune4();
-	 }
+
+	theremin_set(ZERO, ZERO); //Volume to zero
+	fade = get_timer();
+	while(get_timer() - fade < FADE_TICKS);
+	uart_set_rx_handler(NULL);
+	mma_hold_fast(ZERO);
+	power_play(sequencer_fill);
+
+	printf("\r\nTheremin readings: %lu in %lu ms, pitch changes: %lu\r", (unsigned long)theremin_stats.updates,
+			(unsigned long)((fade - started) * MS_PER_SECOND / TICKS_PER_SECOND), (unsigned long)theremin_stats.note_changes);
+	if(theremin_latency_stats.measured)
+		printf("\r\nSensor to pitch latency: last %lu us, mean %lu us, worst %lu us over %lu readings\r",
+				(unsigned long)theremin_latency_stats.last_us,
+				(unsigned long)(theremin_latency_stats.total_us / theremin_latency_stats.measured),
+				(unsigned long)theremin_latency_stats.worst_us, (unsigned long)theremin_latency_stats.measured);
+	printf("\r\n");
 }
@@ -27,7 +27,17 @@
 
 #define ZERO              (0)
 #define ONE               (1)
-#define BUFFER_ARRAY_SIZE (3) //Number of tones
+
+//Theremin sensor to pitch latency: accelerometer read started to the first sample moving to its pitch
+typedef struct theremin_latency_stats
+{
+	uint32_t measured;   //Updates timed, one at a time
+	uint32_t last_us;
+	uint32_t worst_us;
+	uint32_t total_us;   //For the mean
+} theremin_latency_stats_t;
+
+extern theremin_latency_stats_t theremin_latency_stats;
 
 /*
  * @name   init_all
@@ -41,59 +51,38 @@
 void init_all();
 
 /*
- * @name   play_tune1
- * @brief  Function playes tune 1 notes: A4, D5, D6
- *
- * Plays A4, D5, D6 in loop
- *
- * @param  void
- * @return void
- */
-void play_tune1();
-
-/*
- * @name   play_tune2
- * @brief  Function playes tune 2 notes: D4, E5, F5
- *
- * Plays D4, E5, F5 in loop
- *
- * @param  void
- * @return void
- */
-void play_tune2();
-
-/*
- * @name   play_tune3
- * @brief  Function playes tune 3 notes: E6, F6, G6
+ * @name   play_tune
+ * @brief  Function starts one of the tunes
  *
- * Plays A4, D5, D6 in loop
+ * Tune 1: A4, D5, D6, tune 2: D4, E5, F5, tune 3: E6, F6, G6, tune 4: D4, D5, D6,
+ * looped by the sequencer
  *
- * @param  void
+ * @param  int tune (1..4)
  * @return void
  */
-void play_tune3();
+void play_tune(int tune);
 
 /*
- * @name   play_tune4
- * @brief  Function playes tune 4 notes: D4, D5, D6
+ * @name   play_tunes
+ * @brief  Function playes tunes based on accelerometer angle
  *
- * Plays D4, D5, D6 in loop
+ * Function playes tunes based on accelerometer angle
  *
- * @param  void
+ * @param  int roll
  * @return void
  */
-void play_tune4();
+void play_tunes(int roll);
 
 /*
- * @name   play_tunes
- * @brief  Function playes tunes based on accelerometer angle
+ * @name   play_theremin
+ * @brief  Function plays the theremin from the accelerometer until a key is pressed
  *
- * Function playes tunes based on accelerometer angle
+ * Roll sets the pitch, through the scale quantiser and portamento, and pitch angle the volume
  *
- * @param  int roll
+ * @param  uint8_t scale (scale_t), uint32_t glide_ms
  * @return void
  */
-void play_tunes(int roll);
+void play_theremin(uint8_t scale, uint32_t glide_ms);
 
 
 #endif /* MUSICAL_TONES_H_ */
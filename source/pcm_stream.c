@@ -0,0 +1,282 @@
+/*
+ * @file        pcm_stream.c
+ * @brief       Framed, flow-controlled PCM stream receiver function implementations
+ *
+ * Decodes 8- or 12-bit PCM frames byte by byte, as they arrive from the UART receive interrupt,
+ * straight into a jitter buffer of DAC codes that the audio stream producer plays from.
+ * The receive side only moves head and the play side only moves tail, so the two interrupts
+ * share the buffer without locking.
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       MCUXpresso IDE, gcc
+ */
+
+#include <string.h>
+#include "pcm_stream.h"
+#include "dds.h"
+
+#define NIBBLE_MASK   (0x0F)
+#define NIBBLE_BITS   (4)
+#define BYTE_BITS     (8)
+#define PAIR_BYTES    (3)     //Bytes holding two 12-bit samples
+
+typedef enum
+{
+	RX_SYNC0 = 0,
+	RX_SYNC1,
+	RX_TYPE,
+	RX_COUNT,
+	RX_PAYLOAD,
+	RX_CHECK
+} rx_state_t;
+
+pcm_stream_stats_t pcm_stream_stats;
+static uint16_t buffer[PCM_BUFFER_SIZE];
+static volatile uint32_t head;         //Samples published, moved by pcm_stream_rx() only
+static volatile uint32_t tail;         //Samples played, moved by pcm_stream_fill() only
+static volatile uint32_t frames_seen;  //Frames received whole or dropped, each spent a credit
+static uint32_t granted;               //Running count of frames granted by pcm_stream_credits()
+static volatile uint8_t ended;         //End frame received
+static uint8_t playing;                //Past the prefill, not run dry since
+static uint16_t last;                  //Last sample played, held while buffering
+
+//Decoder state, receive interrupt only
+static uint8_t state, type, count, sum, fits;
+static uint32_t payload_index, payload_bytes, decoded;
+static uint16_t pending;               //12-bit sample split across bytes
+
+/*
+ * @name   pcm_stream_reset
+ * @brief  Empties the buffer, clears the counters and waits for a new stream
+ *
+ * @param  void
+ * @return void
+ */
+void pcm_stream_reset()
+{
+	memset(&pcm_stream_stats, 0, sizeof(pcm_stream_stats));
+	pcm_stream_stats.low_water = PCM_BUFFER_SIZE;
+	head = 0;
+	tail = 0;
+	frames_seen = 0;
+	granted = 0;
+	ended = 0;
+	playing = 0;
+	last = DDS_DAC_MIDSCALE;
+	state = RX_SYNC0;
+}
+
+/*
+ * @name   emit
+ * @brief  Writes a decoded sample after the published ones, if the frame fits
+ *
+ * @param  uint16_t sample (12-bit DAC code)
+ * @return void
+ */
+static void emit(uint16_t sample)
+{
+	if(fits && decoded < count)
+		buffer[(head + decoded) & PCM_BUFFER_MASK] = sample;
+	decoded++;
+}
+
+/*
+ * @name   decode
+ * @brief  Decodes one payload byte
+ *
+ * @param  uint8_t byte
+ * @return void
+ */
+static void decode(uint8_t byte)
+{
+	if(type == PCM_FRAME_8)
+	{
+		emit((uint16_t)byte << NIBBLE_BITS);
+		return;
+	}
+	switch(payload_index % PAIR_BYTES)
+	{
+	case 0:
+		pending = byte;
+		break;
+	case 1:
+		emit(pending | (uint16_t)(byte & NIBBLE_MASK) << BYTE_BITS);
+		pending = byte >> NIBBLE_BITS;
+		break;
+	default:
+		emit(pending | (uint16_t)byte << NIBBLE_BITS);
+		break;
+	}
+}
+
+/*
+ * @name   pcm_stream_rx
+ * @brief  Decodes one received byte
+ *
+ * Samples are written past head as they decode and published by moving head once the
+ * checksum matches, so the player never sees part of a frame. A frame that does not fit is
+ * still parsed, to stay in step with the sender, and dropped as an overrun.
+ *
+ * @param  uint8_t byte
+ * @return void
+ */
+void pcm_stream_rx(uint8_t byte)
+{
+	pcm_stream_stats.bytes++;
+	switch(state)
+	{
+	case RX_SYNC0:
+		if(byte == PCM_SYNC0)
+			state = RX_SYNC1;
+		break;
+	case RX_SYNC1:
+		if(byte == PCM_SYNC1)
+			state = RX_TYPE;
+		else if(byte != PCM_SYNC0)
+			state = RX_SYNC0;
+		break;
+	case RX_TYPE:
+		type = byte;
+		sum = byte;
+		if(type == PCM_FRAME_8 || type == PCM_FRAME_12 || type == PCM_FRAME_END)
+			state = RX_COUNT;
+		else
+		{
+			pcm_stream_stats.bad_frames++;
+			state = RX_SYNC0;
+		}
+		break;
+	case RX_COUNT:
+		count = byte;
+		sum += byte;
+		if(type == PCM_FRAME_END)
+		{
+			state = (count == 0) ? RX_CHECK : RX_SYNC0;
+			if(count != 0)
+				pcm_stream_stats.bad_frames++;
+			break;
+		}
+		if(count == 0 || count > PCM_FRAME_SAMPLES)
+		{
+			frames_seen++;
+			pcm_stream_stats.bad_frames++;
+			state = RX_SYNC0;
+			break;
+		}
+		fits = (PCM_BUFFER_SIZE - (head - tail)) >= count;
+		payload_index = 0;
+		payload_bytes = PCM_FRAME_BYTES(type, count);
+		decoded = 0;
+		state = RX_PAYLOAD;
+		break;
+	case RX_PAYLOAD:
+		sum += byte;
+		decode(byte);
+		if(++payload_index == payload_bytes)
+			state = RX_CHECK;
+		break;
+	default:
+		if(byte != sum)
+			pcm_stream_stats.bad_frames++;
+		else if(type == PCM_FRAME_END)
+			ended = 1;
+		else if(!fits)
+			pcm_stream_stats.overruns++;
+		else
+		{
+			head += count;
+			pcm_stream_stats.frames++;
+		}
+		if(type != PCM_FRAME_END)
+			frames_seen++; //After head, so a grant never sees the credit back before the space taken
+		state = RX_SYNC0;
+		break;
+	}
+}
+
+/*
+ * @name   pcm_stream_fill
+ * @brief  Audio stream producer: plays DAC codes from the buffer
+ *
+ * Holds the last sample until PCM_PREFILL samples are buffered, or the stream has ended, and
+ * again after running dry, so a late sender is heard as a gap rather than a stutter. The level
+ * found at each refill while playing, before the end frame, tracks the jitter margin.
+ *
+ * @param  uint16_t *dst, uint32_t count
+ * @return uint32_t samples rendered (always count)
+ */
+uint32_t pcm_stream_fill(uint16_t *dst, uint32_t count)
+{
+	uint32_t level = head - tail;
+	uint32_t n = 0;
+
+	if(!playing && (level >= PCM_PREFILL || (ended && level)))
+		playing = 1;
+	if(playing)
+	{
+		if(level < pcm_stream_stats.low_water && !ended)
+			pcm_stream_stats.low_water = level;
+		n = (level < count) ? level : count;
+		for(uint32_t i = 0; i < n; i++)
+			dst[i] = buffer[(tail + i) & PCM_BUFFER_MASK];
+		if(n)
+			last = dst[n - 1];
+		tail += n;
+		pcm_stream_stats.played += n;
+		if(n < count)
+		{
+			playing = 0;
+			if(!ended)
+				pcm_stream_stats.underruns++;
+		}
+	}
+	for(uint32_t i = n; i < count; i++)
+		dst[i] = last;
+	return count;
+}
+
+/*
+ * @name   pcm_stream_credits
+ * @brief  Grants the sender the frames of free space and returns the running count granted
+ *
+ * Every frame up to frames_seen plus the whole frames of space now can be taken, as frames in
+ * flight were granted within that space. The count only moves forward, so the space frames in
+ * flight will take is not granted twice. A frame lost in its sync bytes keeps its credit until
+ * the stream is reset.
+ *
+ * @param  void
+ * @return uint32_t frames granted since the reset
+ */
+uint32_t pcm_stream_credits()
+{
+	uint32_t limit = frames_seen; //Read before head: a frame completing in between is then not granted twice
+
+	limit += (PCM_BUFFER_SIZE - (head - tail)) / PCM_FRAME_SAMPLES;
+	if(!ended && (int32_t)(limit - granted) > 0)
+		granted = limit;
+	return granted;
+}
+
+/*
+ * @name   pcm_stream_level
+ * @brief  Samples waiting in the buffer
+ *
+ * @param  void
+ * @return uint32_t samples
+ */
+uint32_t pcm_stream_level()
+{
+	return head - tail;
+}
+
+/*
+ * @name   pcm_stream_ended
+ * @brief  Whether the end frame has arrived and the buffer has played out
+ *
+ * @param  void
+ * @return int 1 when the stream is over
+ */
+int pcm_stream_ended()
+{
+	return ended && head == tail;
+}
@@ -0,0 +1,124 @@
+/*
+ * @file        pcm_stream.h
+ * @brief       Framed, flow-controlled PCM stream receiver declarations
+ *
+ * Decodes 8- or 12-bit PCM frames byte by byte, as they arrive from the UART receive interrupt,
+ * straight into a jitter buffer of DAC codes that the audio stream producer plays from.
+ * Flow control is by credit: the receiver grants the sender one credit per frame of free space
+ * and the sender spends one per frame, so a sender that keeps to its credits never overruns.
+ *
+ * Frame: PCM_SYNC0 PCM_SYNC1 type count payload checksum
+ *  - type     PCM_FRAME_8, PCM_FRAME_12 or PCM_FRAME_END
+ *  - count    samples in the frame, 1..PCM_FRAME_SAMPLES (0 for PCM_FRAME_END)
+ *  - payload  8-bit: one unsigned byte per sample
+ *             12-bit: two samples in three bytes, lo8(a), hi4(a) | lo4(b) << 4, hi8(b);
+ *             an odd count pads the last sample's three bytes
+ *  - checksum 8-bit sum of type, count and payload
+ * Credits go back as single bytes holding the running count of frames granted, modulo 256. The
+ * sender may send frames until its own count of frames sent reaches it. A repeated credit byte
+ * grants nothing new, so the receiver can resend it and a lost one only costs time.
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       MCUXpresso IDE, gcc
+ */
+
+#ifndef PCM_STREAM_H_
+#define PCM_STREAM_H_
+
+#include <stdint.h>
+
+#define PCM_SYNC0          (0xA5)
+#define PCM_SYNC1          (0x5A)
+#define PCM_FRAME_8        (1)
+#define PCM_FRAME_12       (2)
+#define PCM_FRAME_END      (3)
+#define PCM_FRAME_SAMPLES  (64)                          //Largest frame, one credit
+#define PCM_FRAME_BYTES(type, n)  ((type) == PCM_FRAME_8 ? (n) : (((n) + 1) / 2) * 3)
+#define PCM_OVERHEAD       (5)                           //Sync, type, count and checksum bytes
+#define PCM_BAUD_RATE      (460800)                      //UART0 rate while streaming
+#define PCM_UART_BITS      (11)                          //Line bits per byte: start, 8 data, even parity, stop
+
+#ifndef PCM_BUFFER_BITS
+#define PCM_BUFFER_BITS    (11)                          //Jitter buffer of 2048 samples, 128 ms at 16 kHz
+#endif
+#define PCM_BUFFER_SIZE    (1 << PCM_BUFFER_BITS)
+#define PCM_BUFFER_MASK    (PCM_BUFFER_SIZE - 1)
+#define PCM_PREFILL        (PCM_BUFFER_SIZE / 2)        //Samples buffered before playing starts or resumes
+#define PCM_WINDOW         (PCM_BUFFER_SIZE / PCM_FRAME_SAMPLES)  //Credits when the buffer is empty, under 256
+
+//Stream counters, printed when the stream ends
+typedef struct pcm_stream_stats
+{
+	uint32_t bytes;         //Bytes received
+	uint32_t frames;        //Frames accepted into the buffer
+	uint32_t bad_frames;    //Frames dropped for a bad checksum, type or count
+	uint32_t overruns;      //Frames dropped because the buffer had no room: the sender overspent its credits
+	uint32_t underruns;     //Times the buffer ran dry while playing; each rebuffers PCM_PREFILL samples
+	uint32_t played;        //Samples played from the buffer
+	uint32_t low_water;     //Fewest samples buffered at a refill while playing, the jitter margin left
+} pcm_stream_stats_t;
+
+extern pcm_stream_stats_t pcm_stream_stats;
+
+/*
+ * @name   pcm_stream_reset
+ * @brief  Empties the buffer, clears the counters and waits for a new stream
+ *
+ * @param  void
+ * @return void
+ */
+void pcm_stream_reset();
+
+/*
+ * @name   pcm_stream_rx
+ * @brief  Decodes one received byte
+ *
+ * Call from the UART receive interrupt. Samples are written into the buffer as they decode and
+ * published when the frame's checksum matches.
+ *
+ * @param  uint8_t byte
+ * @return void
+ */
+void pcm_stream_rx(uint8_t byte);
+
+/*
+ * @name   pcm_stream_fill
+ * @brief  Audio stream producer: plays DAC codes from the buffer
+ *
+ * Holds the last sample until PCM_PREFILL samples are buffered, and again after running dry
+ *
+ * @param  uint16_t *dst, uint32_t count
+ * @return uint32_t samples rendered (always count)
+ */
+uint32_t pcm_stream_fill(uint16_t *dst, uint32_t count);
+
+/*
+ * @name   pcm_stream_credits
+ * @brief  Grants the sender the frames of free space and returns the running count granted
+ *
+ * The caller sends the low byte to the sender when it changes, and again now and then
+ *
+ * @param  void
+ * @return uint32_t frames granted since the reset
+ */
+uint32_t pcm_stream_credits();
+
+/*
+ * @name   pcm_stream_level
+ * @brief  Samples waiting in the buffer
+ *
+ * @param  void
+ * @return uint32_t samples
+ */
+uint32_t pcm_stream_level();
+
+/*
+ * @name   pcm_stream_ended
+ * @brief  Whether the end frame has arrived and the buffer has played out
+ *
+ * @param  void
+ * @return int 1 when the stream is over
+ */
+int pcm_stream_ended();
+
+#endif /* PCM_STREAM_H_ */
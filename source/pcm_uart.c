@@ -0,0 +1,87 @@
+/*
+ * @file        pcm_uart.c
+ * @brief       PCM streaming from the host over UART0 function implementations
+ *
+ * Switches UART0 to PCM_BAUD_RATE, hands received bytes to the pcm_stream frame decoder in the
+ * receive interrupt and plays the jitter buffer through the DAC0 DMA ring. Bytes never pass
+ * through the receive queue and the refill copies buffered samples, so the only work per byte is
+ * the decoder. The foreground loop sends flow control credits as the buffer drains.
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       MCUXpresso IDE
+ */
+
+#include <stdio.h>
+#include <musical_tones.h>
+#include "pcm_uart.h"
+#include "uart.h"
+#include "dma.h"
+#include "power.h"
+#include "sequencer.h"
+#include "systick.h"
+
+#define STDOUT_HANDLE  (1)
+
+/*
+ * @name   pcm_uart_stream
+ * @brief  Function plays one PCM stream from the host
+ *
+ * The console message goes out at the old baud rate before UART0 switches. The output starts on
+ * the jitter buffer straight away and holds midscale until PCM_PREFILL samples have arrived.
+ * Tunes resume from the roll angle once the command processor is left.
+ *
+ * @param  uint32_t rate (Hz, a rate audio_set_sample_rate() accepts)
+ * @return int 1 when the stream ran, 0 for an unsupported rate
+ */
+int pcm_uart_stream(uint32_t rate)
+{
+	uint32_t original = output_sample_rate, bytes = ZERO, granted, sent = ZERO;
+	ticktime_t last_byte, last_credit, timeout = PCM_START_TICKS;
+
+	if(!audio_set_sample_rate(rate))
+		return ZERO;
+	printf("\r\nPCM stream at %lu Hz: send frames at %lu baud\r\n", (unsigned long)rate, (unsigned long)PCM_BAUD_RATE);
+	while(!uart_tx_idle());
+
+	sequencer_stop();
+	pcm_stream_reset();
+	uart_set_rx_handler(pcm_stream_rx);
+	uart_set_baud(PCM_BAUD_RATE);
+	power_play(pcm_stream_fill);
+
+	reset_timer();
+	last_byte = last_credit = get_timer();
+	while(!pcm_stream_ended())
+	{
+		granted = pcm_stream_credits();
+		if(granted != sent || get_timer() != last_credit) //Repeated once a tick in case one was missed
+		{
+			uint8_t credit = (uint8_t)granted;
+
+			__sys_write(STDOUT_HANDLE, (char *)&credit, ONE);
+			sent = granted;
+			last_credit = get_timer();
+		}
+		if(pcm_stream_stats.bytes != bytes)
+		{
+			bytes = pcm_stream_stats.bytes;
+			last_byte = get_timer();
+			timeout = PCM_IDLE_TICKS;
+		}
+		else if(get_timer() - last_byte >= timeout)
+			break;
+	}
+
+	while(!uart_tx_idle());
+	uart_set_baud(BAUD_RATE);
+	uart_set_rx_handler(NULL);
+	power_play(sequencer_fill); //Silent until a tune starts, then power_silence() can sleep
+	audio_set_sample_rate(original);
+
+	printf("\r\nPCM frames: %lu, bad: %lu, overruns: %lu, underruns: %lu\r", (unsigned long)pcm_stream_stats.frames,
+			(unsigned long)pcm_stream_stats.bad_frames, (unsigned long)pcm_stream_stats.overruns,
+			(unsigned long)pcm_stream_stats.underruns);
+	printf("\r\nPCM samples played: %lu, lowest buffer %lu of %d\r\n", (unsigned long)pcm_stream_stats.played,
+			(unsigned long)pcm_stream_stats.low_water, PCM_BUFFER_SIZE);
+	return ONE;
+}
@@ -0,0 +1,34 @@
+/*
+ * @file        pcm_uart.h
+ * @brief       PCM streaming from the host over UART0 function declarations
+ *
+ * Switches UART0 to PCM_BAUD_RATE, hands received bytes to the pcm_stream frame decoder in the
+ * receive interrupt and plays the jitter buffer through the DAC0 DMA ring, sending flow control
+ * credits back until the host ends the stream or goes quiet
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       MCUXpresso IDE
+ */
+
+#ifndef PCM_UART_H_
+#define PCM_UART_H_
+
+#include <stdint.h>
+#include "pcm_stream.h"
+
+#define PCM_START_TICKS   (160)   //Wait for the host's first byte, 10 s of 62.5 ms ticks
+#define PCM_IDLE_TICKS    (16)    //Silence on the line that ends the stream, 1 s
+
+/*
+ * @name   pcm_uart_stream
+ * @brief  Function plays one PCM stream from the host
+ *
+ * Blocks until the end frame has played, or the host sends nothing for PCM_IDLE_TICKS, then
+ * restores the console baud rate, the tunes and the output sample rate
+ *
+ * @param  uint32_t rate (Hz, a rate audio_set_sample_rate() accepts)
+ * @return int 1 when the stream ran, 0 for an unsupported rate
+ */
+int pcm_uart_stream(uint32_t rate);
+
+#endif /* PCM_UART_H_ */
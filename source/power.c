@@ -0,0 +1,295 @@
+/*
+ * @file        power.c
+ * @brief       Silence-aware low power audio output function implementations
+ *
+ * While no tune plays the audio path is faded out, TPM0 and DMA0 are stopped, DAC0 is powered
+ * down and the core sleeps in VLPS until the accelerometer motion interrupt or UART0 input wakes it.
+ * The DAC output is ramped between 0 V and midscale so powering it down and up does not click.
+ * The MCG runs in FEI after sysclock_init(), which VLPS exit restores by itself.
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       MCUXpresso IDE
+ * @references  KL25 Sub-Family Reference Manual, chapters 15 (SMC) and 33 (LPTMR)
+ */
+
+#include <musical_tones.h>
+#include "power.h"
+#include "mixer.h"
+#include "effects.h"
+#include "uart.h"
+#include "accelerometer.h"
+#include "i2c.h"
+#include "MKL25Z4.h"
+
+#define DAC_MAX_CODE      (4095)
+#define STOPM_VLPS        (2)     //SMC_PMCTRL stop mode: very low power stop
+#define LPTMR_LPO         (1)     //LPTMR0 prescaler clock select: 1 kHz LPO, runs in VLPS
+#define MS_PER_SECOND     (1000)
+#define US_PER_SECOND     (1000000)
+#define PORT_IRQ_FALLING  (0xA)   //PORT_PCR IRQC: interrupt on falling edge
+#define PRIORITY          (3)
+#define INT1_MASK         (1UL << MMA_INT1_POS)
+#define INT2_MASK         (1UL << MMA_INT2_POS)
+
+typedef enum
+{
+	WAKE_NONE = 0,
+	WAKE_ACCEL,
+	WAKE_UART
+} wake_t;
+
+power_stats_t power_stats;
+static audio_fill_t source;                              //Producer of the tune being played
+static volatile int32_t dac_bias = ZERO;                 //DC level the stream is centred on, DAC code
+static volatile int32_t bias_target = ZERO;
+static volatile uint32_t settled_at;                     //Sample clock when the ramp has reached the DAC
+static int output_off = ONE;                             //Stream stopped and DAC0 powered down
+static volatile uint8_t wake_source = WAKE_NONE;
+static volatile uint32_t wake_cycles;                    //cycle_count() at the wake interrupt
+static int wake_pending = ZERO;                          //Woken, first sample not played yet
+static volatile uint32_t asleep_seconds;
+
+/*
+ * @name   init_power
+ * @brief  Function initializes the low power wake sources
+ *
+ * PMPROT is write once after reset, so VLPS is allowed here and nowhere else.
+ * LPTMR0 counts the 1 kHz LPO with a compare every second; PTA14 interrupts on the falling edge
+ * of the accelerometer's active low INT1, through the PORTA interrupt init_mma() enabled for the
+ * FIFO. DAC0 is powered down until the first tune.
+ *
+ * @param  void
+ * @return void
+ */
+void init_power()
+{
+	SMC->PMPROT = SMC_PMPROT_AVLP_MASK;
+
+	SIM->SCGC5 |= SIM_SCGC5_LPTMR_MASK | SIM_SCGC5_PORTA_MASK;
+	LPTMR0->CSR = ZERO;
+	LPTMR0->PSR = LPTMR_PSR_PBYP_MASK | LPTMR_PSR_PCS(LPTMR_LPO);
+	LPTMR0->CMR = LPTMR_CMR_COMPARE(MS_PER_SECOND - ONE);
+	NVIC_SetPriority(LPTMR0_IRQn, PRIORITY);
+	NVIC_ClearPendingIRQ(LPTMR0_IRQn);
+	NVIC_EnableIRQ(LPTMR0_IRQn);
+
+	PORTA->PCR[MMA_INT1_POS] = PORT_PCR_ISF_MASK | PORT_PCR_MUX(ONE) | PORT_PCR_IRQC(PORT_IRQ_FALLING);
+	mma_enable_motion_wake();
+
+	DAC0->DAT[ZERO].DATL = ZERO;
+	DAC0->DAT[ZERO].DATH = ZERO;
+	DAC0->C0 &= ~DAC_C0_DACEN_MASK;
+}
+
+/*
+ * @name   ramp_step
+ * @brief  Bias change per sample for a POWER_RAMP_MS ramp at the output sample rate
+ *
+ * @param  void
+ * @return int32_t DAC codes per sample
+ */
+static int32_t ramp_step()
+{
+	int32_t step = (DDS_DAC_MIDSCALE * MS_PER_SECOND) / (int32_t)(output_sample_rate * POWER_RAMP_MS);
+
+	return step ? step : ONE;
+}
+
+/*
+ * @name   power_fill
+ * @brief  Audio stream producer: the tune, moved onto the ramping DC bias
+ *
+ * Costs one comparison per refill once the bias is at midscale. When the bias reaches its target
+ * the sample clock at which that sample leaves the DAC is noted for power_silence().
+ *
+ * @param  uint16_t *dst, uint32_t count
+ * @return uint32_t samples rendered
+ */
+static uint32_t power_fill(uint16_t *dst, uint32_t count)
+{
+	uint32_t produced = source(dst, count);
+	int32_t bias = dac_bias;
+	int32_t target = bias_target;
+	int32_t step;
+
+	if(bias == DDS_DAC_MIDSCALE && target == DDS_DAC_MIDSCALE)
+		return produced;
+
+	step = ramp_step();
+	for(uint32_t i = ZERO; i < produced; i++)
+	{
+		int32_t s;
+
+		if(bias < target)
+			bias = (bias + step > target) ? target : bias + step;
+		else if(bias > target)
+			bias = (bias - step < target) ? target : bias - step;
+		s = (int32_t)dst[i] - DDS_DAC_MIDSCALE + bias;
+		dst[i] = (uint16_t)((s < ZERO) ? ZERO : (s > DAC_MAX_CODE) ? DAC_MAX_CODE : s);
+	}
+	if(bias == target && dac_bias != target)
+		settled_at = audio_sample_clock + AUDIO_LATENCY;
+	dac_bias = bias;
+	return produced;
+}
+
+/*
+ * @name   power_play
+ * @brief  Function streams a producer to DAC0, powering the output up if it was down
+ *
+ * DAC0 comes up at code 0, where it went down, and the bias ramps to midscale under the tune.
+ * The stream starts TPM0 from zero, so the first sample reaches the DAC exactly one TPM0 period
+ * after audio_start_cycles; the time from the wake interrupt to that sample is kept in power_stats.
+ *
+ * @param  audio_fill_t fill
+ * @return int 1 when this was the first tune after a sleep; power_stats then holds its latency
+ */
+int power_play(audio_fill_t fill)
+{
+	int woke = ZERO;
+
+	source = fill;
+	bias_target = DDS_DAC_MIDSCALE;
+	if(output_off)
+	{
+		dac_bias = ZERO;
+		DAC0->C0 |= DAC_C0_DACEN_MASK;
+		output_off = ZERO;
+	}
+	audio_stream_start(power_fill);
+
+	if(wake_pending)
+	{
+		uint32_t first_sample = audio_start_cycles + SystemCoreClock / output_sample_rate;
+
+		power_stats.wake_latency_us = (first_sample - wake_cycles) / (SystemCoreClock / US_PER_SECOND);
+		wake_pending = ZERO;
+		woke = ONE;
+	}
+	return woke;
+}
+
+/*
+ * @name   sleep_until_wake
+ * @brief  Function sleeps in VLPS until the accelerometer or UART0 wakes the core
+ *
+ * UART0 and I2C0 are drained first since their clocks stop in VLPS; the accelerometer FIFO is
+ * not drained while asleep and keeps its newest samples. The motion latch is cleared
+ * after its pin flag, so an event in between still leaves the flag set. Interrupts are masked around the
+ * wake check: WFI still wakes on a pending interrupt, so a wake between check and WFI is not lost.
+ * LPTMR0 seconds wake the core too and it goes straight back to sleep.
+ *
+ * @param  void
+ * @return void
+ */
+static void sleep_until_wake()
+{
+	uint32_t asleep;
+
+	while(!uart_tx_idle());
+	mma_fifo_pause();
+	PORTA->PCR[MMA_INT1_POS] |= PORT_PCR_ISF_MASK;
+	mma_clear_motion();
+	while(!i2c_idle()); //A drain in flight would stop mid-byte in VLPS
+	UART0->S2 |= UART0_S2_RXEDGIF_MASK;
+	UART0->BDH |= UART0_BDH_RXEDGIE_MASK;
+
+	wake_source = WAKE_NONE;
+	asleep_seconds = ZERO;
+	LPTMR0->CSR = LPTMR_CSR_TIE_MASK | LPTMR_CSR_TEN_MASK;
+	SMC->PMCTRL = (SMC->PMCTRL & ~SMC_PMCTRL_STOPM_MASK) | SMC_PMCTRL_STOPM(STOPM_VLPS);
+	(void)SMC->PMCTRL; //Read back so the mode is set before WFI
+	SCB->SCR |= SCB_SCR_SLEEPDEEP_Msk;
+	power_stats.sleeps++;
+
+	__disable_irq();
+	while(wake_source == WAKE_NONE)
+	{
+		__WFI();
+		__enable_irq(); //The wake interrupt runs here
+		__disable_irq();
+		if(wake_source == WAKE_NONE && !(UART0->BDH & UART0_BDH_RXEDGIE_MASK)) //Disarmed by UART0_IRQHandler
+		{
+			wake_cycles = cycle_count();
+			wake_source = WAKE_UART;
+		}
+	}
+	__enable_irq();
+
+	SCB->SCR &= ~SCB_SCR_SLEEPDEEP_Msk;
+	LPTMR0->CNR = ZERO; //Any write latches the counter for reading
+	asleep = asleep_seconds * MS_PER_SECOND + (LPTMR0->CNR & LPTMR_CNR_COUNTER_MASK);
+	LPTMR0->CSR = ZERO;
+	UART0->BDH &= ~UART0_BDH_RXEDGIE_MASK;
+	mma_fifo_resume();
+
+	power_stats.last_asleep_ms = asleep;
+	power_stats.asleep_ms += asleep;
+	if(wake_source == WAKE_ACCEL)
+		power_stats.accel_wakes++;
+	else
+		power_stats.uart_wakes++;
+	wake_pending = ONE;
+}
+
+/*
+ * @name   power_silence
+ * @brief  Function fades the output out and sleeps until woken
+ *
+ * Waits for the mixer's last release and the echo's last repeat, ramps the bias to 0 V and
+ * waits until the ramp has left the ring before stopping TPM0 and DMA0 and powering DAC0 down;
+ * a stream already stopped by a benchmark has nothing to ramp. A wake that does not
+ * lead to a tune sleeps again on the next call.
+ *
+ * @param  void
+ * @return void
+ */
+void power_silence()
+{
+	if(!output_off)
+	{
+		if(mixer_active_voices() || effects_ringing())
+			return;
+		bias_target = ZERO;
+		if(audio_stream_running() && (dac_bias != ZERO || (int32_t)(audio_sample_clock - settled_at) < ZERO))
+			return;
+		audio_stream_stop();
+		DAC0->C0 &= ~DAC_C0_DACEN_MASK;
+		output_off = ONE;
+	}
+	sleep_until_wake();
+}
+
+/*
+ * @name   PORTA_IRQHandler
+ * @brief  PORTA interrupt handler, accelerometer INT1 wake and INT2 FIFO watermark or data-ready
+ *
+ * INT1 only matters while asleep; sleep_until_wake() clears its flag and latch before sleeping
+ *
+ * @param  void
+ * @return void
+ */
+void PORTA_IRQHandler()
+{
+	if(PORTA->ISFR & INT1_MASK)
+	{
+		PORTA->ISFR = INT1_MASK; //Write 1 to clear
+		wake_cycles = cycle_count();
+		wake_source = WAKE_ACCEL;
+	}
+	if(PORTA->ISFR & INT2_MASK)
+		mma_fifo_irq();
+}
+
+/*
+ * @name   LPTMR0_IRQHandler
+ * @brief  LPTMR0 interrupt handler, counts whole seconds asleep
+ *
+ * @param  void
+ * @return void
+ */
+void LPTMR0_IRQHandler()
+{
+	LPTMR0->CSR |= LPTMR_CSR_TCF_MASK; //Write 1 to clear
+	asleep_seconds++;
+}
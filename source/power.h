@@ -0,0 +1,90 @@
+/*
+ * @file        power.h
+ * @brief       Silence-aware low power audio output function declarations
+ *
+ * While no tune plays the audio path is faded out, TPM0 and DMA0 are stopped, DAC0 is powered
+ * down and the core sleeps in VLPS until the accelerometer motion interrupt or UART0 input wakes it.
+ * The DAC output is ramped between 0 V and midscale so powering it down and up does not click.
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       MCUXpresso IDE
+ * @references  KL25 Sub-Family Reference Manual, chapters 15 (SMC) and 33 (LPTMR)
+ */
+
+#ifndef POWER_H_
+#define POWER_H_
+
+#include <stdint.h>
+#include "dma.h"
+
+#define POWER_RAMP_MS     (10)   //DAC output ramp between 0 V and midscale
+#define MMA_INT1_POS      (14)   //PTA14, accelerometer INT1 on the FRDM-KL25Z
+
+//Sleep counters, printed when a tune wakes the output
+typedef struct power_stats
+{
+	uint32_t sleeps;           //Times the core entered VLPS
+	uint32_t accel_wakes;      //Wakes by the accelerometer motion interrupt
+	uint32_t uart_wakes;       //Wakes by UART0 receive activity
+	uint32_t asleep_ms;        //Total time in VLPS, counted by LPTMR0 from the 1 kHz LPO
+	uint32_t last_asleep_ms;   //Length of the last sleep
+	uint32_t wake_latency_us;  //Last wake interrupt to the first DAC sample of the tune that followed
+} power_stats_t;
+
+extern power_stats_t power_stats;
+
+/*
+ * @name   init_power
+ * @brief  Function initializes the low power wake sources
+ *
+ * Allows VLPS, sets up LPTMR0 to time sleeps and PTA14 for the accelerometer motion interrupt,
+ * and powers DAC0 down until the first tune. Call after init_all(), init_mma() and uart_init().
+ *
+ * @param  void
+ * @return void
+ */
+void init_power();
+
+/*
+ * @name   power_play
+ * @brief  Function streams a producer to DAC0, powering the output up if it was down
+ *
+ * Replaces audio_stream_start() for tunes
+ *
+ * @param  audio_fill_t fill
+ * @return int 1 when this was the first tune after a sleep; power_stats then holds its latency
+ */
+int power_play(audio_fill_t fill);
+
+/*
+ * @name   power_silence
+ * @brief  Function fades the output out and sleeps until woken
+ *
+ * Call repeatedly while nothing should play. Returns straight away until the release of the last
+ * note and the fade out have played; then stops the stream, powers DAC0 down, sleeps in VLPS and
+ * returns once the accelerometer or UART0 wakes the core.
+ *
+ * @param  void
+ * @return void
+ */
+void power_silence();
+
+/*
+ * @name   PORTA_IRQHandler
+ * @brief  PORTA interrupt handler, accelerometer INT1 wake
+ *
+ * @param  void
+ * @return void
+ */
+void PORTA_IRQHandler();
+
+/*
+ * @name   LPTMR0_IRQHandler
+ * @brief  LPTMR0 interrupt handler, counts whole seconds asleep
+ *
+ * @param  void
+ * @return void
+ */
+void LPTMR0_IRQHandler();
+
+#endif /* POWER_H_ */
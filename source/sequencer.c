@@ -0,0 +1,215 @@
+/*
+ * @file        sequencer.c
+ * @brief       Pattern sequencer function implementations
+ *
+ * Plays pattern tables of note, length in ticks and velocity through the mixer at a tempo,
+ * optionally looping. Time is counted in output samples: the sequencer is the audio stream
+ * producer, so it is advanced by the DMA0 refills and every note starts on an exact sample,
+ * with no drift between rhythm and pitch.
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       MCUXpresso IDE, gcc
+ */
+
+#include <stddef.h>
+#include "sequencer.h"
+#include "mixer.h"
+#include "tone_cache.h"
+#include "effects.h"
+
+#define SECONDS_PER_MINUTE  (60)
+#define SAMPLE_SHIFT        (8)                              //Step timing is kept in Q8 samples
+#define SAMPLE_ONE          ((uint32_t)1 << SAMPLE_SHIFT)
+#define NO_NOTE             (0xFF)
+
+static const seq_pattern_t *volatile pattern = NULL;  //NULL while stopped or being set up
+static const tone_t *step_tones[SEQ_MAX_STEPS];        //Resolved by sequencer_play()
+static uint8_t step;                                   //Step sounding
+static uint8_t sounding = NO_NOTE;                     //Mixer note id of the step sounding
+static uint32_t samples_per_tick;                      //At the pattern tempo, Q8
+static uint32_t until_next;                            //Samples until the next step, Q8
+
+/*
+ * @name   tick_length
+ * @brief  Length of one tick of a pattern at the output sample rate
+ *
+ * @param  const seq_pattern_t *p
+ * @return uint32_t samples, Q8
+ */
+static uint32_t tick_length(const seq_pattern_t *p)
+{
+	uint32_t length = (uint32_t)(((uint64_t)output_sample_rate * SECONDS_PER_MINUTE << SAMPLE_SHIFT) /
+			((uint32_t)((p->tempo_bpm < SEQ_MIN_BPM) ? SEQ_MIN_BPM : p->tempo_bpm) * SEQ_TICKS_PER_BEAT));
+
+	return (length < SAMPLE_ONE) ? SAMPLE_ONE : length; //At most one step per sample
+}
+
+/*
+ * @name   start_step
+ * @brief  Releases the previous note and starts a step
+ *
+ * The mixer note id is the step index, so a note off never hits a newer note.
+ * The step length is added to the time left, so the fraction of a sample the previous step
+ * ended on carries over and the tempo does not drift.
+ *
+ * @param  const seq_pattern_t *p, uint8_t index
+ * @return void
+ */
+static void start_step(const seq_pattern_t *p, uint8_t index)
+{
+	const seq_step_t *s = &p->steps[index];
+
+	if(sounding != NO_NOTE)
+		mixer_note_off(sounding);
+	sounding = NO_NOTE;
+	if(s->frequency != SEQ_REST)
+	{
+		mixer_note_on(index, step_tones[index], s->velocity);
+		sounding = index;
+	}
+	step = index;
+	until_next += (s->ticks ? s->ticks : 1) * samples_per_tick;
+}
+
+/*
+ * @name   sequencer_play
+ * @brief  Starts a pattern from its first step
+ *
+ * The pattern pointer is cleared first so the clock interrupt leaves the state alone while it
+ * is rebuilt, and published last
+ *
+ * @param  const seq_pattern_t *next
+ * @return void
+ */
+void sequencer_play(const seq_pattern_t *next)
+{
+	sequencer_stop();
+	if(next == NULL || next->length == 0 || next->length > SEQ_MAX_STEPS)
+		return;
+
+	for(int i = 0; i < next->length; i++)
+	{
+		step_tones[i] = (next->steps[i].frequency == SEQ_REST) ? NULL :
+				tone_cache_get(next->steps[i].frequency, next->wave);
+	}
+	if(next->envelope != NULL)
+		mixer_set_envelope(next->envelope);
+	samples_per_tick = tick_length(next);
+	until_next = 0;
+	start_step(next, 0);
+	pattern = next;
+}
+
+/*
+ * @name   sequencer_stop
+ * @brief  Stops the pattern and releases its note
+ *
+ * @param  void
+ * @return void
+ */
+void sequencer_stop()
+{
+	pattern = NULL;
+	if(sounding != NO_NOTE)
+		mixer_note_off(sounding);
+	sounding = NO_NOTE;
+}
+
+/*
+ * @name   sequencer_set_sample_rate
+ * @brief  Moves the synthesis to a new output sample rate while playing
+ *
+ * Recomputes the cached tones in place, rescales the pitch and envelopes of the sounding voices,
+ * the effects and the time left in the current step, so pitch, envelope times, filter cutoff,
+ * echo delay and tempo carry on unchanged.
+ * The caller keeps sequencer_fill() from running meanwhile and switches the DAC timer with it.
+ *
+ * @param  uint32_t rate (Hz)
+ * @return void
+ */
+void sequencer_set_sample_rate(uint32_t rate)
+{
+	uint32_t old_rate = output_sample_rate;
+	const seq_pattern_t *p = pattern;
+
+	if(rate == 0 || rate == old_rate)
+		return;
+	output_sample_rate = rate;
+	tone_cache_retune();
+	mixer_rescale(old_rate, rate);
+	effects_set_sample_rate(rate);
+	if(p != NULL)
+	{
+		samples_per_tick = tick_length(p);
+		until_next = (uint32_t)(((uint64_t)until_next * rate + (old_rate >> 1)) / old_rate);
+	}
+}
+
+/*
+ * @name   sequencer_current
+ * @brief  Pattern being played
+ *
+ * @param  void
+ * @return const seq_pattern_t *, NULL when stopped
+ */
+const seq_pattern_t *sequencer_current()
+{
+	return pattern;
+}
+
+/*
+ * @name   next_step
+ * @brief  Moves to the next step, looping or stopping at the end of the pattern
+ *
+ * @param  const seq_pattern_t *p
+ * @return void
+ */
+static void next_step(const seq_pattern_t *p)
+{
+	if(step + 1 < p->length)
+		start_step(p, step + 1);
+	else if(p->loop)
+		start_step(p, 0);
+	else
+		sequencer_stop();
+}
+
+/*
+ * @name   sequencer_fill
+ * @brief  Audio stream producer: renders the mixer, starting each step on its exact sample
+ *
+ * Renders up to the next step boundary, starts the step, and carries on. Called from
+ * DMA0_IRQHandler, so the sample count it advances by is the DMA0 completion count.
+ *
+ * @param  uint16_t *dst, uint32_t count
+ * @return uint32_t samples rendered (always count)
+ */
+uint32_t sequencer_fill(uint16_t *dst, uint32_t count)
+{
+	uint32_t remaining = count;
+
+	while(remaining)
+	{
+		const seq_pattern_t *p = pattern;
+		uint32_t n = remaining;
+
+		if(p != NULL)
+		{
+			uint32_t due = until_next >> SAMPLE_SHIFT; //Whole samples before the next step starts
+
+			if(due == 0)
+			{
+				next_step(p);
+				continue;
+			}
+			if(due < n)
+				n = due;
+		}
+		mixer_fill(dst, n);
+		if(p != NULL)
+			until_next -= n << SAMPLE_SHIFT;
+		dst += n;
+		remaining -= n;
+	}
+	return count;
+}
@@ -0,0 +1,99 @@
+/*
+ * @file        sequencer.h
+ * @brief       Pattern sequencer function declarations
+ *
+ * Plays pattern tables of note, length in ticks and velocity through the mixer at a tempo,
+ * optionally looping. Time is counted in output samples: the sequencer is the audio stream
+ * producer, so it is advanced by the DMA0 refills and every note starts on an exact sample,
+ * with no drift between rhythm and pitch.
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       MCUXpresso IDE, gcc
+ */
+
+#ifndef SEQUENCER_H_
+#define SEQUENCER_H_
+
+#include <stdint.h>
+#include "envelope.h"
+
+#define SEQ_TICKS_PER_BEAT  (4)    //Step lengths are in sixteenth notes
+#define SEQ_MAX_STEPS       (32)   //Longest pattern
+#define SEQ_REST            (0)    //Step frequency of a rest
+#define SEQ_MIN_BPM         (12)   //Slowest tempo; keeps a tick inside the Q8 sample counter
+#define SEQ_LENGTH(steps)   ((uint8_t)(sizeof(steps) / sizeof((steps)[0])))
+
+//One step of a pattern, 4 bytes
+typedef struct seq_step
+{
+	uint16_t frequency;  //Hz, SEQ_REST for silence
+	uint8_t ticks;       //Step length in ticks
+	uint8_t velocity;    //1..127
+} seq_step_t;
+
+//A tune: steps and how to play them
+typedef struct seq_pattern
+{
+	const seq_step_t *steps;
+	uint8_t length;                  //Steps, at most SEQ_MAX_STEPS
+	uint8_t loop;                    //Start again after the last step
+	uint8_t wave;                    //wave_t of every note
+	uint16_t tempo_bpm;              //Beats per minute, SEQ_TICKS_PER_BEAT ticks each, at least SEQ_MIN_BPM
+	const adsr_params_t *envelope;
+} seq_pattern_t;
+
+/*
+ * @name   sequencer_play
+ * @brief  Starts a pattern from its first step
+ *
+ * Looks up every step's tone here, in the caller's context, so the refill interrupt only
+ * starts and releases voices. Replaces any pattern already playing.
+ *
+ * @param  const seq_pattern_t *pattern
+ * @return void
+ */
+void sequencer_play(const seq_pattern_t *pattern);
+
+/*
+ * @name   sequencer_stop
+ * @brief  Stops the pattern and releases its note
+ *
+ * @param  void
+ * @return void
+ */
+void sequencer_stop();
+
+/*
+ * @name   sequencer_set_sample_rate
+ * @brief  Moves the synthesis to a new output sample rate while playing
+ *
+ * Sets output_sample_rate and retunes cached tones, sounding voices and step timing so pitch,
+ * envelope times and tempo are unchanged. Must not run concurrently with sequencer_fill().
+ *
+ * @param  uint32_t rate (Hz)
+ * @return void
+ */
+void sequencer_set_sample_rate(uint32_t rate);
+
+/*
+ * @name   sequencer_current
+ * @brief  Pattern being played
+ *
+ * @param  void
+ * @return const seq_pattern_t *, NULL when stopped
+ */
+const seq_pattern_t *sequencer_current();
+
+/*
+ * @name   sequencer_fill
+ * @brief  Audio stream producer: renders the mixer, starting each step on its exact sample
+ *
+ * Splits the request at step boundaries so a note starts on the sample its tick falls on,
+ * not at the next refill
+ *
+ * @param  uint16_t *dst, uint32_t count
+ * @return uint32_t samples rendered (always count)
+ */
+uint32_t sequencer_fill(uint16_t *dst, uint32_t count);
+
+#endif /* SEQUENCER_H_ */
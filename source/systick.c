@@ -26,7 +26,9 @@
 //In order to divide an	i/p freq(fin) by a factor of N,	we store N-1 in	the LOAD register.
 
 #define SYSTICK_PRIORITY (3)
-#define SYSTICK_LOAD     (187500) //Load value for obtaining 62.5 msec delay
+#define SYSTICK_LOAD     (187500) //Load value for obtaining 62.5 msec delay from the core clock / 16
+#define SYSTICK_CORE_DIV (16)     //SysTick now runs from the core clock so VAL counts CPU cycles
+#define SYSTICK_PERIOD   (SYSTICK_LOAD * SYSTICK_CORE_DIV) //Core cycles per tick, same 62.5 msec
 #define MS_DELAY_        (62.5)
 
 ticktime_t ms_delay = 0;
@@ -43,10 +45,11 @@ ticktime_t timer = 0; //Variables used for timing calculations
  */
 void init_systicktimer()
 {
-	SysTick->LOAD = SYSTICK_LOAD; //Set reload register
+	SysTick->LOAD = SYSTICK_PERIOD - ONE; //Set reload register
 	NVIC_SetPriority(SysTick_IRQn, SYSTICK_PRIORITY); //Set Priority for SysTick Interrupt
 	SysTick->VAL = ZERO;                   //Load the SysTick Counter Value
-	SysTick->CTRL = SysTick_CTRL_TICKINT_Msk | //Enable Interrupt, alt. clock source
+	SysTick->CTRL = SysTick_CTRL_TICKINT_Msk   | //Enable Interrupt
+			        SysTick_CTRL_CLKSOURCE_Msk | //Core clock, for cycle_count()
 			        SysTick_CTRL_ENABLE_Msk; //Enable SysTick timer
 }
 
@@ -110,3 +113,32 @@ ticktime_t get_timer()
 {
 	return (ms_delay - timer);
 }
+
+/*
+ * @name   cycle_count
+ * @brief  Core clock cycles since startup, modulo 2^32
+ *
+ * Combines the tick count with the SysTick down counter. Safe to call from interrupts of
+ * higher priority than SysTick, where a pending tick has not been counted yet.
+ * Differences of two readings give the cycles spent between them (up to about 89 s at 48 MHz).
+ *
+ * @param  void
+ * @return uint32_t cycles
+ */
+uint32_t cycle_count()
+{
+	uint32_t ticks, val, pending;
+
+	do
+	{
+		ticks = ms_delay;
+		val = SysTick->VAL;
+		pending = SCB->ICSR & SCB_ICSR_PENDSTSET_Msk;
+	} while(ticks != ms_delay);
+
+	//Counter wrapped but SysTick_Handler has not run yet; a large VAL means it wrapped before the read
+	if(pending && (val > (SYSTICK_PERIOD / 2)))
+		ticks++;
+
+	return ticks * SYSTICK_PERIOD + (SYSTICK_PERIOD - ONE - val);
+}
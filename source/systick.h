@@ -74,5 +74,15 @@ void reset_timer();
  */
 ticktime_t get_timer();
 
+/*
+ * @name   cycle_count
+ * @brief  Core clock cycles since startup, modulo 2^32
+ *
+ * Used to measure CPU cycles spent in a piece of code: cycle_count() after - cycle_count() before
+ *
+ * @param  void
+ * @return uint32_t cycles
+ */
+uint32_t cycle_count();
 
 #endif /* SYSTICK_H_ */
@@ -0,0 +1,260 @@
+/*
+ * @file        theremin.c
+ * @brief       Continuous pitch theremin function implementations
+ *
+ * The foreground turns angles into a target tuning word and volume. Every THEREMIN_BLOCK_SIZE
+ * samples the producer moves its pitch and volume a step towards the targets, a one-pole
+ * portamento, and renders the block with the tuning word and gain ramping linearly between the
+ * steps. The pitch curve is the exponential approach of the glide sampled every block and joined
+ * by straight lines, well under a cent from the curve itself for any glide longer than a block.
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       MCUXpresso IDE, gcc
+ */
+
+#include <string.h>
+#include "theremin.h"
+#include "mixer.h"
+#include "wavetable.h"
+#include "tone_to_sample.h"
+#include "effects.h"
+
+#define CENTS_PER_OCTAVE  (1200)
+#define RATIO_STEP_CENTS  (25)        //Cents between entries of ratio_q30
+#define RATIO_STEPS       (CENTS_PER_OCTAVE / RATIO_STEP_CENTS)
+#define RATIO_SHIFT       (30)
+#define COEFF_ONE         (1UL << 16)  //Glide and volume steps are Q16 fractions of the distance left
+#define MS_PER_SECOND     (1000)
+
+//2^(k / 48) for k = 0..48, Q30: pitch ratios in quarter semitones across an octave
+static const uint32_t ratio_q30[RATIO_STEPS + 1] =
+{
+	1073741824, 1089359758, 1105204861, 1121280436, 1137589835, 1154136461, 1170923762,
+	1187955240, 1205234447, 1222764986, 1240550512, 1258594735, 1276901417, 1295474376,
+	1314317484, 1333434672, 1352829926, 1372507291, 1392470869, 1412724824, 1433273380,
+	1454120821, 1475271496, 1496729814, 1518500250, 1540587345, 1562995704, 1585730000,
+	1608794974, 1632195435, 1655936265, 1680022412, 1704458901, 1729250827, 1754403359,
+	1779921743, 1805811301, 1832077432, 1858725612, 1885761398, 1913190429, 1941018425,
+	1969251188, 1997894606, 2026954652, 2056437387, 2086348957, 2116695602, 2147483648
+};
+
+//Notes of each scale in cents above C, the octave's C last
+static const int16_t chromatic[] = { 0, 100, 200, 300, 400, 500, 600, 700, 800, 900, 1000, 1100, 1200 };
+static const int16_t major[] = { 0, 200, 400, 500, 700, 900, 1100, 1200 };
+static const int16_t pentatonic[] = { 0, 200, 400, 700, 900, 1200 };
+static const struct { const int16_t *notes; uint8_t count; } scales[SCALE_COUNT] =
+{
+	{ NULL, 0 },
+	{ chromatic, sizeof(chromatic) / sizeof(chromatic[0]) },
+	{ major, sizeof(major) / sizeof(major[0]) },
+	{ pentatonic, sizeof(pentatonic) / sizeof(pentatonic[0]) }
+};
+
+const char *const theremin_scale_names[SCALE_COUNT] = { "off", "chromatic", "major", "pentatonic" };
+theremin_stats_t theremin_stats;
+
+static dds_osc_t osc;
+static uint32_t base_word;                 //C4 at the output sample rate
+static volatile uint32_t target_word;      //Set by theremin_set(), read by theremin_fill()
+static volatile int32_t target_gain;       //Q15
+static int32_t gain;                       //Q15, at the end of the last block
+static uint32_t glide_coeff = COEFF_ONE;   //Q16 of the pitch distance covered per block
+static uint32_t volume_coeff = COEFF_ONE;
+static uint8_t quantiser = SCALE_CHROMATIC;
+static int32_t last_cents = -1;            //Pitch of the last theremin_set(), cents
+static int32_t mix[THEREMIN_BLOCK_SIZE];
+
+/*
+ * @name   block_coeff
+ * @brief  Fraction of the distance left a one-pole step covers per block
+ *
+ * 1 - e^(-block / tau) is taken as block / (tau + block), within 10% of the time constant for
+ * any time constant of a block or more
+ *
+ * @param  uint32_t ms (time constant, 0 for a jump)
+ * @return uint32_t Q16
+ */
+static uint32_t block_coeff(uint32_t ms)
+{
+	uint32_t tau = (uint32_t)(((uint64_t)ms * output_sample_rate) / MS_PER_SECOND);
+
+	return (uint32_t)(((uint64_t)THEREMIN_BLOCK_SIZE << 16) / (tau + THEREMIN_BLOCK_SIZE));
+}
+
+/*
+ * @name   theremin_start
+ * @brief  Sets the scale and portamento and silences the voice, for the output sample rate
+ *
+ * @param  uint8_t scale (scale_t), uint32_t glide_ms (0..THEREMIN_GLIDE_MAX_MS, 0 jumps)
+ * @return void
+ */
+void theremin_start(uint8_t scale, uint32_t glide_ms)
+{
+	if(glide_ms > THEREMIN_GLIDE_MAX_MS)
+		glide_ms = THEREMIN_GLIDE_MAX_MS;
+	quantiser = (scale < SCALE_COUNT) ? scale : SCALE_CHROMATIC;
+	base_word = dds_tuning_word(THEREMIN_BASE_HZ_Q16, output_sample_rate);
+	glide_coeff = block_coeff(glide_ms);
+	volume_coeff = block_coeff(THEREMIN_VOLUME_MS);
+	memset(&theremin_stats, 0, sizeof(theremin_stats));
+	last_cents = -1;
+	gain = 0;
+	target_gain = 0;
+	target_word = base_word;
+	osc.phase = 0;
+	osc.tuning_word = base_word;
+	osc.table = wavetable_select(WAVE_SINE, base_word);
+}
+
+/*
+ * @name   theremin_quantise
+ * @brief  Snaps a pitch to the nearest note of a scale, holding the last note near the midpoint
+ *
+ * The last note is kept until the pitch is THEREMIN_HYSTERESIS cents nearer another note, so
+ * sensor noise at a midpoint does not flip between two notes
+ *
+ * @param  int32_t cents (above C4), uint8_t scale (scale_t), int32_t last (cents, the last note, or -1)
+ * @return int32_t cents
+ */
+int32_t theremin_quantise(int32_t cents, uint8_t scale, int32_t last)
+{
+	int32_t octave, within, nearest = 0;
+
+	if(scale == SCALE_OFF || scale >= SCALE_COUNT)
+		return cents;
+	if(cents < 0)
+		cents = 0;
+	octave = cents / CENTS_PER_OCTAVE * CENTS_PER_OCTAVE;
+	within = cents - octave;
+	for(int i = 1; i < scales[scale].count; i++)
+	{
+		int32_t note = scales[scale].notes[i];
+		int32_t d = (within > note) ? within - note : note - within;
+		int32_t best = (within > nearest) ? within - nearest : nearest - within;
+
+		if(d < best)
+			nearest = note;
+	}
+	nearest += octave;
+	if(last >= 0 && last != nearest)
+	{
+		int32_t to_last = (cents > last) ? cents - last : last - cents;
+		int32_t to_nearest = (cents > nearest) ? cents - nearest : nearest - cents;
+
+		if(to_last - to_nearest < THEREMIN_HYSTERESIS)
+			return last;
+	}
+	return nearest;
+}
+
+/*
+ * @name   theremin_tuning_word
+ * @brief  DDS tuning word of a pitch at the output sample rate set by theremin_start()
+ *
+ * C4's word times the octave and a ratio interpolated between quarter semitones, within 0.05 cent
+ *
+ * @param  int32_t cents (above C4, 0..THEREMIN_SPAN_CENTS)
+ * @return uint32_t tuning word
+ */
+uint32_t theremin_tuning_word(int32_t cents)
+{
+	uint32_t octave, index, frac, ratio;
+
+	if(cents < 0)
+		cents = 0;
+	else if(cents > THEREMIN_SPAN_CENTS)
+		cents = THEREMIN_SPAN_CENTS;
+	octave = cents / CENTS_PER_OCTAVE;
+	index = (cents % CENTS_PER_OCTAVE) / RATIO_STEP_CENTS;
+	frac = (cents % CENTS_PER_OCTAVE) % RATIO_STEP_CENTS;
+	ratio = ratio_q30[index] + (ratio_q30[index + 1] - ratio_q30[index]) * frac / RATIO_STEP_CENTS;
+	return (uint32_t)((((uint64_t)base_word << octave) * ratio) >> RATIO_SHIFT);
+}
+
+/*
+ * @name   theremin_set
+ * @brief  Maps the board's angles to the pitch and volume the voice glides to
+ *
+ * Roll either way from level raises the pitch; pitch angle either way from level raises the
+ * volume, from silent within THEREMIN_PITCH_DEAD to full at THEREMIN_PITCH_FULL
+ *
+ * @param  int32_t roll, int32_t pitch (hundredths of a degree)
+ * @return int32_t cents above C4 the voice glides to
+ */
+int32_t theremin_set(int32_t roll, int32_t pitch)
+{
+	int32_t cents, level;
+
+	roll = (roll < 0) ? -roll : roll;
+	pitch = (pitch < 0) ? -pitch : pitch;
+	if(roll > THEREMIN_ROLL_SPAN)
+		roll = THEREMIN_ROLL_SPAN;
+	cents = theremin_quantise(roll * THEREMIN_SPAN_CENTS / THEREMIN_ROLL_SPAN, quantiser, last_cents);
+	if(cents > THEREMIN_SPAN_CENTS)
+		cents = THEREMIN_SPAN_CENTS;
+	if(pitch <= THEREMIN_PITCH_DEAD)
+		level = 0;
+	else if(pitch >= THEREMIN_PITCH_FULL)
+		level = MIXER_VOLUME_MAX;
+	else
+		level = (pitch - THEREMIN_PITCH_DEAD) * MIXER_VOLUME_MAX / (THEREMIN_PITCH_FULL - THEREMIN_PITCH_DEAD);
+
+	theremin_stats.updates++;
+	if(cents != last_cents)
+	{
+		theremin_stats.note_changes++;
+		target_word = theremin_tuning_word(cents);
+		last_cents = cents;
+	}
+	target_gain = level;
+	return cents;
+}
+
+/*
+ * @name   theremin_fill
+ * @brief  Audio stream producer: the theremin voice
+ *
+ * Each block moves the tuning word and the gain a one-pole step towards their targets, ramping
+ * both across the block, and picks the wave's band for the pitch it ends on. The block runs
+ * through the effects chain and the mixer's output stage, so echoes and filter resonance are
+ * soft clipped and dithered like the mixer; the output gain applies from the next block.
+ *
+ * @param  uint16_t *dst, uint32_t count
+ * @return uint32_t samples rendered (always count)
+ */
+uint32_t theremin_fill(uint16_t *dst, uint32_t count)
+{
+	uint32_t remaining = count;
+
+	while(remaining)
+	{
+		uint32_t n = (remaining < THEREMIN_BLOCK_SIZE) ? remaining : THEREMIN_BLOCK_SIZE;
+		int32_t distance = (int32_t)(target_word - osc.tuning_word);
+		int32_t word_step = (int32_t)(((int64_t)distance * glide_coeff) >> 16) / (int32_t)n;
+		int32_t next = gain + (int32_t)(((int64_t)(target_gain - gain) * volume_coeff) >> 16);
+		int32_t level, step;
+
+		if(word_step == 0) //Close enough to land on the targets this block
+			word_step = distance / (int32_t)n;
+		if(next == gain)
+			next = target_gain;
+		level = gain * mixer_output_gain(); //Q15 by Q15 is the Q30 dds_mix_glide() ramps
+		step = (next * mixer_output_gain() - level) / (int32_t)n;
+		memset(mix, 0, n * sizeof(mix[0]));
+		if(level || step)
+			dds_mix_glide(&osc, mix, n, level, step, word_step);
+		else
+		{
+			osc.phase += osc.tuning_word * n + word_step * (n * (n - 1) / 2);
+			osc.tuning_word += word_step * n;
+		}
+		osc.table = wavetable_select(WAVE_SINE, osc.tuning_word);
+		gain = next;
+		effects_process(mix, n);
+		mixer_output(mix, dst, n);
+		dst += n;
+		theremin_stats.blocks++;
+		remaining -= n;
+	}
+	return count;
+}
@@ -0,0 +1,99 @@
+/*
+ * @file        theremin.h
+ * @brief       Continuous pitch theremin function declarations
+ *
+ * Maps the roll angle to pitch over two octaves, through an optional scale quantiser, and the
+ * pitch angle to volume. One DDS voice glides to each new pitch with a portamento time
+ * constant: its tuning word moves every sample, so the pitch changes phase continuously at the
+ * sample rate and nothing is rebuilt when it moves.
+ * theremin_set() runs in the foreground and theremin_fill() is the audio stream producer.
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       MCUXpresso IDE, gcc
+ */
+
+#ifndef THEREMIN_H_
+#define THEREMIN_H_
+
+#include <stdint.h>
+
+#define THEREMIN_BASE_HZ_Q16   (17145893)  //C4, 261.63 Hz, Q16.16: the pitch of the board held level
+#define THEREMIN_SPAN_CENTS    (2400)      //Two octaves, C4..C6
+#define THEREMIN_ROLL_SPAN     (9000)      //Roll in hundredths of a degree across the span, either way
+#define THEREMIN_PITCH_DEAD    (500)       //Pitch angle, hundredths of a degree, silent up to here
+#define THEREMIN_PITCH_FULL    (4500)      //Full volume from here
+#define THEREMIN_GLIDE_MS      (60)        //Default portamento time constant
+#define THEREMIN_GLIDE_MAX_MS  (2000)
+#define THEREMIN_VOLUME_MS     (20)        //Volume smoothing time constant
+#define THEREMIN_HYSTERESIS    (15)        //Cents past the midpoint before a quantised note changes
+#define THEREMIN_BLOCK_SIZE    (16)        //Samples per glide and volume step, a power of two
+
+//Quantiser scales, all rooted on C
+typedef enum
+{
+	SCALE_OFF = 0,       //Continuous pitch
+	SCALE_CHROMATIC,
+	SCALE_MAJOR,
+	SCALE_PENTATONIC,    //Major pentatonic
+	SCALE_COUNT
+} scale_t;
+
+//Counters, printed when the theremin command ends
+typedef struct theremin_stats
+{
+	uint32_t updates;       //theremin_set() calls
+	uint32_t note_changes;  //Quantised pitch changes, or every pitch change with SCALE_OFF
+	uint32_t blocks;        //Glide blocks rendered
+} theremin_stats_t;
+
+extern theremin_stats_t theremin_stats;
+extern const char *const theremin_scale_names[SCALE_COUNT];
+
+/*
+ * @name   theremin_start
+ * @brief  Sets the scale and portamento and silences the voice, for the output sample rate
+ *
+ * Call again after a change of the output sample rate
+ *
+ * @param  uint8_t scale (scale_t), uint32_t glide_ms (0..THEREMIN_GLIDE_MAX_MS, 0 jumps)
+ * @return void
+ */
+void theremin_start(uint8_t scale, uint32_t glide_ms);
+
+/*
+ * @name   theremin_quantise
+ * @brief  Snaps a pitch to the nearest note of a scale, holding the last note near the midpoint
+ *
+ * @param  int32_t cents (above C4), uint8_t scale (scale_t), int32_t last (cents, the last note, or -1)
+ * @return int32_t cents
+ */
+int32_t theremin_quantise(int32_t cents, uint8_t scale, int32_t last);
+
+/*
+ * @name   theremin_tuning_word
+ * @brief  DDS tuning word of a pitch at the output sample rate set by theremin_start()
+ *
+ * @param  int32_t cents (above C4, 0..THEREMIN_SPAN_CENTS)
+ * @return uint32_t tuning word
+ */
+uint32_t theremin_tuning_word(int32_t cents);
+
+/*
+ * @name   theremin_set
+ * @brief  Maps the board's angles to the pitch and volume the voice glides to
+ *
+ * @param  int32_t roll, int32_t pitch (hundredths of a degree)
+ * @return int32_t cents above C4 the voice glides to
+ */
+int32_t theremin_set(int32_t roll, int32_t pitch);
+
+/*
+ * @name   theremin_fill
+ * @brief  Audio stream producer: the theremin voice
+ *
+ * @param  uint16_t *dst, uint32_t count
+ * @return uint32_t samples rendered (always count)
+ */
+uint32_t theremin_fill(uint16_t *dst, uint32_t count);
+
+#endif /* THEREMIN_H_ */
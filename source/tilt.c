@@ -0,0 +1,146 @@
+/*
+ * @file        tilt.c
+ * @brief       Integer roll and pitch angle implementations
+ *
+ * The CORDIC runs in vectoring mode: each step rotates the vector by +-atan(2^-i), shifts and
+ * adds only, towards the x axis, summing the rotations. The vector is first turned into the
+ * right half plane and scaled up to 27 or 28 bits, so the last shifts keep their precision;
+ * the gain of the steps, 1.647, still leaves it within 31 bits.
+ * Angles are summed in 1/65536 of a hundredth of a degree, the table's unit.
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       MCUXpresso IDE, gcc
+ * @references  J. E. Volder, "The CORDIC Trigonometric Computing Technique", 1959
+ */
+
+#include "tilt.h"
+
+#define CORDIC_STEPS   (16)        //The last step turns 0.0035 degrees
+#define ANGLE_SHIFT    (16)        //Table unit to hundredths of a degree
+#define ANGLE_HALF     (1L << (ANGLE_SHIFT - 1))
+#define QUARTER_TURN   ((int32_t)(TILT_HALF_TURN / 2) << ANGLE_SHIFT)
+#define SCALE_COARSE   (1L << 23)  //Scaled up 4 bits at a time below this
+#define SCALE_FINE     (1L << 27)  //Then a bit at a time below this
+#define SQRT_TOP_BIT   (1UL << 30)
+#define PITCH_SCALE    (4)         //Pitch takes the square root of 4(y^2 + z^2), to half a count
+
+//atan(2^-i) in 1/65536 of a hundredth of a degree
+static const int32_t cordic_angle[CORDIC_STEPS] =
+{
+	294912000, 174096719, 91987925, 46694507, 23437865, 11730358, 5866610, 2933484,
+	1466764, 733385, 366693, 183346, 91673, 45837, 22918, 11459
+};
+
+/*
+ * @name   tilt_atan2
+ * @brief  Angle of the vector (x, y) from the x axis, as atan2(y, x)
+ *
+ * Within 1 hundredth of a degree: 0.35 of the last step left over and 0.5 rounding the sum
+ *
+ * @param  int32_t y, int32_t x (each within +-TILT_INPUT_MAX)
+ * @return int32_t -17999 to 18000, hundredths of a degree
+ */
+int32_t tilt_atan2(int32_t y, int32_t x)
+{
+	int32_t angle = 0, t;
+	uint32_t magnitude;
+
+	if(x == 0 && y == 0)
+		return 0;
+	if(x < 0) //Turn a quarter towards the right half plane
+	{
+		t = x;
+		if(y >= 0)
+		{
+			x = y;
+			y = -t;
+			angle = QUARTER_TURN;
+		}
+		else
+		{
+			x = -y;
+			y = t;
+			angle = -QUARTER_TURN;
+		}
+	}
+	magnitude = (uint32_t)x | (uint32_t)(y < 0 ? -y : y);
+	while(magnitude < SCALE_COARSE)
+	{
+		magnitude <<= 4;
+		x <<= 4;
+		y <<= 4;
+	}
+	while(magnitude < SCALE_FINE)
+	{
+		magnitude <<= 1;
+		x <<= 1;
+		y <<= 1;
+	}
+
+	for(int i = 0; i < CORDIC_STEPS; i++) //Turns clockwise while y >= 0, by negating through the sign mask
+	{
+		int32_t sign = y >> 31;
+
+		t = x;
+		x += ((y >> i) ^ sign) - sign;
+		y -= ((t >> i) ^ sign) - sign;
+		angle += (cordic_angle[i] ^ sign) - sign;
+	}
+	angle = (angle + ANGLE_HALF) >> ANGLE_SHIFT;
+	return (angle == -TILT_HALF_TURN) ? TILT_HALF_TURN : angle;
+}
+
+/*
+ * @name   tilt_isqrt
+ * @brief  Square root rounded to the nearest integer
+ *
+ * One result bit a step, digit by digit without branching on the data, then rounded up when v is
+ * past root^2 + root
+ *
+ * @param  uint32_t v
+ * @return uint32_t 0 to 65536
+ */
+uint32_t tilt_isqrt(uint32_t v)
+{
+	uint32_t root = 0, rest = v, bit = SQRT_TOP_BIT;
+
+	while(bit > v)
+		bit >>= 2;
+	while(bit)
+	{
+		uint32_t trial = root + bit, taken = -(uint32_t)(rest >= trial); //All ones when the bit is set
+
+		rest -= trial & taken;
+		root = (root >> 1) + (bit & taken);
+		bit >>= 2;
+	}
+	return (rest > root) ? root + 1 : root;
+}
+
+/*
+ * @name   tilt_roll
+ * @brief  Roll angle, rotation around the X axis: atan2(y, z)
+ *
+ * @param  int16_t y, int16_t z (14-bit counts)
+ * @return int32_t -17999 to 18000, hundredths of a degree
+ */
+int32_t tilt_roll(int16_t y, int16_t z)
+{
+	return tilt_atan2(y, z);
+}
+
+/*
+ * @name   tilt_pitch
+ * @brief  Pitch angle, rotation around the Y axis: atan2(x, sqrt(y * y + z * z))
+ *
+ * The root is taken of four times the sum, so it is within a quarter count against x doubled
+ *
+ * @param  int16_t x, int16_t y, int16_t z (14-bit counts)
+ * @return int32_t -9000 to 9000, hundredths of a degree
+ */
+int32_t tilt_pitch(int16_t x, int16_t y, int16_t z)
+{
+	uint32_t sum = (uint32_t)((int32_t)y * y) + (uint32_t)((int32_t)z * z);
+
+	return tilt_atan2((int32_t)x * 2, (int32_t)tilt_isqrt(sum * PITCH_SCALE));
+}
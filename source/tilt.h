@@ -0,0 +1,64 @@
+/*
+ * @file        tilt.h
+ * @brief       Integer roll and pitch angle declarations
+ *
+ * Roll and pitch from the accelerometer counts with integer arithmetic only: a CORDIC atan2
+ * and a rounded integer square root, no soft-float and no libm. Angles are in hundredths of a
+ * degree, as the theremin takes them.
+ * Error bounds, checked against libm over the whole 14-bit range by host/bench_tilt.c:
+ * tilt_atan2() is within 1 hundredth of a degree of the exact angle, tilt_isqrt() is exact
+ * to the nearest integer, and tilt_pitch() within 2 hundredths of a degree.
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       MCUXpresso IDE, gcc
+ * @references  J. E. Volder, "The CORDIC Trigonometric Computing Technique", 1959
+ */
+
+#ifndef TILT_H_
+#define TILT_H_
+
+#include <stdint.h>
+
+#define TILT_CENTIDEGREES  (100)     //Angles are in hundredths of a degree
+#define TILT_HALF_TURN     (18000)
+#define TILT_INPUT_MAX     ((1L << 28) - 1)  //Largest magnitude of a tilt_atan2() argument
+
+/*
+ * @name   tilt_atan2
+ * @brief  Angle of the vector (x, y) from the x axis, as atan2(y, x)
+ *
+ * 0 for (0, 0); 18000, not -18000, along the negative x axis
+ *
+ * @param  int32_t y, int32_t x (each within +-TILT_INPUT_MAX)
+ * @return int32_t -17999 to 18000, hundredths of a degree
+ */
+int32_t tilt_atan2(int32_t y, int32_t x);
+
+/*
+ * @name   tilt_isqrt
+ * @brief  Square root rounded to the nearest integer
+ *
+ * @param  uint32_t v
+ * @return uint32_t 0 to 65536
+ */
+uint32_t tilt_isqrt(uint32_t v);
+
+/*
+ * @name   tilt_roll
+ * @brief  Roll angle, rotation around the X axis: atan2(y, z)
+ *
+ * @param  int16_t y, int16_t z (14-bit counts)
+ * @return int32_t -17999 to 18000, hundredths of a degree
+ */
+int32_t tilt_roll(int16_t y, int16_t z);
+
+/*
+ * @name   tilt_pitch
+ * @brief  Pitch angle, rotation around the Y axis: atan2(x, sqrt(y * y + z * z))
+ *
+ * @param  int16_t x, int16_t y, int16_t z (14-bit counts)
+ * @return int32_t -9000 to 9000, hundredths of a degree
+ */
+int32_t tilt_pitch(int16_t x, int16_t y, int16_t z);
+
+#endif /* TILT_H_ */
@@ -0,0 +1,124 @@
+/*
+ * @file        tone_cache.c
+ * @brief       Frequency-keyed tone descriptor cache function implementations
+ *
+ * Keeps the tuning word and wavetable of recently played tones, keyed by frequency and waveform,
+ * in a fixed RAM budget with least recently used eviction. Repeating a tune costs a lookup
+ * instead of recomputing every tone.
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       MCUXpresso IDE, gcc
+ */
+
+#include <stddef.h>
+#include "tone_cache.h"
+
+//One cached tone; an entry with no table is empty
+typedef struct tone_cache_entry
+{
+	tone_t tone;
+	uint32_t last_used;  //Lookup stamp, smallest is the least recently used
+} tone_cache_entry_t;
+
+tone_cache_stats_t tone_cache_stats;
+static tone_cache_entry_t cache[TONE_CACHE_SIZE];
+static uint32_t lookup_counter = 0;
+
+/*
+ * @name   tone_cache_get
+ * @brief  Looks up a tone, computing it on a miss
+ *
+ * Linear search; the cache is small enough that this is cheaper than hashing.
+ * A miss fills an empty entry, or else the least recently used one.
+ *
+ * @param  int frequency (Hz), uint8_t wave (wave_t)
+ * @return const tone_t *
+ */
+const tone_t *tone_cache_get(int frequency, uint8_t wave)
+{
+	tone_cache_entry_t *victim = &cache[0];
+
+	lookup_counter++;
+	for(int i = 0; i < TONE_CACHE_SIZE; i++)
+	{
+		tone_cache_entry_t *entry = &cache[i];
+
+		if(entry->tone.table == NULL)
+		{
+			if(victim->tone.table != NULL)
+				victim = entry;
+			continue;
+		}
+		if(entry->tone.frequency == frequency && entry->tone.wave == wave)
+		{
+			entry->last_used = lookup_counter;
+			tone_cache_stats.hits++;
+			return &entry->tone;
+		}
+		if(victim->tone.table != NULL && (int32_t)(entry->last_used - victim->last_used) < 0) //Wrap safe comparison
+			victim = entry;
+	}
+
+	tone_cache_stats.misses++;
+	if(victim->tone.table != NULL)
+		tone_cache_stats.evictions++;
+	victim->tone.frequency = frequency;
+	victim->tone.wave = wave;
+	tone_init(&victim->tone);
+	victim->last_used = lookup_counter;
+	return &victim->tone;
+}
+
+/*
+ * @name   tone_cache_flush
+ * @brief  Empties the cache, keeping the counters
+ *
+ * Invalidates every pointer handed out by tone_cache_get(); a sample rate change uses
+ * tone_cache_retune() instead
+ *
+ * @param  void
+ * @return void
+ */
+void tone_cache_flush()
+{
+	for(int i = 0; i < TONE_CACHE_SIZE; i++)
+		cache[i].tone.table = NULL;
+}
+
+/*
+ * @name   tone_cache_retune
+ * @brief  Recomputes every cached tone for the current output sample rate
+ *
+ * Entries are updated in place, so pointers returned by tone_cache_get() stay valid.
+ * Lookups and counters are not touched.
+ *
+ * @param  void
+ * @return void
+ */
+void tone_cache_retune()
+{
+	for(int i = 0; i < TONE_CACHE_SIZE; i++)
+	{
+		if(cache[i].tone.table != NULL)
+			tone_init(&cache[i].tone);
+	}
+}
+
+/*
+ * @name   tone_cache_used
+ * @brief  Number of entries holding a tone
+ *
+ * @param  void
+ * @return uint32_t entries
+ */
+uint32_t tone_cache_used()
+{
+	uint32_t used = 0;
+
+	for(int i = 0; i < TONE_CACHE_SIZE; i++)
+	{
+		if(cache[i].tone.table != NULL)
+			used++;
+	}
+	return used;
+}
@@ -0,0 +1,73 @@
+/*
+ * @file        tone_cache.h
+ * @brief       Frequency-keyed tone descriptor cache declarations
+ *
+ * Keeps the tuning word and wavetable of recently played tones, keyed by frequency and waveform,
+ * in a fixed RAM budget with least recently used eviction. Repeating a tune costs a lookup
+ * instead of recomputing every tone.
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       MCUXpresso IDE, gcc
+ */
+
+#ifndef TONE_CACHE_H_
+#define TONE_CACHE_H_
+
+#include <stdint.h>
+#include "tone_to_sample.h"
+
+#ifndef TONE_CACHE_SIZE
+#define TONE_CACHE_SIZE   (16)   //Entries, override with -DTONE_CACHE_SIZE=n; holds all 4 tunes
+#endif
+
+//Lookup counters, read by the "cache" command
+typedef struct tone_cache_stats
+{
+	uint32_t hits;
+	uint32_t misses;     //Lookups that computed the tone
+	uint32_t evictions;  //Misses that replaced the least recently used entry
+} tone_cache_stats_t;
+
+extern tone_cache_stats_t tone_cache_stats;
+
+/*
+ * @name   tone_cache_get
+ * @brief  Looks up a tone, computing it on a miss
+ *
+ * The returned tone stays valid until TONE_CACHE_SIZE other tones have been looked up since
+ *
+ * @param  int frequency (Hz), uint8_t wave (wave_t)
+ * @return const tone_t *
+ */
+const tone_t *tone_cache_get(int frequency, uint8_t wave);
+
+/*
+ * @name   tone_cache_flush
+ * @brief  Empties the cache, keeping the counters
+ *
+ * @param  void
+ * @return void
+ */
+void tone_cache_flush();
+
+/*
+ * @name   tone_cache_retune
+ * @brief  Recomputes every cached tone for the current output sample rate
+ *
+ * Entries are updated in place, so pointers returned by tone_cache_get() stay valid
+ *
+ * @param  void
+ * @return void
+ */
+void tone_cache_retune();
+
+/*
+ * @name   tone_cache_used
+ * @brief  Number of entries holding a tone
+ *
+ * @param  void
+ * @return uint32_t entries
+ */
+uint32_t tone_cache_used();
+
+#endif /* TONE_CACHE_H_ */
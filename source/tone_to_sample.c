@@ -1,8 +1,8 @@
 /*
  * @file        tone_to_sample.c
- * @brief       Function Stores sine and triangle wave in 1024 size buffer
+ * @brief       Function converts a musical tone to a DDS tuning word
  *
- *  Function Stores sine and triangle wave in 1024 size buffer
+ *  Function converts a musical tone to a DDS tuning word, or fits it into a looped sample buffer
  *
  * @author      Swathi Venkatachalam
  * @tools       MCUXpresso IDE
@@ -10,45 +10,98 @@
  *              Assignment 7
  */
 
-#include <musical_tones.h>
 #include "tone_to_sample.h"
-#include "fp_trig.h"
+#include "dds.h"
+#include "wavetable.h"
 #include "tpm.h"
-#include <stdio.h>
-#include "fsl_debug_console.h"
 
-#define DAC_MAX      (4095)
-#define DAC_MIN      (ZERO)
-#define ONE_FOURTH   (0.25)
-#define THREE_FOURTH (0.75)
+#define CENTS_PER_UNIT_RATIO_X1000  (1731234)  //1000 * 1200 / ln(2)
+
+uint32_t output_sample_rate = OUTPUT_SAMPLE_RATE;
+
+/*
+ * @name   tone_init
+ * @brief  Function computes the DDS tuning word of a tone
+ *
+ * Converting tone frequency to the phase increment played by the DDS oscillator
+ * and picking the band-limited table for its waveform.
+ * No samples are synthesised here, the DMA refill renders them on the fly from flash.
+ * The tuning word is for the current output_sample_rate.
+ *
+ * @param  tone_t *tone
+ * @return void
+ */
+void tone_init(tone_t *tone)
+{
+	tone->tuning_word = dds_tuning_word(DDS_HZ(tone->frequency), output_sample_rate);
+	tone->table = wavetable_select(tone->wave, tone->tuning_word);
+}
 
 /*
- * @name   tone_to_samples
- * @brief  Function initiates DMA0
+ * @name   tone_fit
+ * @brief  Chooses the loop length and cycle count of a buffer for the least pitch error
  *
- * Converting waveform to samples and storing it in 1024 buffer to send it to DAC
+ * For each length L the nearest cycle count is round(f * L / rate). The error of each candidate
+ * is |cycles * rate - f * L| / L; candidates are compared by cross multiplication, so there is
+ * no division in the loop. Cycle counts at or above L / 2 would be at or above Nyquist.
  *
- * @param  buffer *waveform_buffer, int sine_wave (Checks if it's a size wave or triangle wave)
+ * @param  tone_buffer_t *buf, uint32_t freq_q16 (Hz, Q16.16), uint32_t sample_rate (Hz)
  * @return void
  */
-void tone_to_samples(buffer *waveform_buffer) //waveform_buffer: buffer to be filled //tells if its sine waveform or triangular waveform
+void tone_fit(tone_buffer_t *buf, uint32_t freq_q16, uint32_t sample_rate)
 {
-	int i = ZERO;
-	int frequency = waveform_buffer->frequency;
-	int samples_per_period =  ZERO;
-	uint32_t samples_count = ZERO;
-
-	//samples per period calculated
-	waveform_buffer->samples_per_period = OUTPUT_SAMPLE_RATE / frequency; //Samples per period
-	samples_per_period = waveform_buffer->samples_per_period;
-
-	//total number of samples calculated
-	waveform_buffer->sample_count = (samples_per_period) * (BUFFER_SIZE / samples_per_period); //sample count = cycles * samples per period
-	samples_count = waveform_buffer->sample_count;
-	while(i < samples_count)
+	uint64_t rate_q16 = (uint64_t)sample_rate << 16;
+	uint64_t best_error = 0;
+	uint32_t best_length = 1;
+	uint32_t best_cycles = 0;
+
+	for(uint32_t length = 2; length <= BUFFER_SIZE; length++)
+	{
+		uint64_t target = (uint64_t)freq_q16 * length;             //f * L, Q16
+		uint32_t cycles = (uint32_t)((target + (rate_q16 >> 1)) / rate_q16);
+		uint64_t achieved, error;
+
+		if(cycles == 0 || 2 * cycles >= length)
+			continue;
+		achieved = (uint64_t)cycles * rate_q16;
+		error = (achieved > target) ? achieved - target : target - achieved;
+		if(best_cycles == 0 || error * best_length < best_error * length) //error / L < best_error / best_L
+		{
+			best_error = error;
+			best_length = length;
+			best_cycles = cycles;
+			if(error == 0)
+				break;                                          //Exact, and the shortest such loop
+		}
+	}
+
+	buf->frequency_q16 = freq_q16;
+	buf->cycles = (uint16_t)best_cycles;
+	buf->sample_count = (uint16_t)best_length;
+	buf->achieved_q16 = (uint32_t)(((uint64_t)best_cycles * rate_q16 + (best_length >> 1)) / best_length);
+	//cents = 1200 * log2(a / f) ~ 1731.234 * (a - f) / f, well within 0.001 cent for errors of a few cents
+	buf->error_mcents = (freq_q16 == 0) ? 0 :
+			(int32_t)(((int64_t)buf->achieved_q16 - (int64_t)freq_q16) * CENTS_PER_UNIT_RATIO_X1000 / (int64_t)freq_q16);
+}
+
+/*
+ * @name   tone_render_loop
+ * @brief  Fills a fitted buffer with DAC samples of a wavetable
+ *
+ * Sample i is taken at phase i * cycles * 2^32 / sample_count, computed exactly for every sample
+ * rather than accumulated, so sample sample_count would land on phase 0 again and the loop is
+ * seamless at the DMA wrap
+ *
+ * @param  tone_buffer_t *buf, const int16_t *table (DDS_TABLE_SIZE samples)
+ * @return void
+ */
+void tone_render_loop(tone_buffer_t *buf, const int16_t *table)
+{
+	dds_osc_t osc = { 0, 0, table };
+
+	for(uint32_t i = 0; i < buf->sample_count; i++)
 	{
-		//Stores the output of sine function in buffer as a sample
-		waveform_buffer->dac_buffer[i] = fp_sin(i * TWO_PI / samples_per_period) + TRIG_SCALE_FACTOR;
-		i++;
+		osc.phase = (uint32_t)((((uint64_t)i * buf->cycles) << 32) / buf->sample_count);
+		buf->dac_buffer[i] = (uint16_t)((dds_sample(&osc) >> DDS_DAC_SHIFT) + DDS_DAC_MIDSCALE);
 	}
 }
@@ -1,8 +1,8 @@
 /*
  * @file        tone_to_sample.h
- * @brief       Function Stores sine and triangle wave in 1024 size buffer
+ * @brief       Function converts a musical tone to a DDS tuning word
  *
- *  Function prototype that Stores sine and triangle wave in 1024 size buffer
+ *  Function prototype that converts a musical tone to a DDS tuning word
  *
  * @author      Swathi Venkatachalam
  * @tools       MCUXpresso IDE
@@ -44,25 +44,64 @@
 #define WAVEFORM10_FREQ (294) //D4
 #define WAVEFORM11_FREQ (587) //D5
 #define WAVEFORM12_FREQ (1175) //D6
-//buffer struct to store frequency, samples per period, samples count and dac buffer for each waveform generated
-typedef struct buffer
+//DAC output sample rate in Hz that tuning words are computed for, OUTPUT_SAMPLE_RATE at reset.
+//Changed only through audio_set_sample_rate(), which retunes everything built on it.
+extern uint32_t output_sample_rate;
+
+//tone struct to store frequency, waveform, DDS tuning word and flash table for each note
+typedef struct tone
 {
 	int frequency;
-	int samples_per_period;
-	uint32_t sample_count;
+	uint8_t wave;          //wave_t, set before tone_init
+	uint32_t tuning_word;
+	const int16_t *table;  //Wavetable bank entry for this waveform and pitch
+} tone_t;
+
+//Looped sample buffer holding a whole number of cycles, for playback without an oscillator
+typedef struct tone_buffer
+{
+	uint32_t frequency_q16;  //Requested frequency, Hz Q16.16
+	uint32_t achieved_q16;   //sample_rate * cycles / sample_count, Hz Q16.16
+	int32_t error_mcents;    //Achieved against requested, 1/1000 cent
+	uint16_t cycles;         //Whole cycles in the buffer
+	uint16_t sample_count;   //Loop length, at most BUFFER_SIZE
 	uint16_t dac_buffer[BUFFER_SIZE];
-} buffer;
+} tone_buffer_t;
 
 /*
- * @name   tone_to_samples
- * @brief  Function initiates DMA0
+ * @name   tone_init
+ * @brief  Function computes the DDS tuning word of a tone
  *
- * Converting waveform to samples and storing it in 1024 buffer to send it to DAC
+ * Converting tone frequency to the phase increment played by the DDS oscillator
+ * and picking the band-limited table for its waveform
  *
- * @param  buffer *waveform_buffer, int sine_wave (Checks if it's a size wave or triangle wave)
+ * @param  tone_t *tone
  * @return void
  */
 
-void tone_to_samples(buffer *buf);
+void tone_init(tone_t *tone);
+
+/*
+ * @name   tone_fit
+ * @brief  Chooses the loop length and cycle count of a buffer for the least pitch error
+ *
+ * Tries every length up to BUFFER_SIZE with the nearest whole number of cycles, instead of
+ * rounding one period to whole samples, and records the achieved frequency and error
+ *
+ * @param  tone_buffer_t *buf, uint32_t freq_q16 (Hz, Q16.16), uint32_t sample_rate (Hz)
+ * @return void
+ */
+void tone_fit(tone_buffer_t *buf, uint32_t freq_q16, uint32_t sample_rate);
+
+/*
+ * @name   tone_render_loop
+ * @brief  Fills a fitted buffer with DAC samples of a wavetable
+ *
+ * Sample i is taken at phase i * cycles / sample_count exactly, so the loop is seamless at the wrap
+ *
+ * @param  tone_buffer_t *buf, const int16_t *table (DDS_TABLE_SIZE samples)
+ * @return void
+ */
+void tone_render_loop(tone_buffer_t *buf, const int16_t *table);
 
 #endif /* TONE_TO_SAMPLE_H_ */
@@ -13,9 +13,10 @@
 #include <musical_tones.h>
 #include "MKL25Z4.h"
 #include "tpm.h"
+#include "tone_to_sample.h"
 
 
-#define PERIOD              (CLOCK/OUTPUT_SAMPLE_RATE) - ONE
+#define PERIOD(rate)        ((CLOCK/(rate)) - ONE)
 #define PRESCALAR           (ZERO)
 #define INPUT_PERIOD        (CLOCK/INPUT_SAMPLE_RATE) - ONE
 
@@ -41,13 +42,30 @@ void init_TPM0()
 	TPM0->SC = ZERO;
 
 	// Load the Counter and Mod
-	TPM0->MOD = TPM_MOD_MOD(PERIOD); //Generate delay at DAC output sample rate 48KHz
+	TPM0->MOD = TPM_MOD_MOD(PERIOD(output_sample_rate)); //Generate delay at DAC output sample rate, 48KHz at reset
 	TPM0->CNT = ZERO;
 
 	//Set TPM0 to enable DMA transfer, count up and divide clock by no prescaler
 	TPM0->SC = TPM_SC_DMA_MASK | TPM_SC_PS(PRESCALAR);
 }
 
+/*
+ * @name   tpm0_set_sample_rate
+ * @brief  Function reprograms the TPM0 overflow rate
+ *
+ * Sets MOD for a DAC output sample rate. The counter is cleared as well: when MOD shrinks
+ * below the current count TPM0 would otherwise run on to 0xFFFF before its next overflow.
+ *
+ * @param  uint32_t rate (Hz, a divisor of CLOCK)
+ * @return void
+ */
+
+void tpm0_set_sample_rate(uint32_t rate)
+{
+	TPM0->MOD = TPM_MOD_MOD(PERIOD(rate));
+	TPM0->CNT = ZERO; //Any write clears the counter
+}
+
 /*
  * @name   init_TPM1
  * @brief  Function initiates TPM1
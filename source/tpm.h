@@ -13,9 +13,13 @@
 #ifndef TPM_H_
 #define TPM_H_
 
+#include <stdint.h>
+
 #define CLOCK                   (48000000) //Clock frequency
 #define INPUT_SAMPLE_RATE       (96000)//ADC Input Sampling Rate: 96KHz
-#define OUTPUT_SAMPLE_RATE      (48000) //DAC Output Sampling Rate: 48KHz; TPM Overflow
+#define OUTPUT_SAMPLE_RATE      (48000) //DAC Output Sampling Rate at reset: 48KHz; TPM Overflow
+#define OUTPUT_RATE_MIN         (8000)  //Lowest output rate audio_set_sample_rate() accepts
+#define OUTPUT_RATE_MAX         (OUTPUT_SAMPLE_RATE) //Highest, the mixer budget is sized for it
 
 /*
  * @name   init_TPM0
@@ -29,6 +33,18 @@
 
 void init_TPM0();
 
+/*
+ * @name   tpm0_set_sample_rate
+ * @brief  Function reprograms the TPM0 overflow rate
+ *
+ * Sets MOD for a DAC output sample rate; the counter restarts so the new period starts at once
+ *
+ * @param  uint32_t rate (Hz, a divisor of CLOCK)
+ * @return void
+ */
+
+void tpm0_set_sample_rate(uint32_t rate);
+
 /*
  * @name   init_TPM1
  * @brief  Function initiates TPM1
@@ -0,0 +1,87 @@
+/*
+ * @file        tunes.c
+ * @brief       Tune tables and roll angle zones function implementations
+ *
+ * The four tunes played by the roll angle, as sequencer patterns, and the mapping from roll angle
+ * to tune. Kept apart from the player so the same tunes can be rendered on the host.
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       MCUXpresso IDE, gcc
+ */
+
+#include <stddef.h>
+#include "tunes.h"
+#include "tone_to_sample.h"
+#include "wavetable.h"
+
+//Envelope of each tune: attack ms, decay ms, sustain level, release ms
+static const adsr_params_t tune_envelopes[NUM_TUNES] =
+{
+	{ 20, 200, ENV_Q15(0.6), 300 }, //tune 1: soft
+	{ 5,  300, ENV_Q15(0.3), 150 }, //tune 2: plucked
+	{ 5,  0,   ENV_Q15(1.0), 60  }, //tune 3: organ
+	{ 80, 200, ENV_Q15(0.8), 400 }  //tune 4: pad
+};
+
+//Tune notes: frequency, length in sixteenths, velocity
+static const seq_step_t tune1_steps[] = //A4, D5, D6
+{
+	{ WAVEFORM1_FREQ, 4, 127 }, { WAVEFORM2_FREQ, 4, 100 }, { WAVEFORM3_FREQ, 4, 100 }
+};
+static const seq_step_t tune2_steps[] = //D4, E5, F5
+{
+	{ WAVEFORM4_FREQ, 4, 127 }, { WAVEFORM5_FREQ, 4, 100 }, { WAVEFORM6_FREQ, 4, 100 }
+};
+static const seq_step_t tune3_steps[] = //E6, F6, G6
+{
+	{ WAVEFORM7_FREQ, 4, 127 }, { WAVEFORM8_FREQ, 4, 100 }, { WAVEFORM9_FREQ, 4, 100 }
+};
+static const seq_step_t tune4_steps[] = //D4, D5, D6
+{
+	{ WAVEFORM10_FREQ, 4, 127 }, { WAVEFORM11_FREQ, 4, 100 }, { WAVEFORM12_FREQ, 4, 100 }
+};
+
+//Tunes, looping at one note per second; a new tune is a new row
+static const seq_pattern_t tunes[NUM_TUNES] =
+{
+	{ tune1_steps, SEQ_LENGTH(tune1_steps), 1, WAVE_SINE,     60, &tune_envelopes[0] },
+	{ tune2_steps, SEQ_LENGTH(tune2_steps), 1, WAVE_TRIANGLE, 60, &tune_envelopes[1] },
+	{ tune3_steps, SEQ_LENGTH(tune3_steps), 1, WAVE_SQUARE,   60, &tune_envelopes[2] },
+	{ tune4_steps, SEQ_LENGTH(tune4_steps), 1, WAVE_SAW,      60, &tune_envelopes[3] }
+};
+
+/*
+ * @name   tune_pattern
+ * @brief  Pattern of a tune
+ *
+ * @param  int tune (1..NUM_TUNES)
+ * @return const seq_pattern_t *, NULL for any other tune number
+ */
+const seq_pattern_t *tune_pattern(int tune)
+{
+	if(tune < 1 || tune > NUM_TUNES)
+		return NULL;
+	return &tunes[tune - 1];
+}
+
+/*
+ * @name   roll_zone
+ * @brief  Maps the roll angle to the tune zone
+ *
+ * @param  int roll (degrees, positive)
+ * @return int zone: ROLL_SILENT, 1..NUM_TUNES for a tune, ROLL_OUT_OF_RANGE
+ */
+int roll_zone(int roll)
+{
+	if (roll <= 5)
+		return ROLL_SILENT;
+	else if (roll <= 45)
+		return 1;
+	else if (roll <= 90)
+		return 2;
+	else if (roll <= 135)
+		return 3;
+	else if (roll <= 800)
+		return 4;
+	return ROLL_OUT_OF_RANGE;
+}
@@ -0,0 +1,42 @@
+/*
+ * @file        tunes.h
+ * @brief       Tune tables and roll angle zones function declarations
+ *
+ * The four tunes played by the roll angle, as sequencer patterns, and the mapping from roll angle
+ * to tune. Kept apart from the player so the same tunes can be rendered on the host.
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       MCUXpresso IDE, gcc
+ */
+
+#ifndef TUNES_H_
+#define TUNES_H_
+
+#include "sequencer.h"
+
+#define NUM_TUNES        (4)
+#define ROLL_SILENT      (0)     //Zone of a board lying flat
+#define ROLL_OUT_OF_RANGE (-1)   //Zone of a roll no tune is mapped to
+
+/*
+ * @name   tune_pattern
+ * @brief  Pattern of a tune
+ *
+ * Tune 1: A4, D5, D6, tune 2: D4, E5, F5, tune 3: E6, F6, G6, tune 4: D4, D5, D6,
+ * one note a second, looped
+ *
+ * @param  int tune (1..NUM_TUNES)
+ * @return const seq_pattern_t *, NULL for any other tune number
+ */
+const seq_pattern_t *tune_pattern(int tune);
+
+/*
+ * @name   roll_zone
+ * @brief  Maps the roll angle to the tune zone
+ *
+ * @param  int roll (degrees, positive)
+ * @return int zone: ROLL_SILENT, 1..NUM_TUNES for a tune, ROLL_OUT_OF_RANGE
+ */
+int roll_zone(int roll);
+
+#endif /* TUNES_H_ */
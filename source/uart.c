@@ -10,8 +10,69 @@
 
 #include <stdio.h>
 #include "uart.h"
+#include "dma.h"
 
 Q_T TxQ, RxQ; //Transmit and receive queues
+static volatile uart_rx_handler_t rx_handler; //Takes received bytes instead of RxQ when set
+
+/*
+ * @name   set_divider
+ * @brief  Function sets the baud rate divider and oversampling ratio
+ *
+ * Tries every ratio from UART_OSR_MIN to UART_OSR_MAX and keeps the one whose rounded divider
+ * lands closest to the rate. The transmitter and receiver must be disabled.
+ *
+ * @param  uint32_t baud_rate
+ * @return none
+ */
+static void set_divider(uint32_t baud_rate)
+{
+	uint32_t clock = (uint32_t)SYS_CLOCK;
+	uint32_t best_osr = UART_OVERSAMPLE_RATE, best_sbr = 1, best_error = UINT32_MAX;
+
+	for(uint32_t osr = UART_OSR_MIN; osr <= UART_OSR_MAX; osr++)
+	{
+		uint32_t sbr = (clock + (baud_rate * osr) / 2) / (baud_rate * osr);
+		uint32_t actual, error;
+
+		if(sbr == 0 || sbr > UART0_BDL_SBR_MASK + (UART0_BDH_SBR_MASK << SHIFT_BY_EIGHT))
+			continue;
+		actual = clock / (sbr * osr);
+		error = (actual > baud_rate) ? actual - baud_rate : baud_rate - actual;
+		if(error < best_error)
+		{
+			best_error = error;
+			best_osr = osr;
+			best_sbr = sbr;
+		}
+	}
+	UART0->BDH &= ~UART0_BDH_SBR_MASK;
+	UART0->BDH |= UART0_BDH_SBR(best_sbr>>SHIFT_BY_EIGHT);
+	UART0->BDL = UART0_BDL_SBR(best_sbr);
+	UART0->C4 = (UART0->C4 & ~UART0_C4_OSR_MASK) | UART0_C4_OSR(best_osr-1);
+}
+
+/*
+ * @name   send_health
+ * @brief  Function answers a health query with the audio counters as a binary frame
+ *
+ * Runs in the receive interrupt, at the priority of DMA0_IRQHandler, so the counters cannot
+ * change while they are packed. The frame is queued whole or not at all, so a host waiting for
+ * it never sees part of one; it is dropped when the transmit queue lacks room.
+ *
+ * @param  None
+ * @return none
+ */
+static void send_health(void)
+{
+	uint8_t frame[HEALTH_FRAME_BYTES];
+
+	if(Q_MAX_SIZE - cbfifo_length(&TxQ) < HEALTH_FRAME_BYTES)
+		return;
+	health_pack(&audio_stream_stats, frame);
+	cbfifo_enqueue(frame, HEALTH_FRAME_BYTES, &TxQ);
+	UART0->C2 |= UART0_C2_TIE(1);
+}
 
 /*
  * @name   uart_init
@@ -25,8 +86,6 @@ Q_T TxQ, RxQ; //Transmit and receive queues
 //configure UART0 to communicate with the OpenSDA debug	MCU
 void uart_init(uint32_t baud_rate)
 {
-	uint16_t sbr;
-
 	//Clock gating enabled for UART0 and Port A
 	SIM->SCGC4 |= SIM_SCGC4_UART0_MASK;
 	SIM->SCGC5 |= SIM_SCGC5_PORTA_MASK;
@@ -42,11 +101,7 @@ void uart_init(uint32_t baud_rate)
 	PORTA->PCR[2] = PORT_PCR_ISF_MASK | PORT_PCR_MUX(2); // Tx
 
 	//Baud rate and oversampling ratio set
-	sbr = (uint16_t)((SYS_CLOCK)/(baud_rate * UART_OVERSAMPLE_RATE));
-	UART0->BDH &= ~UART0_BDH_SBR_MASK;
-	UART0->BDH |= UART0_BDH_SBR(sbr>>SHIFT_BY_EIGHT);
-	UART0->BDL = UART0_BDL_SBR(sbr);
-	UART0->C4 |= UART0_C4_OSR(UART_OVERSAMPLE_RATE-1);
+	set_divider(baud_rate);
 
 	//Interrupts for RX active edge and LIN break detect set, one stop bit selected
 	UART0->BDH |= UART0_BDH_RXEDGIE(0) |
@@ -106,6 +161,13 @@ void UART0_IRQHandler(void)
 {
 	uint8_t ch; //Variable to store or transmit the data
 
+	//If interrupt due to an RX edge armed by power_sleep(): one wake per sleep, so disarm it
+	if ((UART0->BDH & UART0_BDH_RXEDGIE_MASK) && (UART0->S2 & UART0_S2_RXEDGIF_MASK))
+	{
+		UART0->S2 |= UART0_S2_RXEDGIF_MASK;     //Write 1 to clear
+		UART0->BDH &= ~UART0_BDH_RXEDGIE_MASK;
+	}
+
 	//If interrupt due to error flags
 	if (UART0->S1 & (UART_S1_OR_MASK |
 			 UART_S1_NF_MASK |
@@ -125,16 +187,30 @@ void UART0_IRQHandler(void)
 	if (UART0->S1 & UART0_S1_RDRF_MASK)
 	{
 		ch = UART0->D; //received a character from the D register
-		UART0->D = ch; // The character is immediately sent back (echoed) by writing it back to the D register.
 
-		//Enqueue a byte successfully in read buffer and check if it enqueued
-		if(cbfifo_enqueue(&ch, 1, &RxQ) == 1)
+		//Streaming: the handler takes the byte, no echo
+		if (rx_handler != NULL)
 		{
-			;
+			rx_handler(ch);
+		}
+		//Health query: answered straight away, not echoed or queued for the command line
+		else if (ch == HEALTH_QUERY)
+		{
+			send_health();
 		}
 		else
 		{
-			// error - queue full- discard character
+			UART0->D = ch; // The character is immediately sent back (echoed) by writing it back to the D register.
+
+			//Enqueue a byte successfully in read buffer and check if it enqueued
+			if(cbfifo_enqueue(&ch, 1, &RxQ) == 1)
+			{
+				;
+			}
+			else
+			{
+				// error - queue full- discard character
+			}
 		}
 	}
 
@@ -208,3 +284,49 @@ int __sys_readc(void) //function reads characters from the UART receive buffer,
 	else
 		return ERROR; //Dequeue operation failed
 }
+
+/*
+ * @name   uart_tx_idle
+ * @brief  Function checks whether UART0 has finished transmitting
+ *
+ * True when the transmit queue is empty and the last stop bit has left the shifter.
+ * UART0 stops with its clock in VLPS, so this must hold before sleeping or output is cut off.
+ *
+ * @param  None
+ * @return int 1 when idle, 0 while transmitting
+ */
+int uart_tx_idle(void)
+{
+	return cbfifo_empty(&TxQ) && (UART0->S1 & UART0_S1_TC_MASK);
+}
+
+/*
+ * @name   uart_set_baud
+ * @brief  Function switches the UART0 baud rate
+ *
+ * Picks the oversampling ratio and divider closest to the rate. The receiver and transmitter
+ * are off while the divider changes, so a byte on the line meanwhile is lost.
+ *
+ * @param  uint32_t baud_rate
+ * @return none
+ */
+void uart_set_baud(uint32_t baud_rate)
+{
+	UART0->C2 &= ~UART0_C2_TE_MASK & ~UART0_C2_RE_MASK;
+	set_divider(baud_rate);
+	UART0->C2 |= UART0_C2_RE(1) | UART0_C2_TE(1);
+}
+
+/*
+ * @name   uart_set_rx_handler
+ * @brief  Function routes received bytes to a handler in the interrupt
+ *
+ * NULL restores the echo and the receive queue read by getchar
+ *
+ * @param  uart_rx_handler_t handler
+ * @return none
+ */
+void uart_set_rx_handler(uart_rx_handler_t handler)
+{
+	rx_handler = handler; //Single word write, safe against the receive interrupt
+}
@@ -27,9 +27,14 @@
 #define BUS_CLOCK            (24e6)  // Bus clock frequency: 24MHz
 #define SYS_CLOCK            (24e6)  // System clock frequency: 24MHz
 
+#define UART_OSR_MIN         (8)     // Lower ratios need both edge sampling
+#define UART_OSR_MAX         (32)
 #define SHIFT_BY_EIGHT       (8)     // Shifting sbr by 8 bits
 #define ERROR                (-1)    // Returns -1 on error
 
+//Receive hook: takes each received byte in the interrupt instead of the echo and receive queue
+typedef void (*uart_rx_handler_t)(uint8_t byte);
+
 /*
  * @name   uart_init
  * @brief  Function initializes UART0
@@ -76,4 +81,37 @@ int __sys_write(int handle, char *buf, int size);
  */
 int __sys_readc();
 
+/*
+ * @name   uart_tx_idle
+ * @brief  Function checks whether UART0 has finished transmitting
+ *
+ * True when the transmit queue is empty and the last stop bit has been sent
+ *
+ * @param  None
+ * @return int 1 when idle, 0 while transmitting
+ */
+int uart_tx_idle(void);
+
+/*
+ * @name   uart_set_baud
+ * @brief  Function switches the UART0 baud rate
+ *
+ * Picks the oversampling ratio and divider closest to the rate. Wait for uart_tx_idle() first.
+ *
+ * @param  uint32_t baud_rate
+ * @return none
+ */
+void uart_set_baud(uint32_t baud_rate);
+
+/*
+ * @name   uart_set_rx_handler
+ * @brief  Function routes received bytes to a handler in the interrupt
+ *
+ * NULL restores the echo and the receive queue read by getchar
+ *
+ * @param  uart_rx_handler_t handler
+ * @return none
+ */
+void uart_set_rx_handler(uart_rx_handler_t handler);
+
 #endif /* UART_H_ */
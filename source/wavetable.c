@@ -0,0 +1,74 @@
+/*
+ * @file        wavetable.c
+ * @brief       Flash wavetable bank selection functions
+ *
+ * Picks the table for a waveform and pitch. The tables themselves are generated at build time
+ * into wavetable_data.c by host/gen_wavetables.c.
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       MCUXpresso IDE, gcc
+ */
+
+#include "wavetable.h"
+
+#define NYQUIST_TUNING_WORD  (0x80000000u)
+
+static const char * const wave_names[WAVE_COUNT] = { "sine", "triangle", "square", "saw" };
+
+/*
+ * @name   wavetable_band
+ * @brief  Octave band for a tuning word
+ *
+ * Counts octaves down from Nyquist; a shift loop since the Cortex-M0+ has no CLZ instruction
+ *
+ * @param  uint32_t tuning_word
+ * @return int band, 0..WAVETABLE_BANDS-1
+ */
+int wavetable_band(uint32_t tuning_word)
+{
+	uint32_t limit = NYQUIST_TUNING_WORD >> 1;
+	int band = 0;
+
+	while(band < WAVETABLE_BANDS - 1 && tuning_word < limit)
+	{
+		band++;
+		limit >>= 1;
+	}
+	return band;
+}
+
+/*
+ * @name   wavetable_select
+ * @brief  Table to play a waveform at a pitch
+ *
+ * Unknown waveforms play sine
+ *
+ * @param  uint8_t wave (wave_t), uint32_t tuning_word
+ * @return const int16_t * one cycle, DDS_TABLE_SIZE samples
+ */
+const int16_t *wavetable_select(uint8_t wave, uint32_t tuning_word)
+{
+	switch(wave)
+	{
+	case WAVE_TRIANGLE:
+		return wavetable_triangle[wavetable_band(tuning_word)];
+	case WAVE_SQUARE:
+		return wavetable_square[wavetable_band(tuning_word)];
+	case WAVE_SAW:
+		return wavetable_saw[wavetable_band(tuning_word)];
+	default:
+		return dds_sine_table;
+	}
+}
+
+/*
+ * @name   wavetable_name
+ * @brief  Printable name of a waveform
+ *
+ * @param  uint8_t wave (wave_t)
+ * @return const char *
+ */
+const char *wavetable_name(uint8_t wave)
+{
+	return (wave < WAVE_COUNT) ? wave_names[wave] : "?";
+}
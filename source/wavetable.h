@@ -0,0 +1,66 @@
+/*
+ * @file        wavetable.h
+ * @brief       Flash wavetable bank declarations
+ *
+ * Const one-cycle tables for sine, triangle, square and sawtooth, generated at build time by
+ * host/gen_wavetables.c into wavetable_data.c. Triangle, square and sawtooth have one band-limited
+ * table per octave and the table is picked from the tuning word, so no harmonic reaches Nyquist.
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       MCUXpresso IDE, gcc
+ */
+
+#ifndef WAVETABLE_H_
+#define WAVETABLE_H_
+
+#include <stdint.h>
+#include "dds.h"
+
+#define WAVETABLE_BANDS   (DDS_TABLE_BITS - 2)  //Octave bands; the last one holds DDS_TABLE_SIZE / 8 harmonics
+
+//Waveform of a voice
+typedef enum
+{
+	WAVE_SINE = 0,
+	WAVE_TRIANGLE,
+	WAVE_SQUARE,
+	WAVE_SAW,
+	WAVE_COUNT
+} wave_t;
+
+extern const int16_t wavetable_triangle[WAVETABLE_BANDS][DDS_TABLE_SIZE];
+extern const int16_t wavetable_square[WAVETABLE_BANDS][DDS_TABLE_SIZE];
+extern const int16_t wavetable_saw[WAVETABLE_BANDS][DDS_TABLE_SIZE];
+
+/*
+ * @name   wavetable_band
+ * @brief  Octave band for a tuning word
+ *
+ * Band b holds harmonics up to 2^b and is used for tuning words below 2^(31-b)
+ *
+ * @param  uint32_t tuning_word
+ * @return int band, 0..WAVETABLE_BANDS-1
+ */
+int wavetable_band(uint32_t tuning_word);
+
+/*
+ * @name   wavetable_select
+ * @brief  Table to play a waveform at a pitch
+ *
+ * Unknown waveforms play sine
+ *
+ * @param  uint8_t wave (wave_t), uint32_t tuning_word
+ * @return const int16_t * one cycle, DDS_TABLE_SIZE samples
+ */
+const int16_t *wavetable_select(uint8_t wave, uint32_t tuning_word);
+
+/*
+ * @name   wavetable_name
+ * @brief  Printable name of a waveform
+ *
+ * @param  uint8_t wave (wave_t)
+ * @return const char *
+ */
+const char *wavetable_name(uint8_t wave);
+
+#endif /* WAVETABLE_H_ */
@@ -0,0 +1,695 @@
+/*
+ * @file        wavetable_data.c
+ * @brief       Flash wavetable bank, 256 samples per cycle
+ *
+ * Generated by host/gen_wavetables.c, do not edit. Rebuild with make -C host wavetables TABLE_BITS=8
+ * and build the target with DDS_TABLE_BITS=8.
+ *
+ * @author      Swathi Venkatachalam
+ * @tools       gcc
+ */
+
+#include "wavetable.h"
+
+#if DDS_TABLE_BITS != 8
+#error "wavetable_data.c was generated for DDS_TABLE_BITS 8, rerun make -C host wavetables"
+#endif
+
+//One cycle of sin(2*pi*i/256) * 32767
+const int16_t dds_sine_table[DDS_TABLE_SIZE] =
+{
+	     0,    804,   1608,   2410,   3212,   4011,   4808,   5602,
+	  6393,   7179,   7962,   8739,   9512,  10278,  11039,  11793,
+	 12539,  13279,  14010,  14732,  15446,  16151,  16846,  17530,
+	 18204,  18868,  19519,  20159,  20787,  21403,  22005,  22594,
+	 23170,  23731,  24279,  24811,  25329,  25832,  26319,  26790,
+	 27245,  27683,  28105,  28510,  28898,  29268,  29621,  29956,
+	 30273,  30571,  30852,  31113,  31356,  31580,  31785,  31971,
+	 32137,  32285,  32412,  32521,  32609,  32678,  32728,  32757,
+	 32767,  32757,  32728,  32678,  32609,  32521,  32412,  32285,
+	 32137,  31971,  31785,  31580,  31356,  31113,  30852,  30571,
+	 30273,  29956,  29621,  29268,  28898,  28510,  28105,  27683,
+	 27245,  26790,  26319,  25832,  25329,  24811,  24279,  23731,
+	 23170,  22594,  22005,  21403,  20787,  20159,  19519,  18868,
+	 18204,  17530,  16846,  16151,  15446,  14732,  14010,  13279,
+	 12539,  11793,  11039,  10278,   9512,   8739,   7962,   7179,
+	  6393,   5602,   4808,   4011,   3212,   2410,   1608,    804,
+	     0,   -804,  -1608,  -2410,  -3212,  -4011,  -4808,  -5602,
+	 -6393,  -7179,  -7962,  -8739,  -9512, -10278, -11039, -11793,
+	-12539, -13279, -14010, -14732, -15446, -16151, -16846, -17530,
+	-18204, -18868, -19519, -20159, -20787, -21403, -22005, -22594,
+	-23170, -23731, -24279, -24811, -25329, -25832, -26319, -26790,
+	-27245, -27683, -28105, -28510, -28898, -29268, -29621, -29956,
+	-30273, -30571, -30852, -31113, -31356, -31580, -31785, -31971,
+	-32137, -32285, -32412, -32521, -32609, -32678, -32728, -32757,
+	-32767, -32757, -32728, -32678, -32609, -32521, -32412, -32285,
+	-32137, -31971, -31785, -31580, -31356, -31113, -30852, -30571,
+	-30273, -29956, -29621, -29268, -28898, -28510, -28105, -27683,
+	-27245, -26790, -26319, -25832, -25329, -24811, -24279, -23731,
+	-23170, -22594, -22005, -21403, -20787, -20159, -19519, -18868,
+	-18204, -17530, -16846, -16151, -15446, -14732, -14010, -13279,
+	-12539, -11793, -11039, -10278,  -9512,  -8739,  -7962,  -7179,
+	 -6393,  -5602,  -4808,  -4011,  -3212,  -2410,  -1608,   -804,
+};
+
+const int16_t wavetable_triangle[WAVETABLE_BANDS][DDS_TABLE_SIZE] =
+{
+	//Band 0: harmonics 1..1, tuning words below 2^31
+	{
+		     0,    660,   1320,   1979,   2637,   3293,   3947,   4599,
+		  5248,   5894,   6536,   7175,   7809,   8438,   9063,   9681,
+		 10294,  10901,  11501,  12095,  12681,  13259,  13830,  14392,
+		 14945,  15490,  16025,  16550,  17066,  17571,  18065,  18549,
+		 19022,  19483,  19932,  20369,  20794,  21207,  21607,  21993,
+		 22367,  22727,  23073,  23406,  23724,  24028,  24318,  24593,
+		 24853,  25098,  25328,  25543,  25742,  25926,  26094,  26247,
+		 26384,  26504,  26609,  26698,  26771,  26828,  26868,  26892,
+		 26901,  26892,  26868,  26828,  26771,  26698,  26609,  26504,
+		 26384,  26247,  26094,  25926,  25742,  25543,  25328,  25098,
+		 24853,  24593,  24318,  24028,  23724,  23406,  23073,  22727,
+		 22367,  21993,  21607,  21207,  20794,  20369,  19932,  19483,
+		 19022,  18549,  18065,  17571,  17066,  16550,  16025,  15490,
+		 14945,  14392,  13830,  13259,  12681,  12095,  11501,  10901,
+		 10294,   9681,   9063,   8438,   7809,   7175,   6536,   5894,
+		  5248,   4599,   3947,   3293,   2637,   1979,   1320,    660,
+		     0,   -660,  -1320,  -1979,  -2637,  -3293,  -3947,  -4599,
+		 -5248,  -5894,  -6536,  -7175,  -7809,  -8438,  -9063,  -9681,
+		-10294, -10901, -11501, -12095, -12681, -13259, -13830, -14392,
+		-14945, -15490, -16025, -16550, -17066, -17571, -18065, -18549,
+		-19022, -19483, -19932, -20369, -20794, -21207, -21607, -21993,
+		-22367, -22727, -23073, -23406, -23724, -24028, -24318, -24593,
+		-24853, -25098, -25328, -25543, -25742, -25926, -26094, -26247,
+		-26384, -26504, -26609, -26698, -26771, -26828, -26868, -26892,
+		-26901, -26892, -26868, -26828, -26771, -26698, -26609, -26504,
+		-26384, -26247, -26094, -25926, -25742, -25543, -25328, -25098,
+		-24853, -24593, -24318, -24028, -23724, -23406, -23073, -22727,
+		-22367, -21993, -21607, -21207, -20794, -20369, -19932, -19483,
+		-19022, -18549, -18065, -17571, -17066, -16550, -16025, -15490,
+		-14945, -14392, -13830, -13259, -12681, -12095, -11501, -10901,
+		-10294,  -9681,  -9063,  -8438,  -7809,  -7175,  -6536,  -5894,
+		 -5248,  -4599,  -3947,  -3293,  -2637,  -1979,  -1320,   -660,
+	},
+	//Band 1: harmonics 1..2, tuning words below 2^30
+	{
+		     0,    660,   1320,   1979,   2637,   3293,   3947,   4599,
+		  5248,   5894,   6536,   7175,   7809,   8438,   9063,   9681,
+		 10294,  10901,  11501,  12095,  12681,  13259,  13830,  14392,
+		 14945,  15490,  16025,  16550,  17066,  17571,  18065,  18549,
+		 19022,  19483,  19932,  20369,  20794,  21207,  21607,  21993,
+		 22367,  22727,  23073,  23406,  23724,  24028,  24318,  24593,
+		 24853,  25098,  25328,  25543,  25742,  25926,  26094,  26247,
+		 26384,  26504,  26609,  26698,  26771,  26828,  26868,  26892,
+		 26901,  26892,  26868,  26828,  26771,  26698,  26609,  26504,
+		 26384,  26247,  26094,  25926,  25742,  25543,  25328,  25098,
+		 24853,  24593,  24318,  24028,  23724,  23406,  23073,  22727,
+		 22367,  21993,  21607,  21207,  20794,  20369,  19932,  19483,
+		 19022,  18549,  18065,  17571,  17066,  16550,  16025,  15490,
+		 14945,  14392,  13830,  13259,  12681,  12095,  11501,  10901,
+		 10294,   9681,   9063,   8438,   7809,   7175,   6536,   5894,
+		  5248,   4599,   3947,   3293,   2637,   1979,   1320,    660,
+		     0,   -660,  -1320,  -1979,  -2637,  -3293,  -3947,  -4599,
+		 -5248,  -5894,  -6536,  -7175,  -7809,  -8438,  -9063,  -9681,
+		-10294, -10901, -11501, -12095, -12681, -13259, -13830, -14392,
+		-14945, -15490, -16025, -16550, -17066, -17571, -18065, -18549,
+		-19022, -19483, -19932, -20369, -20794, -21207, -21607, -21993,
+		-22367, -22727, -23073, -23406, -23724, -24028, -24318, -24593,
+		-24853, -25098, -25328, -25543, -25742, -25926, -26094, -26247,
+		-26384, -26504, -26609, -26698, -26771, -26828, -26868, -26892,
+		-26901, -26892, -26868, -26828, -26771, -26698, -26609, -26504,
+		-26384, -26247, -26094, -25926, -25742, -25543, -25328, -25098,
+		-24853, -24593, -24318, -24028, -23724, -23406, -23073, -22727,
+		-22367, -21993, -21607, -21207, -20794, -20369, -19932, -19483,
+		-19022, -18549, -18065, -17571, -17066, -16550, -16025, -15490,
+		-14945, -14392, -13830, -13259, -12681, -12095, -11501, -10901,
+		-10294,  -9681,  -9063,  -8438,  -7809,  -7175,  -6536,  -5894,
+		 -5248,  -4599,  -3947,  -3293,  -2637,  -1979,  -1320,   -660,
+	},
+	//Band 2: harmonics 1..4, tuning words below 2^29
+	{
+		     0,    440,    881,   1324,   1769,   2217,   2669,   3126,
+		  3587,   4055,   4529,   5010,   5498,   5994,   6499,   7012,
+		  7533,   8063,   8602,   9150,   9706,  10271,  10844,  11425,
+		 12014,  12609,  13210,  13818,  14429,  15045,  15665,  16286,
+		 16908,  17530,  18151,  18770,  19385,  19996,  20600,  21196,
+		 21784,  22361,  22927,  23479,  24017,  24539,  25044,  25530,
+		 25997,  26442,  26865,  27264,  27638,  27987,  28309,  28603,
+		 28869,  29105,  29311,  29487,  29631,  29744,  29825,  29873,
+		 29889,  29873,  29825,  29744,  29631,  29487,  29311,  29105,
+		 28869,  28603,  28309,  27987,  27638,  27264,  26865,  26442,
+		 25997,  25530,  25044,  24539,  24017,  23479,  22927,  22361,
+		 21784,  21196,  20600,  19996,  19385,  18770,  18151,  17530,
+		 16908,  16286,  15665,  15045,  14429,  13818,  13210,  12609,
+		 12014,  11425,  10844,  10271,   9706,   9150,   8602,   8063,
+		  7533,   7012,   6499,   5994,   5498,   5010,   4529,   4055,
+		  3587,   3126,   2669,   2217,   1769,   1324,    881,    440,
+		     0,   -440,   -881,  -1324,  -1769,  -2217,  -2669,  -3126,
+		 -3587,  -4055,  -4529,  -5010,  -5498,  -5994,  -6499,  -7012,
+		 -7533,  -8063,  -8602,  -9150,  -9706, -10271, -10844, -11425,
+		-12014, -12609, -13210, -13818, -14429, -15045, -15665, -16286,
+		-16908, -17530, -18151, -18770, -19385, -19996, -20600, -21196,
+		-21784, -22361, -22927, -23479, -24017, -24539, -25044, -25530,
+		-25997, -26442, -26865, -27264, -27638, -27987, -28309, -28603,
+		-28869, -29105, -29311, -29487, -29631, -29744, -29825, -29873,
+		-29889, -29873, -29825, -29744, -29631, -29487, -29311, -29105,
+		-28869, -28603, -28309, -27987, -27638, -27264, -26865, -26442,
+		-25997, -25530, -25044, -24539, -24017, -23479, -22927, -22361,
+		-21784, -21196, -20600, -19996, -19385, -18770, -18151, -17530,
+		-16908, -16286, -15665, -15045, -14429, -13818, -13210, -12609,
+		-12014, -11425, -10844, -10271,  -9706,  -9150,  -8602,  -8063,
+		 -7533,  -7012,  -6499,  -5994,  -5498,  -5010,  -4529,  -4055,
+		 -3587,  -3126,  -2669,  -2217,  -1769,  -1324,   -881,   -440,
+	},
+	//Band 3: harmonics 1..8, tuning words below 2^28
+	{
+		     0,    478,    958,   1441,   1928,   2421,   2921,   3428,
+		  3944,   4467,   4999,   5539,   6085,   6637,   7195,   7755,
+		  8317,   8879,   9439,   9996,  10548,  11094,  11631,  12160,
+		 12680,  13190,  13690,  14181,  14663,  15139,  15608,  16073,
+		 16535,  16998,  17463,  17933,  18410,  18895,  19392,  19901,
+		 20424,  20961,  21513,  22080,  22660,  23252,  23855,  24464,
+		 25078,  25691,  26300,  26900,  27485,  28051,  28591,  29100,
+		 29574,  30006,  30391,  30725,  31005,  31226,  31385,  31482,
+		 31514,  31482,  31385,  31226,  31005,  30725,  30391,  30006,
+		 29574,  29100,  28591,  28051,  27485,  26900,  26300,  25691,
+		 25078,  24464,  23855,  23252,  22660,  22080,  21513,  20961,
+		 20424,  19901,  19392,  18895,  18410,  17933,  17463,  16998,
+		 16535,  16073,  15608,  15139,  14663,  14181,  13690,  13190,
+		 12680,  12160,  11631,  11094,  10548,   9996,   9439,   8879,
+		  8317,   7755,   7195,   6637,   6085,   5539,   4999,   4467,
+		  3944,   3428,   2921,   2421,   1928,   1441,    958,    478,
+		     0,   -478,   -958,  -1441,  -1928,  -2421,  -2921,  -3428,
+		 -3944,  -4467,  -4999,  -5539,  -6085,  -6637,  -7195,  -7755,
+		 -8317,  -8879,  -9439,  -9996, -10548, -11094, -11631, -12160,
+		-12680, -13190, -13690, -14181, -14663, -15139, -15608, -16073,
+		-16535, -16998, -17463, -17933, -18410, -18895, -19392, -19901,
+		-20424, -20961, -21513, -22080, -22660, -23252, -23855, -24464,
+		-25078, -25691, -26300, -26900, -27485, -28051, -28591, -29100,
+		-29574, -30006, -30391, -30725, -31005, -31226, -31385, -31482,
+		-31514, -31482, -31385, -31226, -31005, -30725, -30391, -30006,
+		-29574, -29100, -28591, -28051, -27485, -26900, -26300, -25691,
+		-25078, -24464, -23855, -23252, -22660, -22080, -21513, -20961,
+		-20424, -19901, -19392, -18895, -18410, -17933, -17463, -16998,
+		-16535, -16073, -15608, -15139, -14663, -14181, -13690, -13190,
+		-12680, -12160, -11631, -11094, -10548,  -9996,  -9439,  -8879,
+		 -8317,  -7755,  -7195,  -6637,  -6085,  -5539,  -4999,  -4467,
+		 -3944,  -3428,  -2921,  -2421,  -1928,  -1441,   -958,   -478,
+	},
+	//Band 4: harmonics 1..16, tuning words below 2^27
+	{
+		     0,    499,   1000,   1507,   2022,   2545,   3075,   3611,
+		  4150,   4689,   5224,   5754,   6277,   6791,   7297,   7797,
+		  8294,   8791,   9291,   9798,  10312,  10836,  11369,  11908,
+		 12450,  12993,  13532,  14063,  14586,  15098,  15600,  16095,
+		 16585,  17075,  17570,  18074,  18588,  19116,  19655,  20204,
+		 20758,  21312,  21860,  22397,  22919,  23425,  23913,  24389,
+		 24857,  25325,  25802,  26296,  26813,  27358,  27931,  28526,
+		 29136,  29745,  30336,  30887,  31378,  31786,  32093,  32283,
+		 32348,  32283,  32093,  31786,  31378,  30887,  30336,  29745,
+		 29136,  28526,  27931,  27358,  26813,  26296,  25802,  25325,
+		 24857,  24389,  23913,  23425,  22919,  22397,  21860,  21312,
+		 20758,  20204,  19655,  19116,  18588,  18074,  17570,  17075,
+		 16585,  16095,  15600,  15098,  14586,  14063,  13532,  12993,
+		 12450,  11908,  11369,  10836,  10312,   9798,   9291,   8791,
+		  8294,   7797,   7297,   6791,   6277,   5754,   5224,   4689,
+		  4150,   3611,   3075,   2545,   2022,   1507,   1000,    499,
+		     0,   -499,  -1000,  -1507,  -2022,  -2545,  -3075,  -3611,
+		 -4150,  -4689,  -5224,  -5754,  -6277,  -6791,  -7297,  -7797,
+		 -8294,  -8791,  -9291,  -9798, -10312, -10836, -11369, -11908,
+		-12450, -12993, -13532, -14063, -14586, -15098, -15600, -16095,
+		-16585, -17075, -17570, -18074, -18588, -19116, -19655, -20204,
+		-20758, -21312, -21860, -22397, -22919, -23425, -23913, -24389,
+		-24857, -25325, -25802, -26296, -26813, -27358, -27931, -28526,
+		-29136, -29745, -30336, -30887, -31378, -31786, -32093, -32283,
+		-32348, -32283, -32093, -31786, -31378, -30887, -30336, -29745,
+		-29136, -28526, -27931, -27358, -26813, -26296, -25802, -25325,
+		-24857, -24389, -23913, -23425, -22919, -22397, -21860, -21312,
+		-20758, -20204, -19655, -19116, -18588, -18074, -17570, -17075,
+		-16585, -16095, -15600, -15098, -14586, -14063, -13532, -12993,
+		-12450, -11908, -11369, -10836, -10312,  -9798,  -9291,  -8791,
+		 -8294,  -7797,  -7297,  -6791,  -6277,  -5754,  -5224,  -4689,
+		 -4150,  -3611,  -3075,  -2545,  -2022,  -1507,  -1000,   -499,
+	},
+	//Band 5: harmonics 1..32, tuning words below 2^26
+	{
+		     0,    509,   1024,   1546,   2074,   2602,   3125,   3639,
+		  4148,   4657,   5172,   5695,   6223,   6751,   7274,   7788,
+		  8296,   8805,   9319,   9842,  10371,  10901,  11423,  11937,
+		 12445,  12952,  13466,  13990,  14520,  15051,  15574,  16087,
+		 16592,  17098,  17611,  18136,  18669,  19202,  19727,  20238,
+		 20740,  21242,  21754,  22281,  22819,  23357,  23883,  24391,
+		 24886,  25380,  25890,  26423,  26973,  27523,  28052,  28549,
+		 29022,  29495,  30001,  30560,  31162,  31761,  32282,  32640,
+		 32767,  32640,  32282,  31761,  31162,  30560,  30001,  29495,
+		 29022,  28549,  28052,  27523,  26973,  26423,  25890,  25380,
+		 24886,  24391,  23883,  23357,  22819,  22281,  21754,  21242,
+		 20740,  20238,  19727,  19202,  18669,  18136,  17611,  17098,
+		 16592,  16087,  15574,  15051,  14520,  13990,  13466,  12952,
+		 12445,  11937,  11423,  10901,  10371,   9842,   9319,   8805,
+		  8296,   7788,   7274,   6751,   6223,   5695,   5172,   4657,
+		  4148,   3639,   3125,   2602,   2074,   1546,   1024,    509,
+		     0,   -509,  -1024,  -1546,  -2074,  -2602,  -3125,  -3639,
+		 -4148,  -4657,  -5172,  -5695,  -6223,  -6751,  -7274,  -7788,
+		 -8296,  -8805,  -9319,  -9842, -10371, -10901, -11423, -11937,
+		-12445, -12952, -13466, -13990, -14520, -15051, -15574, -16087,
+		-16592, -17098, -17611, -18136, -18669, -19202, -19727, -20238,
+		-20740, -21242, -21754, -22281, -22819, -23357, -23883, -24391,
+		-24886, -25380, -25890, -26423, -26973, -27523, -28052, -28549,
+		-29022, -29495, -30001, -30560, -31162, -31761, -32282, -32640,
+		-32767, -32640, -32282, -31761, -31162, -30560, -30001, -29495,
+		-29022, -28549, -28052, -27523, -26973, -26423, -25890, -25380,
+		-24886, -24391, -23883, -23357, -22819, -22281, -21754, -21242,
+		-20740, -20238, -19727, -19202, -18669, -18136, -17611, -17098,
+		-16592, -16087, -15574, -15051, -14520, -13990, -13466, -12952,
+		-12445, -11937, -11423, -10901, -10371,  -9842,  -9319,  -8805,
+		 -8296,  -7788,  -7274,  -6751,  -6223,  -5695,  -5172,  -4657,
+		 -4148,  -3639,  -3125,  -2602,  -2074,  -1546,  -1024,   -509,
+	},
+};
+
+const int16_t wavetable_square[WAVETABLE_BANDS][DDS_TABLE_SIZE] =
+{
+	//Band 0: harmonics 1..1, tuning words below 2^31
+	{
+		     0,    804,   1608,   2410,   3212,   4011,   4808,   5602,
+		  6393,   7179,   7962,   8739,   9512,  10278,  11039,  11793,
+		 12539,  13279,  14010,  14732,  15446,  16151,  16846,  17530,
+		 18204,  18868,  19519,  20159,  20787,  21403,  22005,  22594,
+		 23170,  23731,  24279,  24811,  25329,  25832,  26319,  26790,
+		 27245,  27683,  28105,  28510,  28898,  29268,  29621,  29956,
+		 30273,  30571,  30852,  31113,  31356,  31580,  31785,  31971,
+		 32137,  32285,  32412,  32521,  32609,  32678,  32728,  32757,
+		 32767,  32757,  32728,  32678,  32609,  32521,  32412,  32285,
+		 32137,  31971,  31785,  31580,  31356,  31113,  30852,  30571,
+		 30273,  29956,  29621,  29268,  28898,  28510,  28105,  27683,
+		 27245,  26790,  26319,  25832,  25329,  24811,  24279,  23731,
+		 23170,  22594,  22005,  21403,  20787,  20159,  19519,  18868,
+		 18204,  17530,  16846,  16151,  15446,  14732,  14010,  13279,
+		 12539,  11793,  11039,  10278,   9512,   8739,   7962,   7179,
+		  6393,   5602,   4808,   4011,   3212,   2410,   1608,    804,
+		     0,   -804,  -1608,  -2410,  -3212,  -4011,  -4808,  -5602,
+		 -6393,  -7179,  -7962,  -8739,  -9512, -10278, -11039, -11793,
+		-12539, -13279, -14010, -14732, -15446, -16151, -16846, -17530,
+		-18204, -18868, -19519, -20159, -20787, -21403, -22005, -22594,
+		-23170, -23731, -24279, -24811, -25329, -25832, -26319, -26790,
+		-27245, -27683, -28105, -28510, -28898, -29268, -29621, -29956,
+		-30273, -30571, -30852, -31113, -31356, -31580, -31785, -31971,
+		-32137, -32285, -32412, -32521, -32609, -32678, -32728, -32757,
+		-32767, -32757, -32728, -32678, -32609, -32521, -32412, -32285,
+		-32137, -31971, -31785, -31580, -31356, -31113, -30852, -30571,
+		-30273, -29956, -29621, -29268, -28898, -28510, -28105, -27683,
+		-27245, -26790, -26319, -25832, -25329, -24811, -24279, -23731,
+		-23170, -22594, -22005, -21403, -20787, -20159, -19519, -18868,
+		-18204, -17530, -16846, -16151, -15446, -14732, -14010, -13279,
+		-12539, -11793, -11039, -10278,  -9512,  -8739,  -7962,  -7179,
+		 -6393,  -5602,  -4808,  -4011,  -3212,  -2410,  -1608,   -804,
+	},
+	//Band 1: harmonics 1..2, tuning words below 2^30
+	{
+		     0,    804,   1608,   2410,   3212,   4011,   4808,   5602,
+		  6393,   7179,   7962,   8739,   9512,  10278,  11039,  11793,
+		 12539,  13279,  14010,  14732,  15446,  16151,  16846,  17530,
+		 18204,  18868,  19519,  20159,  20787,  21403,  22005,  22594,
+		 23170,  23731,  24279,  24811,  25329,  25832,  26319,  26790,
+		 27245,  27683,  28105,  28510,  28898,  29268,  29621,  29956,
+		 30273,  30571,  30852,  31113,  31356,  31580,  31785,  31971,
+		 32137,  32285,  32412,  32521,  32609,  32678,  32728,  32757,
+		 32767,  32757,  32728,  32678,  32609,  32521,  32412,  32285,
+		 32137,  31971,  31785,  31580,  31356,  31113,  30852,  30571,
+		 30273,  29956,  29621,  29268,  28898,  28510,  28105,  27683,
+		 27245,  26790,  26319,  25832,  25329,  24811,  24279,  23731,
+		 23170,  22594,  22005,  21403,  20787,  20159,  19519,  18868,
+		 18204,  17530,  16846,  16151,  15446,  14732,  14010,  13279,
+		 12539,  11793,  11039,  10278,   9512,   8739,   7962,   7179,
+		  6393,   5602,   4808,   4011,   3212,   2410,   1608,    804,
+		     0,   -804,  -1608,  -2410,  -3212,  -4011,  -4808,  -5602,
+		 -6393,  -7179,  -7962,  -8739,  -9512, -10278, -11039, -11793,
+		-12539, -13279, -14010, -14732, -15446, -16151, -16846, -17530,
+		-18204, -18868, -19519, -20159, -20787, -21403, -22005, -22594,
+		-23170, -23731, -24279, -24811, -25329, -25832, -26319, -26790,
+		-27245, -27683, -28105, -28510, -28898, -29268, -29621, -29956,
+		-30273, -30571, -30852, -31113, -31356, -31580, -31785, -31971,
+		-32137, -32285, -32412, -32521, -32609, -32678, -32728, -32757,
+		-32767, -32757, -32728, -32678, -32609, -32521, -32412, -32285,
+		-32137, -31971, -31785, -31580, -31356, -31113, -30852, -30571,
+		-30273, -29956, -29621, -29268, -28898, -28510, -28105, -27683,
+		-27245, -26790, -26319, -25832, -25329, -24811, -24279, -23731,
+		-23170, -22594, -22005, -21403, -20787, -20159, -19519, -18868,
+		-18204, -17530, -16846, -16151, -15446, -14732, -14010, -13279,
+		-12539, -11793, -11039, -10278,  -9512,  -8739,  -7962,  -7179,
+		 -6393,  -5602,  -4808,  -4011,  -3212,  -2410,  -1608,   -804,
+	},
+	//Band 2: harmonics 1..4, tuning words below 2^29
+	{
+		     0,   1608,   3210,   4804,   6382,   7942,   9478,  10986,
+		 12461,  13899,  15297,  16650,  17955,  19208,  20407,  21549,
+		 22630,  23650,  24605,  25494,  26316,  27070,  27755,  28370,
+		 28917,  29394,  29803,  30145,  30420,  30630,  30778,  30865,
+		 30893,  30866,  30785,  30655,  30478,  30258,  29998,  29703,
+		 29376,  29020,  28641,  28242,  27827,  27401,  26967,  26530,
+		 26093,  25661,  25236,  24824,  24427,  24049,  23692,  23360,
+		 23056,  22781,  22539,  22330,  22157,  22021,  21923,  21864,
+		 21845,  21864,  21923,  22021,  22157,  22330,  22539,  22781,
+		 23056,  23360,  23692,  24049,  24427,  24824,  25236,  25661,
+		 26093,  26530,  26967,  27401,  27827,  28242,  28641,  29020,
+		 29376,  29703,  29998,  30258,  30478,  30655,  30785,  30866,
+		 30893,  30865,  30778,  30630,  30420,  30145,  29803,  29394,
+		 28917,  28370,  27755,  27070,  26316,  25494,  24605,  23650,
+		 22630,  21549,  20407,  19208,  17955,  16650,  15297,  13899,
+		 12461,  10986,   9478,   7942,   6382,   4804,   3210,   1608,
+		     0,  -1608,  -3210,  -4804,  -6382,  -7942,  -9478, -10986,
+		-12461, -13899, -15297, -16650, -17955, -19208, -20407, -21549,
+		-22630, -23650, -24605, -25494, -26316, -27070, -27755, -28370,
+		-28917, -29394, -29803, -30145, -30420, -30630, -30778, -30865,
+		-30893, -30866, -30785, -30655, -30478, -30258, -29998, -29703,
+		-29376, -29020, -28641, -28242, -27827, -27401, -26967, -26530,
+		-26093, -25661, -25236, -24824, -24427, -24049, -23692, -23360,
+		-23056, -22781, -22539, -22330, -22157, -22021, -21923, -21864,
+		-21845, -21864, -21923, -22021, -22157, -22330, -22539, -22781,
+		-23056, -23360, -23692, -24049, -24427, -24824, -25236, -25661,
+		-26093, -26530, -26967, -27401, -27827, -28242, -28641, -29020,
+		-29376, -29703, -29998, -30258, -30478, -30655, -30785, -30866,
+		-30893, -30865, -30778, -30630, -30420, -30145, -29803, -29394,
+		-28917, -28370, -27755, -27070, -26316, -25494, -24605, -23650,
+		-22630, -21549, -20407, -19208, -17955, -16650, -15297, -13899,
+		-12461, -10986,  -9478,  -7942,  -6382,  -4804,  -3210,  -1608,
+	},
+	//Band 3: harmonics 1..8, tuning words below 2^28
+	{
+		     0,   3210,   6380,   9469,  12441,  15260,  17894,  20315,
+		 22501,  24432,  26097,  27489,  28605,  29450,  30033,  30369,
+		 30476,  30377,  30098,  29667,  29115,  28471,  27768,  27036,
+		 26303,  25597,  24941,  24356,  23859,  23463,  23177,  23006,
+		 22949,  23004,  23163,  23415,  23748,  24145,  24590,  25064,
+		 25549,  26025,  26477,  26887,  27241,  27528,  27739,  27867,
+		 27910,  27867,  27743,  27543,  27276,  26953,  26587,  26192,
+		 25783,  25377,  24988,  24631,  24318,  24063,  23873,  23756,
+		 23717,  23756,  23873,  24063,  24318,  24631,  24988,  25377,
+		 25783,  26192,  26587,  26953,  27276,  27543,  27743,  27867,
+		 27910,  27867,  27739,  27528,  27241,  26887,  26477,  26025,
+		 25549,  25064,  24590,  24145,  23748,  23415,  23163,  23004,
+		 22949,  23006,  23177,  23463,  23859,  24356,  24941,  25597,
+		 26303,  27036,  27768,  28471,  29115,  29667,  30098,  30377,
+		 30476,  30369,  30033,  29450,  28605,  27489,  26097,  24432,
+		 22501,  20315,  17894,  15260,  12441,   9469,   6380,   3210,
+		     0,  -3210,  -6380,  -9469, -12441, -15260, -17894, -20315,
+		-22501, -24432, -26097, -27489, -28605, -29450, -30033, -30369,
+		-30476, -30377, -30098, -29667, -29115, -28471, -27768, -27036,
+		-26303, -25597, -24941, -24356, -23859, -23463, -23177, -23006,
+		-22949, -23004, -23163, -23415, -23748, -24145, -24590, -25064,
+		-25549, -26025, -26477, -26887, -27241, -27528, -27739, -27867,
+		-27910, -27867, -27743, -27543, -27276, -26953, -26587, -26192,
+		-25783, -25377, -24988, -24631, -24318, -24063, -23873, -23756,
+		-23717, -23756, -23873, -24063, -24318, -24631, -24988, -25377,
+		-25783, -26192, -26587, -26953, -27276, -27543, -27743, -27867,
+		-27910, -27867, -27739, -27528, -27241, -26887, -26477, -26025,
+		-25549, -25064, -24590, -24145, -23748, -23415, -23163, -23004,
+		-22949, -23006, -23177, -23463, -23859, -24356, -24941, -25597,
+		-26303, -27036, -27768, -28471, -29115, -29667, -30098, -30377,
+		-30476, -30369, -30033, -29450, -28605, -27489, -26097, -24432,
+		-22501, -20315, -17894, -15260, -12441,  -9469,  -6380,  -3210,
+	},
+	//Band 4: harmonics 1..16, tuning words below 2^27
+	{
+		     0,   6379,  12436,  17879,  22469,  26044,  28529,  29939,
+		 30375,  30005,  29049,  27747,  26340,  25041,  24018,  23378,
+		 23166,  23362,  23894,  24651,  25502,  26315,  26975,  27399,
+		 27543,  27406,  27028,  26479,  25852,  25243,  24742,  24415,
+		 24303,  24411,  24714,  25157,  25669,  26171,  26589,  26863,
+		 26958,  26865,  26605,  26220,  25773,  25331,  24962,  24717,
+		 24632,  24716,  24953,  25304,  25715,  26123,  26467,  26695,
+		 26775,  26696,  26471,  26136,  25741,  25348,  25015,  24793,
+		 24715,  24793,  25015,  25348,  25741,  26136,  26471,  26696,
+		 26775,  26695,  26467,  26123,  25715,  25304,  24953,  24716,
+		 24632,  24717,  24962,  25331,  25773,  26220,  26605,  26865,
+		 26958,  26863,  26589,  26171,  25669,  25157,  24714,  24411,
+		 24303,  24415,  24742,  25243,  25852,  26479,  27028,  27406,
+		 27543,  27399,  26975,  26315,  25502,  24651,  23894,  23362,
+		 23166,  23378,  24018,  25041,  26340,  27747,  29049,  30005,
+		 30375,  29939,  28529,  26044,  22469,  17879,  12436,   6379,
+		     0,  -6379, -12436, -17879, -22469, -26044, -28529, -29939,
+		-30375, -30005, -29049, -27747, -26340, -25041, -24018, -23378,
+		-23166, -23362, -23894, -24651, -25502, -26315, -26975, -27399,
+		-27543, -27406, -27028, -26479, -25852, -25243, -24742, -24415,
+		-24303, -24411, -24714, -25157, -25669, -26171, -26589, -26863,
+		-26958, -26865, -26605, -26220, -25773, -25331, -24962, -24717,
+		-24632, -24716, -24953, -25304, -25715, -26123, -26467, -26695,
+		-26775, -26696, -26471, -26136, -25741, -25348, -25015, -24793,
+		-24715, -24793, -25015, -25348, -25741, -26136, -26471, -26696,
+		-26775, -26695, -26467, -26123, -25715, -25304, -24953, -24716,
+		-24632, -24717, -24962, -25331, -25773, -26220, -26605, -26865,
+		-26958, -26863, -26589, -26171, -25669, -25157, -24714, -24411,
+		-24303, -24415, -24742, -25243, -25852, -26479, -27028, -27406,
+		-27543, -27399, -26975, -26315, -25502, -24651, -23894, -23362,
+		-23166, -23378, -24018, -25041, -26340, -27747, -29049, -30005,
+		-30375, -29939, -28529, -26044, -22469, -17879, -12436,  -6379,
+	},
+	//Band 5: harmonics 1..32, tuning words below 2^26
+	{
+		     0,  12435,  22461,  28509,  30350,  29032,  26348,  24055,
+		 23217,  23929,  25493,  26918,  27464,  26973,  25862,  24821,
+		 24413,  24790,  25658,  26485,  26813,  26504,  25786,  25095,
+		 24818,  25082,  25699,  26298,  26539,  26307,  25761,  25229,
+		 25013,  25222,  25716,  26199,  26396,  26204,  25750,  25303,
+		 25121,  25299,  25724,  26143,  26315,  26146,  25743,  25345,
+		 25182,  25343,  25729,  26112,  26270,  26114,  25739,  25367,
+		 25214,  25366,  25733,  26098,  26249,  26099,  25736,  25374,
+		 25224,  25374,  25736,  26099,  26249,  26098,  25733,  25366,
+		 25214,  25367,  25739,  26114,  26270,  26112,  25729,  25343,
+		 25182,  25345,  25743,  26146,  26315,  26143,  25724,  25299,
+		 25121,  25303,  25750,  26204,  26396,  26199,  25716,  25222,
+		 25013,  25229,  25761,  26307,  26539,  26298,  25699,  25082,
+		 24818,  25095,  25786,  26504,  26813,  26485,  25658,  24790,
+		 24413,  24821,  25862,  26973,  27464,  26918,  25493,  23929,
+		 23217,  24055,  26348,  29032,  30350,  28509,  22461,  12435,
+		     0, -12435, -22461, -28509, -30350, -29032, -26348, -24055,
+		-23217, -23929, -25493, -26918, -27464, -26973, -25862, -24821,
+		-24413, -24790, -25658, -26485, -26813, -26504, -25786, -25095,
+		-24818, -25082, -25699, -26298, -26539, -26307, -25761, -25229,
+		-25013, -25222, -25716, -26199, -26396, -26204, -25750, -25303,
+		-25121, -25299, -25724, -26143, -26315, -26146, -25743, -25345,
+		-25182, -25343, -25729, -26112, -26270, -26114, -25739, -25367,
+		-25214, -25366, -25733, -26098, -26249, -26099, -25736, -25374,
+		-25224, -25374, -25736, -26099, -26249, -26098, -25733, -25366,
+		-25214, -25367, -25739, -26114, -26270, -26112, -25729, -25343,
+		-25182, -25345, -25743, -26146, -26315, -26143, -25724, -25299,
+		-25121, -25303, -25750, -26204, -26396, -26199, -25716, -25222,
+		-25013, -25229, -25761, -26307, -26539, -26298, -25699, -25082,
+		-24818, -25095, -25786, -26504, -26813, -26485, -25658, -24790,
+		-24413, -24821, -25862, -26973, -27464, -26918, -25493, -23929,
+		-23217, -24055, -26348, -29032, -30350, -28509, -22461, -12435,
+	},
+};
+
+const int16_t wavetable_saw[WAVETABLE_BANDS][DDS_TABLE_SIZE] =
+{
+	//Band 0: harmonics 1..1, tuning words below 2^31
+	{
+		     0,    446,    892,   1337,   1782,   2225,   2667,   3108,
+		  3546,   3983,   4417,   4848,   5277,   5702,   6124,   6542,
+		  6956,   7366,   7772,   8173,   8569,   8960,   9345,   9725,
+		 10099,  10467,  10828,  11183,  11532,  11873,  12207,  12534,
+		 12854,  13165,  13469,  13764,  14052,  14330,  14600,  14862,
+		 15114,  15357,  15592,  15816,  16031,  16237,  16432,  16618,
+		 16794,  16960,  17115,  17260,  17395,  17519,  17633,  17736,
+		 17828,  17910,  17981,  18041,  18090,  18128,  18156,  18172,
+		 18178,  18172,  18156,  18128,  18090,  18041,  17981,  17910,
+		 17828,  17736,  17633,  17519,  17395,  17260,  17115,  16960,
+		 16794,  16618,  16432,  16237,  16031,  15816,  15592,  15357,
+		 15114,  14862,  14600,  14330,  14052,  13764,  13469,  13165,
+		 12854,  12534,  12207,  11873,  11532,  11183,  10828,  10467,
+		 10099,   9725,   9345,   8960,   8569,   8173,   7772,   7366,
+		  6956,   6542,   6124,   5702,   5277,   4848,   4417,   3983,
+		  3546,   3108,   2667,   2225,   1782,   1337,    892,    446,
+		     0,   -446,   -892,  -1337,  -1782,  -2225,  -2667,  -3108,
+		 -3546,  -3983,  -4417,  -4848,  -5277,  -5702,  -6124,  -6542,
+		 -6956,  -7366,  -7772,  -8173,  -8569,  -8960,  -9345,  -9725,
+		-10099, -10467, -10828, -11183, -11532, -11873, -12207, -12534,
+		-12854, -13165, -13469, -13764, -14052, -14330, -14600, -14862,
+		-15114, -15357, -15592, -15816, -16031, -16237, -16432, -16618,
+		-16794, -16960, -17115, -17260, -17395, -17519, -17633, -17736,
+		-17828, -17910, -17981, -18041, -18090, -18128, -18156, -18172,
+		-18178, -18172, -18156, -18128, -18090, -18041, -17981, -17910,
+		-17828, -17736, -17633, -17519, -17395, -17260, -17115, -16960,
+		-16794, -16618, -16432, -16237, -16031, -15816, -15592, -15357,
+		-15114, -14862, -14600, -14330, -14052, -13764, -13469, -13165,
+		-12854, -12534, -12207, -11873, -11532, -11183, -10828, -10467,
+		-10099,  -9725,  -9345,  -8960,  -8569,  -8173,  -7772,  -7366,
+		 -6956,  -6542,  -6124,  -5702,  -5277,  -4848,  -4417,  -3983,
+		 -3546,  -3108,  -2667,  -2225,  -1782,  -1337,   -892,   -446,
+	},
+	//Band 1: harmonics 1..2, tuning words below 2^30
+	{
+		     0,      0,      1,      4,      9,     17,     29,     46,
+		    68,     97,    132,    176,    227,    288,    358,    438,
+		   530,    632,    746,    873,   1012,   1164,   1330,   1509,
+		  1702,   1909,   2131,   2367,   2618,   2883,   3162,   3456,
+		  3765,   4087,   4424,   4774,   5137,   5514,   5903,   6304,
+		  6717,   7141,   7576,   8020,   8474,   8937,   9407,   9884,
+		 10367,  10856,  11349,  11846,  12345,  12847,  13348,  13850,
+		 14350,  14848,  15343,  15833,  16317,  16795,  17265,  17726,
+		 18178,  18618,  19047,  19462,  19863,  20249,  20619,  20972,
+		 21307,  21622,  21917,  22192,  22444,  22674,  22881,  23063,
+		 23221,  23353,  23458,  23537,  23588,  23612,  23607,  23574,
+		 23511,  23419,  23298,  23147,  22966,  22755,  22514,  22243,
+		 21942,  21612,  21252,  20864,  20446,  20000,  19526,  19024,
+		 18496,  17941,  17361,  16756,  16126,  15473,  14798,  14101,
+		 13383,  12646,  11890,  11116,  10326,   9521,   8701,   7869,
+		  7024,   6170,   5306,   4434,   3555,   2671,   1783,    892,
+		     0,   -892,  -1783,  -2671,  -3555,  -4434,  -5306,  -6170,
+		 -7024,  -7869,  -8701,  -9521, -10326, -11116, -11890, -12646,
+		-13383, -14101, -14798, -15473, -16126, -16756, -17361, -17941,
+		-18496, -19024, -19526, -20000, -20446, -20864, -21252, -21612,
+		-21942, -22243, -22514, -22755, -22966, -23147, -23298, -23419,
+		-23511, -23574, -23607, -23612, -23588, -23537, -23458, -23353,
+		-23221, -23063, -22881, -22674, -22444, -22192, -21917, -21622,
+		-21307, -20972, -20619, -20249, -19863, -19462, -19047, -18618,
+		-18178, -17726, -17265, -16795, -16317, -15833, -15343, -14848,
+		-14350, -13850, -13348, -12847, -12345, -11846, -11349, -10856,
+		-10367,  -9884,  -9407,  -8937,  -8474,  -8020,  -7576,  -7141,
+		 -6717,  -6304,  -5903,  -5514,  -5137,  -4774,  -4424,  -4087,
+		 -3765,  -3456,  -3162,  -2883,  -2618,  -2367,  -2131,  -1909,
+		 -1702,  -1509,  -1330,  -1164,  -1012,   -873,   -746,   -632,
+		  -530,   -438,   -358,   -288,   -227,   -176,   -132,    -97,
+		   -68,    -46,    -29,    -17,     -9,     -4,     -1,      0,
+	},
+	//Band 2: harmonics 1..4, tuning words below 2^29
+	{
+		     0,      0,      4,     12,     28,     55,     95,    149,
+		   221,    312,    423,    556,    713,    893,   1098,   1328,
+		  1583,   1863,   2167,   2494,   2843,   3214,   3603,   4010,
+		  4431,   4866,   5311,   5764,   6222,   6683,   7143,   7599,
+		  8049,   8490,   8920,   9335,   9733,  10112,  10469,  10803,
+		 11113,  11396,  11652,  11880,  12079,  12249,  12391,  12506,
+		 12593,  12654,  12691,  12706,  12700,  12676,  12637,  12586,
+		 12526,  12459,  12390,  12322,  12258,  12202,  12158,  12129,
+		 12118,  12130,  12166,  12231,  12326,  12454,  12617,  12817,
+		 13055,  13332,  13649,  14006,  14402,  14837,  15309,  15817,
+		 16358,  16929,  17529,  18152,  18796,  19455,  20126,  20803,
+		 21480,  22152,  22814,  23460,  24083,  24677,  25237,  25755,
+		 26227,  26646,  27006,  27302,  27529,  27682,  27756,  27747,
+		 27652,  27468,  27191,  26821,  26355,  25792,  25132,  24377,
+		 23526,  22581,  21544,  20419,  19209,  17917,  16549,  15109,
+		 13604,  12039,  10421,   8756,   7053,   5318,   3558,   1783,
+		     0,  -1783,  -3558,  -5318,  -7053,  -8756, -10421, -12039,
+		-13604, -15109, -16549, -17917, -19209, -20419, -21544, -22581,
+		-23526, -24377, -25132, -25792, -26355, -26821, -27191, -27468,
+		-27652, -27747, -27756, -27682, -27529, -27302, -27006, -26646,
+		-26227, -25755, -25237, -24677, -24083, -23460, -22814, -22152,
+		-21480, -20803, -20126, -19455, -18796, -18152, -17529, -16929,
+		-16358, -15817, -15309, -14837, -14402, -14006, -13649, -13332,
+		-13055, -12817, -12617, -12454, -12326, -12231, -12166, -12130,
+		-12118, -12129, -12158, -12202, -12258, -12322, -12390, -12459,
+		-12526, -12586, -12637, -12676, -12700, -12706, -12691, -12654,
+		-12593, -12506, -12391, -12249, -12079, -11880, -11652, -11396,
+		-11113, -10803, -10469, -10112,  -9733,  -9335,  -8920,  -8490,
+		 -8049,  -7599,  -7143,  -6683,  -6222,  -5764,  -5311,  -4866,
+		 -4431,  -4010,  -3603,  -3214,  -2843,  -2494,  -2167,  -1863,
+		 -1583,  -1328,  -1098,   -893,   -713,   -556,   -423,   -312,
+		  -221,   -149,    -95,    -55,    -28,    -12,     -4,      0,
+	},
+	//Band 3: harmonics 1..8, tuning words below 2^28
+	{
+		     0,      2,     13,     43,    100,    191,    322,    498,
+		   720,    988,   1300,   1654,   2043,   2460,   2897,   3345,
+		  3793,   4234,   4656,   5051,   5412,   5732,   6007,   6234,
+		  6413,   6546,   6635,   6687,   6708,   6708,   6695,   6679,
+		  6672,   6683,   6721,   6795,   6912,   7076,   7292,   7559,
+		  7877,   8242,   8649,   9090,   9556,  10037,  10522,  10999,
+		 11458,  11888,  12280,  12624,  12916,  13151,  13327,  13447,
+		 13512,  13529,  13506,  13452,  13380,  13302,  13230,  13177,
+		 13157,  13181,  13258,  13396,  13601,  13875,  14218,  14627,
+		 15095,  15613,  16171,  16754,  17347,  17935,  18502,  19031,
+		 19508,  19919,  20255,  20506,  20668,  20741,  20728,  20634,
+		 20470,  20250,  19992,  19714,  19437,  19185,  18979,  18840,
+		 18790,  18846,  19021,  19325,  19763,  20336,  21037,  21854,
+		 22771,  23763,  24803,  25858,  26891,  27865,  28739,  29470,
+		 30020,  30350,  30426,  30215,  29695,  28845,  27655,  26120,
+		 24245,  22042,  19531,  16740,  13704,  10464,   7066,   3560,
+		     0,  -3560,  -7066, -10464, -13704, -16740, -19531, -22042,
+		-24245, -26120, -27655, -28845, -29695, -30215, -30426, -30350,
+		-30020, -29470, -28739, -27865, -26891, -25858, -24803, -23763,
+		-22771, -21854, -21037, -20336, -19763, -19325, -19021, -18846,
+		-18790, -18840, -18979, -19185, -19437, -19714, -19992, -20250,
+		-20470, -20634, -20728, -20741, -20668, -20506, -20255, -19919,
+		-19508, -19031, -18502, -17935, -17347, -16754, -16171, -15613,
+		-15095, -14627, -14218, -13875, -13601, -13396, -13258, -13181,
+		-13157, -13177, -13230, -13302, -13380, -13452, -13506, -13529,
+		-13512, -13447, -13327, -13151, -12916, -12624, -12280, -11888,
+		-11458, -10999, -10522, -10037,  -9556,  -9090,  -8649,  -8242,
+		 -7877,  -7559,  -7292,  -7076,  -6912,  -6795,  -6721,  -6683,
+		 -6672,  -6679,  -6695,  -6708,  -6708,  -6687,  -6635,  -6546,
+		 -6413,  -6234,  -6007,  -5732,  -5412,  -5051,  -4656,  -4234,
+		 -3793,  -3345,  -2897,  -2460,  -2043,  -1654,  -1300,   -988,
+		  -720,   -498,   -322,   -191,   -100,    -43,    -13,     -2,
+	},
+	//Band 4: harmonics 1..16, tuning words below 2^27
+	{
+		     0,      6,     47,    153,    342,    620,    979,   1396,
+		  1840,   2276,   2669,   2991,   3227,   3373,   3442,   3459,
+		  3456,   3471,   3537,   3679,   3912,   4234,   4630,   5073,
+		  5526,   5953,   6320,   6604,   6794,   6895,   6925,   6915,
+		  6904,   6928,   7020,   7203,   7484,   7855,   8293,   8763,
+		  9226,   9643,   9981,  10221,  10359,  10407,  10392,  10352,
+		 10329,  10364,  10489,  10720,  11059,  11489,  11977,  12481,
+		 12957,  13361,  13664,  13849,  13920,  13901,  13827,  13748,
+		 13711,  13760,  13927,  14223,  14640,  15149,  15706,  16258,
+		 16750,  17137,  17388,  17495,  17472,  17355,  17197,  17059,
+		 17001,  17073,  17303,  17699,  18236,  18870,  19537,  20165,
+		 20684,  21042,  21208,  21182,  20996,  20709,  20400,  20157,
+		 20061,  20173,  20526,  21113,  21889,  22775,  23667,  24455,
+		 25033,  25327,  25299,  24962,  24382,  23671,  22974,  22450,
+		 22247,  22480,  23206,  24410,  25998,  27794,  29561,  31015,
+		 31861,  31822,  30674,  28275,  24587,  19684,  13751,   7072,
+		     0,  -7072, -13751, -19684, -24587, -28275, -30674, -31822,
+		-31861, -31015, -29561, -27794, -25998, -24410, -23206, -22480,
+		-22247, -22450, -22974, -23671, -24382, -24962, -25299, -25327,
+		-25033, -24455, -23667, -22775, -21889, -21113, -20526, -20173,
+		-20061, -20157, -20400, -20709, -20996, -21182, -21208, -21042,
+		-20684, -20165, -19537, -18870, -18236, -17699, -17303, -17073,
+		-17001, -17059, -17197, -17355, -17472, -17495, -17388, -17137,
+		-16750, -16258, -15706, -15149, -14640, -14223, -13927, -13760,
+		-13711, -13748, -13827, -13901, -13920, -13849, -13664, -13361,
+		-12957, -12481, -11977, -11489, -11059, -10720, -10489, -10364,
+		-10329, -10352, -10392, -10407, -10359, -10221,  -9981,  -9643,
+		 -9226,  -8763,  -8293,  -7855,  -7484,  -7203,  -7020,  -6928,
+		 -6904,  -6915,  -6925,  -6895,  -6794,  -6604,  -6320,  -5953,
+		 -5526,  -5073,  -4630,  -4234,  -3912,  -3679,  -3537,  -3471,
+		 -3456,  -3459,  -3442,  -3373,  -3227,  -2991,  -2669,  -2276,
+		 -1840,  -1396,   -979,   -620,   -342,   -153,    -47,     -6,
+	},
+	//Band 5: harmonics 1..32, tuning words below 2^26
+	{
+		     0,     23,    167,    479,    906,   1325,   1618,   1742,
+		  1757,   1788,   1951,   2283,   2719,   3130,   3402,   3506,
+		  3513,   3552,   3736,   4089,   4533,   4935,   5187,   5270,
+		  5268,   5316,   5521,   5895,   6348,   6741,   6971,   7032,
+		  7021,   7078,   7306,   7702,   8165,   8549,   8755,   8793,
+		  8771,   8839,   9091,   9513,   9985,  10359,  10539,  10550,
+		 10518,  10597,  10876,  11326,  11810,  12171,  12323,  12304,
+		 12259,  12351,  12662,  13144,  13642,  13989,  14106,  14053,
+		 13993,  14100,  14448,  14968,  15482,  15813,  15889,  15793,
+		 15716,  15841,  16235,  16802,  17336,  17646,  17670,  17522,
+		 17421,  17570,  18023,  18651,  19211,  19494,  19450,  19231,
+		 19100,  19281,  19814,  20526,  21122,  21366,  21226,  20906,
+		 20732,  20959,  21611,  22447,  23098,  23283,  22993,  22513,
+		 22269,  22573,  23423,  24472,  25217,  25297,  24732,  23953,
+		 23574,  24033,  25292,  26797,  27752,  27582,  26333,  24762,
+		 24003,  24948,  27616,  30886,  32767,  31153,  24754,  13774,
+		     0, -13774, -24754, -31153, -32767, -30886, -27616, -24948,
+		-24003, -24762, -26333, -27582, -27752, -26797, -25292, -24033,
+		-23574, -23953, -24732, -25297, -25217, -24472, -23423, -22573,
+		-22269, -22513, -22993, -23283, -23098, -22447, -21611, -20959,
+		-20732, -20906, -21226, -21366, -21122, -20526, -19814, -19281,
+		-19100, -19231, -19450, -19494, -19211, -18651, -18023, -17570,
+		-17421, -17522, -17670, -17646, -17336, -16802, -16235, -15841,
+		-15716, -15793, -15889, -15813, -15482, -14968, -14448, -14100,
+		-13993, -14053, -14106, -13989, -13642, -13144, -12662, -12351,
+		-12259, -12304, -12323, -12171, -11810, -11326, -10876, -10597,
+		-10518, -10550, -10539, -10359,  -9985,  -9513,  -9091,  -8839,
+		 -8771,  -8793,  -8755,  -8549,  -8165,  -7702,  -7306,  -7078,
+		 -7021,  -7032,  -6971,  -6741,  -6348,  -5895,  -5521,  -5316,
+		 -5268,  -5270,  -5187,  -4935,  -4533,  -4089,  -3736,  -3552,
+		 -3513,  -3506,  -3402,  -3130,  -2719,  -2283,  -1951,  -1788,
+		 -1757,  -1742,  -1618,  -1325,   -906,   -479,   -167,    -23,
+	},
+};